@@ -17,6 +17,9 @@ Common Utility Functions/Macros
 
 #define ALIGN(x) __attribute__ ((aligned (x)))
 
+// place in the core coupled memory (cpu only, not cleared at startup)
+#define CCMRAM __attribute__ ((section (".ccmram")))
+
 //-----------------------------------------------------------------------------
 // Q format to float conversions
 
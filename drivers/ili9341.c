@@ -23,6 +23,14 @@ Don't change the CS line or D/C line until the SPI operation is complete.
 This isn't a problem for bit banged SPI, but in HW based SPI the SPI and
 GPIO operations are asynchronous, so you have to wait for SPI completion.
 
+With cfg.dma set, pixel data for fills and bitmaps is sent with the spi tx
+dma. 1bpp bitmaps are expanded to RGB565 into one line buffer while the
+other is transmitted, pixel buffers are sent as is. The draw functions
+return once the first line is going, the dma callback (lcd_dma_done) keeps
+the lines going and deasserts chip select at the end. Any following lcd
+operation waits for the previous draw to complete. Bitmap/pixel data must
+remain valid until then.
+
 The ili9341 supports hardware scrolling. This remaps the way the driver
 moves the graphics ram onto the display. This only works on the long axis of
 the LCD (320 pixels). If you want to use it for scrolling a screen of
@@ -147,8 +155,14 @@ static void lcd_backlight_on(struct lcd_drv *drv) {
 	gpio_set(drv->cfg.led);
 }
 
+// wait for any dma draw to complete
+void lcd_wait4_done(struct lcd_drv *drv) {
+	while (drv->busy) ;
+}
+
 // assert chip select
 static void lcd_cs_assert(struct lcd_drv *drv) {
+	lcd_wait4_done(drv);
 	gpio_clr(drv->cfg.cs);
 }
 
@@ -284,13 +298,93 @@ static void set_wr_region(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t
 	wr_cmd(drv, CMD_MEM_WR);
 }
 
+//-----------------------------------------------------------------------------
+// dma pixel transfers
+
+#if defined(SPI_DRIVER_HW)
+
+// expand the next pixels into a line buffer, return the number of pixels
+static size_t lcd_px_expand(struct lcd_drv *drv, uint16_t * dst) {
+	size_t n = (drv->count > LCD_LINE_SIZE) ? LCD_LINE_SIZE : drv->count;
+	if (drv->bitmap) {
+		const uint32_t *src = drv->bitmap;
+		uint32_t bit = drv->bit;
+		for (size_t i = 0; i < n; i++) {
+			dst[i] = ((src[bit >> 5] << (bit & 31)) & (1U << 31)) ? drv->fg : drv->bg;
+			bit += 1;
+		}
+		drv->bit = bit;
+	} else {
+		for (size_t i = 0; i < n; i++) {
+			dst[i] = drv->fg;
+		}
+	}
+	drv->count -= n;
+	return n;
+}
+
+// start sending the pixels for the current write region
+static void lcd_px_start(struct lcd_drv *drv, const uint32_t * bitmap, uint32_t count, uint16_t fg, uint16_t bg) {
+	drv->bitmap = bitmap;
+	drv->bit = 0;
+	drv->count = count;
+	drv->fg = fg;
+	drv->bg = bg;
+	// fill both lines, so the callback always has the next line ready
+	drv->line_n[0] = lcd_px_expand(drv, drv->line[0]);
+	drv->line_n[1] = lcd_px_expand(drv, drv->line[1]);
+	drv->line_idx = 0;
+	drv->busy = 1;
+	spi_txbuf16_dma(drv->cfg.spi, drv->line[0], drv->line_n[0]);
+}
+
+// start sending a buffer of pixels for the current write region
+static void lcd_px_buf(struct lcd_drv *drv, const uint16_t * buf, uint32_t count) {
+	drv->count = 0;
+	drv->line_n[0] = count;
+	drv->line_n[1] = 0;
+	drv->line_idx = 0;
+	drv->busy = 1;
+	spi_txbuf16_dma(drv->cfg.spi, buf, count);
+}
+
+// A line has been sent (call from the spi tx dma transfer complete callback)
+void lcd_dma_done(struct lcd_drv *drv) {
+	spi_tx_dma_done(drv->cfg.spi);
+	int idx = drv->line_idx ^ 1;
+	if (drv->line_n[idx]) {
+		// send the next line, then expand the pixels after it into the free line
+		drv->line_idx = idx;
+		spi_txbuf16_dma(drv->cfg.spi, drv->line[idx], drv->line_n[idx]);
+		drv->line_n[idx ^ 1] = lcd_px_expand(drv, drv->line[idx ^ 1]);
+		return;
+	}
+	// the draw is complete
+	lcd_cs_deassert(drv);
+	drv->busy = 0;
+	if (drv->cfg.callback) {
+		drv->cfg.callback(drv);
+	}
+}
+
+#endif
+
 //-----------------------------------------------------------------------------
 // basic graphics operations
 
 // fill a rectangle with a color
 void lcd_fill_rect(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+	if (w == 0 || h == 0) {
+		return;
+	}
 	lcd_cs_assert(drv);
 	set_wr_region(drv, x, y, w, h);
+#if defined(SPI_DRIVER_HW)
+	if (drv->cfg.dma) {
+		lcd_px_start(drv, NULL, w * h, color, color);
+		return;
+	}
+#endif
 	spi_tx16(drv->cfg.spi, color, w * h);
 	lcd_cs_deassert(drv);
 }
@@ -305,9 +399,18 @@ void lcd_set_pixel(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t color)
 
 // draw a bitmap
 void lcd_draw_bitmap(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, uint16_t bg, const uint32_t * buf) {
+	if (w == 0 || h == 0) {
+		return;
+	}
 	lcd_cs_assert(drv);
 	set_wr_region(drv, x, y, w, h);
 	uint32_t count = w * h;
+#if defined(SPI_DRIVER_HW)
+	if (drv->cfg.dma) {
+		lcd_px_start(drv, buf, count, color, bg);
+		return;
+	}
+#endif
 	int i = 0;
 	while (count) {
 		uint32_t bitmap = buf[i];
@@ -323,6 +426,23 @@ void lcd_draw_bitmap(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t w, ui
 	lcd_cs_deassert(drv);
 }
 
+// draw a buffer of RGB565 pixels (w * h < 65536)
+void lcd_draw_pixels(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t * buf) {
+	if (w == 0 || h == 0) {
+		return;
+	}
+	lcd_cs_assert(drv);
+	set_wr_region(drv, x, y, w, h);
+#if defined(SPI_DRIVER_HW)
+	if (drv->cfg.dma) {
+		lcd_px_buf(drv, buf, w * h);
+		return;
+	}
+#endif
+	spi_txbuf16(drv->cfg.spi, buf, w * h);
+	lcd_cs_deassert(drv);
+}
+
 // set the scrolling region
 void lcd_set_scroll_region(struct lcd_drv *drv, uint16_t tfa, uint16_t vsa) {
 	lcd_cs_assert(drv);
@@ -90,6 +90,11 @@ struct lcd_op_queue {
 
 //-----------------------------------------------------------------------------
 
+// pixels per dma line buffer
+#define LCD_LINE_SIZE 320
+
+struct lcd_drv;
+
 struct lcd_cfg {
 	struct spi_drv *spi;	// spi bus
 	int rst;		// gpio for reset pin
@@ -98,12 +103,23 @@ struct lcd_cfg {
 	int led;		// gpio for led backlight control
 	int rotation;		// screen rotation
 	uint16_t bg;		// background color
+	int dma;		// send pixel data with the spi tx dma
+	void (*callback) (struct lcd_drv * lcd);	// dma draw complete (irq context)
 };
 
 struct lcd_drv {
 	struct lcd_cfg cfg;
 	struct lcd_op_queue opq;
 	int width, height;	// screen width/height in pixels
+	// dma pixel transfers
+	uint16_t line[2][LCD_LINE_SIZE];	// double buffered RGB565 lines
+	size_t line_n[2];	// number of pixels in each line
+	int line_idx;		// line being transmitted
+	const uint32_t *bitmap;	// 1bpp pixel source, NULL for a fill
+	uint32_t bit;		// next bitmap bit
+	uint32_t count;		// pixels still to be expanded
+	uint16_t fg, bg;	// pixel colors
+	volatile int busy;	// dma draw in progress
 };
 
 //-----------------------------------------------------------------------------
@@ -112,8 +128,11 @@ int lcd_init(struct lcd_drv *lcd, struct lcd_cfg *cfg);
 void lcd_fill_rect(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
 void lcd_set_pixel(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t color);
 void lcd_draw_bitmap(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, uint16_t bg, const uint32_t * buf);
+void lcd_draw_pixels(struct lcd_drv *drv, uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t * buf);
 void lcd_set_scroll_region(struct lcd_drv *drv, uint16_t tfa, uint16_t vsa);
 void lcd_scroll(struct lcd_drv *drv, uint16_t vsp);
+void lcd_wait4_done(struct lcd_drv *drv);
+void lcd_dma_done(struct lcd_drv *drv);
 
 //-----------------------------------------------------------------------------
 
@@ -33,7 +33,7 @@ static float get_k(float t) {
 	if (t <= 0) {
 		return 1.f;
 	}
-	return 1.f - powe(LN_LEVEL_EPSILON / (t * AUDIO_FS));
+	return 1.f - powe(LN_LEVEL_EPSILON / (t * audio_fs));
 }
 
 //-----------------------------------------------------------------------------
@@ -44,6 +44,12 @@ void adsr_attack(struct adsr *e) {
 	e->state = ADSR_STATE_ATTACK;
 }
 
+// Enter attack state from the current level.
+// Used to re-strike a sounding voice without a click.
+void adsr_retrigger(struct adsr *e) {
+	e->state = ADSR_STATE_ATTACK;
+}
+
 // Enter release state.
 void adsr_release(struct adsr *e) {
 	if (e->state != ADSR_STATE_IDLE) {
@@ -69,10 +75,21 @@ int adsr_is_active(struct adsr *e) {
 	return e->state != ADSR_STATE_IDLE;
 }
 
+// Return non-zero if the adsr is in the attack or decay state.
+int adsr_is_attacking(struct adsr *e) {
+	return (e->state == ADSR_STATE_ATTACK) || (e->state == ADSR_STATE_DECAY);
+}
+
+// Return non-zero if the adsr is in the release or idle state.
+int adsr_is_releasing(struct adsr *e) {
+	return (e->state == ADSR_STATE_RELEASE) || (e->state == ADSR_STATE_IDLE);
+}
+
 //-----------------------------------------------------------------------------
 
 // Return a sample value for the ADSR envelope.
-static float adsr_sample(struct adsr *e) {
+// For models that run the envelope in their own sample loop.
+float adsr_sample(struct adsr *e) {
 	switch (e->state) {
 	case ADSR_STATE_IDLE:
 		// idle - do nothing
@@ -167,6 +184,17 @@ void adsr_update(struct adsr *e, float a, float d, float s, float r) {
 	e->i_trigger = s * LEVEL_EPSILON;
 }
 
+// copy the envelope constants from another envelope (keeps the state)
+void adsr_copy(struct adsr *e, const struct adsr *src) {
+	e->s = src->s;
+	e->ka = src->ka;
+	e->kd = src->kd;
+	e->kr = src->kr;
+	e->d_trigger = src->d_trigger;
+	e->s_trigger = src->s_trigger;
+	e->i_trigger = src->i_trigger;
+}
+
 // AD envelope initialisation
 // a = attack time in seconds (>= 0)
 // d = decay time in seconds (>= 0)
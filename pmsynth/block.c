@@ -14,6 +14,8 @@ and it maybe that other functions could benefit from multiple load/store also.
 */
 //-----------------------------------------------------------------------------
 
+#include <math.h>
+
 #include "pmsynth.h"
 
 //-----------------------------------------------------------------------------
@@ -122,3 +124,24 @@ void block_copy_mul_k(float *dst, const float *src, float k, size_t n) {
 }
 
 //-----------------------------------------------------------------------------
+
+// return the peak absolute value in a block
+float block_peak(const float *buf, size_t n) {
+	float peak = 0.f;
+	// unroll x4
+	while (n > 0) {
+		float x0 = fabsf(buf[0]);
+		float x1 = fabsf(buf[1]);
+		float x2 = fabsf(buf[2]);
+		float x3 = fabsf(buf[3]);
+		x0 = (x0 > x1) ? x0 : x1;
+		x2 = (x2 > x3) ? x2 : x3;
+		x0 = (x0 > x2) ? x0 : x2;
+		peak = (peak > x0) ? peak : x0;
+		buf += 4;
+		n -= 4;
+	}
+	return peak;
+}
+
+//-----------------------------------------------------------------------------
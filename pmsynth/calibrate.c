@@ -0,0 +1,147 @@
+//-----------------------------------------------------------------------------
+/*
+
+Polyphony Calibration
+
+At boot (before the audio starts) each patch renders some worst case blocks:
+all voices sounding at once on the lowest notes. The blocks are timed with
+the DWT cycle counter and the patch polyphony is however many voices fit in
+the block period, less a safety margin for the rest of the render and the
+interrupts. The limits track the clock and the compiler output, so they don't
+go stale when the code or the build options change.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "pmsynth.h"
+
+#define DEBUG
+#include "logging.h"
+
+//-----------------------------------------------------------------------------
+
+// lowest note for the calibration voices (each voice is a semitone higher)
+#define CALIBRATE_NOTE 25
+
+// number of blocks to render, the slowest is used
+#define CALIBRATE_BLOCKS 8
+
+//-----------------------------------------------------------------------------
+
+static void cycles_init(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t cycles(void) {
+	return DWT->CYCCNT;
+}
+
+//-----------------------------------------------------------------------------
+
+// Start all the voices on a channel.
+// Return the number that are active (a voice without delay line memory is
+// silent and costs nothing).
+static int calibrate_start(struct pmsynth *s, uint8_t channel) {
+	int n = 0;
+	for (int i = 0; i < NUM_VOICES; i++) {
+		struct voice *v = &s->voices[i];
+		v->note = CALIBRATE_NOTE + i;
+		v->channel = channel;
+		v->lod = LOD_FULL;
+		v->level = 0.f;
+		v->patch = &s->patches[channel];
+		v->patch->ops->start(v);
+		v->patch->ops->note_on(v, 127);
+		if (v->patch->ops->active(v)) {
+			n += 1;
+		}
+	}
+	return n;
+}
+
+// stop the voices and return them to the unused state
+static void calibrate_stop(struct pmsynth *s) {
+	for (int i = 0; i < NUM_VOICES; i++) {
+		struct voice *v = &s->voices[i];
+		v->patch->ops->stop(v);
+		memset(v->state, 0, VOICE_STATE_SIZE);
+		v->patch = NULL;
+		v->channel = 255;
+		v->note = 255;
+	}
+	gpio_clr(IO_LED_AMBER);
+}
+
+// return the worst case cycles to render a block with all voices active
+static uint32_t calibrate_voices(struct pmsynth *s) {
+	uint32_t worst = 0;
+	float buf_l[AUDIO_BLOCK_SIZE], buf_r[AUDIO_BLOCK_SIZE];
+	for (int j = 0; j < CALIBRATE_BLOCKS; j++) {
+		uint32_t t = 0;
+		for (int i = 0; i < NUM_VOICES; i++) {
+			struct voice *v = &s->voices[i];
+			uint32_t t0 = cycles();
+			if (v->patch->ops->active(v)) {
+				v->patch->ops->generate(v, buf_l, buf_r, AUDIO_BLOCK_SIZE);
+			}
+			t += cycles() - t0;
+		}
+		if (t > worst) {
+			worst = t;
+		}
+	}
+	return worst;
+}
+
+// return the cycles for the per block work that doesn't depend on the voices
+static uint32_t calibrate_overhead(struct pmsynth *s) {
+	float buf[AUDIO_BLOCK_SIZE];
+	int16_t dst[2 * AUDIO_BLOCK_SIZE];
+	memset(buf, 0, sizeof(buf));
+	uint32_t t0 = cycles();
+	svf2_gen_lpf(&s->opf, buf, buf, AUDIO_BLOCK_SIZE, FILT_LOW_PASS);
+	audio_wr(dst, AUDIO_BLOCK_SIZE, buf, buf);
+	return cycles() - t0;
+}
+
+//-----------------------------------------------------------------------------
+
+// measure the polyphony for each patch
+// The patches must be initialised and the voices unused.
+void pmsynth_calibrate(struct pmsynth *s) {
+	cycles_init();
+	// cycles available per block, less the safety margin
+	float budget = CALIBRATE_MARGIN * (float)SystemCoreClock * (float)AUDIO_BLOCK_SIZE / audio_fs;
+	budget -= (float)calibrate_overhead(s);
+
+	for (int i = 0; i < NUM_CHANNELS; i++) {
+		if (s->patches[i].ops == NULL) {
+			continue;
+		}
+		// the voices take delay lines from the pool, keep the renderer out
+		uint32_t lock = audio_render_lock();
+		int active = calibrate_start(s, i);
+		uint32_t t = calibrate_voices(s);
+		calibrate_stop(s);
+		audio_render_unlock(lock);
+
+		// the cost is shared by the voices that rendered
+		uint32_t per_voice = (active == 0) ? 0 : (t + active - 1) / active;
+		int n = (per_voice == 0) ? NUM_VOICES : (int)(budget / (float)per_voice);
+		if (n < 1) {
+			n = 1;
+		}
+		if (n > NUM_VOICES) {
+			n = NUM_VOICES;
+		}
+		s->polyphony[i] = n;
+		DBG("ch%d %d cycles/voice (%d voices), polyphony %d\r\n", i, per_voice, active, n);
+	}
+	s->voice_idx = 0;
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,207 @@
+//-----------------------------------------------------------------------------
+/*
+
+Delay Line Memory Pool
+
+A waveguide needs a delay line as long as the period of its note, so a fixed
+size line is mostly unused by high notes and too short for low ones. Instead
+the voices allocate their delay lines from this pool when they start.
+
+The pool is a buddy allocator. The size classes are powers of two from
+DL_BLOCK_MIN bytes to the pool size, and a request is rounded up to its class.
+A larger free block is split in halves until one is the right size, the
+other halves go on the free lists. A freed block is merged with its buddy
+(the other half of the block it was split from) whenever that is also free,
+so the pool doesn't fragment into small blocks as voices come and go.
+
+Each voice has a budget of DL_VOICE_SIZE bytes, and all the voices fit in
+the pool at their budget. A voice can have a larger block (a low note at the
+full rate) while that still leaves a budget for each of the other voices,
+otherwise it runs at a lower rate (see dl_fits). The voices give their
+blocks back when they go quiet, so the larger blocks aren't held for long.
+
+The voices start and stop in the renderer (PendSV). Callers in the main
+loop (calibration, sample rate changes, stop_voices) hold the renderer off with
+audio_render_lock(), so the pool itself has no locking.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "pmsynth.h"
+#include "utils.h"
+
+#define DEBUG
+#include "logging.h"
+
+//-----------------------------------------------------------------------------
+
+#define DL_CLASSES (DL_POOL_BITS - DL_BLOCK_BITS + 1)
+
+_Static_assert(NUM_VOICES * DL_VOICE_SIZE <= DL_POOL_SIZE, "the voice budgets don't fit the delay line pool");
+
+// a free block
+struct dl_block {
+	struct dl_block *next;
+};
+
+static uint8_t dl_pool[DL_POOL_SIZE] ALIGN(8) CCMRAM;
+
+static struct dl_block *dl_free_list[DL_CLASSES];	// free blocks for each class
+static uint32_t dl_used;	// bytes allocated
+static uint32_t dl_peak;	// most bytes allocated
+static uint32_t dl_fails;	// failed allocations
+static uint32_t dl_blocks;	// free blocks (the lists are only walked by the renderer)
+
+//-----------------------------------------------------------------------------
+
+// return the size class for size bytes (DL_CLASSES if it's too large)
+static int dl_class(size_t size) {
+	int k = 0;
+	while (k < DL_CLASSES && (DL_BLOCK_MIN << k) < size) {
+		k += 1;
+	}
+	return k;
+}
+
+// remove a block from a free list, return 0 if it isn't there
+static int dl_unlink(int k, struct dl_block *b) {
+	struct dl_block **p = &dl_free_list[k];
+	while (*p) {
+		if (*p == b) {
+			*p = b->next;
+			dl_blocks -= 1;
+			return 1;
+		}
+		p = &(*p)->next;
+	}
+	return 0;
+}
+
+static void dl_push(int k, struct dl_block *b) {
+	b->next = dl_free_list[k];
+	dl_free_list[k] = b;
+	dl_blocks += 1;
+}
+
+//-----------------------------------------------------------------------------
+
+// return the block size used for a request of size bytes (0 if it's too large)
+size_t dl_size(size_t size) {
+	int k = dl_class(size);
+	return (k < DL_CLASSES) ? DL_BLOCK_MIN << k : 0;
+}
+
+// Return !=0 if a voice can take a block of size bytes.
+// A block within the voice budget always fits. A larger one has to leave a
+// budget for each of the other voices (counted in bytes, the buddy blocks
+// of the budget size tile the pool).
+int dl_fits(size_t size) {
+	size = dl_size(size);
+	if (size == 0) {
+		return 0;
+	}
+	if (size <= DL_VOICE_SIZE) {
+		return 1;
+	}
+	return dl_used + size + (NUM_VOICES - 1) * DL_VOICE_SIZE <= DL_POOL_SIZE;
+}
+
+// allocate a block of at least size bytes, return NULL if there's no room
+void *dl_alloc(size_t size) {
+	int k = dl_class(size);
+	// find the smallest free block that's large enough
+	int j = k;
+	while (j < DL_CLASSES && dl_free_list[j] == NULL) {
+		j += 1;
+	}
+	if (j >= DL_CLASSES) {
+		dl_fails += 1;
+		return NULL;
+	}
+	struct dl_block *b = dl_free_list[j];
+	dl_free_list[j] = b->next;
+	dl_blocks -= 1;
+	// split it down to the requested size
+	while (j > k) {
+		j -= 1;
+		dl_push(j, (struct dl_block *)((uint8_t *) b + (DL_BLOCK_MIN << j)));
+	}
+	dl_used += DL_BLOCK_MIN << k;
+	if (dl_used > dl_peak) {
+		dl_peak = dl_used;
+	}
+	return b;
+}
+
+// free a block, size is the size it was allocated with
+void dl_free(void *ptr, size_t size) {
+	if (ptr == NULL) {
+		return;
+	}
+	int k = dl_class(size);
+	uint32_t ofs = (uint8_t *) ptr - dl_pool;
+	dl_used -= DL_BLOCK_MIN << k;
+	// merge with the free buddies
+	while (k < DL_CLASSES - 1) {
+		uint32_t buddy = ofs ^ (DL_BLOCK_MIN << k);
+		if (!dl_unlink(k, (struct dl_block *)&dl_pool[buddy])) {
+			break;
+		}
+		ofs &= ~(DL_BLOCK_MIN << k);
+		k += 1;
+	}
+	dl_push(k, (struct dl_block *)&dl_pool[ofs]);
+}
+
+//-----------------------------------------------------------------------------
+
+// reverse len elements of size bytes
+static void dl_reverse(uint8_t * buf, size_t len, size_t size) {
+	uint8_t *a = buf;
+	uint8_t *b = buf + (len - 1) * size;
+	while (a < b) {
+		for (size_t i = 0; i < size; i++) {
+			uint8_t t = a[i];
+			a[i] = b[i];
+			b[i] = t;
+		}
+		a += size;
+		b -= size;
+	}
+}
+
+// Rotate a delay line of len elements (of size bytes) in place, so element
+// ofs moves to the start. Used to resample the delay lines without a buffer.
+void dl_rotate(void *buf, size_t len, size_t ofs, size_t size) {
+	if (len < 2 || ofs % len == 0) {
+		return;
+	}
+	ofs %= len;
+	dl_reverse(buf, ofs, size);
+	dl_reverse((uint8_t *) buf + ofs * size, len - ofs, size);
+	dl_reverse(buf, len, size);
+}
+
+//-----------------------------------------------------------------------------
+
+// display the pool statistics
+// Called from the main loop, so it only reads the counters. The renderer may
+// change them in between, which just skews one line of the report.
+void dl_pool_stats(void) {
+	DBG("delay pool %d/%d bytes, peak %d, %d free blocks, failed %d\r\n", dl_used, DL_POOL_SIZE, dl_peak, dl_blocks, dl_fails);
+}
+
+// Empty the pool.
+// Called at startup (the ccm isn't cleared), there mustn't be any voices using it.
+void dl_pool_init(void) {
+	memset(dl_free_list, 0, sizeof(dl_free_list));
+	dl_blocks = 0;
+	dl_push(DL_CLASSES - 1, (struct dl_block *)dl_pool);
+	dl_used = 0;
+	dl_peak = 0;
+	dl_fails = 0;
+}
+
+//-----------------------------------------------------------------------------
@@ -4,13 +4,16 @@
 Events
 
 The main loop is an event processor. Events are generated asynchronously
-by the world. E.g a request to fill the audio buffer with samples, a midi event,
+by the world. E.g an audio block has been played, a midi event,
 a key down event, etc. The event loop branches to a function to handle the event.
-There is no priority, we just service events as they arrive.
+There is no priority between producers, each queue is drained in turn.
 
-The event queue is a circular buffer. Producers (ISRs or self generated events)
-write to it. Consumers (the main event loop) read from it. The event queue should
-never be full. If it is we have probably blundered.
+Each producer has its own event queue. A queue is a circular buffer with a
+single producer (an ISR, or ISRs at the same priority level) and a single
+consumer (the main event loop). The producer only writes the write index and
+the consumer only writes the read index, so no interrupt masking is needed.
+The event queues should never be full. If they are we have probably blundered,
+so each queue records a high water mark and an overflow count.
 
 The events are a uint32_t and a pointer. Based on the event type the pointer
 may reference some other data structure/buffer. Or it might be some additional
@@ -24,77 +27,124 @@ user of the events.
 
 #include "pmsynth.h"
 
+#define DEBUG
+#include "logging.h"
+
 //-----------------------------------------------------------------------------
 
 #define NUM_EVENTS 16		// must be a power of 2
 
+// per producer queues
+#define EQ_AUDIO 0		// audio dma isr
+#define EQ_MIDI 1		// midi rx isr
+#define EQ_KEYS 2		// system tick isr (key debounce)
+#define NUM_QUEUES 3
+
 // circular buffer for events
 struct event_queue {
 	struct event queue[NUM_EVENTS];
-	size_t rd;
-	size_t wr;
+	volatile uint32_t rd;	// free running read index (consumer)
+	volatile uint32_t wr;	// free running write index (producer)
+	uint32_t hwm;		// high water mark
+	uint32_t overflow;	// number of events dropped on a full queue
 };
 
-static struct event_queue eq;
+static struct event_queue eq[NUM_QUEUES];
 
 //-----------------------------------------------------------------------------
 
-// read an event from the event queue
-int event_rd(struct event *e) {
+// map an event type to the queue of its producer
+static struct event_queue *event_queue(uint32_t type) {
+	switch (EVENT_TYPE(type)) {
+	case EVENT_TYPE_AUDIO:
+		return &eq[EQ_AUDIO];
+	case EVENT_TYPE_MIDI:
+		return &eq[EQ_MIDI];
+	case EVENT_TYPE_KEY_DN:
+	case EVENT_TYPE_KEY_UP:
+		return &eq[EQ_KEYS];
+	default:
+		break;
+	}
+	return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+// read an event from a queue
+static int event_queue_rd(struct event_queue *q, struct event *e) {
+	uint32_t rd = q->rd;
 	struct event *x;
-	uint32_t saved;
-	int rc = 0;
-	// mask interrupts
-	saved = disable_irq();
 	// do we have events?
-	if (eq.rd == eq.wr) {
-		// no events
-		rc = -1;
-		goto exit;
+	if (rd == q->wr) {
+		return -1;
 	}
-	// copy the event data
-	x = &eq.queue[eq.rd];
+	// read the event data after seeing the write index
+	__DMB();
+	x = &q->queue[rd & (NUM_EVENTS - 1)];
 	e->type = x->type;
 	e->ptr = x->ptr;
-	// advance the read index
-	eq.rd = (eq.rd + 1) & (NUM_EVENTS - 1);
- exit:
-	// restore interrupts and return
-	restore_irq(saved);
-	return rc;
+	// release the slot after reading the event data
+	__DMB();
+	q->rd = rd + 1;
+	return 0;
+}
+
+// read an event from the event queues
+int event_rd(struct event *e) {
+	for (int i = 0; i < NUM_QUEUES; i++) {
+		if (!event_queue_rd(&eq[i], e)) {
+			return 0;
+		}
+	}
+	// no events
+	return -1;
 }
 
-// write an event to the event queue
+// write an event to the event queue for this producer
 int event_wr(uint32_t type, void *ptr) {
+	struct event_queue *q = event_queue(type);
 	struct event *x;
-	uint32_t saved;
-	size_t wr;
-	int rc = 0;
-	// mask interrupts
-	saved = disable_irq();
-	wr = (eq.wr + 1) & (NUM_EVENTS - 1);
-	if (wr == eq.rd) {
+	uint32_t wr, level;
+	if (q == NULL) {
+		return -1;
+	}
+	wr = q->wr;
+	level = wr - q->rd;
+	if (level >= NUM_EVENTS) {
 		// the queue is full
-		rc = -1;
-		goto exit;
+		q->overflow += 1;
+		return -1;
 	}
 	// copy the event data
-	x = &eq.queue[eq.wr];
+	x = &q->queue[wr & (NUM_EVENTS - 1)];
 	x->type = type;
 	x->ptr = ptr;
-	// advance the write index
-	eq.wr = wr;
- exit:
-	// restore interrupts and return
-	restore_irq(saved);
-	return rc;
+	// publish the event data before the write index
+	__DMB();
+	q->wr = wr + 1;
+	// record the high water mark
+	if (level + 1 > q->hwm) {
+		q->hwm = level + 1;
+	}
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+// report the event queue statistics
+void event_stats(void) {
+	static const char *const names[NUM_QUEUES] = { "audio", "midi", "keys" };
+	for (int i = 0; i < NUM_QUEUES; i++) {
+		DBG("%s events hwm %d overflow %d\r\n", names[i], eq[i].hwm, eq[i].overflow);
+	}
 }
 
 //-----------------------------------------------------------------------------
 
 // initialise event processing
 int event_init(void) {
-	memset(&eq, 0, sizeof(struct event_queue));
+	memset(eq, 0, sizeof(eq));
 	return 0;
 }
 
@@ -0,0 +1,5367 @@
+// generated by: ./commute -o impulses.c (don't edit)
+#include "pmsynth.h"
+
+static const int16_t mallet_hit_tube_data[16217] = {
+	0, 5, 20, 41, 63, 90, 122, 161, // 0-7
+	208, 264, 328, 401, 483, 572, 669, 773, // 8-15
+	881, 995, 1112, 1232, 1353, 1475, 1596, 1716, // 16-23
+	1834, 1950, 2062, 2170, 2274, 2374, 2470, 2561, // 24-31
+	2648, 2731, 2809, 2884, 2955, 3022, 3086, 3147, // 32-39
+	3205, 3261, 3314, 3364, 3412, 3458, 3502, 3543, // 40-47
+	3583, 3620, 3655, 3687, 3718, 3746, 3772, 3797, // 48-55
+	3820, 3841, 3861, 3880, 3898, 3915, 3932, 3948, // 56-63
+	3965, 3982, 3999, 4016, 4033, 4050, 4068, 4084, // 64-71
+	4100, 4113, 4125, 4134, 4140, 4140, 4136, 4125, // 72-79
+	4108, 4082, 4048, 4004, 3950, 3885, 3809, 3721, // 80-87
+	3622, 3510, 3387, 3252, 3106, 2949, 2782, 2606, // 88-95
+	2422, 2230, 2033, 1830, 1624, 1415, 1205, 994, // 96-103
+	784, 576, 371, 170, -27, -219, -406, -586, // 104-111
+	-760, -928, -1088, -1242, -1390, -1531, -1665, -1793, // 112-119
+	-1916, -2032, -2143, -2250, -2351, -2447, -2539, -2627, // 120-127
+	-2710, -2790, -2865, -2937, -3005, -3069, -3129, -3186, // 128-135
+	-3240, -3291, -3338, -3382, -3423, -3462, -3498, -3533, // 136-143
+	-3565, -3595, -3624, -3652, -3679, -3705, -3730, -3754, // 144-151
+	-3777, -3800, -3821, -3841, -3859, -3875, -3889, -3899, // 152-159
+	-3905, -3907, -3903, -3894, -3877, -3853, -3820, -3779, // 160-167
+	-3728, -3667, -3596, -3513, -3420, -3316, -3200, -3074, // 168-175
+	-2938, -2791, -2636, -2471, -2299, -2120, -1935, -1745, // 176-183
+	-1551, -1354, -1155, -956, -757, -560, -364, -171, // 184-191
+	18, 202, 382, 557, 726, 889, 1046, 1197, // 192-199
+	1342, 1481, 1613, 1741, 1862, 1978, 2089, 2195, // 200-207
+	2296, 2393, 2485, 2573, 2657, 2737, 2813, 2885, // 208-215
+	2954, 3019, 3080, 3138, 3193, 3244, 3293, 3338, // 216-223
+	3381, 3421, 3458, 3494, 3527, 3558, 3588, 3616, // 224-231
+	3643, 3668, 3693, 3716, 3738, 3758, 3777, 3794, // 232-239
+	3809, 3822, 3832, 3838, 3840, 3838, 3830, 3817, // 240-247
+	3797, 3770, 3735, 3691, 3639, 3577, 3506, 3424, // 248-255
+	3333, 3231, 3120, 2998, 2867, 2726, 2577, 2420, // 256-263
+	2256, 2085, 1908, 1726, 1541, 1353, 1163, 972, // 264-271
+	781, 591, 402, 216, 33, -147, -322, -493, // 272-279
+	-659, -820, -976, -1126, -1271, -1410, -1544, -1672, // 280-287
+	-1795, -1914, -2027, -2136, -2240, -2339, -2435, -2526, // 288-295
+	-2613, -2697, -2776, -2852, -2924, -2992, -3057, -3119, // 296-303
+	-3177, -3232, -3284, -3332, -3378, -3421, -3461, -3499, // 304-311
+	-3534, -3568, -3599, -3628, -3656, -3682, -3707, -3729, // 312-319
+	-3751, -3770, -3787, -3803, -3816, -3826, -3833, -3837, // 320-327
+	-3836, -3831, -3821, -3806, -3783, -3754, -3718, -3674, // 328-335
+	-3621, -3560, -3490, -3410, -3321, -3223, -3115, -2998, // 336-343
+	-2872, -2737, -2594, -2443, -2286, -2122, -1953, -1778, // 344-351
+	-1600, -1419, -1236, -1051, -866, -681, -497, -315, // 352-359
+	-136, 41, 214, 384, 549, 710, 865, 1016, // 360-367
+	1163, 1304, 1440, 1571, 1697, 1819, 1936, 2048, // 368-375
+	2156, 2260, 2360, 2455, 2547, 2634, 2718, 2799, // 376-383
+	2875, 2948, 3018, 3084, 3147, 3207, 3263, 3316, // 384-391
+	3367, 3414, 3459, 3501, 3541, 3578, 3613, 3646, // 392-399
+	3677, 3706, 3733, 3758, 3782, 3802, 3821, 3837, // 400-407
+	3851, 3861, 3868, 3872, 3871, 3865, 3854, 3838, // 408-415
+	3815, 3786, 3750, 3706, 3654, 3594, 3525, 3447, // 416-423
+	3361, 3266, 3162, 3049, 2927, 2798, 2660, 2516, // 424-431
+	2364, 2207, 2044, 1877, 1705, 1531, 1354, 1176, // 432-439
+	996, 817, 638, 460, 285, 111, -59, -227, // 440-447
+	-391, -551, -707, -858, -1006, -1149, -1287, -1421, // 448-455
+	-1551, -1676, -1797, -1914, -2027, -2135, -2240, -2341, // 456-463
+	-2439, -2532, -2622, -2709, -2791, -2871, -2947, -3019, // 464-471
+	-3088, -3154, -3217, -3277, -3333, -3387, -3437, -3485, // 472-479
+	-3530, -3573, -3613, -3651, -3686, -3719, -3750, -3778, // 480-487
+	-3804, -3828, -3849, -3867, -3882, -3894, -3902, -3907, // 488-495
+	-3907, -3902, -3892, -3877, -3856, -3828, -3794, -3752, // 496-503
+	-3703, -3646, -3580, -3507, -3425, -3335, -3236, -3129, // 504-511
+	-3013, -2890, -2760, -2622, -2478, -2328, -2173, -2013, // 512-519
+	-1849, -1681, -1511, -1339, -1166, -992, -818, -644, // 520-527
+	-472, -302, -134, 32, 195, 355, 511, 663, // 528-535
+	812, 956, 1097, 1234, 1367, 1496, 1621, 1742, // 536-543
+	1859, 1972, 2082, 2188, 2290, 2389, 2485, 2576, // 544-551
+	2665, 2750, 2832, 2910, 2986, 3058, 3127, 3192, // 552-559
+	3255, 3315, 3372, 3426, 3477, 3526, 3572, 3616, // 560-567
+	3656, 3695, 3731, 3764, 3795, 3823, 3849, 3871, // 568-575
+	3890, 3905, 3917, 3925, 3928, 3927, 3920, 3908, // 576-583
+	3890, 3865, 3834, 3796, 3751, 3697, 3637, 3568, // 584-591
+	3491, 3406, 3313, 3212, 3103, 2987, 2864, 2734, // 592-599
+	2597, 2455, 2307, 2155, 1998, 1838, 1676, 1511, // 600-607
+	1344, 1176, 1008, 841, 674, 508, 343, 181, // 608-615
+	21, -137, -291, -443, -591, -736, -877, -1015, // 616-623
+	-1150, -1281, -1409, -1533, -1653, -1771, -1885, -1995, // 624-631
+	-2102, -2206, -2307, -2404, -2499, -2590, -2677, -2762, // 632-639
+	-2844, -2922, -2997, -3070, -3139, -3205, -3268, -3329, // 640-647
+	-3387, -3441, -3493, -3543, -3590, -3633, -3675, -3713, // 648-655
+	-3749, -3781, -3811, -3837, -3860, -3880, -3895, -3906, // 656-663
+	-3911, -3912, -3908, -3898, -3881, -3859, -3829, -3792, // 664-671
+	-3747, -3695, -3635, -3567, -3491, -3407, -3315, -3216, // 672-679
+	-3108, -2994, -2872, -2744, -2610, -2470, -2325, -2176, // 680-687
+	-2022, -1865, -1705, -1543, -1379, -1213, -1048, -882, // 688-695
+	-716, -551, -388, -226, -66, 92, 247, 400, // 696-703
+	550, 697, 841, 982, 1120, 1254, 1386, 1514, // 704-711
+	1638, 1760, 1878, 1993, 2105, 2214, 2319, 2422, // 712-719
+	2521, 2617, 2710, 2800, 2887, 2972, 3053, 3131, // 720-727
+	3206, 3279, 3348, 3415, 3479, 3540, 3598, 3654, // 728-735
+	3706, 3756, 3802, 3846, 3886, 3923, 3956, 3985, // 736-743
+	4011, 4032, 4048, 4060, 4067, 4068, 4064, 4053, // 744-751
+	4036, 4013, 3983, 3945, 3901, 3849, 3789, 3722, // 752-759
+	3647, 3565, 3475, 3377, 3273, 3161, 3043, 2919, // 760-767
+	2789, 2653, 2513, 2368, 2219, 2067, 1912, 1754, // 768-775
+	1595, 1434, 1273, 1111, 949, 788, 628, 468, // 776-783
+	311, 155, 1, -150, -300, -446, -590, -731, // 784-791
+	-870, -1005, -1138, -1267, -1394, -1518, -1639, -1757, // 792-799
+	-1872, -1984, -2093, -2199, -2302, -2403, -2500, -2595, // 800-807
+	-2687, -2775, -2861, -2945, -3025, -3102, -3177, -3248, // 808-815
+	-3317, -3383, -3446, -3506, -3563, -3617, -3668, -3716, // 816-823
+	-3760, -3801, -3838, -3872, -3901, -3926, -3946, -3962, // 824-831
+	-3973, -3978, -3978, -3972, -3960, -3941, -3916, -3884, // 832-839
+	-3846, -3800, -3747, -3687, -3619, -3544, -3462, -3374, // 840-847
+	-3278, -3175, -3066, -2952, -2831, -2705, -2574, -2439, // 848-855
+	-2299, -2157, -2011, -1862, -1711, -1559, -1405, -1251, // 856-863
+	-1096, -942, -787, -634, -481, -330, -180, -33, // 864-871
+	113, 257, 399, 538, 675, 809, 941, 1071, // 872-879
+	1197, 1321, 1442, 1561, 1677, 1790, 1900, 2008, // 880-887
+	2113, 2215, 2314, 2411, 2505, 2596, 2684, 2770, // 888-895
+	2853, 2933, 3010, 3085, 3156, 3225, 3291, 3355, // 896-903
+	3415, 3472, 3526, 3577, 3624, 3668, 3709, 3745, // 904-911
+	3778, 3806, 3830, 3849, 3864, 3873, 3877, 3875, // 912-919
+	3867, 3853, 3833, 3806, 3773, 3733, 3686, 3632, // 920-927
+	3570, 3502, 3428, 3347, 3260, 3166, 3067, 2962, // 928-935
+	2852, 2737, 2618, 2495, 2368, 2238, 2106, 1971, // 936-943
+	1835, 1696, 1557, 1417, 1276, 1135, 995, 854, // 944-951
+	714, 575, 437, 301, 165, 31, -101, -232, // 952-959
+	-361, -488, -613, -736, -856, -975, -1092, -1206, // 960-967
+	-1318, -1428, -1535, -1641, -1743, -1844, -1942, -2037, // 968-975
+	-2130, -2221, -2309, -2395, -2478, -2558, -2636, -2711, // 976-983
+	-2784, -2854, -2921, -2985, -3047, -3105, -3160, -3212, // 984-991
+	-3261, -3306, -3348, -3385, -3419, -3448, -3473, -3494, // 992-999
+	-3510, -3520, -3526, -3526, -3521, -3510, -3493, -3470, // 1000-1007
+	-3442, -3407, -3366, -3319, -3266, -3207, -3143, -3072, // 1008-1015
+	-2996, -2914, -2827, -2735, -2638, -2537, -2432, -2323, // 1016-1023
+	-2210, -2094, -1976, -1855, -1732, -1607, -1480, -1352, // 1024-1031
+	-1223, -1094, -964, -833, -703, -573, -443, -313, // 1032-1039
+	-185, -56, 71, 197, 322, 446, 568, 689, // 1040-1047
+	809, 927, 1043, 1158, 1270, 1381, 1489, 1596, // 1048-1055
+	1700, 1802, 1901, 1999, 2094, 2186, 2276, 2364, // 1056-1063
+	2449, 2531, 2611, 2688, 2763, 2835, 2904, 2970, // 1064-1071
+	3033, 3093, 3151, 3205, 3255, 3302, 3346, 3386, // 1072-1079
+	3422, 3453, 3481, 3504, 3522, 3535, 3544, 3547, // 1080-1087
+	3545, 3537, 3524, 3505, 3480, 3449, 3412, 3370, // 1088-1095
+	3322, 3268, 3208, 3142, 3071, 2995, 2914, 2828, // 1096-1103
+	2737, 2642, 2542, 2439, 2332, 2222, 2109, 1993, // 1104-1111
+	1874, 1754, 1631, 1507, 1381, 1255, 1127, 999, // 1112-1119
+	870, 741, 612, 484, 355, 227, 99, -27, // 1120-1127
+	-153, -278, -402, -525, -646, -765, -884, -1000, // 1128-1135
+	-1115, -1227, -1338, -1447, -1554, -1658, -1761, -1861, // 1136-1143
+	-1959, -2054, -2147, -2237, -2325, -2410, -2493, -2573, // 1144-1151
+	-2650, -2725, -2796, -2865, -2931, -2993, -3053, -3109, // 1152-1159
+	-3162, -3211, -3256, -3298, -3336, -3369, -3399, -3423, // 1160-1167
+	-3444, -3459, -3469, -3475, -3475, -3470, -3459, -3443, // 1168-1175
+	-3421, -3394, -3361, -3322, -3278, -3228, -3172, -3112, // 1176-1183
+	-3046, -2974, -2898, -2817, -2732, -2642, -2548, -2450, // 1184-1191
+	-2349, -2244, -2136, -2025, -1912, -1797, -1679, -1560, // 1192-1199
+	-1439, -1316, -1193, -1069, -944, -818, -693, -567, // 1200-1207
+	-441, -316, -190, -66, 58, 181, 304, 425, // 1208-1215
+	545, 663, 780, 896, 1010, 1122, 1233, 1341, // 1216-1223
+	1448, 1552, 1655, 1755, 1852, 1948, 2041, 2132, // 1224-1231
+	2220, 2305, 2388, 2469, 2546, 2621, 2693, 2762, // 1232-1239
+	2828, 2892, 2951, 3008, 3062, 3111, 3158, 3200, // 1240-1247
+	3239, 3273, 3304, 3330, 3351, 3368, 3380, 3387, // 1248-1255
+	3389, 3386, 3378, 3364, 3345, 3321, 3291, 3255, // 1256-1263
+	3214, 3167, 3116, 3058, 2996, 2929, 2857, 2780, // 1264-1271
+	2698, 2612, 2523, 2429, 2332, 2231, 2127, 2020, // 1272-1279
+	1911, 1799, 1685, 1569, 1451, 1331, 1211, 1089, // 1280-1287
+	966, 842, 718, 595, 471, 348, 226, 104, // 1288-1295
+	-17, -136, -254, -371, -485, -598, -708, -817, // 1296-1303
+	-923, -1027, -1128, -1228, -1325, -1420, -1512, -1603, // 1304-1311
+	-1691, -1777, -1861, -1943, -2023, -2100, -2176, -2249, // 1312-1319
+	-2320, -2388, -2454, -2518, -2579, -2637, -2692, -2745, // 1320-1327
+	-2794, -2840, -2883, -2922, -2957, -2989, -3016, -3040, // 1328-1335
+	-3059, -3074, -3084, -3090, -3091, -3087, -3078, -3065, // 1336-1343
+	-3046, -3022, -2993, -2958, -2919, -2874, -2824, -2770, // 1344-1351
+	-2710, -2645, -2576, -2502, -2423, -2340, -2253, -2162, // 1352-1359
+	-2067, -1969, -1868, -1764, -1657, -1547, -1436, -1322, // 1360-1367
+	-1208, -1092, -975, -857, -739, -621, -504, -386, // 1368-1375
+	-270, -154, -39, 74, 186, 297, 406, 513, // 1376-1383
+	618, 722, 823, 922, 1020, 1115, 1209, 1300, // 1384-1391
+	1389, 1477, 1562, 1646, 1727, 1807, 1885, 1961, // 1392-1399
+	2035, 2107, 2176, 2244, 2310, 2374, 2435, 2494, // 1400-1407
+	2551, 2605, 2657, 2706, 2752, 2794, 2834, 2871, // 1408-1415
+	2904, 2933, 2959, 2980, 2998, 3012, 3021, 3026, // 1416-1423
+	3027, 3023, 3014, 3000, 2982, 2959, 2930, 2897, // 1424-1431
+	2859, 2816, 2768, 2715, 2657, 2595, 2528, 2456, // 1432-1439
+	2380, 2300, 2215, 2127, 2035, 1940, 1841, 1740, // 1440-1447
+	1636, 1529, 1421, 1310, 1198, 1085, 970, 855, // 1448-1455
+	739, 623, 507, 392, 276, 162, 48, -64, // 1456-1463
+	-175, -285, -394, -501, -606, -710, -812, -912, // 1464-1471
+	-1010, -1106, -1200, -1293, -1383, -1472, -1559, -1644, // 1472-1479
+	-1727, -1808, -1887, -1965, -2040, -2114, -2185, -2254, // 1480-1487
+	-2322, -2387, -2450, -2510, -2568, -2624, -2677, -2727, // 1488-1495
+	-2774, -2818, -2859, -2896, -2930, -2961, -2987, -3010, // 1496-1503
+	-3029, -3044, -3054, -3061, -3062, -3060, -3052, -3040, // 1504-1511
+	-3023, -3001, -2975, -2943, -2907, -2866, -2820, -2770, // 1512-1519
+	-2714, -2654, -2590, -2521, -2448, -2371, -2290, -2205, // 1520-1527
+	-2116, -2024, -1929, -1831, -1730, -1627, -1521, -1413, // 1528-1535
+	-1304, -1193, -1081, -969, -855, -741, -626, -512, // 1536-1543
+	-398, -284, -171, -58, 53, 163, 272, 379, // 1544-1551
+	485, 589, 691, 792, 890, 987, 1081, 1173, // 1552-1559
+	1264, 1352, 1439, 1523, 1605, 1685, 1764, 1840, // 1560-1567
+	1914, 1987, 2057, 2125, 2191, 2255, 2316, 2376, // 1568-1575
+	2433, 2487, 2539, 2588, 2634, 2678, 2718, 2755, // 1576-1583
+	2789, 2819, 2846, 2868, 2888, 2903, 2914, 2920, // 1584-1591
+	2923, 2921, 2915, 2904, 2889, 2869, 2844, 2815, // 1592-1599
+	2781, 2742, 2699, 2651, 2598, 2541, 2479, 2413, // 1600-1607
+	2343, 2269, 2191, 2109, 2023, 1934, 1841, 1746, // 1608-1615
+	1647, 1546, 1443, 1338, 1231, 1122, 1012, 901, // 1616-1623
+	789, 677, 564, 451, 339, 227, 116, 6, // 1624-1631
+	-104, -212, -318, -424, -527, -629, -729, -827, // 1632-1639
+	-924, -1018, -1111, -1202, -1291, -1377, -1462, -1545, // 1640-1647
+	-1626, -1705, -1783, -1858, -1932, -2003, -2073, -2140, // 1648-1655
+	-2206, -2269, -2330, -2389, -2446, -2500, -2552, -2601, // 1656-1663
+	-2647, -2690, -2731, -2768, -2802, -2832, -2859, -2882, // 1664-1671
+	-2901, -2917, -2928, -2936, -2939, -2938, -2932, -2922, // 1672-1679
+	-2908, -2889, -2865, -2837, -2805, -2768, -2726, -2680, // 1680-1687
+	-2629, -2574, -2514, -2451, -2383, -2311, -2235, -2156, // 1688-1695
+	-2073, -1986, -1896, -1803, -1707, -1608, -1507, -1404, // 1696-1703
+	-1299, -1192, -1083, -973, -862, -750, -638, -526, // 1704-1711
+	-413, -301, -189, -78, 32, 142, 250, 357, // 1712-1719
+	462, 566, 669, 769, 868, 965, 1061, 1154, // 1720-1727
+	1246, 1335, 1423, 1509, 1592, 1674, 1754, 1832, // 1728-1735
+	1908, 1982, 2054, 2124, 2191, 2257, 2320, 2380, // 1736-1743
+	2439, 2495, 2548, 2598, 2646, 2691, 2732, 2771, // 1744-1751
+	2806, 2837, 2866, 2890, 2911, 2928, 2941, 2950, // 1752-1759
+	2955, 2956, 2952, 2945, 2932, 2916, 2895, 2869, // 1760-1767
+	2839, 2804, 2765, 2721, 2673, 2621, 2564, 2502, // 1768-1775
+	2437, 2367, 2294, 2216, 2135, 2050, 1962, 1870, // 1776-1783
+	1776, 1679, 1579, 1476, 1372, 1266, 1158, 1048, // 1784-1791
+	938, 827, 715, 603, 490, 378, 266, 154, // 1792-1799
+	44, -66, -175, -283, -390, -495, -598, -700, // 1800-1807
+	-800, -898, -995, -1090, -1183, -1273, -1362, -1449, // 1808-1815
+	-1534, -1618, -1699, -1778, -1855, -1930, -2003, -2073, // 1816-1823
+	-2142, -2208, -2272, -2334, -2394, -2450, -2505, -2556, // 1824-1831
+	-2605, -2651, -2694, -2733, -2770, -2803, -2833, -2859, // 1832-1839
+	-2882, -2900, -2915, -2926, -2933, -2935, -2934, -2928, // 1840-1847
+	-2918, -2903, -2884, -2860, -2832, -2800, -2763, -2722, // 1848-1855
+	-2676, -2626, -2572, -2513, -2450, -2384, -2313, -2238, // 1856-1863
+	-2160, -2078, -1993, -1905, -1814, -1720, -1623, -1524, // 1864-1871
+	-1423, -1320, -1215, -1108, -1001, -892, -783, -673, // 1872-1879
+	-563, -453, -343, -233, -124, -16, 92, 198, // 1880-1887
+	304, 408, 511, 612, 712, 810, 906, 1001, // 1888-1895
+	1094, 1185, 1274, 1361, 1447, 1530, 1612, 1691, // 1896-1903
+	1769, 1845, 1918, 1990, 2059, 2126, 2191, 2254, // 1904-1911
+	2314, 2371, 2427, 2479, 2529, 2575, 2619, 2660, // 1912-1919
+	2697, 2732, 2762, 2790, 2813, 2833, 2850, 2862, // 1920-1927
+	2870, 2875, 2875, 2871, 2862, 2850, 2833, 2812, // 1928-1935
+	2786, 2756, 2722, 2683, 2640, 2593, 2541, 2485, // 1936-1943
+	2426, 2362, 2294, 2223, 2148, 2069, 1987, 1902, // 1944-1951
+	1814, 1724, 1631, 1536, 1439, 1341, 1240, 1139, // 1952-1959
+	1037, 934, 830, 727, 623, 519, 416, 313, // 1960-1967
+	211, 109, 8, -92, -191, -288, -385, -480, // 1968-1975
+	-575, -667, -759, -849, -938, -1025, -1110, -1194, // 1976-1983
+	-1277, -1357, -1436, -1514, -1589, -1663, -1735, -1805, // 1984-1991
+	-1873, -1939, -2003, -2064, -2124, -2181, -2235, -2287, // 1992-1999
+	-2337, -2383, -2427, -2468, -2506, -2540, -2572, -2599, // 2000-2007
+	-2624, -2644, -2661, -2675, -2684, -2689, -2690, -2687, // 2008-2015
+	-2680, -2669, -2653, -2633, -2608, -2580, -2547, -2510, // 2016-2023
+	-2468, -2423, -2374, -2320, -2263, -2202, -2138, -2070, // 2024-2031
+	-1999, -1925, -1848, -1769, -1687, -1603, -1517, -1428, // 2032-2039
+	-1339, -1247, -1155, -1061, -967, -871, -775, -679, // 2040-2047
+	-583, -486, -389, -293, -197, -101, -6, 89, // 2048-2055
+	183, 276, 368, 460, 550, 639, 728, 815, // 2056-2063
+	901, 985, 1069, 1150, 1231, 1310, 1387, 1463, // 2064-2071
+	1537, 1609, 1680, 1749, 1815, 1880, 1943, 2003, // 2072-2079
+	2062, 2117, 2171, 2222, 2270, 2316, 2359, 2399, // 2080-2087
+	2436, 2470, 2500, 2528, 2552, 2572, 2589, 2602, // 2088-2095
+	2612, 2617, 2619, 2616, 2610, 2599, 2585, 2566, // 2096-2103
+	2543, 2516, 2485, 2449, 2410, 2367, 2319, 2268, // 2104-2111
+	2214, 2155, 2093, 2028, 1960, 1888, 1814, 1737, // 2112-2119
+	1657, 1575, 1491, 1405, 1317, 1228, 1137, 1045, // 2120-2127
+	952, 858, 764, 668, 573, 477, 381, 285, // 2128-2135
+	190, 94, -1, -95, -189, -282, -374, -466, // 2136-2143
+	-556, -646, -734, -822, -908, -992, -1076, -1158, // 2144-2151
+	-1238, -1317, -1395, -1471, -1545, -1618, -1688, -1757, // 2152-2159
+	-1824, -1889, -1952, -2013, -2072, -2129, -2184, -2237, // 2160-2167
+	-2287, -2336, -2381, -2425, -2466, -2505, -2540, -2574, // 2168-2175
+	-2604, -2631, -2655, -2676, -2693, -2707, -2717, -2723, // 2176-2183
+	-2725, -2723, -2717, -2707, -2693, -2674, -2651, -2624, // 2184-2191
+	-2592, -2556, -2517, -2473, -2425, -2373, -2318, -2259, // 2192-2199
+	-2197, -2131, -2063, -1992, -1918, -1841, -1762, -1681, // 2200-2207
+	-1598, -1513, -1427, -1339, -1250, -1160, -1069, -977, // 2208-2215
+	-885, -792, -698, -605, -512, -418, -325, -232, // 2216-2223
+	-140, -48, 43, 133, 223, 312, 400, 486, // 2224-2231
+	572, 657, 740, 822, 903, 983, 1061, 1138, // 2232-2239
+	1213, 1288, 1360, 1432, 1502, 1570, 1637, 1703, // 2240-2247
+	1767, 1829, 1890, 1949, 2006, 2061, 2114, 2165, // 2248-2255
+	2213, 2259, 2303, 2344, 2381, 2416, 2448, 2476, // 2256-2263
+	2501, 2522, 2540, 2553, 2563, 2568, 2569, 2566, // 2264-2271
+	2559, 2547, 2531, 2511, 2486, 2457, 2424, 2387, // 2272-2279
+	2346, 2300, 2251, 2199, 2143, 2083, 2021, 1955, // 2280-2287
+	1887, 1815, 1742, 1666, 1588, 1508, 1426, 1342, // 2288-2295
+	1257, 1171, 1084, 995, 906, 816, 726, 635, // 2296-2303
+	544, 453, 362, 271, 180, 90, 0, -89, // 2304-2311
+	-178, -265, -353, -439, -524, -608, -691, -773, // 2312-2319
+	-854, -933, -1011, -1088, -1164, -1239, -1312, -1384, // 2320-2327
+	-1455, -1524, -1592, -1659, -1724, -1787, -1849, -1910, // 2328-2335
+	-1968, -2025, -2079, -2132, -2182, -2230, -2276, -2318, // 2336-2343
+	-2358, -2395, -2429, -2459, -2486, -2509, -2528, -2544, // 2344-2351
+	-2556, -2563, -2566, -2565, -2560, -2550, -2536, -2518, // 2352-2359
+	-2496, -2469, -2438, -2403, -2364, -2321, -2274, -2224, // 2360-2367
+	-2170, -2113, -2053, -1989, -1923, -1854, -1782, -1708, // 2368-2375
+	-1632, -1554, -1474, -1392, -1309, -1224, -1139, -1052, // 2376-2383
+	-964, -875, -786, -697, -607, -516, -426, -336, // 2384-2391
+	-246, -156, -66, 23, 111, 199, 287, 373, // 2392-2399
+	459, 544, 628, 711, 794, 875, 955, 1034, // 2400-2407
+	1112, 1189, 1264, 1339, 1412, 1483, 1554, 1623, // 2408-2415
+	1690, 1756, 1820, 1883, 1944, 2002, 2059, 2113, // 2416-2423
+	2165, 2215, 2262, 2306, 2347, 2385, 2420, 2452, // 2424-2431
+	2480, 2504, 2525, 2542, 2555, 2564, 2568, 2569, // 2432-2439
+	2566, 2558, 2546, 2530, 2509, 2485, 2456, 2424, // 2440-2447
+	2387, 2346, 2302, 2254, 2203, 2149, 2091, 2030, // 2448-2455
+	1966, 1899, 1830, 1758, 1684, 1608, 1530, 1450, // 2456-2463
+	1369, 1286, 1202, 1116, 1030, 943, 855, 766, // 2464-2471
+	677, 588, 499, 409, 320, 231, 142, 53, // 2472-2479
+	-35, -122, -209, -295, -381, -465, -549, -632, // 2480-2487
+	-714, -794, -874, -953, -1030, -1107, -1182, -1256, // 2488-2495
+	-1328, -1400, -1470, -1538, -1605, -1671, -1734, -1796, // 2496-2503
+	-1856, -1914, -1970, -2024, -2076, -2125, -2171, -2215, // 2504-2511
+	-2256, -2294, -2329, -2360, -2388, -2413, -2434, -2451, // 2512-2519
+	-2464, -2474, -2479, -2480, -2478, -2471, -2460, -2445, // 2520-2527
+	-2425, -2402, -2375, -2344, -2308, -2270, -2227, -2181, // 2528-2535
+	-2131, -2078, -2022, -1963, -1901, -1836, -1769, -1699, // 2536-2543
+	-1627, -1553, -1476, -1399, -1319, -1238, -1156, -1072, // 2544-2551
+	-988, -903, -817, -730, -643, -555, -468, -380, // 2552-2559
+	-292, -204, -117, -29, 57, 144, 230, 315, // 2560-2567
+	400, 484, 567, 649, 731, 811, 891, 969, // 2568-2575
+	1047, 1123, 1198, 1272, 1344, 1415, 1484, 1552, // 2576-2583
+	1618, 1682, 1745, 1805, 1863, 1920, 1973, 2025, // 2584-2591
+	2073, 2120, 2163, 2204, 2241, 2276, 2307, 2335, // 2592-2599
+	2360, 2381, 2398, 2413, 2423, 2430, 2433, 2432, // 2600-2607
+	2427, 2418, 2406, 2389, 2369, 2345, 2317, 2286, // 2608-2615
+	2250, 2211, 2169, 2123, 2074, 2022, 1966, 1908, // 2616-2623
+	1847, 1783, 1717, 1648, 1577, 1504, 1429, 1352, // 2624-2631
+	1274, 1194, 1113, 1030, 947, 862, 777, 691, // 2632-2639
+	604, 517, 430, 343, 255, 167, 80, -8, // 2640-2647
+	-95, -181, -267, -353, -438, -522, -605, -688, // 2648-2655
+	-769, -849, -929, -1006, -1083, -1158, -1232, -1305, // 2656-2663
+	-1375, -1445, -1512, -1578, -1641, -1703, -1763, -1820, // 2664-2671
+	-1876, -1929, -1980, -2028, -2074, -2117, -2158, -2196, // 2672-2679
+	-2230, -2262, -2291, -2317, -2340, -2359, -2375, -2387, // 2680-2687
+	-2396, -2401, -2403, -2401, -2395, -2385, -2372, -2355, // 2688-2695
+	-2335, -2310, -2282, -2251, -2215, -2177, -2135, -2089, // 2696-2703
+	-2041, -1989, -1934, -1876, -1816, -1753, -1687, -1619, // 2704-2711
+	-1549, -1477, -1403, -1327, -1250, -1171, -1091, -1009, // 2712-2719
+	-927, -843, -759, -674, -588, -502, -416, -329, // 2720-2727
+	-242, -155, -69, 18, 104, 190, 276, 361, // 2728-2735
+	445, 529, 612, 694, 775, 855, 934, 1011, // 2736-2743
+	1088, 1163, 1236, 1309, 1379, 1448, 1515, 1581, // 2744-2751
+	1645, 1706, 1766, 1823, 1878, 1931, 1982, 2030, // 2752-2759
+	2076, 2119, 2159, 2196, 2231, 2262, 2291, 2316, // 2760-2767
+	2338, 2357, 2372, 2384, 2393, 2398, 2399, 2397, // 2768-2775
+	2392, 2382, 2369, 2353, 2333, 2309, 2282, 2251, // 2776-2783
+	2216, 2179, 2138, 2094, 2046, 1996, 1942, 1886, // 2784-2791
+	1827, 1766, 1702, 1635, 1567, 1496, 1423, 1349, // 2792-2799
+	1273, 1195, 1116, 1036, 954, 872, 788, 704, // 2800-2807
+	619, 534, 448, 362, 276, 190, 104, 18, // 2808-2815
+	-68, -154, -239, -323, -407, -490, -572, -654, // 2816-2823
+	-734, -813, -891, -967, -1042, -1116, -1188, -1258, // 2824-2831
+	-1327, -1393, -1458, -1521, -1581, -1640, -1696, -1750, // 2832-2839
+	-1802, -1851, -1898, -1942, -1984, -2023, -2059, -2092, // 2840-2847
+	-2123, -2150, -2175, -2196, -2215, -2230, -2242, -2251, // 2848-2855
+	-2256, -2258, -2257, -2253, -2245, -2233, -2218, -2200, // 2856-2863
+	-2179, -2154, -2125, -2094, -2059, -2021, -1980, -1936, // 2864-2871
+	-1889, -1839, -1786, -1730, -1672, -1612, -1549, -1484, // 2872-2879
+	-1417, -1347, -1276, -1203, -1128, -1052, -975, -896, // 2880-2887
+	-816, -735, -653, -571, -487, -404, -320, -235, // 2888-2895
+	-151, -66, 18, 102, 186, 270, 353, 435, // 2896-2903
+	516, 597, 676, 755, 832, 908, 983, 1056, // 2904-2911
+	1128, 1198, 1266, 1333, 1397, 1460, 1521, 1579, // 2912-2919
+	1636, 1690, 1742, 1792, 1839, 1884, 1927, 1966, // 2920-2927
+	2004, 2038, 2070, 2100, 2126, 2150, 2170, 2188, // 2928-2935
+	2203, 2215, 2224, 2229, 2232, 2231, 2228, 2221, // 2936-2943
+	2211, 2198, 2181, 2162, 2139, 2113, 2084, 2052, // 2944-2951
+	2017, 1979, 1938, 1894, 1847, 1797, 1745, 1690, // 2952-2959
+	1633, 1573, 1512, 1447, 1381, 1313, 1243, 1171, // 2960-2967
+	1097, 1022, 946, 868, 789, 709, 629, 547, // 2968-2975
+	465, 382, 299, 215, 131, 48, -36, -120, // 2976-2983
+	-203, -286, -368, -450, -531, -611, -690, -769, // 2984-2991
+	-846, -922, -996, -1070, -1141, -1212, -1280, -1347, // 2992-2999
+	-1412, -1475, -1536, -1595, -1652, -1707, -1760, -1810, // 3000-3007
+	-1858, -1903, -1946, -1987, -2024, -2060, -2092, -2122, // 3008-3015
+	-2149, -2173, -2194, -2213, -2228, -2240, -2250, -2256, // 3016-3023
+	-2259, -2259, -2256, -2250, -2241, -2228, -2212, -2194, // 3024-3031
+	-2171, -2146, -2118, -2086, -2052, -2014, -1974, -1931, // 3032-3039
+	-1885, -1836, -1784, -1730, -1673, -1614, -1552, -1489, // 3040-3047
+	-1423, -1355, -1285, -1213, -1139, -1064, -988, -909, // 3048-3055
+	-830, -749, -668, -585, -502, -417, -333, -248, // 3056-3063
+	-162, -76, 9, 95, 180, 265, 350, 434, // 3064-3071
+	517, 599, 681, 761, 841, 919, 996, 1071, // 3072-3079
+	1145, 1217, 1287, 1356, 1423, 1488, 1551, 1611, // 3080-3087
+	1670, 1726, 1780, 1831, 1880, 1927, 1971, 2013, // 3088-3095
+	2052, 2088, 2122, 2153, 2182, 2208, 2231, 2251, // 3096-3103
+	2269, 2284, 2295, 2304, 2310, 2313, 2313, 2310, // 3104-3111
+	2304, 2295, 2283, 2267, 2248, 2226, 2201, 2172, // 3112-3119
+	2141, 2106, 2068, 2027, 1983, 1935, 1885, 1832, // 3120-3127
+	1776, 1717, 1656, 1591, 1525, 1456, 1385, 1312, // 3128-3135
+	1237, 1160, 1082, 1002, 921, 838, 754, 669, // 3136-3143
+	584, 497, 411, 323, 236, 148, 60, -27, // 3144-3151
+	-115, -201, -288, -374, -459, -543, -626, -708, // 3152-3159
+	-789, -869, -947, -1024, -1099, -1172, -1244, -1314, // 3160-3167
+	-1382, -1448, -1513, -1575, -1635, -1693, -1749, -1803, // 3168-3175
+	-1854, -1903, -1950, -1995, -2037, -2076, -2114, -2148, // 3176-3183
+	-2180, -2210, -2236, -2260, -2281, -2300, -2315, -2327, // 3184-3191
+	-2337, -2343, -2346, -2346, -2342, -2336, -2326, -2312, // 3192-3199
+	-2296, -2276, -2252, -2226, -2196, -2162, -2126, -2086, // 3200-3207
+	-2043, -1997, -1948, -1896, -1841, -1783, -1723, -1660, // 3208-3215
+	-1595, -1527, -1457, -1385, -1311, -1235, -1158, -1079, // 3216-3223
+	-998, -917, -834, -750, -665, -579, -493, -406, // 3224-3231
+	-319, -232, -144, -57, 30, 117, 203, 289, // 3232-3239
+	374, 458, 541, 623, 704, 784, 862, 939, // 3240-3247
+	1014, 1088, 1160, 1230, 1299, 1365, 1430, 1492, // 3248-3255
+	1552, 1610, 1666, 1720, 1771, 1821, 1867, 1912, // 3256-3263
+	1954, 1993, 2030, 2065, 2096, 2126, 2152, 2176, // 3264-3271
+	2197, 2215, 2230, 2242, 2252, 2258, 2261, 2261, // 3272-3279
+	2258, 2252, 2243, 2230, 2214, 2195, 2173, 2147, // 3280-3287
+	2119, 2087, 2052, 2014, 1972, 1928, 1881, 1831, // 3288-3295
+	1778, 1722, 1664, 1603, 1540, 1474, 1406, 1336, // 3296-3303
+	1265, 1191, 1115, 1038, 960, 880, 799, 717, // 3304-3311
+	634, 550, 466, 381, 295, 210, 124, 39, // 3312-3319
+	-47, -132, -216, -300, -383, -466, -547, -628, // 3320-3327
+	-707, -785, -861, -937, -1010, -1082, -1153, -1221, // 3328-3335
+	-1288, -1353, -1416, -1477, -1535, -1592, -1646, -1699, // 3336-3343
+	-1749, -1797, -1842, -1885, -1926, -1964, -2000, -2033, // 3344-3351
+	-2064, -2092, -2117, -2139, -2159, -2176, -2190, -2202, // 3352-3359
+	-2210, -2215, -2217, -2216, -2212, -2205, -2194, -2180, // 3360-3367
+	-2163, -2143, -2120, -2093, -2063, -2030, -1993, -1953, // 3368-3375
+	-1911, -1865, -1817, -1765, -1711, -1654, -1594, -1532, // 3376-3383
+	-1468, -1401, -1332, -1261, -1188, -1113, -1037, -959, // 3384-3391
+	-879, -799, -717, -634, -550, -466, -381, -295, // 3392-3399
+	-210, -124, -38, 48, 134, 219, 304, 388, // 3400-3407
+	471, 554, 636, 716, 796, 874, 951, 1026, // 3408-3415
+	1100, 1173, 1243, 1312, 1379, 1444, 1507, 1568, // 3416-3423
+	1628, 1684, 1739, 1792, 1842, 1890, 1935, 1978, // 3424-3431
+	2019, 2057, 2093, 2125, 2156, 2183, 2208, 2230, // 3432-3439
+	2248, 2264, 2277, 2287, 2294, 2298, 2299, 2296, // 3440-3447
+	2291, 2282, 2270, 2254, 2236, 2214, 2188, 2160, // 3448-3455
+	2128, 2093, 2054, 2013, 1968, 1920, 1869, 1815, // 3456-3463
+	1758, 1698, 1635, 1569, 1501, 1431, 1358, 1283, // 3464-3471
+	1206, 1128, 1047, 965, 882, 797, 712, 625, // 3472-3479
+	537, 449, 361, 272, 183, 94, 4, -85, // 3480-3487
+	-174, -262, -350, -438, -524, -610, -695, -779, // 3488-3495
+	-862, -943, -1023, -1102, -1179, -1254, -1327, -1399, // 3496-3503
+	-1468, -1536, -1601, -1664, -1725, -1783, -1839, -1893, // 3504-3511
+	-1944, -1993, -2039, -2082, -2123, -2161, -2196, -2229, // 3512-3519
+	-2259, -2286, -2311, -2333, -2351, -2367, -2380, -2390, // 3520-3527
+	-2397, -2401, -2401, -2399, -2393, -2384, -2371, -2355, // 3528-3535
+	-2335, -2313, -2286, -2256, -2223, -2186, -2146, -2103, // 3536-3543
+	-2056, -2006, -1952, -1896, -1836, -1774, -1709, -1641, // 3544-3551
+	-1571, -1498, -1423, -1346, -1267, -1186, -1103, -1019, // 3552-3559
+	-934, -847, -759, -670, -580, -490, -399, -308, // 3560-3567
+	-216, -124, -33, 59, 150, 241, 332, 421, // 3568-3575
+	510, 598, 685, 771, 856, 939, 1021, 1101, // 3576-3583
+	1179, 1256, 1330, 1403, 1474, 1542, 1608, 1672, // 3584-3591
+	1733, 1792, 1849, 1903, 1954, 2003, 2050, 2094, // 3592-3599
+	2135, 2173, 2209, 2242, 2272, 2299, 2324, 2346, // 3600-3607
+	2365, 2380, 2393, 2403, 2410, 2414, 2414, 2411, // 3608-3615
+	2405, 2396, 2384, 2368, 2348, 2326, 2300, 2270, // 3616-3623
+	2237, 2201, 2162, 2119, 2073, 2024, 1972, 1917, // 3624-3631
+	1859, 1798, 1734, 1668, 1599, 1528, 1454, 1379, // 3632-3639
+	1301, 1222, 1140, 1058, 973, 888, 801, 714, // 3640-3647
+	625, 536, 446, 355, 265, 174, 83, -8, // 3648-3655
+	-99, -190, -280, -369, -458, -545, -632, -718, // 3656-3663
+	-803, -886, -968, -1048, -1126, -1203, -1278, -1351, // 3664-3671
+	-1422, -1491, -1557, -1621, -1683, -1743, -1800, -1855, // 3672-3679
+	-1907, -1956, -2003, -2047, -2089, -2127, -2163, -2197, // 3680-3687
+	-2227, -2255, -2280, -2302, -2321, -2337, -2350, -2361, // 3688-3695
+	-2368, -2372, -2373, -2370, -2365, -2356, -2344, -2328, // 3696-3703
+	-2310, -2287, -2262, -2233, -2200, -2164, -2125, -2083, // 3704-3711
+	-2037, -1988, -1935, -1880, -1822, -1761, -1697, -1630, // 3712-3719
+	-1561, -1489, -1415, -1339, -1261, -1180, -1099, -1015, // 3720-3727
+	-930, -844, -756, -668, -579, -489, -398, -307, // 3728-3735
+	-215, -124, -32, 59, 150, 241, 332, 421, // 3736-3743
+	510, 599, 686, 772, 857, 940, 1022, 1103, // 3744-3751
+	1182, 1259, 1334, 1408, 1479, 1549, 1616, 1681, // 3752-3759
+	1744, 1804, 1862, 1918, 1971, 2021, 2069, 2114, // 3760-3767
+	2156, 2195, 2232, 2266, 2297, 2325, 2350, 2372, // 3768-3775
+	2391, 2407, 2420, 2430, 2436, 2440, 2440, 2436, // 3776-3783
+	2430, 2420, 2406, 2389, 2369, 2345, 2318, 2287, // 3784-3791
+	2253, 2216, 2175, 2130, 2083, 2032, 1978, 1921, // 3792-3799
+	1861, 1798, 1732, 1663, 1592, 1519, 1443, 1366, // 3800-3807
+	1286, 1204, 1121, 1037, 950, 863, 775, 685, // 3808-3815
+	595, 504, 412, 320, 228, 136, 44, -49, // 3816-3823
+	-141, -232, -323, -414, -504, -593, -681, -768, // 3824-3831
+	-853, -938, -1021, -1102, -1182, -1260, -1336, -1411, // 3832-3839
+	-1483, -1553, -1621, -1687, -1750, -1811, -1870, -1926, // 3840-3847
+	-1980, -2030, -2079, -2124, -2167, -2207, -2244, -2278, // 3848-3855
+	-2309, -2337, -2363, -2385, -2405, -2421, -2434, -2445, // 3856-3863
+	-2452, -2456, -2456, -2454, -2448, -2438, -2426, -2410, // 3864-3871
+	-2391, -2368, -2342, -2313, -2280, -2243, -2204, -2161, // 3872-3879
+	-2114, -2065, -2012, -1956, -1897, -1835, -1771, -1703, // 3880-3887
+	-1634, -1561, -1487, -1410, -1331, -1250, -1168, -1084, // 3888-3895
+	-999, -912, -824, -735, -646, -555, -464, -373, // 3896-3903
+	-281, -190, -98, -6, 85, 176, 267, 357, // 3904-3911
+	446, 535, 623, 709, 794, 878, 961, 1042, // 3912-3919
+	1122, 1199, 1275, 1350, 1422, 1492, 1560, 1625, // 3920-3927
+	1689, 1750, 1809, 1865, 1918, 1969, 2018, 2064, // 3928-3935
+	2107, 2147, 2185, 2219, 2251, 2280, 2306, 2329, // 3936-3943
+	2349, 2366, 2380, 2391, 2399, 2403, 2404, 2402, // 3944-3951
+	2397, 2389, 2377, 2362, 2343, 2321, 2296, 2267, // 3952-3959
+	2235, 2199, 2160, 2118, 2073, 2024, 1972, 1917, // 3960-3967
+	1859, 1798, 1735, 1669, 1600, 1528, 1455, 1379, // 3968-3975
+	1301, 1221, 1140, 1057, 972, 886, 798, 710, // 3976-3983
+	621, 530, 439, 348, 256, 164, 72, -20, // 3984-3991
+	-112, -203, -294, -385, -474, -563, -651, -738, // 3992-3999
+	-823, -907, -990, -1071, -1150, -1228, -1304, -1378, // 4000-4007
+	-1449, -1519, -1587, -1652, -1715, -1776, -1834, -1889, // 4008-4015
+	-1943, -1993, -2041, -2086, -2129, -2168, -2205, -2240, // 4016-4023
+	-2271, -2299, -2325, -2347, -2367, -2383, -2397, -2407, // 4024-4031
+	-2415, -2419, -2420, -2418, -2413, -2404, -2392, -2377, // 4032-4039
+	-2359, -2338, -2313, -2285, -2253, -2218, -2180, -2139, // 4040-4047
+	-2095, -2048, -1997, -1944, -1887, -1828, -1766, -1701, // 4048-4055
+	-1634, -1564, -1492, -1418, -1341, -1263, -1182, -1100, // 4056-4063
+	-1017, -932, -846, -758, -670, -581, -491, -400, // 4064-4071
+	-310, -219, -127, -36, 54, 145, 235, 324, // 4072-4079
+	413, 501, 588, 673, 758, 841, 923, 1003, // 4080-4087
+	1082, 1159, 1234, 1308, 1379, 1449, 1516, 1581, // 4088-4095
+	1644, 1704, 1763, 1819, 1872, 1923, 1971, 2017, // 4096-4103
+	2059, 2100, 2137, 2172, 2203, 2232, 2258, 2281, // 4104-4111
+	2301, 2318, 2332, 2343, 2351, 2355, 2356, 2354, // 4112-4119
+	2349, 2340, 2329, 2313, 2295, 2273, 2248, 2219, // 4120-4127
+	2187, 2152, 2114, 2072, 2027, 1980, 1929, 1875, // 4128-4135
+	1818, 1759, 1697, 1632, 1565, 1495, 1423, 1349, // 4136-4143
+	1273, 1195, 1116, 1034, 951, 867, 782, 695, // 4144-4151
+	608, 520, 431, 342, 252, 162, 72, -17, // 4152-4159
+	-107, -196, -285, -373, -461, -547, -633, -718, // 4160-4167
+	-801, -883, -964, -1044, -1122, -1198, -1273, -1345, // 4168-4175
+	-1416, -1485, -1552, -1617, -1679, -1740, -1798, -1853, // 4176-4183
+	-1906, -1957, -2005, -2050, -2092, -2132, -2169, -2203, // 4184-4191
+	-2234, -2262, -2287, -2309, -2328, -2343, -2355, -2364, // 4192-4199
+	-2370, -2373, -2372, -2368, -2360, -2349, -2335, -2318, // 4200-4207
+	-2297, -2273, -2245, -2214, -2180, -2143, -2103, -2059, // 4208-4215
+	-2012, -1963, -1910, -1855, -1797, -1736, -1673, -1607, // 4216-4223
+	-1539, -1468, -1396, -1321, -1245, -1166, -1086, -1005, // 4224-4231
+	-922, -838, -752, -666, -579, -491, -402, -313, // 4232-4239
+	-224, -135, -45, 44, 133, 222, 310, 398, // 4240-4247
+	485, 571, 657, 741, 824, 905, 986, 1065, // 4248-4255
+	1142, 1218, 1292, 1364, 1435, 1503, 1570, 1634, // 4256-4263
+	1696, 1756, 1813, 1869, 1921, 1971, 2019, 2064, // 4264-4271
+	2106, 2146, 2182, 2216, 2247, 2275, 2300, 2322, // 4272-4279
+	2340, 2356, 2368, 2377, 2383, 2386, 2385, 2382, // 4280-4287
+	2374, 2364, 2350, 2333, 2313, 2289, 2262, 2232, // 4288-4295
+	2199, 2163, 2123, 2081, 2035, 1986, 1935, 1881, // 4296-4303
+	1824, 1764, 1702, 1638, 1571, 1501, 1430, 1357, // 4304-4311
+	1282, 1205, 1126, 1046, 964, 882, 798, 713, // 4312-4319
+	627, 541, 454, 367, 279, 191, 103, 16, // 4320-4327
+	-72, -159, -246, -332, -417, -502, -585, -668, // 4328-4335
+	-749, -829, -908, -985, -1061, -1135, -1208, -1278, // 4336-4343
+	-1347, -1413, -1478, -1540, -1601, -1659, -1714, -1768, // 4344-4351
+	-1818, -1867, -1913, -1956, -1996, -2034, -2070, -2102, // 4352-4359
+	-2132, -2159, -2183, -2205, -2223, -2238, -2251, -2260, // 4360-4367
+	-2267, -2270, -2271, -2268, -2262, -2253, -2241, -2225, // 4368-4375
+	-2207, -2185, -2160, -2132, -2100, -2066, -2028, -1988, // 4376-4383
+	-1944, -1898, -1848, -1796, -1741, -1683, -1622, -1560, // 4384-4391
+	-1494, -1427, -1357, -1285, -1211, -1135, -1058, -979, // 4392-4399
+	-899, -817, -734, -650, -566, -480, -394, -308, // 4400-4407
+	-221, -134, -47, 40, 127, 213, 299, 384, // 4408-4415
+	468, 552, 635, 716, 796, 875, 953, 1029, // 4416-4423
+	1104, 1176, 1248, 1317, 1384, 1449, 1513, 1574, // 4424-4431
+	1633, 1690, 1745, 1797, 1847, 1895, 1940, 1983, // 4432-4439
+	2023, 2061, 2096, 2128, 2158, 2185, 2210, 2232, // 4440-4447
+	2251, 2267, 2280, 2290, 2297, 2301, 2303, 2301, // 4448-4455
+	2296, 2287, 2276, 2261, 2243, 2222, 2198, 2170, // 4456-4463
+	2140, 2106, 2069, 2028, 1985, 1939, 1889, 1837, // 4464-4471
+	1782, 1724, 1664, 1601, 1535, 1468, 1398, 1325, // 4472-4479
+	1251, 1175, 1098, 1018, 938, 856, 772, 688, // 4480-4487
+	603, 517, 430, 343, 256, 168, 80, -7, // 4488-4495
+	-95, -182, -268, -354, -440, -524, -608, -690, // 4496-4503
+	-771, -851, -930, -1007, -1082, -1156, -1228, -1299, // 4504-4511
+	-1367, -1433, -1498, -1560, -1620, -1678, -1734, -1787, // 4512-4519
+	-1838, -1887, -1933, -1977, -2019, -2057, -2094, -2127, // 4520-4527
+	-2158, -2186, -2212, -2234, -2254, -2271, -2285, -2296, // 4528-4535
+	-2304, -2310, -2312, -2311, -2306, -2299, -2289, -2275, // 4536-4543
+	-2258, -2238, -2215, -2188, -2159, -2126, -2090, -2051, // 4544-4551
+	-2008, -1963, -1915, -1864, -1811, -1754, -1695, -1634, // 4552-4559
+	-1570, -1503, -1435, -1364, -1292, -1217, -1141, -1063, // 4560-4567
+	-984, -904, -822, -739, -656, -571, -486, -401, // 4568-4575
+	-315, -229, -143, -56, 30, 115, 201, 285, // 4576-4583
+	369, 452, 535, 616, 696, 775, 853, 929, // 4584-4591
+	1003, 1076, 1147, 1217, 1284, 1350, 1413, 1475, // 4592-4599
+	1534, 1592, 1647, 1700, 1750, 1798, 1844, 1887, // 4600-4607
+	1928, 1966, 2002, 2035, 2066, 2094, 2119, 2141, // 4608-4615
+	2161, 2178, 2192, 2203, 2211, 2216, 2218, 2217, // 4616-4623
+	2213, 2206, 2196, 2182, 2166, 2146, 2123, 2097, // 4624-4631
+	2068, 2035, 2000, 1961, 1920, 1875, 1828, 1777, // 4632-4639
+	1724, 1668, 1610, 1549, 1485, 1420, 1352, 1282, // 4640-4647
+	1210, 1137, 1061, 984, 906, 826, 746, 664, // 4648-4655
+	581, 498, 414, 330, 245, 160, 76, -9, // 4656-4663
+	-94, -178, -262, -345, -428, -509, -590, -670, // 4664-4671
+	-749, -827, -903, -978, -1052, -1123, -1194, -1262, // 4672-4679
+	-1329, -1394, -1457, -1518, -1577, -1633, -1688, -1740, // 4680-4687
+	-1790, -1837, -1882, -1925, -1965, -2002, -2037, -2070, // 4688-4695
+	-2099, -2126, -2150, -2172, -2190, -2206, -2218, -2228, // 4696-4703
+	-2235, -2239, -2240, -2237, -2232, -2223, -2212, -2197, // 4704-4711
+	-2179, -2158, -2133, -2106, -2075, -2042, -2005, -1965, // 4712-4719
+	-1923, -1877, -1829, -1778, -1724, -1668, -1609, -1548, // 4720-4727
+	-1484, -1419, -1351, -1281, -1210, -1136, -1061, -985, // 4728-4735
+	-907, -828, -748, -667, -585, -502, -419, -335, // 4736-4743
+	-251, -167, -82, 2, 87, 171, 255, 339, // 4744-4751
+	421, 504, 585, 666, 745, 824, 901, 977, // 4752-4759
+	1051, 1124, 1195, 1264, 1332, 1398, 1461, 1523, // 4760-4767
+	1582, 1640, 1695, 1747, 1798, 1845, 1891, 1933, // 4768-4775
+	1974, 2011, 2046, 2078, 2108, 2134, 2158, 2179, // 4776-4783
+	2197, 2212, 2224, 2234, 2240, 2243, 2243, 2240, // 4784-4791
+	2234, 2225, 2213, 2198, 2179, 2158, 2133, 2105, // 4792-4799
+	2074, 2040, 2003, 1964, 1921, 1875, 1827, 1776, // 4800-4807
+	1722, 1666, 1607, 1546, 1483, 1417, 1350, 1281, // 4808-4815
+	1209, 1136, 1062, 986, 909, 830, 751, 670, // 4816-4823
+	589, 506, 424, 340, 257, 173, 89, 4, // 4824-4831
+	-80, -164, -247, -331, -413, -495, -577, -657, // 4832-4839
+	-736, -815, -892, -968, -1042, -1115, -1186, -1256, // 4840-4847
+	-1323, -1389, -1453, -1515, -1575, -1632, -1688, -1741, // 4848-4855
+	-1791, -1839, -1885, -1928, -1968, -2006, -2041, -2073, // 4856-4863
+	-2103, -2129, -2153, -2174, -2192, -2207, -2219, -2227, // 4864-4871
+	-2233, -2236, -2236, -2232, -2226, -2216, -2203, -2187, // 4872-4879
+	-2168, -2146, -2121, -2093, -2062, -2028, -1991, -1951, // 4880-4887
+	-1909, -1863, -1815, -1764, -1711, -1655, -1597, -1537, // 4888-4895
+	-1474, -1410, -1343, -1275, -1204, -1132, -1059, -984, // 4896-4903
+	-908, -830, -751, -672, -591, -510, -429, -346, // 4904-4911
+	-263, -180, -97, -14, 69, 152, 235, 317, // 4912-4919
+	399, 481, 561, 641, 720, 798, 875, 951, // 4920-4927
+	1025, 1098, 1170, 1239, 1308, 1374, 1438, 1501, // 4928-4935
+	1561, 1619, 1675, 1729, 1780, 1829, 1875, 1918, // 4936-4943
+	1959, 1998, 2033, 2066, 2096, 2123, 2147, 2168, // 4944-4951
+	2187, 2202, 2215, 2224, 2231, 2234, 2234, 2232, // 4952-4959
+	2226, 2217, 2205, 2190, 2172, 2151, 2127, 2100, // 4960-4967
+	2070, 2037, 2001, 1962, 1920, 1876, 1829, 1779, // 4968-4975
+	1726, 1672, 1614, 1555, 1493, 1429, 1363, 1295, // 4976-4983
+	1226, 1154, 1081, 1007, 931, 854, 776, 696, // 4984-4991
+	616, 535, 453, 370, 287, 204, 120, 36, // 4992-4999
+	-48, -132, -216, -300, -383, -466, -548, -630, // 5000-5007
+	-711, -790, -869, -946, -1023, -1097, -1170, -1242, // 5008-5015
+	-1312, -1380, -1446, -1510, -1571, -1631, -1688, -1743, // 5016-5023
+	-1796, -1846, -1893, -1938, -1980, -2019, -2056, -2090, // 5024-5031
+	-2120, -2148, -2173, -2196, -2215, -2231, -2244, -2254, // 5032-5039
+	-2261, -2265, -2266, -2264, -2259, -2251, -2239, -2225, // 5040-5047
+	-2207, -2187, -2163, -2137, -2107, -2075, -2039, -2001, // 5048-5055
+	-1960, -1916, -1869, -1819, -1767, -1713, -1656, -1597, // 5056-5063
+	-1535, -1471, -1405, -1337, -1268, -1196, -1123, -1048, // 5064-5071
+	-972, -894, -815, -735, -654, -572, -489, -405, // 5072-5079
+	-321, -236, -151, -65, 20, 106, 191, 276, // 5080-5087
+	361, 445, 529, 612, 694, 775, 855, 934, // 5088-5095
+	1011, 1087, 1161, 1234, 1305, 1374, 1440, 1505, // 5096-5103
+	1568, 1628, 1686, 1742, 1795, 1845, 1893, 1938, // 5104-5111
+	1981, 2021, 2058, 2092, 2123, 2152, 2177, 2200, // 5112-5119
+	2220, 2236, 2250, 2260, 2268, 2273, 2274, 2273, // 5120-5127
+	2268, 2260, 2250, 2236, 2219, 2199, 2176, 2150, // 5128-5135
+	2121, 2090, 2055, 2017, 1977, 1934, 1888, 1839, // 5136-5143
+	1788, 1735, 1678, 1620, 1559, 1496, 1431, 1364, // 5144-5151
+	1295, 1224, 1152, 1077, 1002, 925, 846, 767, // 5152-5159
+	686, 605, 522, 439, 356, 272, 187, 102, // 5160-5167
+	17, -68, -152, -237, -321, -405, -488, -571, // 5168-5175
+	-652, -733, -812, -891, -968, -1043, -1117, -1190, // 5176-5183
+	-1261, -1329, -1396, -1461, -1524, -1584, -1643, -1698, // 5184-5191
+	-1752, -1803, -1851, -1897, -1940, -1981, -2018, -2053, // 5192-5199
+	-2085, -2115, -2141, -2164, -2185, -2202, -2217, -2228, // 5200-5207
+	-2237, -2242, -2245, -2244, -2240, -2233, -2224, -2211, // 5208-5215
+	-2195, -2176, -2154, -2130, -2102, -2072, -2038, -2002, // 5216-5223
+	-1963, -1922, -1877, -1831, -1781, -1729, -1675, -1619, // 5224-5231
+	-1560, -1499, -1436, -1371, -1305, -1236, -1166, -1094, // 5232-5239
+	-1020, -946, -870, -792, -714, -634, -554, -473, // 5240-5247
+	-391, -308, -225, -142, -58, 25, 109, 193, // 5248-5255
+	276, 359, 442, 524, 605, 685, 765, 843, // 5256-5263
+	920, 996, 1070, 1142, 1213, 1282, 1349, 1414, // 5264-5271
+	1476, 1537, 1595, 1651, 1705, 1756, 1804, 1850, // 5272-5279
+	1893, 1934, 1971, 2006, 2038, 2067, 2094, 2117, // 5280-5287
+	2138, 2155, 2170, 2181, 2190, 2196, 2198, 2198, // 5288-5295
+	2195, 2188, 2179, 2167, 2152, 2134, 2113, 2089, // 5296-5303
+	2063, 2033, 2001, 1967, 1929, 1889, 1846, 1801, // 5304-5311
+	1753, 1703, 1650, 1595, 1538, 1479, 1417, 1354, // 5312-5319
+	1288, 1221, 1152, 1081, 1008, 934, 859, 782, // 5320-5327
+	704, 625, 546, 465, 383, 302, 219, 136, // 5328-5335
+	53, -30, -113, -196, -278, -361, -442, -523, // 5336-5343
+	-603, -683, -761, -838, -914, -988, -1061, -1132, // 5344-5351
+	-1202, -1269, -1335, -1399, -1461, -1520, -1578, -1633, // 5352-5359
+	-1685, -1736, -1783, -1828, -1871, -1911, -1948, -1982, // 5360-5367
+	-2013, -2042, -2068, -2091, -2111, -2128, -2142, -2153, // 5368-5375
+	-2162, -2167, -2169, -2169, -2165, -2159, -2150, -2137, // 5376-5383
+	-2122, -2104, -2083, -2059, -2033, -2003, -1971, -1936, // 5384-5391
+	-1899, -1859, -1816, -1770, -1723, -1672, -1620, -1565, // 5392-5399
+	-1508, -1448, -1387, -1323, -1258, -1191, -1122, -1051, // 5400-5407
+	-979, -906, -831, -755, -678, -599, -520, -440, // 5408-5415
+	-359, -278, -197, -115, -32, 50, 132, 214, // 5416-5423
+	296, 377, 458, 538, 618, 696, 774, 850, // 5424-5431
+	925, 999, 1071, 1142, 1211, 1278, 1344, 1407, // 5432-5439
+	1469, 1528, 1585, 1640, 1692, 1742, 1789, 1834, // 5440-5447
+	1876, 1916, 1952, 1986, 2017, 2045, 2071, 2093, // 5448-5455
+	2113, 2130, 2143, 2154, 2162, 2167, 2169, 2168, // 5456-5463
+	2165, 2158, 2148, 2136, 2121, 2102, 2082, 2058, // 5464-5471
+	2031, 2002, 1970, 1935, 1898, 1858, 1816, 1771, // 5472-5479
+	1723, 1673, 1621, 1567, 1510, 1451, 1390, 1327, // 5480-5487
+	1262, 1195, 1127, 1057, 985, 912, 837, 761, // 5488-5495
+	684, 607, 528, 448, 368, 287, 206, 124, // 5496-5503
+	42, -40, -122, -203, -285, -366, -446, -526, // 5504-5511
+	-605, -683, -760, -836, -911, -985, -1057, -1127, // 5512-5519
+	-1196, -1263, -1328, -1391, -1452, -1511, -1568, -1622, // 5520-5527
+	-1674, -1724, -1771, -1815, -1857, -1896, -1933, -1966, // 5528-5535
+	-1997, -2026, -2051, -2073, -2093, -2109, -2123, -2134, // 5536-5543
+	-2142, -2147, -2149, -2148, -2144, -2138, -2128, -2116, // 5544-5551
+	-2101, -2083, -2062, -2039, -2012, -1983, -1951, -1917, // 5552-5559
+	-1880, -1841, -1798, -1754, -1707, -1657, -1605, -1551, // 5560-5567
+	-1495, -1437, -1376, -1314, -1249, -1183, -1115, -1045, // 5568-5575
+	-974, -901, -827, -752, -676, -598, -520, -441, // 5576-5583
+	-361, -280, -199, -118, -37, 45, 126, 208, // 5584-5591
+	289, 370, 450, 529, 608, 686, 763, 839, // 5592-5599
+	914, 987, 1059, 1129, 1198, 1265, 1329, 1392, // 5600-5607
+	1453, 1512, 1568, 1623, 1674, 1724, 1770, 1814, // 5608-5615
+	1856, 1895, 1931, 1965, 1995, 2023, 2048, 2071, // 5616-5623
+	2090, 2107, 2121, 2132, 2140, 2145, 2148, 2147, // 5624-5631
+	2144, 2138, 2130, 2118, 2104, 2087, 2067, 2044, // 5632-5639
+	2019, 1991, 1960, 1927, 1891, 1852, 1811, 1767, // 5640-5647
+	1721, 1673, 1622, 1569, 1513, 1456, 1396, 1334, // 5648-5655
+	1271, 1205, 1138, 1069, 998, 926, 853, 778, // 5656-5663
+	702, 625, 547, 468, 388, 308, 227, 146, // 5664-5671
+	65, -17, -98, -179, -261, -341, -422, -501, // 5672-5679
+	-580, -658, -735, -811, -886, -959, -1031, -1101, // 5680-5687
+	-1170, -1237, -1302, -1365, -1426, -1485, -1542, -1596, // 5688-5695
+	-1649, -1699, -1746, -1791, -1833, -1873, -1910, -1945, // 5696-5703
+	-1977, -2006, -2032, -2056, -2077, -2095, -2110, -2123, // 5704-5711
+	-2133, -2140, -2144, -2145, -2144, -2139, -2132, -2122, // 5712-5719
+	-2109, -2094, -2076, -2054, -2030, -2004, -1974, -1942, // 5720-5727
+	-1908, -1870, -1831, -1788, -1743, -1696, -1646, -1594, // 5728-5735
+	-1540, -1483, -1425, -1364, -1302, -1237, -1171, -1103, // 5736-5743
+	-1033, -962, -890, -816, -741, -665, -587, -509, // 5744-5751
+	-431, -351, -271, -191, -110, -29, 52, 133, // 5752-5759
+	214, 294, 374, 454, 533, 611, 688, 764, // 5760-5767
+	838, 912, 984, 1055, 1124, 1191, 1257, 1320, // 5768-5775
+	1382, 1442, 1499, 1555, 1608, 1658, 1706, 1752, // 5776-5783
+	1795, 1836, 1874, 1910, 1943, 1973, 2000, 2025, // 5784-5791
+	2047, 2066, 2082, 2096, 2106, 2114, 2119, 2121, // 5792-5799
+	2120, 2117, 2110, 2101, 2089, 2074, 2057, 2036, // 5800-5807
+	2013, 1987, 1958, 1927, 1893, 1856, 1817, 1775, // 5808-5815
+	1731, 1684, 1635, 1584, 1530, 1475, 1417, 1357, // 5816-5823
+	1295, 1232, 1166, 1099, 1030, 960, 888, 815, // 5824-5831
+	741, 666, 589, 512, 434, 356, 276, 197, // 5832-5839
+	117, 37, -44, -124, -204, -284, -363, -442, // 5840-5847
+	-520, -597, -674, -749, -823, -896, -968, -1039, // 5848-5855
+	-1107, -1174, -1240, -1303, -1365, -1424, -1481, -1537, // 5856-5863
+	-1590, -1640, -1689, -1735, -1778, -1819, -1858, -1893, // 5864-5871
+	-1926, -1957, -1985, -2010, -2032, -2051, -2068, -2082, // 5872-5879
+	-2093, -2101, -2107, -2109, -2109, -2105, -2099, -2090, // 5880-5887
+	-2079, -2064, -2046, -2026, -2003, -1977, -1949, -1918, // 5888-5895
+	-1884, -1847, -1808, -1767, -1722, -1676, -1627, -1576, // 5896-5903
+	-1522, -1467, -1409, -1350, -1288, -1225, -1159, -1093, // 5904-5911
+	-1024, -954, -883, -810, -736, -662, -586, -509, // 5912-5919
+	-431, -353, -274, -195, -116, -36, 44, 124, // 5920-5927
+	204, 283, 362, 441, 519, 596, 673, 748, // 5928-5935
+	822, 896, 968, 1038, 1107, 1174, 1240, 1304, // 5936-5943
+	1366, 1425, 1483, 1539, 1592, 1643, 1692, 1738, // 5944-5951
+	1782, 1823, 1862, 1898, 1931, 1962, 1990, 2015, // 5952-5959
+	2038, 2058, 2075, 2089, 2100, 2109, 2114, 2117, // 5960-5967
+	2117, 2114, 2108, 2100, 2088, 2074, 2057, 2037, // 5968-5975
+	2014, 1989, 1961, 1930, 1896, 1860, 1821, 1780, // 5976-5983
+	1736, 1690, 1641, 1590, 1537, 1482, 1425, 1365, // 5984-5991
+	1304, 1241, 1176, 1109, 1041, 971, 900, 827, // 5992-5999
+	753, 679, 603, 526, 449, 371, 292, 213, // 6000-6007
+	133, 53, -27, -106, -186, -265, -344, -423, // 6008-6015
+	-501, -578, -654, -730, -804, -877, -949, -1019, // 6016-6023
+	-1088, -1155, -1220, -1284, -1345, -1405, -1462, -1518, // 6024-6031
+	-1571, -1622, -1671, -1717, -1760, -1802, -1840, -1877, // 6032-6039
+	-1910, -1941, -1969, -1995, -2017, -2037, -2055, -2069, // 6040-6047
+	-2081, -2090, -2096, -2099, -2099, -2097, -2091, -2083, // 6048-6055
+	-2072, -2058, -2041, -2022, -1999, -1974, -1946, -1915, // 6056-6063
+	-1882, -1846, -1807, -1766, -1723, -1677, -1628, -1578, // 6064-6071
+	-1525, -1469, -1412, -1353, -1292, -1229, -1164, -1098, // 6072-6079
+	-1030, -961, -890, -818, -745, -670, -595, -519, // 6080-6087
+	-442, -365, -286, -208, -129, -50, 29, 109, // 6088-6095
+	188, 266, 345, 423, 500, 577, 653, 728, // 6096-6103
+	801, 874, 945, 1015, 1084, 1150, 1216, 1279, // 6104-6111
+	1340, 1400, 1457, 1513, 1566, 1617, 1665, 1711, // 6112-6119
+	1755, 1796, 1835, 1871, 1905, 1936, 1964, 1989, // 6120-6127
+	2012, 2032, 2049, 2063, 2075, 2084, 2090, 2092, // 6128-6135
+	2093, 2090, 2084, 2076, 2065, 2051, 2034, 2014, // 6136-6143
+	1992, 1966, 1938, 1908, 1875, 1839, 1800, 1759, // 6144-6151
+	1716, 1670, 1622, 1572, 1520, 1465, 1408, 1350, // 6152-6159
+	1289, 1227, 1163, 1097, 1030, 961, 891, 819, // 6160-6167
+	747, 673, 598, 523, 446, 369, 292, 214, // 6168-6175
+	135, 57, -22, -101, -179, -258, -336, -413, // 6176-6183
+	-490, -567, -642, -717, -790, -863, -934, -1003, // 6184-6191
+	-1072, -1138, -1203, -1266, -1328, -1387, -1444, -1500, // 6192-6199
+	-1553, -1603, -1652, -1698, -1741, -1782, -1821, -1857, // 6200-6207
+	-1890, -1921, -1949, -1974, -1996, -2016, -2033, -2047, // 6208-6215
+	-2058, -2067, -2072, -2075, -2075, -2072, -2066, -2057, // 6216-6223
+	-2046, -2032, -2015, -1995, -1972, -1947, -1919, -1889, // 6224-6231
+	-1855, -1820, -1782, -1741, -1698, -1653, -1605, -1555, // 6232-6239
+	-1503, -1449, -1393, -1335, -1276, -1214, -1151, -1086, // 6240-6247
+	-1020, -952, -883, -812, -741, -668, -595, -520, // 6248-6255
+	-445, -369, -293, -216, -139, -62, 16, 93, // 6256-6263
+	171, 248, 325, 402, 477, 553, 627, 701, // 6264-6271
+	773, 845, 915, 984, 1052, 1118, 1182, 1244, // 6272-6279
+	1305, 1364, 1421, 1476, 1528, 1579, 1627, 1673, // 6280-6287
+	1716, 1757, 1795, 1831, 1864, 1895, 1923, 1948, // 6288-6295
+	1970, 1990, 2006, 2020, 2031, 2040, 2045, 2048, // 6296-6303
+	2048, 2045, 2039, 2030, 2019, 2004, 1988, 1968, // 6304-6311
+	1946, 1921, 1893, 1863, 1830, 1795, 1757, 1717, // 6312-6319
+	1675, 1630, 1583, 1534, 1483, 1430, 1375, 1318, // 6320-6327
+	1259, 1198, 1136, 1072, 1007, 940, 872, 803, // 6328-6335
+	732, 661, 588, 515, 441, 366, 290, 215, // 6336-6343
+	138, 62, -15, -91, -168, -244, -320, -396, // 6344-6351
+	-471, -545, -619, -692, -764, -835, -905, -973, // 6352-6359
+	-1040, -1106, -1170, -1232, -1293, -1352, -1408, -1463, // 6360-6367
+	-1516, -1566, -1614, -1660, -1704, -1745, -1783, -1819, // 6368-6375
+	-1853, -1884, -1912, -1937, -1960, -1980, -1997, -2011, // 6376-6383
+	-2023, -2032, -2038, -2041, -2041, -2039, -2033, -2025, // 6384-6391
+	-2014, -2001, -1985, -1965, -1944, -1919, -1892, -1863, // 6392-6399
+	-1831, -1796, -1759, -1719, -1678, -1634, -1587, -1539, // 6400-6407
+	-1488, -1435, -1381, -1324, -1266, -1206, -1144, -1081, // 6408-6415
+	-1016, -950, -882, -814, -744, -673, -601, -528, // 6416-6423
+	-454, -380, -305, -230, -155, -79, -3, 73, // 6424-6431
+	149, 225, 300, 375, 450, 524, 597, 670, // 6432-6439
+	741, 812, 881, 949, 1016, 1081, 1145, 1207, // 6440-6447
+	1268, 1326, 1383, 1438, 1490, 1541, 1589, 1635, // 6448-6455
+	1679, 1720, 1759, 1795, 1829, 1860, 1888, 1914, // 6456-6463
+	1937, 1957, 1975, 1990, 2002, 2011, 2017, 2021, // 6464-6471
+	2021, 2019, 2014, 2007, 1996, 1983, 1967, 1948, // 6472-6479
+	1927, 1903, 1876, 1847, 1816, 1782, 1745, 1706, // 6480-6487
+	1665, 1622, 1576, 1528, 1478, 1426, 1373, 1317, // 6488-6495
+	1259, 1200, 1139, 1077, 1013, 947, 881, 813, // 6496-6503
+	744, 674, 602, 530, 457, 384, 310, 235, // 6504-6511
+	160, 85, 9, -66, -142, -217, -293, -367, // 6512-6519
+	-442, -515, -588, -660, -731, -802, -870, -938, // 6520-6527
+	-1004, -1069, -1132, -1194, -1254, -1312, -1368, -1422, // 6528-6535
+	-1474, -1524, -1572, -1617, -1660, -1701, -1739, -1775, // 6536-6543
+	-1808, -1839, -1867, -1892, -1915, -1935, -1952, -1967, // 6544-6551
+	-1979, -1988, -1994, -1998, -1999, -1997, -1993, -1985, // 6552-6559
+	-1975, -1963, -1947, -1929, -1909, -1885, -1860, -1831, // 6560-6567
+	-1800, -1767, -1731, -1693, -1653, -1610, -1565, -1518, // 6568-6575
+	-1469, -1418, -1365, -1309, -1253, -1194, -1134, -1072, // 6576-6583
+	-1008, -944, -877, -810, -741, -672, -601, -529, // 6584-6591
+	-457, -384, -311, -237, -162, -88, -13, 62, // 6592-6599
+	137, 211, 285, 359, 432, 505, 577, 648, // 6600-6607
+	718, 787, 854, 921, 986, 1050, 1112, 1172, // 6608-6615
+	1231, 1288, 1343, 1397, 1448, 1497, 1544, 1588, // 6616-6623
+	1631, 1671, 1709, 1744, 1777, 1807, 1835, 1860, // 6624-6631
+	1883, 1903, 1920, 1935, 1947, 1956, 1963, 1967, // 6632-6639
+	1968, 1966, 1962, 1955, 1945, 1932, 1917, 1900, // 6640-6647
+	1879, 1856, 1831, 1803, 1772, 1739, 1704, 1666, // 6648-6655
+	1626, 1584, 1539, 1492, 1444, 1393, 1341, 1286, // 6656-6663
+	1230, 1172, 1112, 1051, 988, 924, 859, 792, // 6664-6671
+	725, 656, 586, 515, 444, 372, 299, 226, // 6672-6679
+	153, 79, 6, -68, -142, -215, -289, -361, // 6680-6687
+	-434, -505, -576, -646, -715, -783, -850, -915, // 6688-6695
+	-980, -1042, -1103, -1163, -1221, -1277, -1331, -1383, // 6696-6703
+	-1434, -1482, -1528, -1572, -1614, -1653, -1690, -1725, // 6704-6711
+	-1757, -1787, -1814, -1839, -1861, -1880, -1897, -1912, // 6712-6719
+	-1923, -1932, -1939, -1942, -1943, -1941, -1937, -1930, // 6720-6727
+	-1920, -1908, -1893, -1875, -1855, -1832, -1806, -1778, // 6728-6735
+	-1748, -1715, -1680, -1642, -1603, -1560, -1516, -1470, // 6736-6743
+	-1421, -1371, -1319, -1265, -1209, -1151, -1092, -1031, // 6744-6751
+	-969, -905, -840, -774, -706, -638, -569, -499, // 6752-6759
+	-428, -357, -285, -212, -140, -67, 6, 79, // 6760-6767
+	152, 225, 297, 369, 440, 511, 581, 650, // 6768-6775
+	718, 785, 851, 915, 979, 1040, 1101, 1159, // 6776-6783
+	1216, 1271, 1325, 1376, 1426, 1473, 1519, 1562, // 6784-6791
+	1603, 1641, 1678, 1712, 1744, 1773, 1799, 1824, // 6792-6799
+	1845, 1865, 1881, 1895, 1907, 1915, 1922, 1925, // 6800-6807
+	1926, 1924, 1919, 1912, 1903, 1890, 1875, 1858, // 6808-6815
+	1837, 1815, 1789, 1762, 1732, 1699, 1664, 1627, // 6816-6823
+	1587, 1546, 1502, 1456, 1408, 1358, 1307, 1253, // 6824-6831
+	1198, 1141, 1082, 1022, 961, 898, 834, 768, // 6832-6839
+	702, 634, 566, 497, 427, 356, 285, 214, // 6840-6847
+	142, 70, -2, -74, -146, -218, -290, -361, // 6848-6855
+	-431, -501, -570, -639, -706, -772, -838, -901, // 6856-6863
+	-964, -1025, -1085, -1143, -1199, -1254, -1307, -1358, // 6864-6871
+	-1407, -1454, -1499, -1541, -1582, -1620, -1657, -1690, // 6872-6879
+	-1722, -1751, -1777, -1801, -1823, -1842, -1859, -1873, // 6880-6887
+	-1884, -1893, -1899, -1902, -1903, -1902, -1897, -1890, // 6888-6895
+	-1881, -1869, -1854, -1837, -1817, -1794, -1770, -1742, // 6896-6903
+	-1713, -1681, -1647, -1610, -1571, -1530, -1487, -1442, // 6904-6911
+	-1395, -1346, -1295, -1243, -1188, -1132, -1075, -1016, // 6912-6919
+	-955, -893, -830, -766, -701, -634, -567, -499, // 6920-6927
+	-430, -361, -291, -221, -150, -79, -8, 63, // 6928-6935
+	134, 204, 275, 345, 414, 483, 551, 619, // 6936-6943
+	685, 750, 815, 878, 939, 1000, 1059, 1116, // 6944-6951
+	1172, 1226, 1278, 1329, 1377, 1424, 1469, 1511, // 6952-6959
+	1551, 1589, 1625, 1659, 1690, 1719, 1745, 1769, // 6960-6967
+	1791, 1809, 1826, 1840, 1851, 1860, 1866, 1869, // 6968-6975
+	1870, 1869, 1864, 1857, 1848, 1836, 1821, 1804, // 6976-6983
+	1785, 1763, 1738, 1711, 1682, 1650, 1616, 1580, // 6984-6991
+	1542, 1502, 1459, 1415, 1369, 1320, 1270, 1219, // 6992-6999
+	1165, 1110, 1053, 995, 936, 875, 813, 750, // 7000-7007
+	686, 621, 555, 488, 420, 352, 283, 214, // 7008-7015
+	145, 75, 5, -64, -134, -204, -273, -342, // 7016-7023
+	-410, -478, -545, -611, -677, -741, -804, -867, // 7024-7031
+	-928, -987, -1045, -1102, -1157, -1211, -1262, -1312, // 7032-7039
+	-1360, -1406, -1450, -1492, -1532, -1570, -1605, -1638, // 7040-7047
+	-1669, -1697, -1723, -1747, -1768, -1787, -1803, -1817, // 7048-7055
+	-1828, -1836, -1842, -1846, -1847, -1845, -1841, -1834, // 7056-7063
+	-1824, -1812, -1798, -1781, -1762, -1740, -1716, -1689, // 7064-7071
+	-1660, -1629, -1596, -1560, -1523, -1483, -1441, -1398, // 7072-7079
+	-1352, -1305, -1255, -1204, -1152, -1098, -1042, -985, // 7080-7087
+	-927, -867, -806, -745, -682, -618, -553, -488, // 7088-7095
+	-422, -355, -288, -221, -153, -85, -17, 51, // 7096-7103
+	119, 187, 255, 322, 389, 455, 520, 585, // 7104-7111
+	649, 712, 774, 835, 894, 953, 1010, 1065, // 7112-7119
+	1119, 1171, 1222, 1271, 1318, 1363, 1406, 1447, // 7120-7127
+	1487, 1524, 1558, 1591, 1621, 1649, 1675, 1698, // 7128-7135
+	1719, 1737, 1753, 1767, 1778, 1787, 1793, 1796, // 7136-7143
+	1797, 1796, 1792, 1785, 1776, 1765, 1751, 1735, // 7144-7151
+	1716, 1695, 1671, 1646, 1618, 1587, 1555, 1521, // 7152-7159
+	1484, 1445, 1405, 1362, 1318, 1272, 1224, 1174, // 7160-7167
+	1123, 1070, 1016, 961, 904, 846, 787, 727, // 7168-7175
+	666, 604, 541, 477, 413, 348, 283, 217, // 7176-7183
+	151, 85, 18, -48, -114, -180, -246, -312, // 7184-7191
+	-377, -442, -505, -569, -631, -692, -753, -812, // 7192-7199
+	-871, -928, -983, -1037, -1090, -1141, -1191, -1238, // 7200-7207
+	-1284, -1328, -1371, -1411, -1449, -1485, -1519, -1551, // 7208-7215
+	-1581, -1608, -1633, -1656, -1677, -1695, -1711, -1724, // 7216-7223
+	-1735, -1743, -1749, -1753, -1754, -1753, -1749, -1743, // 7224-7231
+	-1734, -1723, -1710, -1694, -1676, -1655, -1633, -1608, // 7232-7239
+	-1580, -1551, -1519, -1485, -1449, -1412, -1372, -1330, // 7240-7247
+	-1287, -1242, -1195, -1146, -1096, -1044, -991, -937, // 7248-7255
+	-881, -824, -766, -707, -647, -586, -524, -461, // 7256-7263
+	-398, -335, -270, -206, -141, -76, -11, 54, // 7264-7271
+	120, 185, 249, 314, 378, 441, 504, 566, // 7272-7279
+	627, 687, 747, 805, 862, 918, 973, 1026, // 7280-7287
+	1078, 1128, 1177, 1224, 1269, 1312, 1354, 1393, // 7288-7295
+	1431, 1466, 1500, 1531, 1560, 1587, 1612, 1635, // 7296-7303
+	1655, 1673, 1688, 1702, 1712, 1721, 1727, 1730, // 7304-7311
+	1732, 1730, 1727, 1721, 1712, 1702, 1688, 1673, // 7312-7319
+	1655, 1635, 1613, 1588, 1561, 1532, 1501, 1468, // 7320-7327
+	1433, 1396, 1357, 1316, 1273, 1229, 1183, 1135, // 7328-7335
+	1086, 1036, 983, 930, 875, 820, 763, 704, // 7336-7343
+	646, 586, 525, 464, 402, 339, 276, 213, // 7344-7351
+	149, 85, 21, -43, -107, -171, -235, -298, // 7352-7359
+	-361, -423, -485, -546, -606, -666, -724, -781, // 7360-7367
+	-838, -893, -947, -999, -1050, -1099, -1147, -1193, // 7368-7375
+	-1238, -1280, -1321, -1360, -1397, -1432, -1465, -1496, // 7376-7383
+	-1524, -1551, -1575, -1597, -1616, -1634, -1649, -1661, // 7384-7391
+	-1672, -1680, -1685, -1688, -1689, -1688, -1684, -1677, // 7392-7399
+	-1669, -1658, -1645, -1629, -1611, -1591, -1569, -1544, // 7400-7407
+	-1517, -1489, -1458, -1425, -1390, -1354, -1315, -1275, // 7408-7415
+	-1232, -1189, -1143, -1096, -1048, -998, -946, -894, // 7416-7423
+	-840, -785, -729, -672, -614, -555, -495, -435, // 7424-7431
+	-374, -312, -250, -188, -125, -62, 1, 64, // 7432-7439
+	127, 189, 252, 314, 376, 437, 498, 558, // 7440-7447
+	617, 675, 733, 789, 844, 898, 951, 1003, // 7448-7455
+	1052, 1101, 1148, 1193, 1236, 1278, 1318, 1356, // 7456-7463
+	1392, 1426, 1458, 1488, 1515, 1541, 1564, 1586, // 7464-7471
+	1604, 1621, 1635, 1647, 1657, 1665, 1670, 1672, // 7472-7479
+	1673, 1671, 1666, 1660, 1651, 1640, 1626, 1610, // 7480-7487
+	1592, 1572, 1550, 1525, 1499, 1470, 1439, 1407, // 7488-7495
+	1372, 1336, 1298, 1258, 1216, 1172, 1127, 1081, // 7496-7503
+	1033, 983, 933, 881, 827, 773, 717, 661, // 7504-7511
+	604, 545, 487, 427, 367, 306, 245, 183, // 7512-7519
+	122, 60, -2, -64, -126, -188, -250, -311, // 7520-7527
+	-372, -432, -492, -551, -609, -666, -722, -778, // 7528-7535
+	-832, -885, -937, -987, -1036, -1084, -1130, -1174, // 7536-7543
+	-1217, -1258, -1297, -1334, -1370, -1403, -1434, -1464, // 7544-7551
+	-1491, -1516, -1539, -1560, -1578, -1595, -1609, -1620, // 7552-7559
+	-1630, -1637, -1642, -1645, -1645, -1643, -1639, -1632, // 7560-7567
+	-1623, -1612, -1599, -1583, -1566, -1546, -1524, -1500, // 7568-7575
+	-1474, -1445, -1415, -1383, -1349, -1313, -1276, -1236, // 7576-7583
+	-1195, -1152, -1108, -1062, -1015, -967, -917, -866, // 7584-7591
+	-813, -760, -706, -650, -594, -537, -479, -421, // 7592-7599
+	-362, -302, -242, -182, -121, -61, 0, 61, // 7600-7607
+	121, 182, 242, 302, 361, 420, 479, 536, // 7608-7615
+	593, 649, 704, 758, 811, 863, 914, 963, // 7616-7623
+	1011, 1057, 1102, 1146, 1187, 1227, 1265, 1302, // 7624-7631
+	1336, 1368, 1399, 1428, 1454, 1478, 1501, 1521, // 7632-7639
+	1539, 1555, 1568, 1580, 1589, 1596, 1600, 1603, // 7640-7647
+	1603, 1601, 1596, 1590, 1581, 1570, 1557, 1541, // 7648-7655
+	1524, 1504, 1482, 1458, 1433, 1405, 1375, 1343, // 7656-7663
+	1310, 1275, 1237, 1199, 1158, 1116, 1073, 1028, // 7664-7671
+	981, 934, 885, 835, 783, 731, 677, 623, // 7672-7679
+	568, 512, 455, 398, 340, 282, 223, 164, // 7680-7687
+	105, 46, -14, -73, -133, -192, -251, -309, // 7688-7695
+	-367, -425, -482, -538, -594, -649, -702, -755, // 7696-7703
+	-807, -858, -907, -955, -1002, -1047, -1091, -1133, // 7704-7711
+	-1174, -1213, -1250, -1285, -1319, -1351, -1380, -1408, // 7712-7719
+	-1434, -1458, -1479, -1499, -1516, -1532, -1545, -1556, // 7720-7727
+	-1564, -1571, -1575, -1577, -1577, -1575, -1570, -1564, // 7728-7735
+	-1555, -1544, -1531, -1515, -1498, -1479, -1457, -1434, // 7736-7743
+	-1408, -1381, -1352, -1321, -1288, -1253, -1217, -1179, // 7744-7751
+	-1139, -1098, -1055, -1011, -966, -919, -871, -822, // 7752-7759
+	-771, -720, -668, -614, -560, -505, -450, -394, // 7760-7767
+	-337, -280, -222, -165, -106, -48, 10, 68, // 7768-7775
+	126, 184, 242, 299, 356, 412, 468, 523, // 7776-7783
+	578, 631, 684, 736, 786, 836, 884, 931, // 7784-7791
+	976, 1020, 1063, 1104, 1144, 1182, 1218, 1253, // 7792-7799
+	1285, 1316, 1345, 1372, 1397, 1420, 1441, 1460, // 7800-7807
+	1477, 1492, 1505, 1516, 1524, 1530, 1535, 1537, // 7808-7815
+	1536, 1534, 1530, 1523, 1515, 1504, 1491, 1476, // 7816-7823
+	1459, 1440, 1419, 1396, 1372, 1345, 1316, 1286, // 7824-7831
+	1254, 1220, 1184, 1147, 1108, 1068, 1026, 983, // 7832-7839
+	939, 893, 846, 798, 749, 699, 647, 595, // 7840-7847
+	542, 489, 435, 380, 324, 269, 213, 156, // 7848-7855
+	100, 43, -14, -71, -127, -184, -240, -296, // 7856-7863
+	-351, -406, -460, -514, -567, -619, -670, -720, // 7864-7871
+	-769, -817, -863, -909, -953, -996, -1037, -1077, // 7872-7879
+	-1116, -1152, -1187, -1221, -1252, -1282, -1310, -1336, // 7880-7887
+	-1360, -1382, -1403, -1421, -1437, -1451, -1463, -1473, // 7888-7895
+	-1481, -1487, -1491, -1493, -1492, -1490, -1485, -1479, // 7896-7903
+	-1470, -1459, -1446, -1432, -1415, -1396, -1376, -1353, // 7904-7911
+	-1329, -1302, -1274, -1245, -1213, -1180, -1145, -1109, // 7912-7919
+	-1071, -1032, -991, -949, -905, -861, -815, -768, // 7920-7927
+	-720, -671, -621, -570, -519, -466, -413, -360, // 7928-7935
+	-306, -251, -197, -142, -87, -31, 24, 79, // 7936-7943
+	134, 189, 244, 298, 352, 405, 458, 510, // 7944-7951
+	562, 612, 662, 710, 758, 804, 850, 894, // 7952-7959
+	937, 978, 1018, 1057, 1094, 1129, 1163, 1195, // 7960-7967
+	1226, 1255, 1282, 1307, 1330, 1352, 1371, 1389, // 7968-7975
+	1405, 1418, 1430, 1440, 1448, 1453, 1457, 1458, // 7976-7983
+	1458, 1456, 1451, 1445, 1436, 1426, 1413, 1399, // 7984-7991
+	1383, 1365, 1344, 1322, 1299, 1273, 1246, 1217, // 7992-7999
+	1186, 1154, 1120, 1084, 1047, 1009, 969, 928, // 8000-8007
+	885, 842, 797, 751, 704, 656, 607, 558, // 8008-8015
+	507, 456, 405, 352, 300, 247, 193, 139, // 8016-8023
+	86, 32, -22, -76, -130, -184, -237, -290, // 8024-8031
+	-342, -394, -446, -496, -547, -596, -644, -691, // 8032-8039
+	-738, -783, -827, -871, -912, -953, -992, -1030, // 8040-8047
+	-1066, -1100, -1134, -1165, -1195, -1223, -1250, -1274, // 8048-8055
+	-1297, -1318, -1338, -1355, -1370, -1384, -1395, -1405, // 8056-8063
+	-1413, -1418, -1422, -1424, -1423, -1421, -1417, -1411, // 8064-8071
+	-1403, -1393, -1381, -1367, -1351, -1333, -1314, -1292, // 8072-8079
+	-1269, -1244, -1218, -1189, -1159, -1128, -1095, -1060, // 8080-8087
+	-1024, -987, -948, -908, -867, -824, -781, -736, // 8088-8095
+	-690, -644, -596, -548, -499, -449, -399, -348, // 8096-8103
+	-297, -245, -193, -140, -88, -35, 17, 70, // 8104-8111
+	122, 174, 226, 278, 329, 380, 430, 479, // 8112-8119
+	528, 576, 623, 669, 714, 759, 802, 844, // 8120-8127
+	884, 924, 962, 998, 1034, 1067, 1100, 1130, // 8128-8135
+	1159, 1187, 1213, 1237, 1259, 1280, 1298, 1315, // 8136-8143
+	1330, 1344, 1355, 1364, 1372, 1378, 1381, 1383, // 8144-8151
+	1383, 1381, 1377, 1371, 1363, 1353, 1342, 1328, // 8152-8159
+	1313, 1296, 1277, 1256, 1234, 1210, 1184, 1157, // 8160-8167
+	1128, 1097, 1065, 1032, 997, 960, 923, 884, // 8168-8175
+	844, 803, 760, 717, 673, 627, 581, 534, // 8176-8183
+	487, 438, 389, 340, 290, 240, 190, 139, // 8184-8191
+	88, 37, -14, -65, -116, -166, -217, -267, // 8192-8199
+	-316, -365, -414, -462, -509, -556, -601, -646, // 8200-8207
+	-690, -733, -774, -815, -854, -893, -930, -965, // 8208-8215
+	-999, -1032, -1064, -1093, -1122, -1148, -1173, -1197, // 8216-8223
+	-1218, -1238, -1257, -1273, -1288, -1301, -1312, -1321, // 8224-8231
+	-1328, -1334, -1337, -1339, -1339, -1337, -1333, -1327, // 8232-8239
+	-1320, -1310, -1299, -1286, -1271, -1255, -1236, -1216, // 8240-8247
+	-1194, -1171, -1146, -1119, -1091, -1062, -1030, -998, // 8248-8255
+	-964, -929, -892, -855, -816, -776, -735, -693, // 8256-8263
+	-650, -606, -561, -516, -469, -423, -375, -327, // 8264-8271
+	-279, -231, -182, -133, -83, -34, 15, 65, // 8272-8279
+	114, 163, 212, 260, 308, 355, 402, 449, // 8280-8287
+	494, 539, 583, 627, 669, 710, 751, 790, // 8288-8295
+	828, 865, 901, 935, 968, 1000, 1030, 1059, // 8296-8303
+	1086, 1112, 1136, 1159, 1180, 1199, 1217, 1233, // 8304-8311
+	1247, 1259, 1270, 1278, 1285, 1291, 1294, 1296, // 8312-8319
+	1295, 1293, 1289, 1284, 1276, 1267, 1256, 1243, // 8320-8327
+	1229, 1213, 1195, 1175, 1154, 1131, 1107, 1081, // 8328-8335
+	1053, 1024, 994, 962, 929, 895, 860, 823, // 8336-8343
+	785, 746, 706, 665, 624, 581, 538, 494, // 8344-8351
+	449, 403, 357, 311, 264, 217, 170, 122, // 8352-8359
+	74, 27, -21, -69, -116, -164, -211, -258, // 8360-8367
+	-304, -350, -396, -440, -484, -528, -571, -612, // 8368-8375
+	-653, -693, -732, -770, -807, -843, -877, -910, // 8376-8383
+	-942, -973, -1002, -1030, -1056, -1081, -1105, -1126, // 8384-8391
+	-1147, -1165, -1182, -1197, -1211, -1223, -1233, -1242, // 8392-8399
+	-1248, -1253, -1256, -1258, -1257, -1255, -1251, -1246, // 8400-8407
+	-1238, -1229, -1218, -1206, -1192, -1176, -1158, -1139, // 8408-8415
+	-1118, -1096, -1072, -1047, -1020, -992, -963, -932, // 8416-8423
+	-900, -866, -832, -796, -760, -722, -683, -643, // 8424-8431
+	-603, -561, -519, -476, -433, -389, -344, -299, // 8432-8439
+	-254, -208, -162, -116, -70, -24, 23, 69, // 8440-8447
+	115, 161, 206, 252, 297, 341, 385, 429, // 8448-8455
+	471, 513, 555, 595, 635, 674, 711, 748, // 8456-8463
+	784, 818, 852, 884, 915, 945, 973, 1000, // 8464-8471
+	1025, 1049, 1072, 1093, 1113, 1131, 1147, 1162, // 8472-8479
+	1175, 1186, 1196, 1204, 1211, 1215, 1218, 1220, // 8480-8487
+	1219, 1217, 1213, 1208, 1201, 1192, 1181, 1169, // 8488-8495
+	1155, 1140, 1123, 1105, 1084, 1063, 1040, 1015, // 8496-8503
+	989, 962, 934, 904, 873, 840, 807, 772, // 8504-8511
+	737, 700, 663, 624, 585, 545, 504, 463, // 8512-8519
+	421, 378, 335, 292, 248, 204, 159, 115, // 8520-8527
+	70, 25, -19, -64, -109, -153, -197, -241, // 8528-8535
+	-284, -327, -370, -412, -453, -494, -533, -573, // 8536-8543
+	-611, -648, -685, -720, -755, -788, -820, -851, // 8544-8551
+	-881, -910, -937, -963, -988, -1011, -1033, -1053, // 8552-8559
+	-1072, -1089, -1105, -1119, -1132, -1143, -1153, -1161, // 8560-8567
+	-1167, -1171, -1174, -1176, -1175, -1173, -1169, -1164, // 8568-8575
+	-1157, -1149, -1139, -1127, -1114, -1099, -1082, -1064, // 8576-8583
+	-1045, -1024, -1002, -978, -954, -927, -900, -871, // 8584-8591
+	-841, -810, -778, -744, -710, -675, -639, -602, // 8592-8599
+	-564, -525, -486, -446, -406, -365, -323, -282, // 8600-8607
+	-239, -197, -154, -111, -68, -25, 18, 61, // 8608-8615
+	104, 147, 189, 231, 273, 314, 355, 396, // 8616-8623
+	436, 475, 513, 551, 588, 624, 659, 693, // 8624-8631
+	726, 759, 790, 820, 848, 876, 902, 927, // 8632-8639
+	951, 973, 994, 1014, 1032, 1049, 1064, 1078, // 8640-8647
+	1090, 1101, 1110, 1117, 1123, 1128, 1131, 1132, // 8648-8655
+	1132, 1130, 1126, 1121, 1115, 1106, 1097, 1085, // 8656-8663
+	1073, 1058, 1043, 1025, 1007, 987, 965, 943, // 8664-8671
+	919, 893, 867, 839, 811, 781, 750, 718, // 8672-8679
+	685, 651, 616, 581, 544, 507, 469, 431, // 8680-8687
+	392, 353, 313, 273, 232, 191, 150, 108, // 8688-8695
+	67, 26, -16, -57, -99, -140, -181, -221, // 8696-8703
+	-262, -302, -341, -380, -418, -456, -493, -529, // 8704-8711
+	-565, -600, -634, -667, -699, -730, -760, -789, // 8712-8719
+	-816, -843, -868, -893, -915, -937, -957, -976, // 8720-8727
+	-994, -1010, -1025, -1038, -1050, -1060, -1069, -1076, // 8728-8735
+	-1082, -1086, -1089, -1090, -1090, -1088, -1085, -1080, // 8736-8743
+	-1074, -1066, -1057, -1046, -1034, -1020, -1005, -988, // 8744-8751
+	-970, -951, -931, -909, -886, -862, -836, -809, // 8752-8759
+	-782, -753, -723, -692, -661, -628, -595, -560, // 8760-8767
+	-525, -490, -453, -416, -379, -341, -303, -264, // 8768-8775
+	-225, -185, -146, -106, -66, -26, 14, 54, // 8776-8783
+	94, 133, 173, 212, 251, 289, 327, 365, // 8784-8791
+	402, 438, 474, 509, 543, 577, 609, 641, // 8792-8799
+	672, 702, 731, 758, 785, 811, 835, 858, // 8800-8807
+	881, 901, 921, 939, 956, 971, 986, 998, // 8808-8815
+	1010, 1020, 1028, 1035, 1041, 1045, 1048, 1049, // 8816-8823
+	1049, 1047, 1044, 1039, 1033, 1025, 1016, 1006, // 8824-8831
+	994, 981, 967, 951, 934, 915, 895, 874, // 8832-8839
+	852, 829, 804, 779, 752, 724, 696, 666, // 8840-8847
+	635, 604, 572, 539, 505, 471, 436, 400, // 8848-8855
+	364, 328, 291, 253, 215, 178, 139, 101, // 8856-8863
+	63, 24, -14, -53, -91, -129, -167, -205, // 8864-8871
+	-242, -279, -316, -352, -388, -422, -457, -491, // 8872-8879
+	-523, -556, -587, -618, -647, -676, -704, -730, // 8880-8887
+	-756, -781, -804, -827, -848, -868, -887, -904, // 8888-8895
+	-920, -935, -949, -961, -972, -982, -990, -997, // 8896-8903
+	-1002, -1006, -1009, -1010, -1010, -1008, -1005, -1000, // 8904-8911
+	-994, -987, -979, -969, -957, -945, -931, -915, // 8912-8919
+	-899, -881, -862, -842, -820, -798, -774, -750, // 8920-8927
+	-724, -697, -670, -641, -612, -582, -551, -519, // 8928-8935
+	-487, -454, -420, -386, -351, -316, -280, -245, // 8936-8943
+	-208, -172, -135, -98, -61, -24, 13, 50, // 8944-8951
+	87, 123, 160, 196, 232, 267, 303, 337, // 8952-8959
+	371, 405, 438, 471, 502, 533, 563, 593, // 8960-8967
+	621, 649, 676, 701, 726, 750, 773, 794, // 8968-8975
+	814, 834, 852, 869, 884, 899, 912, 924, // 8976-8983
+	934, 943, 951, 958, 963, 967, 969, 971, // 8984-8991
+	970, 969, 966, 962, 956, 949, 941, 931, // 8992-8999
+	921, 908, 895, 880, 865, 848, 829, 810, // 9000-9007
+	790, 768, 745, 722, 697, 672, 645, 618, // 9008-9015
+	590, 561, 531, 501, 470, 438, 406, 373, // 9016-9023
+	340, 306, 272, 237, 202, 167, 132, 97, // 9024-9031
+	61, 26, -10, -45, -81, -116, -151, -186, // 9032-9039
+	-220, -254, -288, -322, -354, -387, -418, -450, // 9040-9047
+	-480, -510, -539, -567, -595, -621, -647, -672, // 9048-9055
+	-695, -718, -740, -761, -780, -799, -816, -833, // 9056-9063
+	-848, -862, -874, -886, -896, -905, -912, -919, // 9064-9071
+	-924, -928, -930, -931, -931, -930, -927, -923, // 9072-9079
+	-918, -911, -903, -894, -884, -872, -859, -845, // 9080-9087
+	-830, -814, -796, -778, -758, -738, -716, -693, // 9088-9095
+	-670, -645, -620, -594, -567, -539, -511, -481, // 9096-9103
+	-452, -421, -390, -359, -327, -295, -262, -229, // 9104-9111
+	-196, -162, -128, -94, -60, -26, 8, 42, // 9112-9119
+	76, 110, 143, 177, 210, 243, 275, 307, // 9120-9127
+	339, 370, 400, 430, 459, 488, 516, 543, // 9128-9135
+	569, 595, 620, 643, 666, 688, 709, 729, // 9136-9143
+	748, 766, 782, 798, 813, 826, 838, 849, // 9144-9151
+	859, 868, 875, 881, 886, 890, 892, 893, // 9152-9159
+	893, 892, 889, 885, 880, 874, 866, 858, // 9160-9167
+	848, 837, 824, 811, 797, 781, 764, 747, // 9168-9175
+	728, 708, 687, 666, 643, 620, 596, 570, // 9176-9183
+	545, 518, 491, 463, 434, 405, 376, 346, // 9184-9191
+	315, 284, 253, 221, 189, 157, 124, 92, // 9192-9199
+	59, 27, -6, -39, -71, -104, -136, -168, // 9200-9207
+	-199, -231, -262, -293, -323, -353, -382, -411, // 9208-9215
+	-439, -466, -493, -519, -544, -569, -592, -615, // 9216-9223
+	-637, -658, -678, -697, -715, -732, -749, -764, // 9224-9231
+	-778, -790, -802, -813, -822, -830, -838, -843, // 9232-9239
+	-848, -852, -854, -855, -855, -854, -852, -848, // 9240-9247
+	-843, -837, -830, -822, -812, -802, -790, -777, // 9248-9255
+	-764, -749, -733, -716, -698, -679, -659, -639, // 9256-9263
+	-617, -595, -571, -547, -523, -497, -471, -444, // 9264-9271
+	-417, -389, -361, -332, -303, -273, -243, -213, // 9272-9279
+	-182, -151, -120, -89, -58, -27, 4, 36, // 9280-9287
+	67, 98, 129, 159, 190, 220, 249, 279, // 9288-9295
+	308, 336, 364, 392, 418, 445, 470, 495, // 9296-9303
+	520, 543, 566, 587, 609, 629, 648, 666, // 9304-9311
+	684, 700, 715, 730, 743, 756, 767, 777, // 9312-9319
+	786, 794, 801, 807, 811, 815, 817, 818, // 9320-9327
+	818, 817, 815, 811, 807, 801, 794, 786, // 9328-9335
+	777, 767, 756, 744, 731, 716, 701, 685, // 9336-9343
+	668, 650, 631, 611, 590, 569, 547, 524, // 9344-9351
+	500, 476, 451, 425, 399, 373, 345, 318, // 9352-9359
+	290, 261, 233, 204, 174, 145, 115, 86, // 9360-9367
+	56, 26, -4, -34, -64, -93, -123, -152, // 9368-9375
+	-181, -210, -239, -267, -294, -322, -349, -375, // 9376-9383
+	-401, -426, -450, -474, -497, -520, -541, -562, // 9384-9391
+	-582, -602, -620, -638, -654, -670, -685, -699, // 9392-9399
+	-712, -723, -734, -744, -753, -760, -767, -772, // 9400-9407
+	-777, -780, -782, -784, -784, -783, -780, -777, // 9408-9415
+	-773, -768, -761, -754, -745, -735, -725, -713, // 9416-9423
+	-700, -687, -672, -657, -641, -623, -605, -586, // 9424-9431
+	-567, -546, -525, -503, -480, -457, -433, -409, // 9432-9439
+	-384, -358, -332, -306, -279, -252, -225, -197, // 9440-9447
+	-169, -141, -112, -84, -55, -27, 2, 31, // 9448-9455
+	59, 88, 116, 144, 172, 199, 226, 253, // 9456-9463
+	280, 306, 332, 357, 381, 405, 429, 452, // 9464-9471
+	474, 496, 516, 536, 556, 574, 592, 609, // 9472-9479
+	625, 640, 654, 667, 680, 691, 701, 711, // 9480-9487
+	719, 726, 733, 738, 742, 746, 748, 749, // 9488-9495
+	749, 748, 746, 743, 739, 734, 728, 721, // 9496-9503
+	713, 703, 693, 682, 670, 657, 644, 629, // 9504-9511
+	613, 597, 580, 562, 543, 523, 503, 482, // 9512-9519
+	460, 438, 416, 392, 368, 344, 319, 294, // 9520-9527
+	268, 243, 216, 190, 163, 136, 109, 82, // 9528-9535
+	55, 27, 0, -27, -55, -82, -109, -136, // 9536-9543
+	-162, -189, -215, -240, -266, -291, -315, -339, // 9544-9551
+	-363, -386, -408, -430, -452, -472, -492, -511, // 9552-9559
+	-530, -548, -565, -581, -596, -610, -624, -637, // 9560-9567
+	-649, -660, -670, -679, -687, -694, -700, -705, // 9568-9575
+	-709, -712, -715, -716, -716, -715, -713, -710, // 9576-9583
+	-707, -702, -696, -689, -681, -673, -663, -653, // 9584-9591
+	-641, -629, -616, -602, -587, -571, -555, -538, // 9592-9599
+	-520, -501, -482, -462, -441, -420, -399, -376, // 9600-9607
+	-353, -330, -307, -283, -258, -233, -208, -183, // 9608-9615
+	-158, -132, -106, -80, -54, -28, -2, 24, // 9616-9623
+	50, 76, 102, 128, 153, 178, 203, 228, // 9624-9631
+	252, 276, 300, 323, 345, 367, 389, 410, // 9632-9639
+	430, 450, 469, 487, 505, 522, 538, 554, // 9640-9647
+	568, 582, 595, 607, 619, 629, 639, 648, // 9648-9655
+	655, 662, 668, 673, 677, 680, 683, 684, // 9656-9663
+	684, 683, 681, 679, 675, 671, 665, 659, // 9664-9671
+	652, 643, 634, 624, 613, 602, 589, 576, // 9672-9679
+	562, 547, 531, 515, 498, 480, 462, 443, // 9680-9687
+	423, 403, 382, 361, 339, 317, 295, 272, // 9688-9695
+	249, 225, 201, 177, 153, 128, 103, 79, // 9696-9703
+	54, 29, 4, -21, -46, -71, -95, -120, // 9704-9711
+	-144, -168, -192, -215, -239, -261, -284, -306, // 9712-9719
+	-327, -348, -369, -389, -409, -427, -446, -463, // 9720-9727
+	-480, -497, -512, -527, -541, -554, -567, -579, // 9728-9735
+	-590, -600, -609, -617, -625, -631, -637, -642, // 9736-9743
+	-646, -649, -651, -652, -652, -652, -650, -648, // 9744-9751
+	-644, -640, -635, -629, -622, -614, -606, -596, // 9752-9759
+	-586, -575, -563, -550, -537, -523, -508, -493, // 9760-9767
+	-476, -459, -442, -424, -405, -386, -366, -346, // 9768-9775
+	-326, -304, -283, -261, -239, -217, -194, -171, // 9776-9783
+	-148, -124, -101, -77, -53, -29, -6, 18, // 9784-9791
+	42, 65, 89, 112, 135, 158, 181, 204, // 9792-9799
+	226, 248, 269, 290, 311, 331, 350, 370, // 9800-9807
+	388, 406, 424, 441, 457, 472, 487, 501, // 9808-9815
+	515, 528, 540, 551, 561, 571, 580, 588, // 9816-9823
+	595, 602, 607, 612, 616, 619, 621, 622, // 9824-9831
+	622, 622, 620, 618, 615, 611, 606, 600, // 9832-9839
+	594, 587, 578, 570, 560, 549, 538, 526, // 9840-9847
+	513, 500, 486, 471, 456, 440, 423, 406, // 9848-9855
+	388, 370, 351, 332, 312, 292, 272, 251, // 9856-9863
+	230, 209, 187, 165, 143, 121, 98, 76, // 9864-9871
+	53, 30, 8, -15, -38, -60, -83, -105, // 9872-9879
+	-127, -149, -171, -192, -213, -234, -254, -274, // 9880-9887
+	-294, -313, -332, -350, -368, -385, -402, -418, // 9888-9895
+	-434, -449, -463, -476, -489, -502, -513, -524, // 9896-9903
+	-534, -543, -552, -560, -566, -573, -578, -582, // 9904-9911
+	-586, -589, -591, -592, -593, -592, -591, -589, // 9912-9919
+	-586, -582, -578, -573, -566, -560, -552, -543, // 9920-9927
+	-534, -524, -514, -502, -490, -478, -464, -450, // 9928-9935
+	-436, -420, -405, -388, -371, -354, -336, -318, // 9936-9943
+	-299, -280, -261, -241, -221, -201, -180, -159, // 9944-9951
+	-138, -117, -96, -74, -53, -31, -9, 12, // 9952-9959
+	34, 55, 77, 98, 119, 140, 160, 181, // 9960-9967
+	201, 221, 240, 259, 278, 297, 315, 332, // 9968-9975
+	349, 365, 381, 397, 412, 426, 440, 453, // 9976-9983
+	465, 477, 488, 498, 508, 517, 525, 532, // 9984-9991
+	539, 545, 550, 554, 558, 561, 563, 564, // 9992-9999
+	565, 564, 563, 561, 559, 555, 551, 546, // 10000-10007
+	540, 534, 526, 518, 510, 500, 490, 479, // 10008-10015
+	468, 456, 443, 430, 416, 402, 387, 371, // 10016-10023
+	355, 339, 322, 305, 287, 269, 250, 232, // 10024-10031
+	212, 193, 173, 154, 134, 113, 93, 73, // 10032-10039
+	52, 32, 11, -10, -30, -50, -71, -91, // 10040-10047
+	-111, -131, -151, -170, -189, -208, -227, -245, // 10048-10055
+	-263, -281, -298, -315, -331, -347, -362, -376, // 10056-10063
+	-391, -404, -417, -430, -442, -453, -463, -473, // 10064-10071
+	-483, -491, -499, -506, -513, -518, -523, -528, // 10072-10079
+	-531, -534, -536, -537, -538, -537, -536, -535, // 10080-10087
+	-532, -529, -525, -520, -515, -509, -502, -494, // 10088-10095
+	-486, -477, -468, -458, -447, -436, -424, -411, // 10096-10103
+	-398, -384, -370, -355, -340, -325, -308, -292, // 10104-10111
+	-275, -258, -240, -223, -204, -186, -167, -148, // 10112-10119
+	-129, -110, -91, -71, -52, -32, -13, 7, // 10120-10127
+	26, 46, 65, 85, 104, 123, 141, 160, // 10128-10135
+	178, 196, 214, 232, 249, 265, 282, 298, // 10136-10143
+	313, 328, 343, 357, 370, 383, 396, 408, // 10144-10151
+	419, 430, 440, 449, 458, 466, 474, 481, // 10152-10159
+	487, 493, 497, 502, 505, 508, 510, 511, // 10160-10167
+	512, 511, 511, 509, 507, 504, 500, 496, // 10168-10175
+	491, 485, 478, 471, 464, 455, 446, 437, // 10176-10183
+	426, 416, 404, 392, 380, 367, 354, 340, // 10184-10191
+	325, 310, 295, 280, 264, 247, 231, 214, // 10192-10199
+	196, 179, 161, 143, 125, 107, 89, 70, // 10200-10207
+	51, 33, 14, -4, -23, -42, -60, -78, // 10208-10215
+	-97, -115, -133, -150, -168, -185, -202, -218, // 10216-10223
+	-235, -251, -266, -281, -296, -311, -324, -338, // 10224-10231
+	-351, -363, -375, -387, -397, -408, -417, -426, // 10232-10239
+	-435, -443, -450, -457, -463, -468, -473, -477, // 10240-10247
+	-480, -483, -485, -486, -486, -486, -486, -484, // 10248-10255
+	-482, -479, -476, -472, -467, -462, -456, -449, // 10256-10263
+	-442, -434, -425, -416, -407, -397, -386, -375, // 10264-10271
+	-363, -351, -338, -325, -311, -297, -282, -268, // 10272-10279
+	-253, -237, -221, -205, -189, -172, -155, -138, // 10280-10287
+	-121, -104, -86, -69, -51, -33, -16, 2, // 10288-10295
+	20, 37, 55, 72, 90, 107, 124, 141, // 10296-10303
+	158, 174, 190, 206, 221, 237, 251, 266, // 10304-10311
+	280, 294, 307, 320, 332, 344, 355, 366, // 10312-10319
+	377, 387, 396, 405, 413, 420, 427, 434, // 10320-10327
+	439, 444, 449, 453, 456, 459, 461, 462, // 10328-10335
+	463, 463, 462, 461, 459, 456, 453, 449, // 10336-10343
+	445, 440, 434, 428, 421, 414, 406, 397, // 10344-10351
+	388, 378, 368, 357, 346, 335, 323, 310, // 10352-10359
+	297, 284, 270, 256, 242, 227, 212, 197, // 10360-10367
+	181, 166, 150, 133, 117, 101, 84, 67, // 10368-10375
+	51, 34, 17, 0, -17, -33, -50, -67, // 10376-10383
+	-83, -100, -116, -132, -148, -163, -179, -194, // 10384-10391
+	-209, -223, -237, -251, -264, -278, -290, -302, // 10392-10399
+	-314, -326, -336, -347, -357, -366, -375, -383, // 10400-10407
+	-391, -398, -405, -411, -417, -422, -426, -430, // 10408-10415
+	-433, -436, -437, -439, -440, -440, -439, -438, // 10416-10423
+	-436, -434, -431, -427, -423, -419, -413, -407, // 10424-10431
+	-401, -394, -386, -378, -370, -361, -351, -341, // 10432-10439
+	-331, -320, -308, -296, -284, -272, -259, -245, // 10440-10447
+	-232, -218, -203, -189, -174, -159, -144, -129, // 10448-10455
+	-113, -98, -82, -66, -50, -34, -18, -2, // 10456-10463
+	14, 30, 46, 61, 77, 93, 108, 123, // 10464-10471
+	138, 153, 168, 182, 196, 210, 224, 237, // 10472-10479
+	250, 262, 274, 286, 297, 308, 318, 328, // 10480-10487
+	338, 347, 355, 363, 371, 378, 384, 390, // 10488-10495
+	395, 400, 404, 408, 411, 414, 415, 417, // 10496-10503
+	418, 418, 417, 416, 415, 413, 410, 407, // 10504-10511
+	403, 398, 393, 388, 382, 375, 368, 361, // 10512-10519
+	352, 344, 335, 325, 315, 305, 294, 283, // 10520-10527
+	272, 260, 247, 235, 222, 209, 195, 181, // 10528-10535
+	168, 153, 139, 124, 110, 95, 80, 65, // 10536-10543
+	50, 35, 19, 4, -11, -26, -41, -56, // 10544-10551
+	-71, -86, -101, -115, -129, -144, -157, -171, // 10552-10559
+	-185, -198, -211, -223, -235, -247, -259, -270, // 10560-10567
+	-281, -291, -301, -310, -320, -328, -336, -344, // 10568-10575
+	-351, -358, -364, -370, -375, -379, -383, -387, // 10576-10583
+	-390, -392, -394, -396, -396, -397, -396, -395, // 10584-10591
+	-394, -392, -390, -387, -383, -379, -374, -369, // 10592-10599
+	-363, -357, -351, -343, -336, -328, -319, -310, // 10600-10607
+	-301, -291, -281, -270, -259, -248, -237, -225, // 10608-10615
+	-212, -200, -187, -174, -161, -148, -134, -120, // 10616-10623
+	-106, -92, -78, -64, -49, -35, -21, -6, // 10624-10631
+	8, 23, 37, 51, 65, 80, 93, 107, // 10632-10639
+	121, 134, 148, 161, 173, 186, 198, 210, // 10640-10647
+	222, 233, 244, 255, 265, 275, 284, 293, // 10648-10655
+	302, 310, 318, 325, 332, 339, 345, 350, // 10656-10663
+	355, 360, 363, 367, 370, 372, 374, 375, // 10664-10671
+	376, 377, 376, 376, 374, 373, 370, 367, // 10672-10679
+	364, 360, 356, 351, 346, 340, 334, 327, // 10680-10687
+	320, 312, 304, 296, 287, 278, 268, 258, // 10688-10695
+	248, 237, 226, 215, 203, 192, 180, 167, // 10696-10703
+	155, 142, 129, 116, 103, 90, 76, 63, // 10704-10711
+	49, 35, 22, 8, -6, -19, -33, -47, // 10712-10719
+	-60, -73, -87, -100, -113, -126, -138, -151, // 10720-10727
+	-163, -175, -186, -198, -209, -220, -230, -240, // 10728-10735
+	-250, -259, -269, -277, -286, -293, -301, -308, // 10736-10743
+	-314, -321, -326, -332, -336, -341, -344, -348, // 10744-10751
+	-351, -353, -355, -356, -357, -357, -357, -357, // 10752-10759
+	-355, -354, -352, -349, -346, -342, -338, -334, // 10760-10767
+	-329, -324, -318, -311, -305, -297, -290, -282, // 10768-10775
+	-274, -265, -256, -246, -237, -227, -216, -206, // 10776-10783
+	-195, -184, -172, -161, -149, -137, -124, -112, // 10784-10791
+	-100, -87, -74, -61, -48, -36, -23, -10, // 10792-10799
+	3, 16, 29, 42, 55, 68, 80, 93, // 10800-10807
+	105, 117, 129, 141, 153, 164, 175, 186, // 10808-10815
+	197, 207, 217, 226, 236, 245, 253, 262, // 10816-10823
+	270, 277, 284, 291, 297, 303, 309, 314, // 10824-10831
+	318, 323, 326, 329, 332, 335, 336, 338, // 10832-10839
+	339, 339, 339, 338, 337, 336, 334, 332, // 10840-10847
+	329, 325, 322, 318, 313, 308, 302, 296, // 10848-10855
+	290, 283, 276, 269, 261, 253, 244, 235, // 10856-10863
+	226, 217, 207, 197, 186, 176, 165, 154, // 10864-10871
+	143, 132, 120, 108, 96, 84, 72, 60, // 10872-10879
+	48, 36, 23, 11, -1, -14, -26, -38, // 10880-10887
+	-50, -62, -74, -86, -98, -109, -121, -132, // 10888-10895
+	-143, -154, -164, -175, -185, -195, -204, -213, // 10896-10903
+	-222, -231, -239, -247, -255, -262, -269, -275, // 10904-10911
+	-281, -287, -292, -297, -301, -305, -309, -312, // 10912-10919
+	-315, -317, -319, -320, -321, -322, -322, -321, // 10920-10927
+	-320, -319, -317, -315, -312, -309, -306, -302, // 10928-10935
+	-298, -293, -288, -282, -276, -270, -263, -256, // 10936-10943
+	-249, -241, -233, -225, -216, -207, -198, -188, // 10944-10951
+	-178, -169, -158, -148, -137, -126, -116, -104, // 10952-10959
+	-93, -82, -70, -59, -47, -36, -24, -12, // 10960-10967
+	-1, 11, 23, 34, 46, 57, 69, 80, // 10968-10975
+	91, 102, 113, 124, 134, 144, 154, 164, // 10976-10983
+	174, 183, 192, 201, 210, 218, 226, 233, // 10984-10991
+	240, 247, 254, 260, 266, 271, 276, 281, // 10992-10999
+	285, 289, 293, 296, 298, 300, 302, 304, // 11000-11007
+	305, 305, 305, 305, 304, 303, 301, 299, // 11008-11015
+	297, 294, 291, 287, 283, 278, 274, 268, // 11016-11023
+	263, 257, 251, 244, 237, 230, 222, 214, // 11024-11031
+	206, 198, 189, 180, 171, 162, 152, 142, // 11032-11039
+	132, 122, 112, 101, 91, 80, 69, 58, // 11040-11047
+	48, 37, 26, 15, 4, -7, -18, -29, // 11048-11055
+	-40, -51, -61, -72, -83, -93, -103, -113, // 11056-11063
+	-123, -133, -142, -151, -160, -169, -178, -186, // 11064-11071
+	-194, -202, -209, -216, -223, -230, -236, -242, // 11072-11079
+	-247, -252, -257, -262, -266, -269, -273, -276, // 11080-11087
+	-278, -280, -282, -283, -284, -285, -285, -285, // 11088-11095
+	-284, -283, -282, -280, -278, -275, -272, -269, // 11096-11103
+	-265, -261, -257, -252, -247, -241, -235, -229, // 11104-11111
+	-223, -216, -209, -202, -194, -186, -178, -170, // 11112-11119
+	-161, -152, -143, -134, -125, -115, -106, -96, // 11120-11127
+	-86, -76, -66, -56, -46, -35, -25, -15, // 11128-11135
+	-4, 6, 17, 27, 37, 47, 57, 67, // 11136-11143
+	77, 87, 97, 106, 116, 125, 134, 143, // 11144-11151
+	151, 160, 168, 176, 183, 191, 198, 204, // 11152-11159
+	211, 217, 223, 229, 234, 239, 243, 248, // 11160-11167
+	252, 255, 258, 261, 264, 266, 267, 269, // 11168-11175
+	270, 270, 270, 270, 270, 269, 268, 266, // 11176-11183
+	264, 261, 259, 256, 252, 248, 244, 240, // 11184-11191
+	235, 230, 224, 218, 212, 206, 199, 192, // 11192-11199
+	185, 178, 170, 162, 154, 146, 137, 129, // 11200-11207
+	120, 111, 102, 93, 83, 74, 64, 54, // 11208-11215
+	45, 35, 25, 15, 6, -4, -14, -24, // 11216-11223
+	-34, -43, -53, -62, -72, -81, -90, -99, // 11224-11231
+	-108, -117, -126, -134, -142, -150, -158, -165, // 11232-11239
+	-173, -180, -186, -193, -199, -205, -211, -216, // 11240-11247
+	-221, -226, -230, -234, -238, -241, -244, -247, // 11248-11255
+	-250, -252, -253, -255, -256, -256, -256, -256, // 11256-11263
+	-256, -255, -254, -252, -250, -248, -246, -243, // 11264-11271
+	-240, -236, -232, -228, -223, -219, -213, -208, // 11272-11279
+	-202, -196, -190, -184, -177, -170, -163, -155, // 11280-11287
+	-148, -140, -132, -123, -115, -107, -98, -89, // 11288-11295
+	-80, -71, -62, -53, -44, -35, -25, -16, // 11296-11303
+	-7, 3, 12, 21, 30, 40, 49, 58, // 11304-11311
+	67, 75, 84, 93, 101, 110, 118, 126, // 11312-11319
+	133, 141, 148, 156, 162, 169, 176, 182, // 11320-11327
+	188, 193, 199, 204, 209, 213, 218, 221, // 11328-11335
+	225, 228, 231, 234, 236, 238, 240, 241, // 11336-11343
+	242, 243, 243, 243, 243, 242, 241, 239, // 11344-11351
+	238, 236, 233, 231, 228, 224, 221, 217, // 11352-11359
+	212, 208, 203, 198, 193, 187, 181, 175, // 11360-11367
+	169, 162, 155, 148, 141, 134, 126, 118, // 11368-11375
+	110, 102, 94, 86, 77, 69, 60, 52, // 11376-11383
+	43, 34, 25, 17, 8, -1, -10, -19, // 11384-11391
+	-27, -36, -45, -53, -62, -70, -79, -87, // 11392-11399
+	-95, -103, -110, -118, -125, -133, -140, -146, // 11400-11407
+	-153, -159, -166, -171, -177, -183, -188, -193, // 11408-11415
+	-197, -202, -206, -209, -213, -216, -219, -221, // 11416-11423
+	-224, -226, -227, -228, -229, -230, -230, -230, // 11424-11431
+	-230, -229, -228, -227, -226, -224, -221, -219, // 11432-11439
+	-216, -213, -210, -206, -202, -198, -193, -188, // 11440-11447
+	-183, -178, -172, -167, -161, -154, -148, -141, // 11448-11455
+	-135, -128, -121, -113, -106, -98, -90, -83, // 11456-11463
+	-75, -67, -58, -50, -42, -34, -25, -17, // 11464-11471
+	-9, 0, 8, 16, 25, 33, 41, 49, // 11472-11479
+	57, 65, 73, 81, 89, 96, 104, 111, // 11480-11487
+	118, 125, 131, 138, 144, 150, 156, 162, // 11488-11495
+	167, 172, 177, 182, 186, 190, 194, 198, // 11496-11503
+	201, 204, 207, 209, 212, 213, 215, 216, // 11504-11511
+	217, 218, 218, 218, 218, 218, 217, 215, // 11512-11519
+	214, 212, 210, 208, 205, 202, 199, 196, // 11520-11527
+	192, 188, 184, 179, 174, 169, 164, 159, // 11528-11535
+	153, 147, 141, 135, 129, 122, 115, 108, // 11536-11543
+	101, 94, 87, 79, 72, 64, 57, 49, // 11544-11551
+	41, 33, 25, 17, 9, 1, -7, -14, // 11552-11559
+	-22, -30, -38, -46, -53, -61, -68, -76, // 11560-11567
+	-83, -90, -97, -104, -111, -117, -124, -130, // 11568-11575
+	-136, -142, -147, -152, -158, -163, -167, -172, // 11576-11583
+	-176, -180, -184, -187, -190, -193, -196, -198, // 11584-11591
+	-200, -202, -204, -205, -206, -206, -207, -207, // 11592-11599
+	-207, -206, -205, -204, -203, -201, -200, -197, // 11600-11607
+	-195, -192, -189, -186, -182, -179, -175, -170, // 11608-11615
+	-166, -161, -156, -151, -146, -140, -135, -129, // 11616-11623
+	-123, -116, -110, -104, -97, -90, -83, -76, // 11624-11631
+	-69, -62, -55, -47, -40, -32, -25, -17, // 11632-11639
+	-10, -2, 5, 13, 20, 28, 35, 42, // 11640-11647
+	50, 57, 64, 71, 78, 84, 91, 98, // 11648-11655
+	104, 110, 116, 122, 128, 133, 139, 144, // 11656-11663
+	149, 153, 158, 162, 166, 170, 174, 177, // 11664-11671
+	180, 183, 185, 188, 190, 191, 193, 194, // 11672-11679
+	195, 196, 196, 196, 196, 196, 195, 194, // 11680-11687
+	193, 191, 189, 187, 185, 183, 180, 177, // 11688-11695
+	173, 170, 166, 162, 158, 154, 149, 144, // 11696-11703
+	139, 134, 128, 123, 117, 111, 105, 99, // 11704-11711
+	93, 86, 80, 73, 66, 60, 53, 46, // 11712-11719
+	39, 32, 25, 18, 10, 3, -4, -11, // 11720-11727
+	-18, -25, -32, -39, -46, -53, -59, -66, // 11728-11735
+	-73, -79, -85, -92, -98, -103, -109, -115, // 11736-11743
+	-120, -126, -131, -135, -140, -145, -149, -153, // 11744-11751
+	-157, -161, -164, -167, -170, -173, -175, -177, // 11752-11759
+	-179, -181, -182, -184, -185, -185, -186, -186, // 11760-11767
+	-186, -185, -185, -184, -183, -181, -180, -178, // 11768-11775
+	-176, -173, -171, -168, -165, -161, -158, -154, // 11776-11783
+	-150, -146, -142, -137, -132, -127, -122, -117, // 11784-11791
+	-112, -106, -100, -95, -89, -83, -76, -70, // 11792-11799
+	-64, -57, -51, -44, -38, -31, -24, -18, // 11800-11807
+	-11, -4, 3, 9, 16, 23, 29, 36, // 11808-11815
+	43, 49, 55, 62, 68, 74, 80, 86, // 11816-11823
+	92, 97, 103, 108, 113, 118, 123, 128, // 11824-11831
+	132, 137, 141, 145, 148, 152, 155, 158, // 11832-11839
+	161, 163, 166, 168, 170, 171, 173, 174, // 11840-11847
+	175, 176, 176, 176, 176, 176, 175, 174, // 11848-11855
+	173, 172, 171, 169, 167, 165, 162, 159, // 11856-11863
+	157, 153, 150, 147, 143, 139, 135, 131, // 11864-11871
+	126, 122, 117, 112, 107, 101, 96, 91, // 11872-11879
+	85, 79, 73, 67, 61, 55, 49, 43, // 11880-11887
+	37, 30, 24, 18, 11, 5, -2, -8, // 11888-11895
+	-14, -21, -27, -33, -40, -46, -52, -58, // 11896-11903
+	-64, -70, -75, -81, -86, -92, -97, -102, // 11904-11911
+	-107, -112, -116, -121, -125, -129, -133, -137, // 11912-11919
+	-140, -143, -147, -149, -152, -155, -157, -159, // 11920-11927
+	-161, -162, -164, -165, -166, -166, -167, -167, // 11928-11935
+	-167, -167, -166, -165, -165, -163, -162, -160, // 11936-11943
+	-158, -156, -154, -152, -149, -146, -143, -140, // 11944-11951
+	-136, -132, -128, -124, -120, -116, -111, -107, // 11952-11959
+	-102, -97, -92, -87, -81, -76, -70, -65, // 11960-11967
+	-59, -53, -47, -41, -36, -30, -23, -17, // 11968-11975
+	-11, -5, 1, 7, 13, 19, 25, 31, // 11976-11983
+	37, 43, 48, 54, 60, 65, 71, 76, // 11984-11991
+	81, 86, 91, 96, 101, 105, 110, 114, // 11992-11999
+	118, 122, 126, 129, 133, 136, 139, 142, // 12000-12007
+	144, 147, 149, 151, 152, 154, 155, 156, // 12008-12015
+	157, 158, 158, 159, 159, 158, 158, 157, // 12016-12023
+	156, 155, 154, 152, 151, 149, 147, 144, // 12024-12031
+	142, 139, 136, 133, 130, 126, 123, 119, // 12032-12039
+	115, 111, 106, 102, 97, 93, 88, 83, // 12040-12047
+	78, 73, 68, 62, 57, 51, 46, 40, // 12048-12055
+	35, 29, 23, 17, 12, 6, 0, -6, // 12056-12063
+	-11, -17, -23, -28, -34, -40, -45, -50, // 12064-12071
+	-56, -61, -66, -71, -76, -81, -86, -90, // 12072-12079
+	-95, -99, -103, -107, -111, -115, -119, -122, // 12080-12087
+	-125, -128, -131, -134, -136, -139, -141, -143, // 12088-12095
+	-144, -146, -147, -148, -149, -150, -150, -150, // 12096-12103
+	-150, -150, -150, -149, -148, -147, -146, -145, // 12104-12111
+	-143, -141, -139, -137, -135, -132, -129, -126, // 12112-12119
+	-123, -120, -117, -113, -109, -105, -101, -97, // 12120-12127
+	-93, -88, -84, -79, -74, -70, -65, -60, // 12128-12135
+	-55, -49, -44, -39, -33, -28, -23, -17, // 12136-12143
+	-12, -6, -1, 5, 10, 15, 21, 26, // 12144-12151
+	32, 37, 42, 47, 52, 57, 62, 67, // 12152-12159
+	72, 76, 81, 85, 89, 94, 98, 101, // 12160-12167
+	105, 109, 112, 115, 118, 121, 124, 127, // 12168-12175
+	129, 131, 133, 135, 137, 138, 139, 140, // 12176-12183
+	141, 142, 142, 142, 143, 142, 142, 141, // 12184-12191
+	141, 140, 139, 137, 136, 134, 132, 130, // 12192-12199
+	128, 126, 123, 120, 117, 114, 111, 108, // 12200-12207
+	104, 100, 97, 93, 89, 84, 80, 76, // 12208-12215
+	71, 67, 62, 57, 52, 47, 43, 38, // 12216-12223
+	32, 27, 22, 17, 12, 7, 2, -4, // 12224-12231
+	-9, -14, -19, -24, -29, -34, -39, -44, // 12232-12239
+	-49, -54, -58, -63, -67, -72, -76, -80, // 12240-12247
+	-84, -88, -92, -96, -99, -103, -106, -109, // 12248-12255
+	-112, -115, -117, -120, -122, -124, -126, -128, // 12256-12263
+	-129, -131, -132, -133, -134, -134, -135, -135, // 12264-12271
+	-135, -135, -135, -134, -134, -133, -132, -130, // 12272-12279
+	-129, -127, -126, -124, -122, -119, -117, -114, // 12280-12287
+	-112, -109, -106, -103, -99, -96, -92, -88, // 12288-12295
+	-85, -81, -77, -72, -68, -64, -59, -55, // 12296-12303
+	-50, -46, -41, -36, -31, -27, -22, -17, // 12304-12311
+	-12, -7, -2, 3, 8, 12, 17, 22, // 12312-12319
+	27, 32, 36, 41, 46, 50, 55, 59, // 12320-12327
+	63, 67, 71, 75, 79, 83, 87, 90, // 12328-12335
+	93, 97, 100, 103, 106, 108, 111, 113, // 12336-12343
+	115, 117, 119, 121, 122, 124, 125, 126, // 12344-12351
+	127, 127, 128, 128, 128, 128, 128, 128, // 12352-12359
+	127, 126, 125, 124, 123, 121, 120, 118, // 12360-12367
+	116, 114, 111, 109, 106, 104, 101, 98, // 12368-12375
+	95, 92, 88, 85, 81, 77, 73, 70, // 12376-12383
+	66, 61, 57, 53, 49, 44, 40, 35, // 12384-12391
+	31, 26, 22, 17, 12, 8, 3, -2, // 12392-12399
+	-6, -11, -16, -20, -25, -29, -34, -38, // 12400-12407
+	-42, -47, -51, -55, -59, -63, -67, -71, // 12408-12415
+	-75, -78, -82, -85, -88, -91, -94, -97, // 12416-12423
+	-100, -102, -105, -107, -109, -111, -113, -114, // 12424-12431
+	-116, -117, -118, -119, -120, -121, -121, -121, // 12432-12439
+	-122, -122, -121, -121, -120, -120, -119, -118, // 12440-12447
+	-117, -115, -114, -112, -110, -108, -106, -104, // 12448-12455
+	-101, -99, -96, -93, -90, -87, -84, -81, // 12456-12463
+	-77, -74, -70, -66, -63, -59, -55, -51, // 12464-12471
+	-47, -43, -38, -34, -30, -26, -21, -17, // 12472-12479
+	-12, -8, -4, 1, 5, 10, 14, 18, // 12480-12487
+	23, 27, 31, 35, 40, 44, 48, 52, // 12488-12495
+	55, 59, 63, 67, 70, 73, 77, 80, // 12496-12503
+	83, 86, 89, 91, 94, 96, 99, 101, // 12504-12511
+	103, 105, 107, 108, 109, 111, 112, 113, // 12512-12519
+	114, 114, 115, 115, 115, 115, 115, 115, // 12520-12527
+	114, 113, 113, 112, 111, 109, 108, 106, // 12528-12535
+	105, 103, 101, 99, 96, 94, 91, 89, // 12536-12543
+	86, 83, 80, 77, 74, 70, 67, 63, // 12544-12551
+	60, 56, 52, 49, 45, 41, 37, 33, // 12552-12559
+	29, 25, 21, 16, 12, 8, 4, 0, // 12560-12567
+	-4, -9, -13, -17, -21, -25, -29, -33, // 12568-12575
+	-37, -41, -45, -48, -52, -56, -59, -63, // 12576-12583
+	-66, -69, -72, -75, -78, -81, -84, -86, // 12584-12591
+	-89, -91, -93, -95, -97, -99, -101, -102, // 12592-12599
+	-104, -105, -106, -107, -108, -108, -109, -109, // 12600-12607
+	-109, -109, -109, -109, -108, -108, -107, -106, // 12608-12615
+	-105, -104, -103, -101, -99, -98, -96, -94, // 12616-12623
+	-92, -89, -87, -85, -82, -79, -76, -73, // 12624-12631
+	-70, -67, -64, -61, -57, -54, -50, -47, // 12632-12639
+	-43, -39, -36, -32, -28, -24, -20, -16, // 12640-12647
+	-12, -8, -4, 0, 4, 7, 11, 15, // 12648-12655
+	19, 23, 27, 31, 34, 38, 42, 45, // 12656-12663
+	49, 52, 56, 59, 62, 65, 68, 71, // 12664-12671
+	74, 76, 79, 81, 84, 86, 88, 90, // 12672-12679
+	92, 94, 95, 97, 98, 99, 100, 101, // 12680-12687
+	102, 102, 103, 103, 103, 103, 103, 103, // 12688-12695
+	103, 102, 101, 101, 100, 99, 97, 96, // 12696-12703
+	94, 93, 91, 89, 87, 85, 83, 80, // 12704-12711
+	78, 75, 73, 70, 67, 64, 61, 58, // 12712-12719
+	55, 52, 48, 45, 41, 38, 34, 31, // 12720-12727
+	27, 23, 20, 16, 12, 8, 5, 1, // 12728-12735
+	-3, -7, -10, -14, -18, -21, -25, -29, // 12736-12743
+	-32, -36, -39, -42, -46, -49, -52, -55, // 12744-12751
+	-58, -61, -64, -67, -69, -72, -74, -77, // 12752-12759
+	-79, -81, -83, -85, -87, -88, -90, -91, // 12760-12767
+	-93, -94, -95, -96, -96, -97, -97, -98, // 12768-12775
+	-98, -98, -98, -98, -97, -97, -96, -95, // 12776-12783
+	-95, -93, -92, -91, -90, -88, -86, -85, // 12784-12791
+	-83, -81, -79, -76, -74, -72, -69, -67, // 12792-12799
+	-64, -61, -58, -55, -52, -49, -46, -43, // 12800-12807
+	-40, -36, -33, -30, -26, -23, -19, -16, // 12808-12815
+	-12, -8, -5, -1, 2, 6, 9, 13, // 12816-12823
+	16, 20, 23, 27, 30, 33, 37, 40, // 12824-12831
+	43, 46, 49, 52, 55, 58, 60, 63, // 12832-12839
+	65, 68, 70, 72, 75, 77, 79, 80, // 12840-12847
+	82, 84, 85, 86, 88, 89, 90, 91, // 12848-12855
+	91, 92, 92, 93, 93, 93, 93, 93, // 12856-12863
+	92, 92, 91, 91, 90, 89, 88, 86, // 12864-12871
+	85, 84, 82, 80, 79, 77, 75, 73, // 12872-12879
+	71, 68, 66, 63, 61, 58, 56, 53, // 12880-12887
+	50, 47, 44, 41, 38, 35, 32, 28, // 12888-12895
+	25, 22, 19, 15, 12, 8, 5, 2, // 12896-12903
+	-2, -5, -8, -12, -15, -18, -22, -25, // 12904-12911
+	-28, -31, -34, -37, -40, -43, -46, -49, // 12912-12919
+	-52, -54, -57, -59, -62, -64, -66, -68, // 12920-12927
+	-70, -72, -74, -76, -78, -79, -80, -82, // 12928-12935
+	-83, -84, -85, -86, -86, -87, -87, -88, // 12936-12943
+	-88, -88, -88, -88, -87, -87, -87, -86, // 12944-12951
+	-85, -84, -83, -82, -81, -80, -78, -77, // 12952-12959
+	-75, -73, -71, -69, -67, -65, -63, -61, // 12960-12967
+	-58, -56, -53, -50, -48, -45, -42, -39, // 12968-12975
+	-36, -33, -30, -27, -24, -21, -18, -15, // 12976-12983
+	-12, -9, -5, -2, 1, 4, 7, 11, // 12984-12991
+	14, 17, 20, 23, 26, 29, 32, 35, // 12992-12999
+	38, 41, 43, 46, 49, 51, 54, 56, // 13000-13007
+	58, 60, 63, 65, 67, 68, 70, 72, // 13008-13015
+	73, 75, 76, 77, 79, 80, 80, 81, // 13016-13023
+	82, 82, 83, 83, 83, 84, 84, 83, // 13024-13031
+	83, 83, 82, 82, 81, 80, 79, 78, // 13032-13039
+	77, 76, 74, 73, 71, 70, 68, 66, // 13040-13047
+	64, 62, 60, 58, 56, 53, 51, 48, // 13048-13055
+	46, 43, 40, 38, 35, 32, 29, 26, // 13056-13063
+	24, 21, 18, 15, 12, 9, 6, 2, // 13064-13071
+	-1, -4, -7, -10, -13, -16, -19, -21, // 13072-13079
+	-24, -27, -30, -33, -35, -38, -41, -43, // 13080-13087
+	-46, -48, -50, -53, -55, -57, -59, -61, // 13088-13095
+	-63, -65, -66, -68, -69, -71, -72, -73, // 13096-13103
+	-74, -75, -76, -77, -78, -78, -79, -79, // 13104-13111
+	-79, -79, -79, -79, -79, -78, -78, -77, // 13112-13119
+	-77, -76, -75, -74, -73, -72, -71, -69, // 13120-13127
+	-68, -66, -65, -63, -61, -59, -57, -55, // 13128-13135
+	-53, -51, -48, -46, -44, -41, -39, -36, // 13136-13143
+	-34, -31, -28, -25, -23, -20, -17, -14, // 13144-13151
+	-11, -9, -6, -3, 0, 3, 6, 9, // 13152-13159
+	11, 14, 17, 20, 23, 25, 28, 31, // 13160-13167
+	33, 36, 38, 41, 43, 45, 47, 50, // 13168-13175
+	52, 54, 56, 57, 59, 61, 63, 64, // 13176-13183
+	65, 67, 68, 69, 70, 71, 72, 73, // 13184-13191
+	73, 74, 74, 75, 75, 75, 75, 75, // 13192-13199
+	75, 74, 74, 73, 73, 72, 71, 70, // 13200-13207
+	69, 68, 67, 66, 64, 63, 61, 60, // 13208-13215
+	58, 56, 54, 52, 50, 48, 46, 44, // 13216-13223
+	42, 39, 37, 34, 32, 29, 27, 24, // 13224-13231
+	22, 19, 16, 14, 11, 8, 6, 3, // 13232-13239
+	0, -3, -5, -8, -11, -13, -16, -19, // 13240-13247
+	-21, -24, -26, -29, -31, -34, -36, -38, // 13248-13255
+	-41, -43, -45, -47, -49, -51, -53, -55, // 13256-13263
+	-56, -58, -59, -61, -62, -63, -65, -66, // 13264-13271
+	-67, -68, -68, -69, -70, -70, -71, -71, // 13272-13279
+	-71, -71, -71, -71, -71, -71, -70, -70, // 13280-13287
+	-69, -69, -68, -67, -66, -65, -64, -63, // 13288-13295
+	-61, -60, -58, -57, -55, -54, -52, -50, // 13296-13303
+	-48, -46, -44, -42, -40, -38, -35, -33, // 13304-13311
+	-31, -28, -26, -23, -21, -18, -16, -13, // 13312-13319
+	-11, -8, -6, -3, 0, 2, 5, 7, // 13320-13327
+	10, 12, 15, 17, 20, 22, 25, 27, // 13328-13335
+	29, 32, 34, 36, 38, 40, 42, 44, // 13336-13343
+	46, 48, 50, 51, 53, 55, 56, 57, // 13344-13351
+	59, 60, 61, 62, 63, 64, 65, 65, // 13352-13359
+	66, 66, 67, 67, 67, 67, 67, 67, // 13360-13367
+	67, 67, 67, 66, 66, 65, 64, 63, // 13368-13375
+	63, 62, 61, 59, 58, 57, 55, 54, // 13376-13383
+	52, 51, 49, 47, 46, 44, 42, 40, // 13384-13391
+	38, 36, 34, 31, 29, 27, 25, 22, // 13392-13399
+	20, 18, 15, 13, 10, 8, 6, 3, // 13400-13407
+	1, -2, -4, -7, -9, -11, -14, -16, // 13408-13415
+	-19, -21, -23, -25, -28, -30, -32, -34, // 13416-13423
+	-36, -38, -40, -42, -44, -45, -47, -49, // 13424-13431
+	-50, -52, -53, -54, -55, -57, -58, -59, // 13432-13439
+	-60, -60, -61, -62, -62, -63, -63, -64, // 13440-13447
+	-64, -64, -64, -64, -64, -63, -63, -63, // 13448-13455
+	-62, -62, -61, -60, -59, -58, -57, -56, // 13456-13463
+	-55, -54, -53, -51, -50, -48, -47, -45, // 13464-13471
+	-43, -42, -40, -38, -36, -34, -32, -30, // 13472-13479
+	-28, -26, -24, -21, -19, -17, -15, -12, // 13480-13487
+	-10, -8, -6, -3, -1, 1, 4, 6, // 13488-13495
+	8, 11, 13, 15, 17, 20, 22, 24, // 13496-13503
+	26, 28, 30, 32, 34, 36, 38, 39, // 13504-13511
+	41, 43, 44, 46, 47, 49, 50, 51, // 13512-13519
+	52, 54, 55, 55, 56, 57, 58, 58, // 13520-13527
+	59, 59, 60, 60, 60, 61, 61, 61, // 13528-13535
+	60, 60, 60, 60, 59, 59, 58, 57, // 13536-13543
+	56, 56, 55, 54, 53, 51, 50, 49, // 13544-13551
+	48, 46, 45, 43, 41, 40, 38, 36, // 13552-13559
+	35, 33, 31, 29, 27, 25, 23, 21, // 13560-13567
+	19, 16, 14, 12, 10, 8, 6, 3, // 13568-13575
+	1, -1, -3, -5, -8, -10, -12, -14, // 13576-13583
+	-16, -18, -20, -22, -24, -26, -28, -30, // 13584-13591
+	-32, -34, -35, -37, -39, -40, -42, -43, // 13592-13599
+	-45, -46, -47, -48, -49, -51, -51, -52, // 13600-13607
+	-53, -54, -55, -55, -56, -56, -57, -57, // 13608-13615
+	-57, -57, -57, -57, -57, -57, -57, -56, // 13616-13623
+	-56, -55, -55, -54, -54, -53, -52, -51, // 13624-13631
+	-50, -49, -48, -46, -45, -44, -42, -41, // 13632-13639
+	-39, -38, -36, -35, -33, -31, -29, -28, // 13640-13647
+	-26, -24, -22, -20, -18, -16, -14, -12, // 13648-13655
+	-10, -8, -6, -4, -2, 1, 3, 5, // 13656-13663
+	7, 9, 11, 13, 15, 17, 19, 21, // 13664-13671
+	23, 24, 26, 28, 30, 32, 33, 35, // 13672-13679
+	36, 38, 39, 41, 42, 43, 44, 46, // 13680-13687
+	47, 48, 49, 49, 50, 51, 52, 52, // 13688-13695
+	53, 53, 54, 54, 54, 54, 54, 54, // 13696-13703
+	54, 54, 54, 53, 53, 53, 52, 51, // 13704-13711
+	51, 50, 49, 48, 47, 46, 45, 44, // 13712-13719
+	43, 42, 40, 39, 38, 36, 35, 33, // 13720-13727
+	31, 30, 28, 26, 25, 23, 21, 19, // 13728-13735
+	17, 15, 13, 12, 10, 8, 6, 4, // 13736-13743
+	2, 0, -2, -4, -6, -8, -10, -12, // 13744-13751
+	-14, -16, -18, -19, -21, -23, -25, -26, // 13752-13759
+	-28, -30, -31, -33, -34, -36, -37, -38, // 13760-13767
+	-40, -41, -42, -43, -44, -45, -46, -47, // 13768-13775
+	-47, -48, -49, -49, -50, -50, -51, -51, // 13776-13783
+	-51, -51, -51, -51, -51, -51, -51, -51, // 13784-13791
+	-50, -50, -49, -49, -48, -47, -47, -46, // 13792-13799
+	-45, -44, -43, -42, -41, -40, -38, -37, // 13800-13807
+	-36, -34, -33, -32, -30, -28, -27, -25, // 13808-13815
+	-24, -22, -20, -18, -17, -15, -13, -11, // 13816-13823
+	-9, -7, -6, -4, -2, 0, 2, 4, // 13824-13831
+	6, 7, 9, 11, 13, 15, 16, 18, // 13832-13839
+	20, 21, 23, 25, 26, 28, 29, 31, // 13840-13847
+	32, 34, 35, 36, 37, 38, 40, 41, // 13848-13855
+	42, 42, 43, 44, 45, 46, 46, 47, // 13856-13863
+	47, 48, 48, 48, 48, 49, 49, 49, // 13864-13871
+	49, 49, 48, 48, 48, 47, 47, 46, // 13872-13879
+	46, 45, 44, 44, 43, 42, 41, 40, // 13880-13887
+	39, 38, 37, 35, 34, 33, 32, 30, // 13888-13895
+	29, 27, 26, 24, 23, 21, 19, 18, // 13896-13903
+	16, 14, 13, 11, 9, 7, 6, 4, // 13904-13911
+	2, 0, -1, -3, -5, -7, -8, -10, // 13912-13919
+	-12, -13, -15, -17, -18, -20, -22, -23, // 13920-13927
+	-25, -26, -27, -29, -30, -31, -33, -34, // 13928-13935
+	-35, -36, -37, -38, -39, -40, -41, -42, // 13936-13943
+	-42, -43, -44, -44, -45, -45, -45, -46, // 13944-13951
+	-46, -46, -46, -46, -46, -46, -46, -46, // 13952-13959
+	-45, -45, -44, -44, -43, -43, -42, -41, // 13960-13967
+	-41, -40, -39, -38, -37, -36, -35, -34, // 13968-13975
+	-33, -31, -30, -29, -27, -26, -25, -23, // 13976-13983
+	-22, -20, -19, -17, -15, -14, -12, -11, // 13984-13991
+	-9, -7, -6, -4, -2, -1, 1, 3, // 13992-13999
+	4, 6, 8, 9, 11, 13, 14, 16, // 14000-14007
+	17, 19, 20, 22, 23, 24, 26, 27, // 14008-14015
+	28, 30, 31, 32, 33, 34, 35, 36, // 14016-14023
+	37, 38, 39, 39, 40, 41, 41, 42, // 14024-14031
+	42, 43, 43, 43, 43, 43, 44, 44, // 14032-14039
+	44, 43, 43, 43, 43, 43, 42, 42, // 14040-14047
+	41, 41, 40, 39, 39, 38, 37, 36, // 14048-14055
+	35, 34, 33, 32, 31, 30, 29, 27, // 14056-14063
+	26, 25, 23, 22, 21, 19, 18, 16, // 14064-14071
+	15, 13, 12, 10, 9, 7, 6, 4, // 14072-14079
+	2, 1, -1, -2, -4, -6, -7, -9, // 14080-14087
+	-10, -12, -13, -15, -16, -18, -19, -20, // 14088-14095
+	-22, -23, -24, -25, -27, -28, -29, -30, // 14096-14103
+	-31, -32, -33, -34, -35, -36, -36, -37, // 14104-14111
+	-38, -38, -39, -39, -40, -40, -40, -41, // 14112-14119
+	-41, -41, -41, -41, -41, -41, -41, -41, // 14120-14127
+	-41, -40, -40, -39, -39, -38, -38, -37, // 14128-14135
+	-37, -36, -35, -34, -33, -32, -31, -30, // 14136-14143
+	-29, -28, -27, -26, -25, -24, -22, -21, // 14144-14151
+	-20, -18, -17, -16, -14, -13, -11, -10, // 14152-14159
+	-8, -7, -5, -4, -2, -1, 1, 2, // 14160-14167
+	4, 5, 7, 8, 9, 11, 12, 14, // 14168-14175
+	15, 16, 18, 19, 20, 22, 23, 24, // 14176-14183
+	25, 26, 27, 28, 29, 30, 31, 32, // 14184-14191
+	33, 34, 34, 35, 36, 36, 37, 37, // 14192-14199
+	38, 38, 38, 39, 39, 39, 39, 39, // 14200-14207
+	39, 39, 39, 39, 38, 38, 38, 37, // 14208-14215
+	37, 36, 36, 35, 35, 34, 33, 32, // 14216-14223
+	32, 31, 30, 29, 28, 27, 26, 25, // 14224-14231
+	24, 22, 21, 20, 19, 17, 16, 15, // 14232-14239
+	13, 12, 11, 9, 8, 7, 5, 4, // 14240-14247
+	2, 1, 0, -2, -3, -5, -6, -7, // 14248-14255
+	-9, -10, -12, -13, -14, -15, -17, -18, // 14256-14263
+	-19, -20, -21, -23, -24, -25, -26, -27, // 14264-14271
+	-28, -29, -29, -30, -31, -32, -32, -33, // 14272-14279
+	-34, -34, -35, -35, -36, -36, -36, -36, // 14280-14287
+	-37, -37, -37, -37, -37, -37, -37, -37, // 14288-14295
+	-36, -36, -36, -35, -35, -35, -34, -33, // 14296-14303
+	-33, -32, -32, -31, -30, -29, -28, -27, // 14304-14311
+	-27, -26, -25, -24, -22, -21, -20, -19, // 14312-14319
+	-18, -17, -15, -14, -13, -12, -10, -9, // 14320-14327
+	-8, -6, -5, -4, -2, -1, 0, 2, // 14328-14335
+	3, 4, 6, 7, 8, 9, 11, 12, // 14336-14343
+	13, 14, 16, 17, 18, 19, 20, 21, // 14344-14351
+	22, 23, 24, 25, 26, 27, 28, 29, // 14352-14359
+	29, 30, 31, 31, 32, 32, 33, 33, // 14360-14367
+	34, 34, 34, 34, 35, 35, 35, 35, // 14368-14375
+	35, 35, 35, 35, 34, 34, 34, 34, // 14376-14383
+	33, 33, 32, 32, 31, 31, 30, 29, // 14384-14391
+	29, 28, 27, 26, 25, 24, 23, 22, // 14392-14399
+	21, 20, 19, 18, 17, 16, 15, 14, // 14400-14407
+	12, 11, 10, 9, 8, 6, 5, 4, // 14408-14415
+	3, 1, 0, -1, -3, -4, -5, -6, // 14416-14423
+	-7, -9, -10, -11, -12, -13, -15, -16, // 14424-14431
+	-17, -18, -19, -20, -21, -22, -23, -24, // 14432-14439
+	-24, -25, -26, -27, -28, -28, -29, -29, // 14440-14447
+	-30, -30, -31, -31, -32, -32, -32, -32, // 14448-14455
+	-33, -33, -33, -33, -33, -33, -33, -33, // 14456-14463
+	-33, -32, -32, -32, -31, -31, -31, -30, // 14464-14471
+	-30, -29, -28, -28, -27, -26, -26, -25, // 14472-14479
+	-24, -23, -22, -21, -20, -19, -18, -17, // 14480-14487
+	-16, -15, -14, -13, -12, -11, -10, -8, // 14488-14495
+	-7, -6, -5, -4, -3, -1, 0, 1, // 14496-14503
+	2, 3, 5, 6, 7, 8, 9, 10, // 14504-14511
+	11, 13, 14, 15, 16, 17, 18, 19, // 14512-14519
+	20, 20, 21, 22, 23, 24, 24, 25, // 14520-14527
+	26, 26, 27, 28, 28, 29, 29, 29, // 14528-14535
+	30, 30, 30, 31, 31, 31, 31, 31, // 14536-14543
+	31, 31, 31, 31, 31, 30, 30, 30, // 14544-14551
+	30, 29, 29, 28, 28, 27, 27, 26, // 14552-14559
+	26, 25, 24, 23, 23, 22, 21, 20, // 14560-14567
+	19, 18, 17, 16, 15, 14, 13, 12, // 14568-14575
+	11, 10, 9, 8, 7, 6, 5, 4, // 14576-14583
+	3, 1, 0, -1, -2, -3, -4, -5, // 14584-14591
+	-6, -7, -9, -10, -11, -12, -13, -14, // 14592-14599
+	-15, -16, -17, -17, -18, -19, -20, -21, // 14600-14607
+	-22, -22, -23, -24, -24, -25, -25, -26, // 14608-14615
+	-26, -27, -27, -28, -28, -28, -29, -29, // 14616-14623
+	-29, -29, -29, -29, -29, -29, -29, -29, // 14624-14631
+	-29, -29, -29, -28, -28, -28, -27, -27, // 14632-14639
+	-26, -26, -25, -25, -24, -24, -23, -22, // 14640-14647
+	-21, -21, -20, -19, -18, -17, -17, -16, // 14648-14655
+	-15, -14, -13, -12, -11, -10, -9, -8, // 14656-14663
+	-7, -6, -5, -4, -3, -1, 0, 1, // 14664-14671
+	2, 3, 4, 5, 6, 7, 8, 9, // 14672-14679
+	10, 11, 12, 13, 14, 15, 16, 16, // 14680-14687
+	17, 18, 19, 20, 20, 21, 22, 22, // 14688-14695
+	23, 24, 24, 25, 25, 25, 26, 26, // 14696-14703
+	27, 27, 27, 27, 27, 28, 28, 28, // 14704-14711
+	28, 28, 28, 28, 27, 27, 27, 27, // 14712-14719
+	27, 26, 26, 25, 25, 25, 24, 24, // 14720-14727
+	23, 22, 22, 21, 20, 20, 19, 18, // 14728-14735
+	17, 17, 16, 15, 14, 13, 12, 11, // 14736-14743
+	10, 9, 8, 7, 7, 6, 5, 4, // 14744-14751
+	3, 2, 1, 0, -1, -2, -3, -4, // 14752-14759
+	-5, -6, -7, -8, -9, -10, -11, -12, // 14760-14767
+	-13, -14, -15, -15, -16, -17, -18, -18, // 14768-14775
+	-19, -20, -20, -21, -22, -22, -23, -23, // 14776-14783
+	-24, -24, -24, -25, -25, -25, -25, -26, // 14784-14791
+	-26, -26, -26, -26, -26, -26, -26, -26, // 14792-14799
+	-26, -26, -26, -25, -25, -25, -24, -24, // 14800-14807
+	-24, -23, -23, -22, -22, -21, -21, -20, // 14808-14815
+	-19, -19, -18, -17, -16, -16, -15, -14, // 14816-14823
+	-13, -12, -12, -11, -10, -9, -8, -7, // 14824-14831
+	-6, -5, -4, -3, -2, -2, -1, 0, // 14832-14839
+	1, 2, 3, 4, 5, 6, 7, 8, // 14840-14847
+	9, 10, 10, 11, 12, 13, 14, 14, // 14848-14855
+	15, 16, 17, 17, 18, 19, 19, 20, // 14856-14863
+	20, 21, 21, 22, 22, 23, 23, 23, // 14864-14871
+	24, 24, 24, 24, 24, 24, 25, 25, // 14872-14879
+	25, 25, 25, 25, 24, 24, 24, 24, // 14880-14887
+	24, 23, 23, 23, 22, 22, 21, 21, // 14888-14895
+	21, 20, 19, 19, 18, 18, 17, 16, // 14896-14903
+	16, 15, 14, 13, 13, 12, 11, 10, // 14904-14911
+	9, 9, 8, 7, 6, 5, 4, 3, // 14912-14919
+	2, 2, 1, 0, -1, -2, -3, -4, // 14920-14927
+	-5, -6, -6, -7, -8, -9, -10, -11, // 14928-14935
+	-11, -12, -13, -14, -14, -15, -16, -16, // 14936-14943
+	-17, -17, -18, -19, -19, -20, -20, -20, // 14944-14951
+	-21, -21, -22, -22, -22, -22, -23, -23, // 14952-14959
+	-23, -23, -23, -23, -23, -23, -23, -23, // 14960-14967
+	-23, -23, -23, -23, -22, -22, -22, -21, // 14968-14975
+	-21, -21, -20, -20, -19, -19, -18, -18, // 14976-14983
+	-17, -17, -16, -16, -15, -14, -13, -13, // 14984-14991
+	-12, -11, -11, -10, -9, -8, -7, -7, // 14992-14999
+	-6, -5, -4, -3, -2, -2, -1, 0, // 15000-15007
+	1, 2, 3, 3, 4, 5, 6, 7, // 15008-15015
+	8, 8, 9, 10, 11, 11, 12, 13, // 15016-15023
+	13, 14, 15, 15, 16, 16, 17, 17, // 15024-15031
+	18, 18, 19, 19, 20, 20, 20, 21, // 15032-15039
+	21, 21, 21, 22, 22, 22, 22, 22, // 15040-15047
+	22, 22, 22, 22, 22, 22, 22, 21, // 15048-15055
+	21, 21, 21, 20, 20, 20, 19, 19, // 15056-15063
+	18, 18, 17, 17, 16, 16, 15, 15, // 15064-15071
+	14, 13, 13, 12, 11, 11, 10, 9, // 15072-15079
+	9, 8, 7, 6, 6, 5, 4, 3, // 15080-15087
+	2, 2, 1, 0, -1, -2, -2, -3, // 15088-15095
+	-4, -5, -6, -6, -7, -8, -9, -9, // 15096-15103
+	-10, -11, -11, -12, -13, -13, -14, -14, // 15104-15111
+	-15, -15, -16, -16, -17, -17, -18, -18, // 15112-15119
+	-19, -19, -19, -20, -20, -20, -20, -20, // 15120-15127
+	-21, -21, -21, -21, -21, -21, -21, -21, // 15128-15135
+	-21, -21, -20, -20, -20, -20, -20, -19, // 15136-15143
+	-19, -19, -18, -18, -17, -17, -17, -16, // 15144-15151
+	-16, -15, -15, -14, -13, -13, -12, -12, // 15152-15159
+	-11, -10, -10, -9, -8, -8, -7, -6, // 15160-15167
+	-5, -5, -4, -3, -2, -2, -1, 0, // 15168-15175
+	1, 1, 2, 3, 4, 4, 5, 6, // 15176-15183
+	7, 7, 8, 9, 9, 10, 11, 11, // 15184-15191
+	12, 12, 13, 13, 14, 14, 15, 15, // 15192-15199
+	16, 16, 17, 17, 17, 18, 18, 18, // 15200-15207
+	19, 19, 19, 19, 19, 19, 19, 20, // 15208-15215
+	20, 20, 20, 20, 19, 19, 19, 19, // 15216-15223
+	19, 19, 18, 18, 18, 18, 17, 17, // 15224-15231
+	17, 16, 16, 15, 15, 14, 14, 13, // 15232-15239
+	13, 12, 12, 11, 10, 10, 9, 9, // 15240-15247
+	8, 7, 7, 6, 5, 4, 4, 3, // 15248-15255
+	2, 2, 1, 0, -1, -1, -2, -3, // 15256-15263
+	-3, -4, -5, -5, -6, -7, -7, -8, // 15264-15271
+	-9, -9, -10, -10, -11, -12, -12, -13, // 15272-15279
+	-13, -14, -14, -14, -15, -15, -16, -16, // 15280-15287
+	-16, -17, -17, -17, -17, -18, -18, -18, // 15288-15295
+	-18, -18, -18, -18, -18, -18, -18, -18, // 15296-15303
+	-18, -18, -18, -18, -18, -18, -17, -17, // 15304-15311
+	-17, -17, -16, -16, -16, -15, -15, -14, // 15312-15319
+	-14, -14, -13, -13, -12, -12, -11, -10, // 15320-15327
+	-10, -9, -9, -8, -7, -7, -6, -6, // 15328-15335
+	-5, -4, -4, -3, -2, -2, -1, 0, // 15336-15343
+	0, 1, 2, 2, 3, 4, 4, 5, // 15344-15351
+	6, 6, 7, 8, 8, 9, 9, 10, // 15352-15359
+	10, 11, 11, 12, 12, 13, 13, 14, // 15360-15367
+	14, 14, 15, 15, 15, 16, 16, 16, // 15368-15375
+	17, 17, 17, 17, 17, 17, 17, 17, // 15376-15383
+	17, 17, 17, 17, 17, 17, 17, 17, // 15384-15391
+	17, 17, 17, 16, 16, 16, 15, 15, // 15392-15399
+	15, 14, 14, 14, 13, 13, 12, 12, // 15400-15407
+	11, 11, 10, 10, 9, 9, 8, 8, // 15408-15415
+	7, 7, 6, 5, 5, 4, 4, 3, // 15416-15423
+	2, 2, 1, 0, 0, -1, -2, -2, // 15424-15431
+	-3, -3, -4, -5, -5, -6, -6, -7, // 15432-15439
+	-8, -8, -9, -9, -10, -10, -11, -11, // 15440-15447
+	-12, -12, -12, -13, -13, -14, -14, -14, // 15448-15455
+	-15, -15, -15, -15, -16, -16, -16, -16, // 15456-15463
+	-16, -16, -16, -16, -16, -16, -16, -16, // 15464-15471
+	-16, -16, -16, -16, -16, -16, -16, -15, // 15472-15479
+	-15, -15, -15, -14, -14, -14, -13, -13, // 15480-15487
+	-13, -12, -12, -11, -11, -10, -10, -9, // 15488-15495
+	-9, -8, -8, -7, -7, -6, -6, -5, // 15496-15503
+	-5, -4, -3, -3, -2, -2, -1, 0, // 15504-15511
+	0, 1, 1, 2, 3, 3, 4, 4, // 15512-15519
+	5, 5, 6, 7, 7, 8, 8, 9, // 15520-15527
+	9, 10, 10, 10, 11, 11, 12, 12, // 15528-15535
+	12, 13, 13, 13, 14, 14, 14, 14, // 15536-15543
+	15, 15, 15, 15, 15, 15, 15, 15, // 15544-15551
+	15, 15, 15, 15, 15, 15, 15, 15, // 15552-15559
+	15, 15, 15, 14, 14, 14, 14, 13, // 15560-15567
+	13, 13, 13, 12, 12, 11, 11, 11, // 15568-15575
+	10, 10, 9, 9, 8, 8, 7, 7, // 15576-15583
+	6, 6, 5, 5, 4, 4, 3, 3, // 15584-15591
+	2, 2, 1, 0, 0, -1, -1, -2, // 15592-15599
+	-2, -3, -4, -4, -5, -5, -6, -6, // 15600-15607
+	-7, -7, -8, -8, -9, -9, -9, -10, // 15608-15615
+	-10, -11, -11, -11, -12, -12, -12, -13, // 15616-15623
+	-13, -13, -13, -14, -14, -14, -14, -14, // 15624-15631
+	-14, -14, -15, -15, -15, -15, -15, -15, // 15632-15639
+	-15, -15, -14, -14, -14, -14, -14, -14, // 15640-15647
+	-14, -13, -13, -13, -13, -12, -12, -12, // 15648-15655
+	-11, -11, -11, -10, -10, -9, -9, -8, // 15656-15663
+	-8, -8, -7, -7, -6, -6, -5, -5, // 15664-15671
+	-4, -4, -3, -3, -2, -2, -1, 0, // 15672-15679
+	0, 1, 1, 2, 2, 3, 3, 4, // 15680-15687
+	4, 5, 5, 6, 6, 7, 7, 8, // 15688-15695
+	8, 8, 9, 9, 10, 10, 10, 11, // 15696-15703
+	11, 11, 12, 12, 12, 12, 13, 13, // 15704-15711
+	13, 13, 13, 13, 13, 14, 14, 14, // 15712-15719
+	14, 14, 14, 14, 14, 14, 14, 13, // 15720-15727
+	13, 13, 13, 13, 13, 13, 12, 12, // 15728-15735
+	12, 12, 11, 11, 11, 10, 10, 10, // 15736-15743
+	9, 9, 8, 8, 8, 7, 7, 6, // 15744-15751
+	6, 5, 5, 4, 4, 3, 3, 3, // 15752-15759
+	2, 2, 1, 1, 0, 0, -1, -1, // 15760-15767
+	-2, -2, -3, -3, -4, -4, -5, -5, // 15768-15775
+	-6, -6, -7, -7, -7, -8, -8, -9, // 15776-15783
+	-9, -9, -10, -10, -10, -11, -11, -11, // 15784-15791
+	-11, -12, -12, -12, -12, -12, -12, -13, // 15792-15799
+	-13, -13, -13, -13, -13, -13, -13, -13, // 15800-15807
+	-13, -13, -13, -13, -13, -12, -12, -12, // 15808-15815
+	-12, -12, -12, -11, -11, -11, -11, -10, // 15816-15823
+	-10, -10, -9, -9, -9, -8, -8, -8, // 15824-15831
+	-7, -7, -6, -6, -6, -5, -5, -4, // 15832-15839
+	-4, -3, -3, -2, -2, -1, -1, -1, // 15840-15847
+	0, 0, 1, 1, 2, 2, 3, 3, // 15848-15855
+	4, 4, 4, 5, 5, 6, 6, 7, // 15856-15863
+	7, 7, 8, 8, 8, 9, 9, 9, // 15864-15871
+	10, 10, 10, 10, 11, 11, 11, 11, // 15872-15879
+	11, 12, 12, 12, 12, 12, 12, 12, // 15880-15887
+	12, 12, 12, 12, 12, 12, 12, 12, // 15888-15895
+	12, 12, 12, 11, 11, 11, 11, 11, // 15896-15903
+	10, 10, 10, 10, 9, 9, 9, 9, // 15904-15911
+	8, 8, 8, 7, 7, 6, 6, 6, // 15912-15919
+	5, 5, 4, 4, 4, 3, 3, 2, // 15920-15927
+	2, 1, 1, 1, 0, 0, -1, -1, // 15928-15935
+	-2, -2, -3, -3, -3, -4, -4, -5, // 15936-15943
+	-5, -5, -6, -6, -6, -7, -7, -8, // 15944-15951
+	-8, -8, -8, -9, -9, -9, -10, -10, // 15952-15959
+	-10, -10, -10, -10, -11, -11, -11, -11, // 15960-15967
+	-11, -11, -11, -11, -11, -11, -11, -11, // 15968-15975
+	-11, -11, -11, -10, -10, -10, -10, -10, // 15976-15983
+	-10, -9, -9, -9, -9, -9, -8, -8, // 15984-15991
+	-8, -8, -7, -7, -7, -6, -6, -6, // 15992-15999
+	-5, -5, -5, -4, -4, -4, -3, -3, // 16000-16007
+	-3, -2, -2, -2, -1, -1, -1, 0, // 16008-16015
+	0, 0, 1, 1, 1, 1, 2, 2, // 16016-16023
+	2, 3, 3, 3, 3, 4, 4, 4, // 16024-16031
+	4, 5, 5, 5, 5, 5, 6, 6, // 16032-16039
+	6, 6, 6, 6, 6, 6, 6, 7, // 16040-16047
+	7, 7, 7, 7, 7, 7, 7, 7, // 16048-16055
+	7, 7, 7, 7, 7, 6, 6, 6, // 16056-16063
+	6, 6, 6, 6, 6, 6, 5, 5, // 16064-16071
+	5, 5, 5, 5, 5, 4, 4, 4, // 16072-16079
+	4, 4, 3, 3, 3, 3, 3, 3, // 16080-16087
+	2, 2, 2, 2, 2, 1, 1, 1, // 16088-16095
+	1, 1, 0, 0, 0, 0, 0, 0, // 16096-16103
+	-1, -1, -1, -1, -1, -1, -2, -2, // 16104-16111
+	-2, -2, -2, -2, -2, -2, -2, -2, // 16112-16119
+	-3, -3, -3, -3, -3, -3, -3, -3, // 16120-16127
+	-3, -3, -3, -3, -3, -3, -3, -3, // 16128-16135
+	-3, -3, -3, -3, -3, -3, -3, -3, // 16136-16143
+	-3, -3, -3, -3, -3, -3, -2, -2, // 16144-16151
+	-2, -2, -2, -2, -2, -2, -2, -2, // 16152-16159
+	-2, -2, -2, -1, -1, -1, -1, -1, // 16160-16167
+	-1, -1, -1, -1, -1, -1, -1, -1, // 16168-16175
+	0, 0, 0, 0, 0, 0, 0, 0, // 16176-16183
+	0, 0, 0, 0, 0, 0, 0, 0, // 16184-16191
+	0, 0, 0, 0, 0, 0, 0, 0, // 16192-16199
+	0, 0, 0, 0, 0, 0, 0, 0, // 16200-16207
+	0, 0, 0, 0, 0, 0, 0, 0, // 16208-16215
+	0, // 16216-16216
+};
+
+static const int16_t mallet_hit_guitar_data[9549] = {
+	0, 6, 25, 59, 111, 189, 299, 448, // 0-7
+	637, 869, 1146, 1467, 1830, 2234, 2676, 3152, // 8-15
+	3658, 4190, 4744, 5314, 5896, 6485, 7077, 7667, // 16-23
+	8251, 8825, 9385, 9929, 10454, 10958, 11438, 11894, // 24-31
+	12324, 12727, 13103, 13453, 13775, 14071, 14342, 14587, // 32-39
+	14807, 15004, 15179, 15332, 15464, 15576, 15670, 15745, // 40-47
+	15802, 15843, 15867, 15876, 15869, 15848, 15813, 15765, // 48-55
+	15703, 15629, 15542, 15444, 15336, 15216, 15087, 14950, // 56-63
+	14803, 14650, 14490, 14324, 14153, 13978, 13800, 13619, // 64-71
+	13437, 13253, 13069, 12885, 12702, 12520, 12340, 12161, // 72-79
+	11985, 11811, 11640, 11471, 11304, 11141, 10980, 10822, // 80-87
+	10666, 10513, 10363, 10215, 10071, 9928, 9789, 9652, // 88-95
+	9518, 9387, 9259, 9135, 9014, 8896, 8782, 8671, // 96-103
+	8564, 8460, 8360, 8263, 8169, 8079, 7990, 7904, // 104-111
+	7820, 7738, 7656, 7575, 7495, 7414, 7333, 7250, // 112-119
+	7166, 7081, 6993, 6903, 6811, 6717, 6620, 6521, // 120-127
+	6420, 6318, 6213, 6108, 6002, 5896, 5790, 5685, // 128-135
+	5580, 5478, 5377, 5278, 5182, 5089, 4998, 4911, // 136-143
+	4826, 4743, 4663, 4585, 4509, 4434, 4361, 4287, // 144-151
+	4214, 4139, 4064, 3987, 3907, 3825, 3740, 3651, // 152-159
+	3560, 3464, 3365, 3263, 3157, 3049, 2938, 2824, // 160-167
+	2709, 2593, 2476, 2360, 2244, 2130, 2017, 1907, // 168-175
+	1800, 1696, 1596, 1501, 1409, 1322, 1239, 1161, // 176-183
+	1087, 1016, 949, 886, 825, 767, 711, 656, // 184-191
+	602, 549, 496, 443, 391, 338, 285, 231, // 192-199
+	178, 124, 72, 20, -30, -78, -124, -166, // 200-207
+	-203, -236, -263, -284, -297, -303, -300, -288, // 208-215
+	-267, -237, -197, -147, -87, -18, 60, 147, // 216-223
+	243, 346, 456, 572, 693, 818, 947, 1077, // 224-231
+	1209, 1341, 1473, 1602, 1729, 1851, 1970, 2083, // 232-239
+	2190, 2290, 2383, 2470, 2548, 2618, 2681, 2735, // 240-247
+	2781, 2819, 2849, 2872, 2888, 2896, 2898, 2894, // 248-255
+	2884, 2868, 2848, 2823, 2794, 2761, 2725, 2686, // 256-263
+	2645, 2601, 2555, 2506, 2456, 2404, 2351, 2296, // 264-271
+	2239, 2180, 2120, 2058, 1993, 1926, 1856, 1784, // 272-279
+	1708, 1629, 1546, 1459, 1368, 1272, 1171, 1065, // 280-287
+	953, 836, 713, 584, 449, 309, 163, 11, // 288-295
+	-146, -308, -475, -647, -822, -1000, -1182, -1365, // 296-303
+	-1550, -1736, -1921, -2106, -2289, -2470, -2648, -2822, // 304-311
+	-2991, -3155, -3313, -3465, -3610, -3748, -3877, -3999, // 312-319
+	-4113, -4217, -4314, -4402, -4481, -4552, -4615, -4671, // 320-327
+	-4718, -4759, -4794, -4822, -4844, -4862, -4875, -4884, // 328-335
+	-4890, -4893, -4894, -4893, -4890, -4887, -4883, -4879, // 336-343
+	-4876, -4873, -4872, -4872, -4873, -4877, -4883, -4891, // 344-351
+	-4902, -4915, -4932, -4951, -4974, -5000, -5029, -5062, // 352-359
+	-5098, -5138, -5181, -5229, -5280, -5334, -5392, -5454, // 360-367
+	-5519, -5588, -5659, -5733, -5810, -5889, -5970, -6053, // 368-375
+	-6137, -6221, -6306, -6391, -6475, -6557, -6638, -6717, // 376-383
+	-6793, -6865, -6934, -6998, -7057, -7111, -7160, -7202, // 384-391
+	-7238, -7267, -7290, -7306, -7315, -7317, -7312, -7300, // 392-399
+	-7282, -7257, -7226, -7188, -7146, -7098, -7045, -6987, // 400-407
+	-6925, -6860, -6792, -6720, -6647, -6571, -6494, -6416, // 408-415
+	-6337, -6257, -6177, -6097, -6017, -5938, -5859, -5781, // 416-423
+	-5704, -5628, -5553, -5478, -5405, -5333, -5261, -5190, // 424-431
+	-5120, -5051, -4982, -4913, -4844, -4776, -4707, -4638, // 432-439
+	-4568, -4498, -4427, -4355, -4282, -4207, -4131, -4053, // 440-447
+	-3974, -3892, -3808, -3722, -3633, -3541, -3447, -3349, // 448-455
+	-3248, -3144, -3036, -2924, -2808, -2689, -2565, -2437, // 456-463
+	-2305, -2168, -2027, -1881, -1730, -1575, -1414, -1250, // 464-471
+	-1080, -906, -727, -543, -356, -164, 32, 232, // 472-479
+	435, 642, 852, 1064, 1279, 1496, 1714, 1934, // 480-487
+	2154, 2374, 2594, 2814, 3032, 3248, 3461, 3672, // 488-495
+	3879, 4082, 4280, 4473, 4660, 4842, 5016, 5184, // 496-503
+	5344, 5496, 5640, 5775, 5901, 6018, 6127, 6225, // 504-511
+	6315, 6395, 6466, 6527, 6579, 6623, 6657, 6682, // 512-519
+	6700, 6709, 6710, 6704, 6691, 6671, 6644, 6612, // 520-527
+	6574, 6531, 6483, 6430, 6374, 6314, 6250, 6183, // 528-535
+	6114, 6042, 5968, 5892, 5814, 5734, 5653, 5571, // 536-543
+	5488, 5404, 5319, 5234, 5148, 5062, 4975, 4889, // 544-551
+	4802, 4715, 4628, 4541, 4455, 4368, 4282, 4197, // 552-559
+	4112, 4027, 3943, 3860, 3778, 3696, 3616, 3536, // 560-567
+	3458, 3381, 3305, 3230, 3156, 3084, 3013, 2944, // 568-575
+	2876, 2810, 2745, 2681, 2620, 2560, 2501, 2445, // 576-583
+	2390, 2336, 2285, 2235, 2187, 2140, 2095, 2053, // 584-591
+	2012, 1972, 1935, 1899, 1865, 1833, 1803, 1775, // 592-599
+	1748, 1722, 1699, 1677, 1656, 1637, 1619, 1603, // 600-607
+	1588, 1574, 1560, 1548, 1537, 1526, 1516, 1506, // 608-615
+	1497, 1488, 1478, 1469, 1460, 1451, 1441, 1431, // 616-623
+	1421, 1410, 1399, 1387, 1374, 1361, 1348, 1334, // 624-631
+	1319, 1304, 1288, 1272, 1255, 1238, 1221, 1204, // 632-639
+	1186, 1169, 1152, 1135, 1118, 1101, 1085, 1070, // 640-647
+	1055, 1040, 1027, 1014, 1002, 991, 980, 971, // 648-655
+	963, 956, 950, 945, 941, 938, 937, 937, // 656-663
+	939, 944, 950, 960, 972, 988, 1007, 1029, // 664-671
+	1055, 1084, 1116, 1150, 1187, 1227, 1268, 1312, // 672-679
+	1357, 1403, 1450, 1497, 1545, 1593, 1641, 1688, // 680-687
+	1735, 1781, 1826, 1870, 1912, 1954, 1994, 2032, // 688-695
+	2069, 2104, 2138, 2170, 2200, 2228, 2255, 2279, // 696-703
+	2302, 2323, 2342, 2359, 2374, 2387, 2398, 2407, // 704-711
+	2413, 2417, 2418, 2417, 2413, 2407, 2398, 2386, // 712-719
+	2371, 2353, 2332, 2308, 2281, 2251, 2218, 2181, // 720-727
+	2141, 2098, 2052, 2002, 1950, 1894, 1834, 1772, // 728-735
+	1706, 1638, 1566, 1491, 1413, 1332, 1247, 1160, // 736-743
+	1070, 977, 882, 783, 683, 579, 473, 365, // 744-751
+	255, 143, 29, -87, -204, -323, -443, -563, // 752-759
+	-685, -807, -929, -1052, -1174, -1297, -1418, -1539, // 760-767
+	-1659, -1777, -1895, -2010, -2124, -2236, -2346, -2453, // 768-775
+	-2558, -2661, -2760, -2857, -2951, -3042, -3129, -3214, // 776-783
+	-3294, -3372, -3446, -3516, -3582, -3645, -3704, -3759, // 784-791
+	-3811, -3859, -3902, -3942, -3978, -4011, -4039, -4064, // 792-799
+	-4085, -4102, -4116, -4126, -4133, -4136, -4137, -4134, // 800-807
+	-4129, -4121, -4111, -4098, -4084, -4067, -4049, -4029, // 808-815
+	-4008, -3986, -3963, -3939, -3915, -3891, -3866, -3842, // 816-823
+	-3818, -3795, -3772, -3749, -3728, -3707, -3687, -3669, // 824-831
+	-3651, -3634, -3618, -3604, -3590, -3577, -3566, -3555, // 832-839
+	-3545, -3535, -3526, -3518, -3510, -3502, -3495, -3487, // 840-847
+	-3480, -3472, -3463, -3455, -3445, -3435, -3424, -3412, // 848-855
+	-3399, -3384, -3368, -3351, -3332, -3311, -3289, -3265, // 856-863
+	-3238, -3210, -3179, -3147, -3112, -3074, -3035, -2993, // 864-871
+	-2949, -2902, -2853, -2802, -2749, -2693, -2634, -2574, // 872-879
+	-2511, -2447, -2380, -2311, -2241, -2169, -2095, -2019, // 880-887
+	-1942, -1864, -1785, -1704, -1622, -1540, -1457, -1373, // 888-895
+	-1288, -1203, -1118, -1033, -947, -862, -777, -691, // 896-903
+	-607, -522, -438, -355, -272, -190, -108, -27, // 904-911
+	53, 132, 210, 287, 363, 438, 512, 584, // 912-919
+	656, 726, 796, 864, 931, 997, 1062, 1125, // 920-927
+	1188, 1249, 1310, 1370, 1430, 1490, 1550, 1611, // 928-935
+	1672, 1736, 1800, 1866, 1933, 2002, 2071, 2142, // 936-943
+	2213, 2284, 2356, 2427, 2497, 2566, 2634, 2701, // 944-951
+	2765, 2827, 2886, 2942, 2996, 3046, 3093, 3136, // 952-959
+	3175, 3211, 3242, 3270, 3295, 3315, 3332, 3345, // 960-967
+	3354, 3361, 3363, 3363, 3360, 3354, 3346, 3334, // 968-975
+	3321, 3305, 3287, 3268, 3246, 3223, 3198, 3171, // 976-983
+	3144, 3115, 3085, 3053, 3021, 2988, 2954, 2920, // 984-991
+	2884, 2848, 2812, 2774, 2737, 2699, 2660, 2622, // 992-999
+	2583, 2543, 2504, 2464, 2425, 2385, 2346, 2306, // 1000-1007
+	2267, 2227, 2188, 2149, 2111, 2073, 2035, 1998, // 1008-1015
+	1961, 1924, 1889, 1854, 1819, 1785, 1753, 1721, // 1016-1023
+	1689, 1659, 1630, 1602, 1574, 1548, 1522, 1498, // 1024-1031
+	1475, 1452, 1431, 1411, 1393, 1376, 1361, 1348, // 1032-1039
+	1336, 1326, 1319, 1313, 1309, 1306, 1305, 1306, // 1040-1047
+	1308, 1311, 1315, 1320, 1326, 1332, 1339, 1346, // 1048-1055
+	1353, 1360, 1368, 1375, 1382, 1388, 1395, 1401, // 1056-1063
+	1407, 1413, 1419, 1424, 1429, 1434, 1439, 1444, // 1064-1071
+	1448, 1453, 1457, 1461, 1465, 1469, 1472, 1476, // 1072-1079
+	1478, 1481, 1483, 1484, 1485, 1485, 1484, 1483, // 1080-1087
+	1481, 1478, 1474, 1470, 1464, 1458, 1451, 1444, // 1088-1095
+	1435, 1426, 1417, 1407, 1397, 1386, 1375, 1364, // 1096-1103
+	1354, 1343, 1333, 1322, 1312, 1303, 1294, 1285, // 1104-1111
+	1277, 1270, 1263, 1256, 1250, 1245, 1240, 1236, // 1112-1119
+	1232, 1228, 1224, 1221, 1217, 1214, 1211, 1208, // 1120-1127
+	1205, 1201, 1198, 1194, 1191, 1187, 1182, 1178, // 1128-1135
+	1174, 1169, 1164, 1159, 1154, 1149, 1143, 1138, // 1136-1143
+	1133, 1127, 1122, 1116, 1111, 1105, 1100, 1094, // 1144-1151
+	1088, 1083, 1077, 1070, 1063, 1056, 1049, 1041, // 1152-1159
+	1032, 1023, 1013, 1002, 990, 978, 964, 949, // 1160-1167
+	933, 916, 897, 878, 857, 834, 810, 785, // 1168-1175
+	758, 730, 701, 671, 639, 606, 571, 536, // 1176-1183
+	499, 461, 423, 383, 343, 302, 260, 217, // 1184-1191
+	174, 130, 86, 42, -3, -47, -93, -138, // 1192-1199
+	-183, -229, -274, -320, -366, -411, -457, -503, // 1200-1207
+	-549, -595, -641, -687, -734, -780, -827, -874, // 1208-1215
+	-922, -970, -1018, -1067, -1116, -1166, -1216, -1266, // 1216-1223
+	-1317, -1368, -1419, -1471, -1523, -1575, -1626, -1678, // 1224-1231
+	-1729, -1780, -1831, -1880, -1929, -1977, -2024, -2070, // 1232-1239
+	-2114, -2157, -2199, -2238, -2276, -2312, -2346, -2378, // 1240-1247
+	-2407, -2435, -2460, -2484, -2505, -2524, -2541, -2556, // 1248-1255
+	-2569, -2580, -2589, -2596, -2601, -2605, -2607, -2608, // 1256-1263
+	-2608, -2606, -2603, -2599, -2594, -2588, -2581, -2573, // 1264-1271
+	-2565, -2556, -2546, -2535, -2524, -2513, -2501, -2488, // 1272-1279
+	-2475, -2462, -2448, -2435, -2422, -2408, -2395, -2383, // 1280-1287
+	-2371, -2360, -2349, -2338, -2326, -2314, -2300, -2284, // 1288-1295
+	-2266, -2245, -2221, -2193, -2161, -2126, -2087, -2044, // 1296-1303
+	-1998, -1948, -1896, -1842, -1785, -1727, -1667, -1606, // 1304-1311
+	-1545, -1483, -1422, -1361, -1300, -1241, -1183, -1125, // 1312-1319
+	-1070, -1015, -962, -911, -861, -813, -766, -720, // 1320-1327
+	-676, -633, -591, -550, -510, -471, -432, -395, // 1328-1335
+	-358, -322, -286, -251, -216, -182, -149, -116, // 1336-1343
+	-84, -52, -20, 10, 41, 71, 100, 129, // 1344-1351
+	157, 185, 213, 240, 267, 295, 321, 348, // 1352-1359
+	375, 402, 429, 457, 484, 512, 540, 569, // 1360-1367
+	598, 627, 657, 687, 717, 748, 779, 810, // 1368-1375
+	841, 872, 903, 934, 965, 996, 1026, 1056, // 1376-1383
+	1086, 1115, 1144, 1172, 1200, 1227, 1253, 1279, // 1384-1391
+	1304, 1328, 1352, 1374, 1396, 1417, 1438, 1457, // 1392-1399
+	1476, 1494, 1511, 1527, 1542, 1556, 1570, 1582, // 1400-1407
+	1594, 1604, 1614, 1622, 1629, 1635, 1641, 1645, // 1408-1415
+	1648, 1650, 1650, 1650, 1649, 1646, 1643, 1638, // 1416-1423
+	1633, 1626, 1618, 1610, 1600, 1589, 1578, 1565, // 1424-1431
+	1552, 1537, 1522, 1505, 1488, 1469, 1450, 1429, // 1432-1439
+	1408, 1386, 1362, 1337, 1312, 1285, 1258, 1229, // 1440-1447
+	1200, 1169, 1138, 1106, 1074, 1041, 1007, 973, // 1448-1455
+	938, 903, 868, 834, 799, 764, 730, 696, // 1456-1463
+	662, 629, 597, 565, 534, 504, 475, 446, // 1464-1471
+	419, 392, 366, 341, 317, 293, 271, 249, // 1472-1479
+	228, 207, 188, 169, 150, 133, 116, 99, // 1480-1487
+	84, 69, 54, 41, 29, 17, 7, -3, // 1488-1495
+	-11, -18, -23, -27, -30, -31, -31, -28, // 1496-1503
+	-24, -19, -11, -2, 9, 22, 37, 53, // 1504-1511
+	71, 91, 112, 134, 158, 182, 208, 235, // 1512-1519
+	262, 291, 319, 349, 378, 408, 437, 467, // 1520-1527
+	496, 526, 555, 583, 612, 639, 667, 693, // 1528-1535
+	720, 745, 771, 796, 820, 844, 867, 890, // 1536-1543
+	913, 935, 957, 978, 998, 1017, 1036, 1053, // 1544-1551
+	1069, 1083, 1096, 1107, 1116, 1122, 1127, 1130, // 1552-1559
+	1131, 1130, 1127, 1123, 1116, 1108, 1099, 1089, // 1560-1567
+	1077, 1064, 1050, 1036, 1020, 1004, 988, 971, // 1568-1575
+	953, 935, 917, 898, 880, 861, 841, 821, // 1576-1583
+	802, 781, 761, 740, 718, 696, 674, 652, // 1584-1591
+	629, 605, 581, 557, 532, 507, 481, 456, // 1592-1599
+	429, 403, 376, 348, 321, 293, 265, 237, // 1600-1607
+	209, 181, 152, 124, 95, 67, 38, 9, // 1608-1615
+	-19, -48, -77, -106, -135, -164, -193, -222, // 1616-1623
+	-251, -281, -311, -340, -370, -401, -431, -462, // 1624-1631
+	-493, -524, -556, -588, -620, -653, -686, -720, // 1632-1639
+	-754, -788, -823, -858, -894, -930, -967, -1004, // 1640-1647
+	-1042, -1080, -1119, -1158, -1197, -1237, -1277, -1317, // 1648-1655
+	-1357, -1398, -1439, -1479, -1520, -1560, -1600, -1640, // 1656-1663
+	-1679, -1718, -1756, -1794, -1830, -1866, -1901, -1935, // 1664-1671
+	-1967, -1999, -2029, -2058, -2085, -2112, -2136, -2160, // 1672-1679
+	-2182, -2202, -2221, -2239, -2255, -2270, -2283, -2295, // 1680-1687
+	-2306, -2315, -2323, -2329, -2334, -2338, -2341, -2342, // 1688-1695
+	-2341, -2339, -2336, -2331, -2324, -2315, -2304, -2291, // 1696-1703
+	-2277, -2260, -2242, -2222, -2199, -2176, -2150, -2123, // 1704-1711
+	-2095, -2065, -2034, -2001, -1968, -1934, -1899, -1863, // 1712-1719
+	-1827, -1790, -1753, -1716, -1678, -1641, -1603, -1565, // 1720-1727
+	-1528, -1491, -1454, -1417, -1380, -1343, -1307, -1271, // 1728-1735
+	-1235, -1200, -1164, -1129, -1094, -1059, -1025, -990, // 1736-1743
+	-956, -921, -887, -853, -819, -785, -751, -717, // 1744-1751
+	-683, -650, -616, -583, -550, -517, -484, -452, // 1752-1759
+	-420, -388, -357, -326, -296, -266, -237, -208, // 1760-1767
+	-180, -152, -126, -99, -74, -49, -25, -2, // 1768-1775
+	20, 42, 63, 84, 103, 122, 141, 158, // 1776-1783
+	175, 192, 208, 223, 238, 252, 266, 279, // 1784-1791
+	292, 304, 316, 328, 339, 349, 359, 369, // 1792-1799
+	378, 386, 395, 402, 409, 416, 422, 428, // 1800-1807
+	433, 438, 442, 446, 450, 453, 457, 459, // 1808-1815
+	462, 465, 467, 469, 470, 472, 473, 474, // 1816-1823
+	475, 475, 476, 476, 476, 476, 476, 476, // 1824-1831
+	476, 475, 475, 475, 474, 474, 474, 474, // 1832-1839
+	474, 474, 475, 476, 477, 478, 480, 481, // 1840-1847
+	484, 486, 488, 491, 494, 497, 500, 503, // 1848-1855
+	506, 509, 512, 515, 517, 520, 522, 524, // 1856-1863
+	526, 528, 529, 531, 532, 533, 533, 534, // 1864-1871
+	535, 535, 535, 536, 536, 537, 537, 538, // 1872-1879
+	538, 539, 540, 542, 543, 545, 547, 549, // 1880-1887
+	551, 554, 557, 560, 563, 566, 570, 573, // 1888-1895
+	577, 580, 584, 588, 592, 596, 600, 604, // 1896-1903
+	607, 611, 615, 619, 622, 626, 630, 634, // 1904-1911
+	638, 642, 645, 649, 653, 657, 662, 666, // 1912-1919
+	670, 675, 679, 684, 688, 693, 697, 702, // 1920-1927
+	706, 711, 715, 719, 723, 727, 730, 733, // 1928-1935
+	736, 739, 741, 742, 744, 745, 745, 745, // 1936-1943
+	744, 743, 742, 740, 738, 735, 732, 728, // 1944-1951
+	725, 722, 719, 717, 716, 717, 719, 723, // 1952-1959
+	729, 737, 747, 760, 774, 790, 808, 827, // 1960-1967
+	848, 869, 892, 915, 939, 963, 987, 1010, // 1968-1975
+	1034, 1056, 1078, 1099, 1119, 1138, 1155, 1171, // 1976-1983
+	1186, 1199, 1211, 1221, 1230, 1237, 1243, 1247, // 1984-1991
+	1250, 1252, 1253, 1252, 1250, 1247, 1243, 1238, // 1992-1999
+	1232, 1225, 1218, 1209, 1200, 1190, 1180, 1169, // 2000-2007
+	1157, 1145, 1133, 1120, 1106, 1093, 1079, 1064, // 2008-2015
+	1050, 1035, 1020, 1005, 989, 974, 958, 942, // 2016-2023
+	925, 909, 892, 875, 858, 840, 823, 805, // 2024-2031
+	786, 768, 749, 729, 710, 690, 669, 649, // 2032-2039
+	628, 607, 585, 563, 541, 519, 497, 475, // 2040-2047
+	453, 430, 408, 386, 364, 342, 321, 299, // 2048-2055
+	278, 257, 236, 215, 195, 175, 155, 135, // 2056-2063
+	115, 95, 76, 56, 36, 16, -5, -25, // 2064-2071
+	-46, -68, -89, -112, -134, -157, -180, -204, // 2072-2079
+	-228, -252, -277, -301, -326, -351, -375, -400, // 2080-2087
+	-424, -449, -473, -496, -520, -543, -565, -588, // 2088-2095
+	-610, -631, -652, -673, -693, -713, -733, -753, // 2096-2103
+	-772, -792, -811, -830, -849, -869, -888, -908, // 2104-2111
+	-927, -947, -967, -987, -1008, -1028, -1049, -1069, // 2112-2119
+	-1090, -1110, -1131, -1152, -1172, -1192, -1212, -1232, // 2120-2127
+	-1251, -1270, -1288, -1306, -1323, -1339, -1355, -1370, // 2128-2135
+	-1385, -1399, -1412, -1424, -1436, -1447, -1457, -1466, // 2136-2143
+	-1475, -1483, -1490, -1496, -1502, -1507, -1511, -1515, // 2144-2151
+	-1518, -1520, -1521, -1522, -1521, -1520, -1518, -1515, // 2152-2159
+	-1511, -1506, -1501, -1494, -1487, -1479, -1472, -1464, // 2160-2167
+	-1457, -1451, -1446, -1441, -1439, -1437, -1437, -1438, // 2168-2175
+	-1440, -1444, -1449, -1454, -1460, -1466, -1473, -1479, // 2176-2183
+	-1486, -1491, -1496, -1500, -1504, -1506, -1506, -1506, // 2184-2191
+	-1504, -1500, -1495, -1489, -1481, -1471, -1460, -1448, // 2192-2199
+	-1435, -1420, -1405, -1388, -1370, -1352, -1333, -1313, // 2200-2207
+	-1292, -1270, -1249, -1226, -1203, -1180, -1156, -1132, // 2208-2215
+	-1107, -1083, -1057, -1032, -1006, -980, -953, -926, // 2216-2223
+	-899, -872, -844, -816, -788, -761, -733, -705, // 2224-2231
+	-678, -650, -624, -597, -572, -547, -522, -499, // 2232-2239
+	-476, -455, -434, -415, -396, -379, -363, -348, // 2240-2247
+	-334, -322, -310, -300, -291, -282, -275, -268, // 2248-2255
+	-263, -258, -254, -251, -248, -246, -244, -243, // 2256-2263
+	-242, -242, -241, -241, -242, -242, -242, -243, // 2264-2271
+	-244, -244, -245, -246, -247, -247, -248, -249, // 2272-2279
+	-250, -250, -251, -252, -253, -254, -255, -255, // 2280-2287
+	-256, -258, -259, -260, -261, -263, -265, -266, // 2288-2295
+	-268, -271, -273, -275, -278, -281, -284, -287, // 2296-2303
+	-290, -294, -297, -301, -304, -308, -311, -314, // 2304-2311
+	-318, -321, -324, -327, -330, -332, -334, -336, // 2312-2319
+	-338, -340, -341, -342, -343, -344, -344, -345, // 2320-2327
+	-345, -346, -347, -348, -350, -352, -354, -356, // 2328-2335
+	-359, -362, -365, -369, -372, -375, -378, -381, // 2336-2343
+	-383, -385, -386, -387, -387, -385, -383, -380, // 2344-2351
+	-376, -370, -364, -356, -347, -336, -325, -312, // 2352-2359
+	-298, -283, -267, -250, -232, -213, -194, -174, // 2360-2367
+	-153, -132, -111, -90, -68, -47, -25, -4, // 2368-2375
+	17, 37, 58, 78, 97, 116, 134, 152, // 2376-2383
+	170, 187, 203, 219, 235, 250, 265, 280, // 2384-2391
+	295, 309, 323, 338, 352, 366, 381, 395, // 2392-2399
+	410, 425, 440, 455, 470, 486, 502, 517, // 2400-2407
+	533, 550, 566, 582, 598, 614, 630, 646, // 2408-2415
+	662, 678, 693, 708, 723, 737, 751, 765, // 2416-2423
+	778, 791, 804, 815, 827, 838, 849, 859, // 2424-2431
+	869, 878, 887, 896, 904, 912, 919, 927, // 2432-2439
+	933, 940, 946, 952, 958, 963, 968, 972, // 2440-2447
+	976, 980, 983, 986, 988, 990, 992, 993, // 2448-2455
+	993, 993, 992, 990, 988, 986, 982, 979, // 2456-2463
+	974, 969, 963, 957, 950, 942, 934, 926, // 2464-2471
+	917, 908, 898, 888, 877, 867, 856, 844, // 2472-2479
+	833, 821, 809, 797, 784, 772, 759, 746, // 2480-2487
+	732, 719, 705, 691, 676, 662, 647, 632, // 2488-2495
+	617, 602, 586, 571, 555, 540, 524, 509, // 2496-2503
+	493, 477, 462, 446, 431, 416, 401, 387, // 2504-2511
+	373, 359, 345, 332, 320, 308, 297, 286, // 2512-2519
+	275, 266, 257, 249, 241, 234, 228, 222, // 2520-2527
+	217, 213, 209, 206, 203, 201, 199, 198, // 2528-2535
+	197, 196, 196, 196, 196, 197, 197, 198, // 2536-2543
+	198, 199, 199, 200, 200, 201, 201, 201, // 2544-2551
+	200, 200, 200, 199, 198, 197, 196, 195, // 2552-2559
+	194, 193, 192, 191, 190, 188, 187, 186, // 2560-2567
+	186, 185, 185, 185, 185, 185, 185, 186, // 2568-2575
+	186, 186, 187, 187, 187, 187, 186, 184, // 2576-2583
+	182, 178, 174, 169, 162, 154, 145, 134, // 2584-2591
+	122, 109, 95, 80, 64, 47, 30, 12, // 2592-2599
+	-6, -25, -43, -62, -80, -99, -116, -134, // 2600-2607
+	-151, -167, -182, -197, -212, -225, -238, -250, // 2608-2615
+	-262, -273, -284, -294, -304, -313, -322, -330, // 2616-2623
+	-339, -347, -355, -363, -371, -379, -388, -396, // 2624-2631
+	-404, -412, -421, -429, -438, -447, -456, -465, // 2632-2639
+	-474, -483, -493, -502, -511, -521, -530, -539, // 2640-2647
+	-549, -558, -567, -576, -584, -593, -601, -609, // 2648-2655
+	-617, -624, -632, -638, -645, -651, -657, -662, // 2656-2663
+	-667, -671, -675, -679, -682, -684, -686, -688, // 2664-2671
+	-689, -689, -689, -689, -687, -685, -683, -680, // 2672-2679
+	-677, -672, -668, -662, -656, -650, -643, -635, // 2680-2687
+	-627, -618, -609, -599, -588, -577, -566, -554, // 2688-2695
+	-541, -528, -515, -501, -487, -473, -458, -443, // 2696-2703
+	-428, -413, -397, -382, -366, -351, -336, -321, // 2704-2711
+	-306, -291, -277, -262, -249, -235, -222, -209, // 2712-2719
+	-196, -184, -172, -161, -150, -139, -128, -118, // 2720-2727
+	-108, -98, -88, -79, -70, -60, -51, -42, // 2728-2735
+	-33, -24, -16, -7, 2, 11, 19, 28, // 2736-2743
+	37, 45, 54, 62, 70, 78, 85, 93, // 2744-2751
+	100, 106, 113, 118, 124, 129, 133, 136, // 2752-2759
+	140, 142, 144, 145, 146, 146, 145, 144, // 2760-2767
+	143, 141, 138, 136, 133, 130, 126, 122, // 2768-2775
+	119, 115, 111, 107, 102, 98, 94, 90, // 2776-2783
+	85, 81, 76, 72, 67, 62, 57, 52, // 2784-2791
+	46, 40, 34, 27, 21, 14, 6, -2, // 2792-2799
+	-10, -18, -27, -36, -45, -55, -65, -74, // 2800-2807
+	-84, -94, -104, -114, -123, -132, -141, -150, // 2808-2815
+	-158, -165, -172, -178, -184, -189, -193, -196, // 2816-2823
+	-198, -199, -198, -197, -194, -190, -184, -176, // 2824-2831
+	-167, -157, -145, -131, -116, -100, -82, -64, // 2832-2839
+	-44, -23, -2, 21, 44, 69, 93, 119, // 2840-2847
+	144, 170, 197, 223, 250, 277, 304, 330, // 2848-2855
+	356, 383, 408, 434, 459, 483, 507, 530, // 2856-2863
+	553, 574, 596, 616, 636, 655, 673, 690, // 2864-2871
+	707, 723, 738, 752, 766, 779, 791, 803, // 2872-2879
+	814, 825, 835, 844, 853, 861, 869, 876, // 2880-2887
+	883, 889, 895, 900, 905, 909, 913, 917, // 2888-2895
+	920, 923, 925, 927, 928, 930, 931, 931, // 2896-2903
+	931, 931, 931, 931, 930, 929, 928, 926, // 2904-2911
+	924, 922, 920, 917, 914, 911, 908, 904, // 2912-2919
+	901, 896, 892, 887, 882, 877, 871, 865, // 2920-2927
+	859, 852, 845, 838, 830, 822, 813, 805, // 2928-2935
+	796, 786, 777, 767, 756, 746, 735, 724, // 2936-2943
+	713, 701, 690, 678, 666, 654, 642, 629, // 2944-2951
+	616, 604, 591, 577, 564, 551, 537, 523, // 2952-2959
+	509, 495, 480, 465, 450, 435, 419, 403, // 2960-2967
+	386, 370, 353, 335, 318, 300, 282, 263, // 2968-2975
+	244, 225, 206, 187, 168, 148, 128, 109, // 2976-2983
+	89, 70, 51, 32, 12, -6, -25, -44, // 2984-2991
+	-62, -81, -99, -117, -135, -152, -169, -186, // 2992-2999
+	-202, -218, -234, -249, -263, -278, -291, -304, // 3000-3007
+	-316, -328, -339, -350, -359, -369, -377, -385, // 3008-3015
+	-392, -399, -405, -411, -415, -420, -423, -426, // 3016-3023
+	-428, -430, -431, -432, -431, -430, -429, -427, // 3024-3031
+	-424, -420, -416, -412, -406, -400, -394, -387, // 3032-3039
+	-379, -371, -363, -354, -344, -335, -325, -314, // 3040-3047
+	-303, -292, -280, -267, -254, -240, -226, -211, // 3048-3055
+	-196, -180, -163, -146, -129, -111, -93, -75, // 3056-3063
+	-57, -39, -22, -4, 13, 29, 45, 60, // 3064-3071
+	75, 89, 102, 115, 126, 137, 147, 156, // 3072-3079
+	164, 171, 177, 183, 187, 191, 193, 195, // 3080-3087
+	195, 195, 194, 191, 188, 185, 180, 176, // 3088-3095
+	171, 166, 161, 157, 153, 149, 146, 143, // 3096-3103
+	141, 139, 138, 138, 137, 137, 138, 139, // 3104-3111
+	140, 141, 141, 142, 143, 143, 143, 142, // 3112-3119
+	140, 137, 133, 128, 121, 114, 105, 94, // 3120-3127
+	82, 69, 55, 40, 24, 6, -12, -30, // 3128-3135
+	-49, -69, -89, -109, -130, -150, -170, -190, // 3136-3143
+	-210, -230, -249, -267, -285, -303, -320, -336, // 3144-3151
+	-352, -367, -382, -396, -409, -422, -435, -446, // 3152-3159
+	-458, -468, -478, -488, -498, -506, -515, -523, // 3160-3167
+	-531, -539, -546, -553, -560, -566, -573, -579, // 3168-3175
+	-584, -590, -595, -599, -604, -608, -612, -615, // 3176-3183
+	-618, -621, -624, -626, -627, -629, -630, -630, // 3184-3191
+	-630, -630, -629, -628, -626, -625, -622, -620, // 3192-3199
+	-617, -614, -610, -607, -604, -600, -596, -593, // 3200-3207
+	-589, -586, -582, -578, -575, -571, -567, -563, // 3208-3215
+	-559, -555, -551, -546, -542, -537, -531, -525, // 3216-3223
+	-519, -513, -506, -499, -491, -483, -474, -466, // 3224-3231
+	-457, -447, -437, -428, -418, -407, -397, -387, // 3232-3239
+	-376, -366, -356, -346, -336, -326, -316, -307, // 3240-3247
+	-299, -290, -282, -275, -268, -262, -256, -251, // 3248-3255
+	-246, -241, -237, -233, -230, -226, -223, -220, // 3256-3263
+	-216, -213, -210, -206, -203, -199, -195, -191, // 3264-3271
+	-186, -181, -176, -171, -165, -159, -153, -146, // 3272-3279
+	-139, -132, -124, -116, -109, -101, -92, -84, // 3280-3287
+	-76, -67, -58, -50, -41, -32, -24, -15, // 3288-3295
+	-6, 2, 11, 20, 28, 37, 45, 54, // 3296-3303
+	63, 72, 81, 89, 98, 108, 117, 126, // 3304-3311
+	136, 145, 155, 165, 175, 185, 195, 206, // 3312-3319
+	216, 226, 237, 247, 257, 267, 277, 287, // 3320-3327
+	296, 305, 314, 323, 331, 338, 346, 352, // 3328-3335
+	359, 364, 370, 374, 379, 382, 386, 388, // 3336-3343
+	391, 392, 394, 395, 396, 396, 397, 397, // 3344-3351
+	397, 396, 396, 396, 396, 395, 395, 396, // 3352-3359
+	396, 397, 399, 401, 403, 406, 410, 414, // 3360-3367
+	420, 425, 432, 439, 446, 455, 463, 472, // 3368-3375
+	481, 491, 501, 510, 520, 530, 540, 550, // 3376-3383
+	559, 569, 578, 586, 594, 602, 609, 616, // 3384-3391
+	622, 628, 633, 637, 641, 644, 647, 649, // 3392-3399
+	651, 652, 652, 652, 652, 651, 650, 649, // 3400-3407
+	647, 646, 643, 641, 639, 636, 633, 630, // 3408-3415
+	627, 624, 621, 617, 613, 609, 605, 601, // 3416-3423
+	596, 591, 586, 581, 575, 569, 563, 556, // 3424-3431
+	549, 542, 534, 526, 517, 509, 499, 490, // 3432-3439
+	480, 470, 459, 448, 437, 426, 414, 402, // 3440-3447
+	390, 377, 365, 352, 340, 327, 314, 301, // 3448-3455
+	288, 274, 259, 244, 228, 210, 192, 172, // 3456-3463
+	151, 129, 105, 80, 54, 27, -1, -30, // 3464-3471
+	-59, -89, -120, -150, -181, -211, -241, -271, // 3472-3479
+	-301, -330, -358, -385, -411, -436, -461, -484, // 3480-3487
+	-506, -528, -548, -568, -586, -604, -620, -636, // 3488-3495
+	-651, -664, -677, -689, -699, -708, -716, -723, // 3496-3503
+	-728, -731, -733, -734, -733, -730, -726, -721, // 3504-3511
+	-713, -705, -695, -684, -672, -659, -645, -630, // 3512-3519
+	-614, -598, -581, -564, -546, -528, -510, -492, // 3520-3527
+	-473, -455, -436, -417, -399, -380, -362, -344, // 3528-3535
+	-325, -307, -289, -271, -253, -235, -217, -199, // 3536-3543
+	-181, -164, -146, -129, -112, -95, -78, -61, // 3544-3551
+	-45, -29, -14, 1, 15, 29, 43, 56, // 3552-3559
+	68, 80, 91, 102, 112, 121, 130, 138, // 3560-3567
+	146, 154, 161, 167, 174, 179, 185, 191, // 3568-3575
+	196, 201, 206, 211, 215, 220, 224, 228, // 3576-3583
+	233, 236, 240, 244, 247, 250, 253, 255, // 3584-3591
+	257, 258, 260, 260, 261, 260, 260, 258, // 3592-3599
+	256, 254, 251, 247, 243, 239, 233, 228, // 3600-3607
+	221, 215, 207, 200, 192, 183, 175, 166, // 3608-3615
+	156, 147, 137, 127, 118, 108, 98, 89, // 3616-3623
+	79, 70, 61, 52, 43, 34, 26, 17, // 3624-3631
+	9, 1, -7, -16, -24, -32, -40, -48, // 3632-3639
+	-57, -65, -74, -82, -91, -100, -109, -118, // 3640-3647
+	-127, -137, -146, -156, -166, -176, -186, -196, // 3648-3655
+	-206, -216, -226, -236, -247, -257, -267, -278, // 3656-3663
+	-288, -298, -308, -318, -328, -338, -348, -357, // 3664-3671
+	-367, -376, -385, -393, -401, -409, -417, -424, // 3672-3679
+	-431, -437, -443, -449, -454, -459, -463, -466, // 3680-3687
+	-470, -472, -474, -476, -477, -478, -479, -479, // 3688-3695
+	-478, -477, -475, -472, -469, -465, -461, -455, // 3696-3703
+	-449, -441, -433, -424, -413, -402, -390, -376, // 3704-3711
+	-362, -347, -331, -314, -296, -278, -258, -238, // 3712-3719
+	-217, -196, -173, -151, -128, -105, -81, -57, // 3720-3727
+	-33, -10, 14, 37, 61, 83, 106, 128, // 3728-3735
+	150, 171, 191, 211, 231, 250, 268, 285, // 3736-3743
+	302, 319, 335, 351, 366, 381, 396, 410, // 3744-3751
+	425, 439, 453, 467, 481, 495, 509, 523, // 3752-3759
+	537, 550, 563, 575, 588, 599, 610, 621, // 3760-3767
+	631, 640, 648, 655, 662, 667, 672, 675, // 3768-3775
+	678, 680, 680, 680, 679, 677, 674, 670, // 3776-3783
+	666, 660, 654, 647, 640, 631, 623, 613, // 3784-3791
+	603, 593, 582, 570, 558, 546, 533, 520, // 3792-3799
+	507, 494, 480, 466, 452, 438, 424, 410, // 3800-3807
+	396, 382, 368, 355, 341, 328, 315, 302, // 3808-3815
+	290, 277, 266, 254, 243, 232, 221, 212, // 3816-3823
+	202, 193, 184, 176, 169, 162, 155, 149, // 3824-3831
+	144, 139, 135, 132, 128, 126, 124, 122, // 3832-3839
+	121, 120, 119, 119, 119, 119, 120, 121, // 3840-3847
+	121, 122, 124, 125, 126, 127, 128, 129, // 3848-3855
+	130, 131, 131, 131, 131, 131, 130, 128, // 3856-3863
+	127, 124, 121, 118, 114, 109, 104, 99, // 3864-3871
+	93, 87, 80, 74, 68, 61, 55, 49, // 3872-3879
+	43, 38, 33, 28, 24, 21, 18, 15, // 3880-3887
+	13, 12, 11, 11, 11, 11, 12, 14, // 3888-3895
+	15, 17, 19, 22, 25, 27, 30, 33, // 3896-3903
+	36, 39, 41, 44, 46, 49, 51, 53, // 3904-3911
+	55, 56, 58, 59, 60, 61, 61, 62, // 3912-3919
+	62, 62, 61, 61, 60, 59, 58, 57, // 3920-3927
+	56, 54, 52, 50, 47, 44, 40, 36, // 3928-3935
+	32, 27, 22, 16, 9, 2, -6, -14, // 3936-3943
+	-23, -32, -42, -52, -62, -73, -85, -96, // 3944-3951
+	-108, -120, -132, -144, -156, -169, -181, -193, // 3952-3959
+	-204, -216, -227, -238, -249, -259, -269, -279, // 3960-3967
+	-288, -297, -305, -313, -321, -328, -335, -342, // 3968-3975
+	-348, -354, -360, -366, -372, -378, -384, -391, // 3976-3983
+	-397, -404, -411, -418, -426, -433, -441, -449, // 3984-3991
+	-457, -464, -472, -479, -485, -492, -498, -503, // 3992-3999
+	-508, -512, -515, -518, -520, -522, -523, -523, // 4000-4007
+	-523, -522, -521, -520, -518, -515, -512, -509, // 4008-4015
+	-506, -502, -498, -493, -488, -483, -478, -473, // 4016-4023
+	-467, -461, -455, -449, -443, -437, -431, -425, // 4024-4031
+	-418, -412, -406, -400, -394, -389, -383, -378, // 4032-4039
+	-373, -368, -363, -358, -354, -349, -345, -342, // 4040-4047
+	-338, -335, -332, -329, -327, -325, -324, -323, // 4048-4055
+	-322, -321, -321, -321, -321, -321, -322, -322, // 4056-4063
+	-323, -323, -324, -324, -324, -325, -325, -325, // 4064-4071
+	-326, -326, -326, -326, -326, -326, -326, -325, // 4072-4079
+	-325, -325, -325, -324, -324, -323, -322, -322, // 4080-4087
+	-320, -319, -318, -316, -314, -312, -309, -306, // 4088-4095
+	-304, -300, -297, -293, -289, -286, -282, -278, // 4096-4103
+	-274, -270, -266, -262, -259, -256, -253, -251, // 4104-4111
+	-249, -248, -247, -247, -247, -248, -251, -254, // 4112-4119
+	-258, -263, -269, -277, -285, -295, -305, -316, // 4120-4127
+	-329, -342, -355, -369, -384, -399, -414, -429, // 4128-4135
+	-444, -459, -474, -489, -503, -517, -530, -543, // 4136-4143
+	-555, -566, -577, -587, -596, -605, -612, -619, // 4144-4151
+	-625, -630, -634, -637, -640, -641, -641, -641, // 4152-4159
+	-639, -637, -633, -629, -624, -618, -611, -604, // 4160-4167
+	-595, -586, -577, -567, -556, -544, -532, -520, // 4168-4175
+	-507, -494, -480, -466, -452, -437, -422, -407, // 4176-4183
+	-391, -375, -359, -343, -326, -310, -293, -276, // 4184-4191
+	-258, -241, -223, -206, -188, -170, -152, -133, // 4192-4199
+	-115, -96, -77, -59, -39, -20, -1, 19, // 4200-4207
+	38, 58, 77, 97, 117, 136, 156, 176, // 4208-4215
+	195, 215, 234, 253, 272, 291, 310, 328, // 4216-4223
+	346, 364, 382, 400, 417, 434, 451, 467, // 4224-4231
+	483, 499, 514, 529, 544, 558, 571, 584, // 4232-4239
+	597, 609, 620, 631, 641, 651, 659, 667, // 4240-4247
+	674, 681, 686, 690, 694, 697, 699, 700, // 4248-4255
+	700, 700, 699, 697, 694, 691, 687, 682, // 4256-4263
+	677, 672, 666, 660, 654, 647, 640, 633, // 4264-4271
+	626, 619, 612, 604, 597, 589, 582, 574, // 4272-4279
+	567, 559, 551, 544, 537, 529, 522, 514, // 4280-4287
+	507, 499, 492, 485, 477, 470, 463, 455, // 4288-4295
+	448, 441, 434, 426, 419, 412, 405, 398, // 4296-4303
+	391, 384, 378, 371, 364, 358, 352, 346, // 4304-4311
+	340, 334, 328, 323, 318, 313, 308, 303, // 4312-4319
+	299, 294, 290, 286, 282, 278, 274, 269, // 4320-4327
+	265, 261, 257, 253, 249, 245, 241, 237, // 4328-4335
+	233, 229, 225, 222, 219, 216, 214, 212, // 4336-4343
+	210, 209, 209, 209, 209, 210, 211, 213, // 4344-4351
+	215, 217, 220, 223, 226, 229, 233, 236, // 4352-4359
+	239, 242, 245, 247, 249, 250, 251, 251, // 4360-4367
+	251, 250, 248, 247, 244, 242, 239, 236, // 4368-4375
+	233, 229, 226, 223, 221, 218, 216, 214, // 4376-4383
+	213, 212, 211, 212, 212, 214, 216, 219, // 4384-4391
+	223, 227, 232, 238, 245, 252, 261, 270, // 4392-4399
+	279, 289, 300, 311, 322, 334, 346, 358, // 4400-4407
+	370, 383, 396, 408, 421, 434, 447, 460, // 4408-4415
+	473, 486, 498, 510, 522, 534, 545, 555, // 4416-4423
+	566, 575, 584, 592, 600, 606, 612, 617, // 4424-4431
+	621, 624, 626, 627, 628, 627, 625, 623, // 4432-4439
+	619, 615, 610, 604, 597, 589, 581, 572, // 4440-4447
+	563, 552, 541, 530, 518, 505, 492, 479, // 4448-4455
+	465, 451, 437, 422, 407, 392, 376, 360, // 4456-4463
+	344, 328, 312, 296, 279, 263, 246, 230, // 4464-4471
+	213, 197, 180, 164, 148, 132, 116, 101, // 4472-4479
+	85, 70, 55, 41, 27, 13, -1, -14, // 4480-4487
+	-27, -40, -52, -65, -77, -88, -100, -111, // 4488-4495
+	-122, -133, -143, -154, -164, -174, -184, -194, // 4496-4503
+	-204, -214, -224, -234, -243, -253, -262, -272, // 4504-4511
+	-281, -290, -299, -308, -317, -326, -334, -342, // 4512-4519
+	-350, -358, -365, -372, -379, -386, -392, -398, // 4520-4527
+	-404, -409, -414, -419, -423, -427, -430, -434, // 4528-4535
+	-437, -439, -441, -443, -445, -446, -446, -447, // 4536-4543
+	-447, -446, -445, -444, -442, -440, -438, -435, // 4544-4551
+	-432, -429, -425, -421, -416, -412, -407, -402, // 4552-4559
+	-397, -391, -386, -380, -375, -370, -364, -359, // 4560-4567
+	-354, -349, -344, -339, -335, -331, -327, -324, // 4568-4575
+	-321, -318, -316, -314, -313, -311, -311, -310, // 4576-4583
+	-310, -311, -312, -313, -314, -316, -319, -321, // 4584-4591
+	-324, -327, -330, -334, -337, -341, -345, -348, // 4592-4599
+	-352, -356, -360, -364, -368, -372, -376, -380, // 4600-4607
+	-383, -387, -390, -393, -396, -399, -401, -404, // 4608-4615
+	-406, -408, -409, -410, -412, -412, -413, -414, // 4616-4623
+	-414, -414, -414, -415, -415, -415, -415, -415, // 4624-4631
+	-416, -416, -417, -418, -419, -420, -421, -423, // 4632-4639
+	-424, -426, -428, -430, -432, -434, -437, -439, // 4640-4647
+	-441, -444, -446, -448, -450, -452, -454, -455, // 4648-4655
+	-456, -457, -457, -457, -456, -455, -454, -452, // 4656-4663
+	-450, -448, -446, -443, -440, -437, -435, -432, // 4664-4671
+	-429, -427, -425, -423, -421, -419, -418, -417, // 4672-4679
+	-416, -415, -414, -413, -412, -412, -410, -409, // 4680-4687
+	-408, -406, -404, -402, -399, -396, -393, -389, // 4688-4695
+	-384, -379, -374, -368, -362, -355, -347, -339, // 4696-4703
+	-331, -322, -313, -303, -293, -283, -272, -261, // 4704-4711
+	-251, -239, -228, -217, -206, -194, -183, -172, // 4712-4719
+	-161, -151, -140, -130, -119, -109, -99, -90, // 4720-4727
+	-80, -71, -62, -53, -44, -36, -28, -20, // 4728-4735
+	-12, -4, 3, 10, 17, 24, 31, 38, // 4736-4743
+	44, 51, 58, 64, 71, 77, 84, 91, // 4744-4751
+	98, 104, 111, 118, 125, 132, 138, 145, // 4752-4759
+	151, 158, 164, 170, 176, 182, 187, 192, // 4760-4767
+	197, 202, 206, 210, 214, 218, 221, 224, // 4768-4775
+	226, 229, 231, 233, 234, 236, 237, 238, // 4776-4783
+	238, 238, 239, 239, 238, 238, 237, 236, // 4784-4791
+	234, 232, 230, 228, 225, 222, 218, 214, // 4792-4799
+	210, 205, 200, 195, 189, 183, 176, 170, // 4800-4807
+	163, 156, 148, 141, 133, 125, 117, 110, // 4808-4815
+	102, 95, 87, 80, 73, 67, 60, 54, // 4816-4823
+	49, 43, 38, 33, 29, 25, 21, 18, // 4824-4831
+	15, 12, 9, 7, 4, 2, 0, -2, // 4832-4839
+	-3, -5, -7, -8, -10, -11, -13, -14, // 4840-4847
+	-15, -17, -18, -19, -19, -20, -21, -21, // 4848-4855
+	-21, -20, -20, -19, -17, -15, -13, -10, // 4856-4863
+	-6, -2, 2, 8, 13, 20, 27, 34, // 4864-4871
+	42, 51, 60, 69, 79, 89, 99, 109, // 4872-4879
+	119, 130, 140, 150, 160, 170, 180, 190, // 4880-4887
+	199, 209, 218, 226, 235, 243, 251, 259, // 4888-4895
+	267, 274, 281, 288, 295, 301, 308, 314, // 4896-4903
+	320, 325, 331, 336, 342, 347, 352, 356, // 4904-4911
+	361, 365, 369, 372, 376, 379, 382, 385, // 4912-4919
+	387, 389, 392, 394, 396, 398, 400, 402, // 4920-4927
+	405, 407, 409, 411, 414, 416, 418, 420, // 4928-4935
+	422, 423, 424, 425, 426, 426, 426, 426, // 4936-4943
+	425, 424, 422, 420, 417, 415, 411, 408, // 4944-4951
+	404, 400, 395, 390, 385, 380, 375, 369, // 4952-4959
+	363, 356, 350, 343, 336, 328, 321, 313, // 4960-4967
+	304, 295, 286, 277, 267, 257, 247, 236, // 4968-4975
+	225, 213, 201, 189, 176, 163, 150, 136, // 4976-4983
+	122, 108, 93, 79, 64, 48, 33, 17, // 4984-4991
+	1, -15, -32, -49, -66, -83, -101, -118, // 4992-4999
+	-136, -153, -171, -188, -206, -223, -240, -256, // 5000-5007
+	-273, -289, -304, -319, -334, -348, -361, -374, // 5008-5015
+	-387, -398, -409, -420, -429, -438, -447, -454, // 5016-5023
+	-461, -467, -472, -476, -480, -483, -485, -487, // 5024-5031
+	-487, -488, -487, -486, -485, -483, -480, -477, // 5032-5039
+	-474, -470, -466, -462, -458, -453, -448, -443, // 5040-5047
+	-438, -433, -428, -422, -416, -411, -405, -399, // 5048-5055
+	-393, -386, -380, -374, -367, -360, -354, -347, // 5056-5063
+	-340, -333, -326, -318, -311, -304, -296, -288, // 5064-5071
+	-280, -272, -264, -256, -247, -238, -229, -219, // 5072-5079
+	-210, -200, -190, -180, -170, -159, -149, -138, // 5080-5087
+	-127, -116, -106, -95, -85, -74, -64, -54, // 5088-5095
+	-44, -35, -25, -17, -8, 0, 7, 14, // 5096-5103
+	21, 27, 33, 38, 43, 47, 50, 53, // 5104-5111
+	56, 58, 60, 61, 62, 62, 62, 61, // 5112-5119
+	61, 60, 58, 56, 54, 52, 50, 47, // 5120-5127
+	44, 41, 38, 35, 31, 28, 24, 21, // 5128-5135
+	17, 14, 10, 6, 2, -1, -5, -9, // 5136-5143
+	-12, -16, -20, -23, -27, -30, -34, -38, // 5144-5151
+	-41, -44, -48, -51, -54, -56, -59, -62, // 5152-5159
+	-64, -66, -68, -70, -72, -74, -76, -77, // 5160-5167
+	-78, -80, -81, -82, -83, -84, -85, -86, // 5168-5175
+	-87, -88, -88, -89, -90, -91, -91, -92, // 5176-5183
+	-93, -94, -95, -96, -97, -98, -99, -100, // 5184-5191
+	-101, -102, -104, -105, -106, -108, -109, -110, // 5192-5199
+	-111, -112, -113, -114, -115, -116, -116, -116, // 5200-5207
+	-116, -116, -116, -116, -115, -114, -113, -112, // 5208-5215
+	-111, -110, -109, -107, -106, -104, -103, -101, // 5216-5223
+	-100, -98, -96, -95, -93, -91, -89, -88, // 5224-5231
+	-86, -84, -81, -79, -77, -74, -72, -69, // 5232-5239
+	-66, -62, -59, -55, -51, -47, -42, -37, // 5240-5247
+	-31, -25, -19, -12, -4, 4, 12, 20, // 5248-5255
+	29, 38, 48, 58, 67, 77, 86, 96, // 5256-5263
+	105, 114, 123, 132, 140, 147, 155, 161, // 5264-5271
+	167, 173, 178, 183, 187, 190, 193, 196, // 5272-5279
+	198, 199, 200, 201, 201, 201, 201, 200, // 5280-5287
+	199, 197, 195, 193, 191, 188, 185, 182, // 5288-5295
+	179, 176, 172, 169, 165, 162, 158, 154, // 5296-5303
+	150, 146, 142, 138, 134, 130, 126, 122, // 5304-5311
+	117, 113, 108, 103, 98, 93, 87, 81, // 5312-5319
+	76, 70, 63, 57, 51, 44, 38, 32, // 5320-5327
+	26, 21, 15, 10, 5, 1, -3, -6, // 5328-5335
+	-9, -11, -13, -14, -15, -15, -15, -14, // 5336-5343
+	-13, -11, -9, -6, -4, 0, 3, 6, // 5344-5351
+	10, 14, 18, 21, 25, 29, 32, 36, // 5352-5359
+	39, 43, 46, 49, 52, 55, 58, 61, // 5360-5367
+	63, 66, 69, 72, 75, 78, 82, 85, // 5368-5375
+	89, 93, 97, 101, 105, 110, 114, 119, // 5376-5383
+	124, 129, 134, 139, 144, 149, 154, 159, // 5384-5391
+	164, 170, 175, 180, 185, 190, 195, 200, // 5392-5399
+	205, 210, 215, 220, 225, 229, 234, 239, // 5400-5407
+	244, 248, 253, 258, 263, 267, 272, 277, // 5408-5415
+	282, 286, 291, 295, 299, 303, 307, 311, // 5416-5423
+	315, 318, 321, 323, 326, 327, 329, 330, // 5424-5431
+	330, 330, 330, 329, 327, 325, 323, 319, // 5432-5439
+	315, 311, 306, 300, 294, 287, 280, 272, // 5440-5447
+	263, 254, 244, 234, 223, 212, 200, 189, // 5448-5455
+	176, 164, 151, 138, 125, 112, 99, 86, // 5456-5463
+	73, 60, 48, 35, 23, 10, -2, -13, // 5464-5471
+	-25, -36, -47, -58, -69, -80, -90, -100, // 5472-5479
+	-111, -121, -131, -141, -150, -160, -170, -179, // 5480-5487
+	-189, -198, -208, -217, -226, -235, -244, -253, // 5488-5495
+	-262, -270, -279, -287, -295, -302, -309, -316, // 5496-5503
+	-323, -329, -335, -340, -345, -349, -353, -357, // 5504-5511
+	-360, -363, -366, -368, -369, -371, -371, -372, // 5512-5519
+	-372, -372, -372, -371, -371, -369, -368, -367, // 5520-5527
+	-365, -363, -361, -358, -355, -352, -349, -346, // 5528-5535
+	-342, -338, -333, -328, -323, -318, -312, -305, // 5536-5543
+	-298, -291, -283, -275, -266, -257, -247, -237, // 5544-5551
+	-227, -216, -205, -194, -182, -171, -159, -146, // 5552-5559
+	-134, -121, -109, -96, -83, -71, -58, -45, // 5560-5567
+	-32, -19, -7, 6, 19, 31, 44, 56, // 5568-5575
+	68, 80, 92, 104, 116, 127, 138, 149, // 5576-5583
+	160, 170, 181, 191, 201, 211, 220, 230, // 5584-5591
+	239, 247, 256, 264, 272, 279, 286, 293, // 5592-5599
+	299, 305, 310, 314, 319, 322, 325, 328, // 5600-5607
+	330, 331, 332, 332, 332, 331, 330, 328, // 5608-5615
+	325, 322, 319, 315, 311, 307, 302, 298, // 5616-5623
+	293, 289, 284, 280, 275, 271, 267, 263, // 5624-5631
+	259, 256, 252, 249, 246, 242, 239, 236, // 5632-5639
+	233, 229, 226, 222, 219, 215, 211, 207, // 5640-5647
+	202, 198, 193, 188, 182, 176, 170, 164, // 5648-5655
+	157, 150, 143, 136, 128, 120, 111, 103, // 5656-5663
+	94, 84, 75, 65, 55, 44, 34, 23, // 5664-5671
+	12, 1, -10, -22, -33, -45, -57, -68, // 5672-5679
+	-80, -91, -103, -114, -125, -136, -147, -158, // 5680-5687
+	-168, -178, -188, -198, -207, -216, -225, -234, // 5688-5695
+	-242, -250, -257, -264, -271, -277, -283, -288, // 5696-5703
+	-293, -298, -302, -305, -309, -311, -314, -315, // 5704-5711
+	-316, -317, -317, -316, -315, -313, -311, -308, // 5712-5719
+	-304, -300, -295, -290, -283, -277, -270, -262, // 5720-5727
+	-254, -245, -236, -226, -216, -206, -196, -185, // 5728-5735
+	-174, -163, -152, -140, -129, -118, -106, -95, // 5736-5743
+	-84, -73, -62, -51, -40, -30, -20, -10, // 5744-5751
+	0, 10, 19, 28, 37, 46, 54, 62, // 5752-5759
+	70, 78, 86, 93, 101, 108, 115, 121, // 5760-5767
+	128, 134, 140, 146, 151, 157, 162, 166, // 5768-5775
+	171, 175, 179, 182, 185, 188, 190, 193, // 5776-5783
+	194, 196, 197, 198, 199, 199, 200, 199, // 5784-5791
+	199, 199, 198, 197, 196, 194, 193, 191, // 5792-5799
+	189, 187, 184, 182, 179, 176, 173, 169, // 5800-5807
+	165, 161, 157, 153, 148, 143, 138, 132, // 5808-5815
+	127, 121, 115, 109, 102, 95, 89, 82, // 5816-5823
+	75, 67, 60, 53, 45, 38, 30, 23, // 5824-5831
+	15, 8, 0, -7, -14, -21, -27, -34, // 5832-5839
+	-40, -46, -52, -58, -64, -69, -74, -79, // 5840-5847
+	-84, -88, -93, -97, -101, -104, -108, -111, // 5848-5855
+	-114, -117, -120, -122, -124, -126, -128, -130, // 5856-5863
+	-132, -134, -135, -136, -138, -139, -140, -141, // 5864-5871
+	-143, -143, -144, -145, -146, -146, -146, -146, // 5872-5879
+	-146, -146, -145, -145, -144, -143, -141, -140, // 5880-5887
+	-138, -136, -134, -131, -129, -126, -123, -120, // 5888-5895
+	-116, -113, -109, -105, -100, -96, -91, -87, // 5896-5903
+	-82, -77, -72, -68, -63, -58, -53, -49, // 5904-5911
+	-44, -40, -36, -32, -28, -24, -20, -17, // 5912-5919
+	-13, -10, -6, -3, 0, 4, 7, 11, // 5920-5927
+	14, 18, 22, 25, 29, 33, 37, 41, // 5928-5935
+	45, 49, 53, 57, 61, 65, 69, 73, // 5936-5943
+	76, 80, 83, 86, 89, 91, 93, 95, // 5944-5951
+	97, 98, 99, 99, 100, 100, 100, 100, // 5952-5959
+	99, 99, 98, 97, 96, 95, 94, 93, // 5960-5967
+	92, 91, 90, 88, 87, 85, 83, 82, // 5968-5975
+	80, 77, 75, 73, 70, 67, 63, 60, // 5976-5983
+	56, 52, 48, 43, 38, 33, 28, 22, // 5984-5991
+	16, 10, 4, -2, -8, -15, -21, -28, // 5992-5999
+	-34, -41, -47, -53, -59, -65, -71, -76, // 6000-6007
+	-82, -87, -91, -96, -100, -104, -107, -111, // 6008-6015
+	-113, -116, -118, -120, -121, -123, -123, -124, // 6016-6023
+	-124, -124, -123, -122, -121, -119, -117, -115, // 6024-6031
+	-113, -110, -107, -103, -99, -96, -91, -87, // 6032-6039
+	-82, -78, -73, -68, -63, -57, -52, -46, // 6040-6047
+	-40, -34, -28, -22, -16, -10, -3, 3, // 6048-6055
+	10, 17, 23, 30, 37, 44, 51, 58, // 6056-6063
+	66, 73, 80, 87, 94, 101, 108, 115, // 6064-6071
+	122, 129, 135, 142, 148, 155, 161, 167, // 6072-6079
+	172, 178, 183, 189, 194, 199, 204, 208, // 6080-6087
+	213, 217, 221, 225, 229, 233, 237, 241, // 6088-6095
+	244, 248, 251, 255, 258, 261, 265, 268, // 6096-6103
+	271, 274, 277, 280, 283, 286, 288, 290, // 6104-6111
+	292, 294, 296, 297, 297, 298, 298, 298, // 6112-6119
+	297, 296, 294, 292, 289, 286, 283, 279, // 6120-6127
+	274, 269, 264, 258, 252, 246, 239, 232, // 6128-6135
+	224, 216, 208, 199, 191, 182, 173, 163, // 6136-6143
+	154, 145, 135, 126, 116, 107, 97, 87, // 6144-6151
+	78, 68, 59, 50, 40, 31, 22, 13, // 6152-6159
+	4, -6, -15, -23, -32, -41, -50, -58, // 6160-6167
+	-67, -75, -83, -91, -99, -107, -114, -121, // 6168-6175
+	-128, -135, -142, -148, -154, -160, -165, -170, // 6176-6183
+	-175, -180, -184, -188, -192, -196, -199, -202, // 6184-6191
+	-204, -207, -209, -211, -212, -214, -215, -215, // 6192-6199
+	-216, -216, -216, -215, -214, -213, -212, -210, // 6200-6207
+	-208, -205, -202, -199, -195, -191, -187, -182, // 6208-6215
+	-177, -171, -165, -159, -152, -146, -138, -131, // 6216-6223
+	-123, -115, -107, -98, -90, -81, -72, -63, // 6224-6231
+	-54, -45, -35, -26, -17, -8, 1, 9, // 6232-6239
+	18, 26, 34, 42, 50, 57, 65, 71, // 6240-6247
+	78, 84, 90, 96, 101, 106, 111, 115, // 6248-6255
+	119, 123, 126, 129, 132, 135, 137, 139, // 6256-6263
+	141, 143, 144, 146, 147, 148, 149, 150, // 6264-6271
+	151, 151, 152, 152, 152, 153, 153, 153, // 6272-6279
+	153, 152, 152, 152, 151, 151, 150, 149, // 6280-6287
+	148, 147, 145, 144, 142, 140, 138, 135, // 6288-6295
+	133, 129, 126, 123, 119, 114, 110, 105, // 6296-6303
+	100, 95, 89, 83, 77, 71, 65, 58, // 6304-6311
+	52, 45, 38, 31, 24, 17, 10, 2, // 6312-6319
+	-5, -12, -20, -27, -35, -43, -50, -58, // 6320-6327
+	-66, -74, -82, -91, -99, -107, -115, -124, // 6328-6335
+	-132, -140, -149, -157, -165, -174, -182, -190, // 6336-6343
+	-198, -205, -213, -220, -228, -235, -242, -248, // 6344-6351
+	-255, -261, -267, -272, -277, -282, -287, -291, // 6352-6359
+	-296, -299, -303, -306, -309, -311, -313, -315, // 6360-6367
+	-317, -318, -320, -320, -321, -321, -321, -321, // 6368-6375
+	-320, -320, -319, -317, -316, -314, -312, -309, // 6376-6383
+	-306, -303, -300, -296, -292, -288, -284, -279, // 6384-6391
+	-274, -268, -263, -257, -250, -244, -237, -230, // 6392-6399
+	-222, -215, -207, -199, -191, -182, -173, -165, // 6400-6407
+	-155, -146, -137, -127, -118, -108, -98, -88, // 6408-6415
+	-78, -68, -58, -48, -38, -29, -19, -9, // 6416-6423
+	1, 10, 20, 29, 38, 47, 56, 64, // 6424-6431
+	72, 80, 88, 96, 103, 111, 117, 124, // 6432-6439
+	131, 137, 143, 148, 153, 158, 163, 167, // 6440-6447
+	171, 175, 178, 181, 184, 186, 188, 190, // 6448-6455
+	191, 192, 192, 192, 192, 191, 190, 189, // 6456-6463
+	187, 185, 183, 180, 177, 173, 169, 165, // 6464-6471
+	161, 156, 151, 146, 140, 135, 129, 123, // 6472-6479
+	117, 111, 105, 99, 93, 87, 81, 75, // 6480-6487
+	69, 63, 58, 52, 46, 41, 35, 30, // 6488-6495
+	25, 20, 14, 9, 4, -1, -6, -11, // 6496-6503
+	-17, -22, -27, -33, -39, -44, -50, -56, // 6504-6511
+	-63, -69, -75, -81, -87, -94, -100, -106, // 6512-6519
+	-111, -117, -122, -126, -130, -134, -138, -141, // 6520-6527
+	-143, -145, -146, -147, -147, -146, -146, -144, // 6528-6535
+	-143, -140, -138, -135, -132, -128, -124, -121, // 6536-6543
+	-116, -112, -108, -103, -99, -95, -90, -86, // 6544-6551
+	-81, -77, -72, -68, -64, -60, -56, -52, // 6552-6559
+	-48, -44, -41, -37, -33, -29, -25, -21, // 6560-6567
+	-17, -13, -9, -4, 0, 5, 9, 14, // 6568-6575
+	19, 24, 28, 33, 38, 43, 48, 53, // 6576-6583
+	57, 62, 67, 71, 75, 80, 84, 88, // 6584-6591
+	91, 95, 99, 102, 105, 109, 112, 115, // 6592-6599
+	117, 120, 123, 125, 127, 130, 132, 134, // 6600-6607
+	136, 137, 139, 140, 142, 143, 144, 145, // 6608-6615
+	146, 146, 147, 147, 147, 147, 147, 147, // 6616-6623
+	146, 146, 145, 144, 142, 141, 139, 137, // 6624-6631
+	135, 133, 130, 127, 124, 121, 117, 114, // 6632-6639
+	110, 106, 101, 97, 92, 87, 82, 77, // 6640-6647
+	71, 66, 60, 55, 49, 43, 37, 31, // 6648-6655
+	25, 19, 13, 7, 2, -4, -10, -16, // 6656-6663
+	-22, -27, -33, -38, -44, -49, -54, -59, // 6664-6671
+	-65, -70, -75, -80, -84, -89, -94, -98, // 6672-6679
+	-103, -107, -112, -116, -120, -123, -127, -131, // 6680-6687
+	-134, -137, -139, -142, -144, -146, -147, -149, // 6688-6695
+	-150, -150, -150, -150, -150, -149, -148, -147, // 6696-6703
+	-145, -143, -141, -138, -136, -133, -130, -127, // 6704-6711
+	-124, -121, -117, -114, -110, -107, -103, -100, // 6712-6719
+	-96, -93, -89, -85, -82, -78, -75, -71, // 6720-6727
+	-67, -63, -59, -56, -52, -47, -43, -39, // 6728-6735
+	-34, -29, -25, -20, -14, -9, -3, 2, // 6736-6743
+	8, 14, 20, 27, 33, 39, 46, 52, // 6744-6751
+	59, 65, 72, 78, 84, 90, 96, 102, // 6752-6759
+	108, 113, 118, 123, 127, 132, 136, 140, // 6760-6767
+	143, 147, 150, 153, 155, 157, 159, 161, // 6768-6775
+	163, 164, 165, 166, 166, 166, 166, 166, // 6776-6783
+	165, 164, 163, 162, 160, 158, 156, 154, // 6784-6791
+	151, 148, 145, 142, 138, 134, 131, 126, // 6792-6799
+	122, 118, 113, 108, 103, 98, 93, 87, // 6800-6807
+	82, 76, 70, 64, 58, 52, 46, 40, // 6808-6815
+	33, 27, 20, 14, 7, 1, -6, -12, // 6816-6823
+	-19, -25, -32, -38, -44, -51, -57, -63, // 6824-6831
+	-69, -75, -80, -86, -91, -96, -102, -107, // 6832-6839
+	-111, -116, -121, -125, -130, -134, -138, -143, // 6840-6847
+	-147, -151, -154, -158, -162, -165, -169, -172, // 6848-6855
+	-175, -178, -181, -183, -186, -188, -190, -192, // 6856-6863
+	-194, -195, -197, -198, -199, -199, -199, -199, // 6864-6871
+	-199, -199, -198, -197, -195, -194, -192, -189, // 6872-6879
+	-187, -184, -181, -178, -174, -171, -167, -162, // 6880-6887
+	-158, -153, -149, -143, -138, -133, -127, -121, // 6888-6895
+	-115, -109, -102, -96, -89, -82, -75, -68, // 6896-6903
+	-61, -53, -46, -38, -31, -24, -16, -9, // 6904-6911
+	-1, 6, 13, 20, 27, 34, 41, 47, // 6912-6919
+	54, 60, 66, 72, 78, 84, 89, 95, // 6920-6927
+	100, 105, 109, 114, 118, 122, 126, 129, // 6928-6935
+	133, 136, 139, 141, 144, 146, 148, 150, // 6936-6943
+	152, 153, 155, 156, 157, 158, 158, 159, // 6944-6951
+	159, 160, 160, 160, 160, 159, 159, 158, // 6952-6959
+	158, 157, 156, 154, 153, 151, 149, 147, // 6960-6967
+	145, 142, 140, 137, 133, 130, 126, 123, // 6968-6975
+	119, 114, 110, 105, 100, 95, 90, 85, // 6976-6983
+	79, 73, 68, 62, 55, 49, 43, 37, // 6984-6991
+	30, 24, 17, 11, 4, -2, -8, -14, // 6992-6999
+	-21, -27, -33, -39, -44, -50, -56, -61, // 7000-7007
+	-66, -71, -76, -81, -86, -90, -95, -99, // 7008-7015
+	-103, -107, -110, -114, -117, -120, -123, -126, // 7016-7023
+	-129, -131, -134, -136, -138, -140, -142, -144, // 7024-7031
+	-145, -147, -148, -149, -150, -151, -152, -153, // 7032-7039
+	-153, -153, -153, -153, -152, -152, -151, -150, // 7040-7047
+	-149, -147, -145, -144, -142, -139, -137, -134, // 7048-7055
+	-132, -129, -126, -122, -119, -115, -112, -108, // 7056-7063
+	-104, -100, -95, -91, -87, -82, -78, -73, // 7064-7071
+	-68, -63, -59, -54, -49, -44, -39, -34, // 7072-7079
+	-29, -25, -20, -15, -10, -6, -1, 3, // 7080-7087
+	7, 11, 15, 19, 22, 25, 28, 31, // 7088-7095
+	33, 35, 37, 39, 41, 42, 43, 44, // 7096-7103
+	45, 45, 45, 45, 45, 45, 45, 44, // 7104-7111
+	44, 43, 42, 42, 41, 40, 39, 38, // 7112-7119
+	37, 36, 35, 34, 33, 32, 31, 30, // 7120-7127
+	29, 28, 27, 25, 24, 23, 21, 20, // 7128-7135
+	18, 17, 15, 13, 12, 10, 8, 7, // 7136-7143
+	5, 3, 2, 0, -2, -4, -5, -7, // 7144-7151
+	-9, -11, -13, -15, -17, -19, -21, -23, // 7152-7159
+	-25, -27, -30, -32, -34, -37, -40, -42, // 7160-7167
+	-45, -48, -51, -54, -57, -60, -63, -66, // 7168-7175
+	-69, -72, -76, -79, -82, -85, -88, -91, // 7176-7183
+	-94, -97, -100, -103, -106, -108, -111, -113, // 7184-7191
+	-115, -117, -119, -121, -122, -124, -125, -125, // 7192-7199
+	-126, -126, -127, -126, -126, -125, -124, -123, // 7200-7207
+	-122, -120, -118, -116, -113, -110, -107, -104, // 7208-7215
+	-101, -97, -94, -90, -86, -82, -78, -73, // 7216-7223
+	-69, -65, -60, -55, -51, -46, -42, -37, // 7224-7231
+	-32, -27, -23, -18, -13, -8, -4, 1, // 7232-7239
+	6, 10, 15, 19, 24, 29, 33, 37, // 7240-7247
+	42, 46, 51, 55, 59, 63, 67, 71, // 7248-7255
+	75, 79, 82, 86, 90, 93, 97, 100, // 7256-7263
+	103, 106, 109, 112, 115, 118, 121, 124, // 7264-7271
+	126, 129, 131, 134, 136, 138, 140, 142, // 7272-7279
+	144, 146, 148, 150, 151, 153, 154, 155, // 7280-7287
+	156, 157, 158, 158, 158, 158, 158, 158, // 7288-7295
+	158, 157, 156, 155, 153, 151, 150, 147, // 7296-7303
+	145, 143, 140, 137, 134, 130, 127, 123, // 7304-7311
+	119, 115, 111, 106, 102, 97, 92, 88, // 7312-7319
+	83, 78, 73, 68, 63, 58, 53, 48, // 7320-7327
+	43, 38, 33, 28, 24, 19, 14, 10, // 7328-7335
+	5, 1, -3, -7, -11, -15, -19, -22, // 7336-7343
+	-26, -29, -32, -35, -38, -41, -44, -46, // 7344-7351
+	-49, -51, -53, -55, -57, -59, -60, -62, // 7352-7359
+	-63, -64, -65, -65, -66, -66, -67, -67, // 7360-7367
+	-66, -66, -65, -65, -64, -63, -62, -60, // 7368-7375
+	-59, -57, -55, -52, -50, -47, -44, -41, // 7376-7383
+	-38, -34, -30, -26, -22, -17, -13, -8, // 7384-7391
+	-3, 3, 8, 14, 20, 26, 32, 38, // 7392-7399
+	44, 50, 56, 63, 69, 75, 82, 88, // 7400-7407
+	94, 100, 106, 112, 118, 124, 130, 135, // 7408-7415
+	140, 146, 151, 156, 161, 166, 170, 174, // 7416-7423
+	179, 183, 187, 190, 194, 197, 201, 204, // 7424-7431
+	207, 209, 212, 214, 217, 219, 221, 223, // 7432-7439
+	224, 226, 227, 228, 229, 230, 231, 231, // 7440-7447
+	231, 231, 231, 231, 231, 230, 229, 228, // 7448-7455
+	227, 226, 225, 223, 221, 220, 217, 215, // 7456-7463
+	213, 210, 208, 205, 202, 198, 195, 191, // 7464-7471
+	188, 184, 180, 176, 172, 167, 163, 158, // 7472-7479
+	153, 148, 143, 138, 133, 127, 122, 116, // 7480-7487
+	110, 104, 99, 92, 86, 80, 74, 68, // 7488-7495
+	61, 55, 48, 42, 35, 28, 22, 15, // 7496-7503
+	8, 2, -5, -11, -18, -24, -30, -37, // 7504-7511
+	-43, -48, -54, -60, -65, -71, -76, -81, // 7512-7519
+	-85, -90, -94, -98, -102, -106, -110, -113, // 7520-7527
+	-116, -119, -122, -125, -127, -129, -131, -133, // 7528-7535
+	-135, -136, -137, -139, -139, -140, -141, -141, // 7536-7543
+	-141, -141, -141, -141, -141, -140, -139, -138, // 7544-7551
+	-137, -136, -135, -133, -132, -130, -128, -126, // 7552-7559
+	-124, -122, -120, -118, -116, -113, -111, -109, // 7560-7567
+	-106, -104, -101, -99, -96, -94, -91, -88, // 7568-7575
+	-86, -83, -80, -78, -75, -72, -69, -66, // 7576-7583
+	-63, -60, -57, -54, -51, -48, -44, -41, // 7584-7591
+	-38, -34, -31, -28, -24, -21, -17, -14, // 7592-7599
+	-10, -7, -3, 0, 4, 7, 10, 14, // 7600-7607
+	17, 20, 23, 26, 29, 31, 34, 36, // 7608-7615
+	38, 40, 42, 44, 46, 47, 49, 50, // 7616-7623
+	51, 52, 52, 53, 53, 53, 53, 53, // 7624-7631
+	52, 51, 50, 49, 48, 47, 45, 43, // 7632-7639
+	42, 39, 37, 35, 32, 30, 27, 24, // 7640-7647
+	21, 18, 14, 11, 7, 3, -1, -5, // 7648-7655
+	-9, -13, -17, -22, -26, -31, -35, -40, // 7656-7663
+	-45, -49, -54, -59, -63, -68, -73, -77, // 7664-7671
+	-82, -87, -91, -95, -100, -104, -108, -112, // 7672-7679
+	-116, -120, -124, -128, -132, -135, -138, -142, // 7680-7687
+	-145, -148, -151, -154, -156, -159, -161, -163, // 7688-7695
+	-165, -167, -168, -170, -171, -172, -173, -174, // 7696-7703
+	-175, -176, -176, -176, -176, -176, -176, -175, // 7704-7711
+	-175, -174, -173, -172, -171, -170, -168, -167, // 7712-7719
+	-165, -163, -161, -159, -156, -154, -151, -148, // 7720-7727
+	-145, -142, -139, -135, -132, -129, -125, -121, // 7728-7735
+	-118, -114, -110, -106, -103, -99, -95, -91, // 7736-7743
+	-88, -84, -80, -76, -73, -69, -66, -62, // 7744-7751
+	-58, -55, -51, -48, -44, -40, -37, -33, // 7752-7759
+	-29, -26, -22, -18, -15, -11, -7, -4, // 7760-7767
+	0, 3, 7, 10, 14, 17, 20, 23, // 7768-7775
+	26, 29, 32, 35, 37, 40, 42, 44, // 7776-7783
+	46, 48, 49, 51, 52, 53, 54, 55, // 7784-7791
+	55, 56, 56, 56, 56, 56, 55, 55, // 7792-7799
+	54, 53, 53, 52, 51, 49, 48, 47, // 7800-7807
+	45, 44, 42, 41, 39, 37, 35, 33, // 7808-7815
+	31, 29, 27, 25, 23, 20, 18, 16, // 7816-7823
+	13, 11, 8, 6, 3, 0, -2, -5, // 7824-7831
+	-7, -10, -12, -15, -17, -19, -21, -24, // 7832-7839
+	-26, -28, -30, -31, -33, -34, -36, -37, // 7840-7847
+	-38, -39, -40, -41, -42, -42, -43, -43, // 7848-7855
+	-43, -43, -43, -43, -42, -42, -41, -40, // 7856-7863
+	-40, -39, -38, -36, -35, -34, -32, -30, // 7864-7871
+	-29, -27, -25, -23, -21, -18, -16, -14, // 7872-7879
+	-11, -9, -6, -3, 0, 2, 5, 8, // 7880-7887
+	11, 14, 18, 21, 24, 27, 30, 34, // 7888-7895
+	37, 40, 44, 47, 50, 53, 57, 60, // 7896-7903
+	63, 66, 69, 72, 75, 78, 81, 83, // 7904-7911
+	86, 89, 91, 94, 96, 98, 101, 103, // 7912-7919
+	105, 107, 109, 111, 113, 115, 117, 119, // 7920-7927
+	121, 122, 124, 126, 128, 129, 131, 132, // 7928-7935
+	134, 135, 137, 138, 139, 140, 141, 142, // 7936-7943
+	143, 144, 144, 145, 145, 145, 145, 144, // 7944-7951
+	144, 143, 143, 142, 140, 139, 138, 136, // 7952-7959
+	134, 132, 130, 128, 126, 124, 121, 119, // 7960-7967
+	116, 113, 111, 108, 105, 102, 100, 97, // 7968-7975
+	94, 91, 88, 85, 82, 80, 77, 74, // 7976-7983
+	71, 68, 65, 62, 59, 56, 53, 49, // 7984-7991
+	46, 43, 40, 36, 33, 30, 26, 23, // 7992-7999
+	19, 15, 12, 8, 5, 1, -2, -6, // 8000-8007
+	-9, -13, -16, -20, -23, -26, -29, -33, // 8008-8015
+	-36, -39, -42, -44, -47, -50, -52, -55, // 8016-8023
+	-57, -59, -61, -63, -65, -67, -69, -70, // 8024-8031
+	-72, -73, -75, -76, -77, -78, -79, -79, // 8032-8039
+	-80, -80, -81, -81, -81, -81, -81, -81, // 8040-8047
+	-81, -80, -79, -79, -78, -77, -76, -74, // 8048-8055
+	-73, -72, -70, -68, -67, -65, -63, -61, // 8056-8063
+	-58, -56, -54, -51, -49, -46, -44, -41, // 8064-8071
+	-38, -35, -32, -29, -26, -23, -20, -17, // 8072-8079
+	-14, -11, -8, -5, -2, 1, 4, 7, // 8080-8087
+	10, 13, 15, 18, 20, 23, 25, 28, // 8088-8095
+	30, 32, 34, 36, 38, 40, 42, 44, // 8096-8103
+	45, 47, 48, 50, 51, 52, 53, 54, // 8104-8111
+	55, 56, 56, 57, 57, 57, 57, 57, // 8112-8119
+	57, 57, 56, 55, 55, 54, 52, 51, // 8120-8127
+	49, 48, 46, 44, 42, 40, 38, 35, // 8128-8135
+	33, 30, 28, 25, 22, 20, 17, 14, // 8136-8143
+	11, 9, 6, 3, 0, -3, -5, -8, // 8144-8151
+	-11, -14, -16, -19, -22, -25, -28, -30, // 8152-8159
+	-33, -36, -39, -42, -45, -48, -51, -54, // 8160-8167
+	-57, -59, -62, -65, -68, -71, -73, -76, // 8168-8175
+	-78, -81, -83, -85, -88, -90, -91, -93, // 8176-8183
+	-95, -96, -98, -99, -100, -101, -102, -103, // 8184-8191
+	-103, -104, -104, -104, -104, -104, -104, -103, // 8192-8199
+	-103, -102, -102, -101, -100, -99, -98, -97, // 8200-8207
+	-96, -95, -94, -93, -91, -90, -89, -87, // 8208-8215
+	-86, -84, -83, -81, -79, -78, -76, -74, // 8216-8223
+	-72, -70, -68, -66, -64, -62, -60, -57, // 8224-8231
+	-55, -53, -50, -48, -45, -42, -40, -37, // 8232-8239
+	-34, -32, -29, -26, -23, -20, -17, -14, // 8240-8247
+	-12, -9, -6, -3, 0, 3, 5, 8, // 8248-8255
+	11, 13, 16, 19, 21, 24, 26, 28, // 8256-8263
+	31, 33, 35, 37, 39, 41, 43, 44, // 8264-8271
+	46, 48, 49, 51, 52, 53, 54, 55, // 8272-8279
+	56, 57, 58, 58, 59, 59, 60, 60, // 8280-8287
+	60, 60, 60, 60, 59, 59, 58, 58, // 8288-8295
+	57, 56, 56, 55, 54, 53, 52, 50, // 8296-8303
+	49, 48, 47, 45, 44, 42, 41, 39, // 8304-8311
+	38, 36, 35, 33, 31, 30, 28, 26, // 8312-8319
+	25, 23, 21, 19, 18, 16, 14, 12, // 8320-8327
+	10, 9, 7, 5, 3, 1, -1, -3, // 8328-8335
+	-5, -7, -8, -10, -12, -14, -16, -18, // 8336-8343
+	-20, -21, -23, -25, -26, -28, -29, -30, // 8344-8351
+	-32, -33, -34, -35, -36, -37, -38, -38, // 8352-8359
+	-39, -39, -40, -40, -40, -40, -40, -40, // 8360-8367
+	-40, -40, -39, -39, -38, -38, -37, -36, // 8368-8375
+	-35, -34, -33, -32, -31, -30, -29, -28, // 8376-8383
+	-26, -25, -24, -22, -21, -20, -18, -17, // 8384-8391
+	-15, -13, -12, -10, -8, -7, -5, -3, // 8392-8399
+	-1, 1, 3, 5, 7, 9, 11, 13, // 8400-8407
+	16, 18, 20, 22, 24, 27, 29, 31, // 8408-8415
+	34, 36, 38, 40, 42, 44, 47, 49, // 8416-8423
+	51, 53, 55, 57, 58, 60, 62, 63, // 8424-8431
+	65, 67, 68, 69, 71, 72, 73, 74, // 8432-8439
+	75, 76, 77, 77, 78, 78, 79, 79, // 8440-8447
+	80, 80, 80, 81, 81, 81, 81, 80, // 8448-8455
+	80, 80, 80, 79, 79, 78, 78, 77, // 8456-8463
+	76, 75, 74, 73, 72, 71, 70, 68, // 8464-8471
+	67, 65, 64, 62, 60, 58, 56, 54, // 8472-8479
+	52, 50, 47, 45, 43, 40, 38, 36, // 8480-8487
+	33, 31, 28, 26, 23, 20, 18, 15, // 8488-8495
+	13, 10, 8, 5, 3, 0, -2, -4, // 8496-8503
+	-7, -9, -12, -14, -16, -18, -21, -23, // 8504-8511
+	-25, -27, -29, -31, -33, -34, -36, -38, // 8512-8519
+	-39, -41, -42, -43, -45, -46, -47, -48, // 8520-8527
+	-48, -49, -50, -51, -51, -51, -52, -52, // 8528-8535
+	-52, -52, -52, -52, -52, -52, -52, -51, // 8536-8543
+	-51, -51, -50, -50, -49, -48, -47, -47, // 8544-8551
+	-46, -45, -44, -43, -42, -41, -40, -39, // 8552-8559
+	-38, -37, -35, -34, -33, -31, -30, -29, // 8560-8567
+	-27, -26, -24, -23, -21, -20, -18, -17, // 8568-8575
+	-15, -14, -12, -11, -9, -8, -6, -5, // 8576-8583
+	-4, -2, -1, 1, 2, 3, 4, 6, // 8584-8591
+	7, 8, 9, 10, 11, 11, 12, 13, // 8592-8599
+	14, 14, 15, 15, 16, 16, 16, 17, // 8600-8607
+	17, 17, 17, 17, 17, 17, 17, 17, // 8608-8615
+	17, 17, 16, 16, 16, 16, 15, 15, // 8616-8623
+	15, 14, 14, 14, 13, 13, 12, 12, // 8624-8631
+	11, 11, 10, 9, 9, 8, 7, 7, // 8632-8639
+	6, 5, 4, 4, 3, 2, 1, 0, // 8640-8647
+	-1, -2, -3, -4, -5, -6, -7, -8, // 8648-8655
+	-9, -10, -11, -12, -13, -14, -15, -16, // 8656-8663
+	-17, -18, -19, -19, -20, -21, -22, -23, // 8664-8671
+	-23, -24, -25, -25, -26, -27, -27, -28, // 8672-8679
+	-28, -29, -29, -30, -30, -31, -31, -31, // 8680-8687
+	-32, -32, -32, -32, -33, -33, -33, -33, // 8688-8695
+	-33, -33, -33, -33, -33, -33, -33, -33, // 8696-8703
+	-33, -33, -33, -32, -32, -32, -31, -31, // 8704-8711
+	-31, -30, -30, -29, -29, -28, -27, -27, // 8712-8719
+	-26, -25, -24, -23, -22, -21, -20, -19, // 8720-8727
+	-18, -17, -16, -15, -14, -12, -11, -10, // 8728-8735
+	-9, -7, -6, -5, -3, -2, -1, 1, // 8736-8743
+	2, 4, 5, 7, 8, 10, 11, 13, // 8744-8751
+	14, 15, 17, 18, 20, 21, 23, 24, // 8752-8759
+	25, 26, 28, 29, 30, 31, 32, 33, // 8760-8767
+	34, 35, 36, 37, 38, 38, 39, 40, // 8768-8775
+	40, 41, 41, 41, 42, 42, 42, 42, // 8776-8783
+	42, 42, 42, 42, 42, 42, 42, 41, // 8784-8791
+	41, 40, 40, 39, 39, 38, 37, 36, // 8792-8799
+	35, 35, 33, 32, 31, 30, 29, 28, // 8800-8807
+	26, 25, 23, 22, 21, 19, 18, 16, // 8808-8815
+	14, 13, 11, 10, 8, 7, 5, 3, // 8816-8823
+	2, 0, -1, -3, -4, -5, -7, -8, // 8824-8831
+	-10, -11, -12, -13, -15, -16, -17, -18, // 8832-8839
+	-19, -20, -21, -22, -23, -24, -24, -25, // 8840-8847
+	-26, -27, -27, -28, -28, -29, -29, -30, // 8848-8855
+	-30, -31, -31, -31, -32, -32, -32, -32, // 8856-8863
+	-32, -32, -32, -32, -32, -32, -31, -31, // 8864-8871
+	-31, -30, -30, -29, -29, -28, -27, -27, // 8872-8879
+	-26, -25, -24, -23, -22, -21, -20, -19, // 8880-8887
+	-18, -17, -16, -15, -14, -12, -11, -10, // 8888-8895
+	-9, -7, -6, -5, -4, -2, -1, 0, // 8896-8903
+	1, 3, 4, 5, 6, 7, 9, 10, // 8904-8911
+	11, 12, 13, 14, 16, 17, 18, 19, // 8912-8919
+	20, 21, 22, 23, 23, 24, 25, 26, // 8920-8927
+	26, 27, 28, 28, 29, 29, 30, 30, // 8928-8935
+	30, 31, 31, 31, 31, 31, 31, 31, // 8936-8943
+	31, 31, 31, 31, 31, 31, 31, 30, // 8944-8951
+	30, 30, 29, 29, 28, 28, 28, 27, // 8952-8959
+	27, 26, 26, 25, 24, 24, 23, 22, // 8960-8967
+	22, 21, 20, 19, 19, 18, 17, 16, // 8968-8975
+	15, 14, 13, 12, 11, 10, 9, 8, // 8976-8983
+	7, 6, 5, 4, 3, 2, 1, 0, // 8984-8991
+	-1, -2, -3, -4, -5, -6, -7, -8, // 8992-8999
+	-9, -9, -10, -11, -12, -13, -14, -15, // 9000-9007
+	-16, -17, -18, -18, -19, -20, -21, -21, // 9008-9015
+	-22, -23, -24, -24, -25, -25, -26, -26, // 9016-9023
+	-27, -27, -28, -28, -28, -29, -29, -29, // 9024-9031
+	-29, -30, -30, -30, -30, -30, -30, -30, // 9032-9039
+	-30, -30, -30, -30, -29, -29, -29, -29, // 9040-9047
+	-28, -28, -28, -27, -27, -26, -26, -25, // 9048-9055
+	-25, -24, -24, -23, -23, -22, -21, -21, // 9056-9063
+	-20, -19, -19, -18, -17, -16, -16, -15, // 9064-9071
+	-14, -13, -12, -12, -11, -10, -9, -8, // 9072-9079
+	-7, -6, -5, -4, -3, -2, -1, 0, // 9080-9087
+	1, 2, 3, 4, 5, 6, 7, 7, // 9088-9095
+	8, 9, 10, 11, 11, 12, 13, 14, // 9096-9103
+	14, 15, 15, 16, 16, 17, 17, 18, // 9104-9111
+	18, 18, 19, 19, 19, 19, 19, 20, // 9112-9119
+	20, 20, 20, 20, 20, 20, 20, 20, // 9120-9127
+	20, 20, 20, 20, 20, 19, 19, 19, // 9128-9135
+	19, 18, 18, 18, 17, 17, 17, 16, // 9136-9143
+	16, 15, 15, 14, 14, 13, 12, 12, // 9144-9151
+	11, 10, 10, 9, 8, 8, 7, 6, // 9152-9159
+	5, 5, 4, 3, 3, 2, 1, 0, // 9160-9167
+	0, -1, -2, -2, -3, -4, -5, -5, // 9168-9175
+	-6, -7, -7, -8, -8, -9, -10, -10, // 9176-9183
+	-11, -11, -12, -12, -13, -13, -14, -14, // 9184-9191
+	-14, -15, -15, -15, -16, -16, -16, -16, // 9192-9199
+	-16, -16, -16, -16, -16, -16, -16, -15, // 9200-9207
+	-15, -15, -15, -14, -14, -13, -13, -12, // 9208-9215
+	-12, -11, -11, -10, -9, -9, -8, -7, // 9216-9223
+	-7, -6, -5, -4, -4, -3, -2, -2, // 9224-9231
+	-1, 0, 0, 1, 2, 3, 3, 4, // 9232-9239
+	4, 5, 6, 6, 7, 8, 8, 9, // 9240-9247
+	9, 10, 10, 11, 11, 12, 12, 13, // 9248-9255
+	13, 14, 14, 15, 15, 16, 16, 16, // 9256-9263
+	17, 17, 18, 18, 18, 19, 19, 19, // 9264-9271
+	19, 20, 20, 20, 20, 20, 20, 20, // 9272-9279
+	20, 20, 20, 20, 20, 20, 20, 19, // 9280-9287
+	19, 19, 19, 18, 18, 18, 17, 17, // 9288-9295
+	16, 16, 15, 15, 14, 14, 13, 13, // 9296-9303
+	12, 12, 11, 10, 10, 9, 9, 8, // 9304-9311
+	7, 7, 6, 5, 5, 4, 3, 3, // 9312-9319
+	2, 1, 0, 0, -1, -1, -2, -3, // 9320-9327
+	-3, -4, -4, -5, -6, -6, -7, -7, // 9328-9335
+	-7, -8, -8, -9, -9, -9, -10, -10, // 9336-9343
+	-10, -10, -11, -11, -11, -11, -11, -12, // 9344-9351
+	-12, -12, -12, -12, -12, -12, -12, -12, // 9352-9359
+	-12, -12, -12, -12, -12, -12, -12, -12, // 9360-9367
+	-12, -12, -12, -12, -12, -12, -12, -12, // 9368-9375
+	-12, -11, -11, -11, -11, -11, -10, -10, // 9376-9383
+	-10, -10, -10, -9, -9, -9, -9, -8, // 9384-9391
+	-8, -8, -7, -7, -7, -7, -6, -6, // 9392-9399
+	-6, -5, -5, -5, -5, -4, -4, -4, // 9400-9407
+	-4, -3, -3, -3, -2, -2, -2, -2, // 9408-9415
+	-1, -1, -1, -1, 0, 0, 0, 0, // 9416-9423
+	1, 1, 1, 1, 1, 2, 2, 2, // 9424-9431
+	2, 2, 2, 2, 3, 3, 3, 3, // 9432-9439
+	3, 3, 3, 3, 3, 3, 3, 3, // 9440-9447
+	3, 3, 3, 3, 3, 3, 3, 3, // 9448-9455
+	3, 3, 3, 3, 3, 3, 2, 2, // 9456-9463
+	2, 2, 2, 2, 2, 2, 2, 1, // 9464-9471
+	1, 1, 1, 1, 1, 1, 1, 1, // 9472-9479
+	0, 0, 0, 0, 0, 0, 0, 0, // 9480-9487
+	0, -1, -1, -1, -1, -1, -1, -1, // 9488-9495
+	-1, -1, -1, -1, -2, -2, -2, -2, // 9496-9503
+	-2, -2, -2, -2, -2, -2, -2, -2, // 9504-9511
+	-2, -2, -2, -2, -2, -2, -2, -2, // 9512-9519
+	-2, -2, -2, -2, -2, -1, -1, -1, // 9520-9527
+	-1, -1, -1, -1, -1, -1, -1, -1, // 9528-9535
+	-1, -1, -1, -1, -1, 0, 0, 0, // 9536-9543
+	0, 0, 0, 0, 0, // 9544-9548
+};
+
+static const int16_t viola_hit_guitar_data[9472] = {
+	0, 0, -1, 1, 4, 8, 17, 33, // 0-7
+	51, 75, 92, 119, 139, 152, 153, 125, // 8-15
+	96, 42, -27, -124, -250, -393, -557, -736, // 16-23
+	-927, -1114, -1295, -1459, -1599, -1703, -1783, -1815, // 24-31
+	-1806, -1764, -1708, -1644, -1593, -1580, -1570, -1591, // 32-39
+	-1638, -1717, -1818, -1941, -2072, -2199, -2320, -2412, // 40-47
+	-2459, -2464, -2469, -2484, -2537, -2628, -2792, -3067, // 48-55
+	-3458, -3929, -4416, -4907, -5334, -5632, -5720, -5532, // 56-63
+	-5069, -4319, -3300, -2026, -541, 1093, 2830, 4577, // 64-71
+	6291, 7906, 9346, 10568, 11555, 12286, 12780, 13075, // 72-79
+	13134, 13013, 12739, 12350, 11878, 11371, 10833, 10282, // 80-87
+	9811, 9423, 9156, 9031, 9050, 9217, 9523, 9914, // 88-95
+	10348, 10776, 11165, 11480, 11659, 11703, 11590, 11352, // 96-103
+	10997, 10530, 9972, 9338, 8693, 8074, 7474, 6891, // 104-111
+	6357, 5888, 5486, 5132, 4818, 4557, 4354, 4190, // 112-119
+	4039, 3922, 3806, 3671, 3531, 3361, 3153, 2911, // 120-127
+	2652, 2381, 2125, 1892, 1676, 1495, 1359, 1265, // 128-135
+	1192, 1122, 1026, 902, 739, 488, 130, -345, // 136-143
+	-943, -1656, -2467, -3355, -4293, -5232, -6130, -6970, // 144-151
+	-7736, -8413, -8983, -9427, -9756, -9973, -10067, -10045, // 152-159
+	-9904, -9668, -9372, -9033, -8691, -8365, -8110, -7955, // 160-167
+	-7913, -8001, -8210, -8531, -8955, -9458, -10004, -10571, // 168-175
+	-11113, -11591, -11974, -12233, -12353, -12325, -12144, -11813, // 176-183
+	-11342, -10742, -10016, -9171, -8219, -7152, -5971, -4696, // 184-191
+	-3345, -1928, -471, 988, 2396, 3709, 4893, 5907, // 192-199
+	6715, 7286, 7620, 7731, 7643, 7396, 7028, 6594, // 200-207
+	6160, 5776, 5481, 5308, 5271, 5377, 5611, 5948, // 208-215
+	6359, 6816, 7296, 7775, 8231, 8652, 9030, 9355, // 216-223
+	9641, 9871, 10043, 10144, 10164, 10095, 9928, 9664, // 224-231
+	9304, 8869, 8377, 7858, 7339, 6848, 6415, 6072, // 232-239
+	5827, 5679, 5627, 5654, 5737, 5834, 5918, 5957, // 240-247
+	5912, 5771, 5533, 5200, 4793, 4338, 3864, 3399, // 248-255
+	2964, 2578, 2246, 1961, 1711, 1477, 1238, 976, // 256-263
+	677, 339, -40, -449, -870, -1282, -1663, -1984, // 264-271
+	-2227, -2381, -2438, -2396, -2262, -2051, -1783, -1472, // 272-279
+	-1133, -792, -458, -148, 134, 387, 605, 793, // 280-287
+	944, 1064, 1145, 1186, 1177, 1110, 976, 774, // 288-295
+	504, 162, -235, -673, -1121, -1563, -1979, -2343, // 296-303
+	-2632, -2830, -2927, -2918, -2809, -2605, -2320, -1970, // 304-311
+	-1572, -1148, -716, -289, 121, 510, 876, 1220, // 312-319
+	1540, 1835, 2109, 2351, 2552, 2705, 2800, 2830, // 320-327
+	2790, 2673, 2483, 2229, 1931, 1605, 1265, 940, // 328-335
+	648, 405, 230, 129, 102, 141, 230, 343, // 336-343
+	459, 552, 591, 552, 415, 174, -169, -604, // 344-351
+	-1115, -1677, -2263, -2842, -3389, -3878, -4289, -4608, // 352-359
+	-4826, -4944, -4962, -4887, -4724, -4484, -4177, -3816, // 360-367
+	-3416, -2988, -2552, -2129, -1742, -1406, -1135, -942, // 368-375
+	-830, -797, -832, -922, -1047, -1190, -1333, -1467, // 376-383
+	-1589, -1692, -1779, -1851, -1917, -1983, -2053, -2129, // 384-391
+	-2208, -2286, -2361, -2423, -2466, -2489, -2483, -2449, // 392-399
+	-2380, -2284, -2167, -2034, -1888, -1739, -1590, -1447, // 400-407
+	-1317, -1211, -1137, -1099, -1106, -1169, -1294, -1482, // 408-415
+	-1728, -2026, -2363, -2724, -3087, -3425, -3716, -3935, // 416-423
+	-4066, -4092, -4000, -3787, -3454, -3009, -2463, -1832, // 424-431
+	-1138, -401, 351, 1092, 1795, 2437, 2998, 3459, // 432-439
+	3812, 4051, 4183, 4221, 4182, 4089, 3966, 3835, // 440-447
+	3717, 3625, 3568, 3551, 3570, 3619, 3688, 3770, // 448-455
+	3860, 3954, 4050, 4147, 4248, 4357, 4475, 4601, // 456-463
+	4732, 4864, 4990, 5103, 5193, 5254, 5277, 5258, // 464-471
+	5193, 5083, 4930, 4739, 4512, 4257, 3980, 3693, // 472-479
+	3407, 3133, 2884, 2667, 2490, 2359, 2275, 2240, // 480-487
+	2246, 2285, 2345, 2413, 2479, 2529, 2558, 2557, // 488-495
+	2522, 2452, 2348, 2212, 2045, 1849, 1623, 1369, // 496-503
+	1088, 780, 441, 71, -327, -747, -1179, -1614, // 504-511
+	-2042, -2453, -2830, -3161, -3437, -3651, -3799, -3878, // 512-519
+	-3889, -3835, -3724, -3560, -3353, -3111, -2837, -2539, // 520-527
+	-2226, -1905, -1587, -1283, -1008, -772, -586, -460, // 528-535
+	-401, -410, -482, -606, -773, -968, -1175, -1382, // 536-543
+	-1573, -1737, -1863, -1944, -1970, -1936, -1836, -1667, // 544-551
+	-1430, -1130, -776, -383, 35, 458, 862, 1228, // 552-559
+	1538, 1778, 1940, 2021, 2025, 1963, 1852, 1713, // 560-567
+	1564, 1424, 1311, 1237, 1210, 1233, 1301, 1409, // 568-575
+	1549, 1712, 1890, 2073, 2258, 2441, 2619, 2790, // 576-583
+	2952, 3103, 3243, 3370, 3484, 3581, 3658, 3712, // 584-591
+	3743, 3744, 3715, 3652, 3555, 3423, 3257, 3060, // 592-599
+	2835, 2590, 2328, 2058, 1785, 1517, 1257, 1012, // 600-607
+	785, 578, 394, 232, 92, -26, -121, -192, // 608-615
+	-238, -259, -256, -229, -180, -115, -42, 29, // 616-623
+	85, 116, 112, 63, -34, -179, -370, -600, // 624-631
+	-859, -1135, -1418, -1697, -1964, -2213, -2437, -2635, // 632-639
+	-2809, -2959, -3087, -3197, -3287, -3359, -3409, -3440, // 640-647
+	-3445, -3422, -3365, -3274, -3148, -2988, -2793, -2569, // 648-655
+	-2317, -2040, -1744, -1432, -1107, -770, -421, -65, // 656-663
+	301, 673, 1053, 1439, 1833, 2236, 2646, 3062, // 664-671
+	3481, 3898, 4310, 4711, 5094, 5452, 5780, 6074, // 672-679
+	6332, 6553, 6740, 6896, 7026, 7136, 7230, 7315, // 680-687
+	7390, 7457, 7515, 7564, 7600, 7621, 7623, 7607, // 688-695
+	7572, 7519, 7447, 7357, 7250, 7124, 6978, 6812, // 696-703
+	6624, 6413, 6179, 5922, 5647, 5355, 5047, 4728, // 704-711
+	4399, 4061, 3716, 3365, 3010, 2652, 2296, 1945, // 712-719
+	1605, 1282, 980, 703, 450, 220, 10, -188, // 720-727
+	-380, -574, -776, -990, -1222, -1470, -1735, -2012, // 728-735
+	-2297, -2582, -2861, -3125, -3365, -3573, -3739, -3857, // 736-743
+	-3920, -3925, -3868, -3753, -3584, -3368, -3113, -2831, // 744-751
+	-2530, -2224, -1920, -1627, -1354, -1106, -887, -702, // 752-759
+	-555, -451, -393, -386, -436, -544, -712, -939, // 760-767
+	-1219, -1547, -1911, -2299, -2696, -3087, -3458, -3797, // 768-775
+	-4093, -4340, -4533, -4673, -4760, -4798, -4790, -4741, // 776-783
+	-4652, -4526, -4365, -4169, -3937, -3671, -3373, -3045, // 784-791
+	-2691, -2317, -1930, -1536, -1143, -760, -392, -46, // 792-799
+	274, 561, 813, 1028, 1203, 1338, 1434, 1490, // 800-807
+	1510, 1498, 1456, 1388, 1297, 1188, 1064, 932, // 808-815
+	797, 663, 537, 426, 336, 270, 232, 221, // 816-823
+	234, 267, 311, 355, 391, 409, 404, 373, // 824-831
+	317, 243, 160, 81, 23, 0, 24, 107, // 832-839
+	254, 465, 736, 1058, 1419, 1803, 2196, 2583, // 840-847
+	2953, 3295, 3605, 3878, 4114, 4313, 4476, 4603, // 848-855
+	4694, 4748, 4763, 4738, 4669, 4556, 4400, 4203, // 856-863
+	3970, 3709, 3430, 3144, 2863, 2601, 2370, 2179, // 864-871
+	2034, 1939, 1892, 1888, 1916, 1966, 2025, 2079, // 872-879
+	2117, 2131, 2114, 2065, 1985, 1879, 1751, 1606, // 880-887
+	1451, 1287, 1116, 939, 754, 560, 357, 146, // 888-895
+	-68, -281, -484, -669, -826, -950, -1037, -1084, // 896-903
+	-1095, -1076, -1033, -974, -907, -838, -773, -714, // 904-911
+	-662, -615, -571, -526, -477, -424, -362, -293, // 912-919
+	-217, -137, -59, 12, 67, 98, 96, 54, // 920-927
+	-34, -170, -353, -580, -843, -1129, -1427, -1720, // 928-935
+	-1995, -2239, -2442, -2600, -2711, -2776, -2802, -2797, // 936-943
+	-2769, -2727, -2675, -2618, -2553, -2478, -2387, -2276, // 944-951
+	-2141, -1978, -1789, -1579, -1354, -1127, -907, -707, // 952-959
+	-537, -403, -310, -257, -241, -254, -287, -328, // 960-967
+	-365, -389, -392, -367, -311, -224, -110, 28, // 968-975
+	182, 344, 507, 664, 805, 925, 1018, 1081, // 976-983
+	1109, 1100, 1053, 969, 847, 690, 501, 284, // 984-991
+	45, -208, -468, -724, -967, -1186, -1370, -1510, // 992-999
+	-1598, -1630, -1604, -1521, -1386, -1205, -990, -752, // 1000-1007
+	-504, -259, -30, 174, 344, 473, 561, 608, // 1008-1015
+	616, 593, 545, 480, 408, 337, 273, 221, // 1016-1023
+	185, 166, 164, 178, 205, 243, 288, 338, // 1024-1031
+	393, 450, 509, 572, 639, 711, 788, 873, // 1032-1039
+	963, 1059, 1160, 1267, 1379, 1497, 1621, 1756, // 1040-1047
+	1903, 2066, 2245, 2441, 2654, 2879, 3113, 3348, // 1048-1055
+	3576, 3790, 3981, 4144, 4273, 4365, 4420, 4439, // 1056-1063
+	4424, 4381, 4316, 4234, 4143, 4046, 3950, 3858, // 1064-1071
+	3773, 3696, 3625, 3558, 3490, 3414, 3325, 3216, // 1072-1079
+	3083, 2922, 2734, 2520, 2286, 2039, 1787, 1542, // 1080-1087
+	1312, 1103, 922, 772, 651, 558, 488, 437, // 1088-1095
+	401, 375, 356, 340, 327, 316, 305, 289, // 1096-1103
+	267, 233, 181, 105, -2, -144, -327, -550, // 1104-1111
+	-813, -1112, -1439, -1787, -2145, -2502, -2847, -3170, // 1112-1119
+	-3465, -3725, -3946, -4127, -4267, -4369, -4432, -4461, // 1120-1127
+	-4456, -4420, -4355, -4262, -4141, -3994, -3823, -3629, // 1128-1135
+	-3414, -3182, -2934, -2675, -2410, -2142, -1879, -1623, // 1136-1143
+	-1380, -1153, -944, -752, -577, -417, -268, -126, // 1144-1151
+	14, 153, 296, 443, 596, 754, 914, 1074, // 1152-1159
+	1232, 1384, 1527, 1659, 1778, 1881, 1968, 2038, // 1160-1167
+	2091, 2126, 2143, 2142, 2122, 2084, 2026, 1950, // 1168-1175
+	1856, 1746, 1622, 1488, 1349, 1208, 1069, 935, // 1176-1183
+	810, 694, 586, 485, 389, 293, 192, 83, // 1184-1191
+	-38, -172, -319, -476, -638, -799, -950, -1083, // 1192-1199
+	-1188, -1258, -1288, -1276, -1220, -1124, -993, -832, // 1200-1207
+	-651, -457, -258, -60, 131, 314, 487, 651, // 1208-1215
+	808, 961, 1111, 1261, 1412, 1563, 1714, 1860, // 1216-1223
+	2000, 2128, 2242, 2335, 2406, 2448, 2461, 2440, // 1224-1231
+	2386, 2295, 2169, 2007, 1812, 1586, 1335, 1062, // 1232-1239
+	774, 480, 186, -99, -366, -606, -811, -974, // 1240-1247
+	-1091, -1157, -1173, -1140, -1062, -948, -806, -646, // 1248-1255
+	-480, -318, -169, -40, 62, 135, 181, 201, // 1256-1263
+	201, 186, 164, 140, 121, 107, 104, 109, // 1264-1271
+	124, 143, 167, 192, 219, 246, 275, 309, // 1272-1279
+	349, 398, 458, 529, 607, 688, 765, 829, // 1280-1287
+	870, 879, 848, 770, 642, 465, 243, -15, // 1288-1295
+	-299, -596, -895, -1182, -1446, -1677, -1871, -2022, // 1296-1303
+	-2131, -2198, -2226, -2218, -2179, -2112, -2022, -1910, // 1304-1311
+	-1781, -1638, -1484, -1323, -1159, -999, -847, -712, // 1312-1319
+	-599, -515, -464, -450, -472, -531, -620, -734, // 1320-1327
+	-864, -1002, -1136, -1257, -1357, -1429, -1467, -1469, // 1328-1335
+	-1434, -1363, -1258, -1125, -968, -794, -609, -420, // 1336-1343
+	-232, -53, 113, 260, 384, 479, 543, 573, // 1344-1351
+	565, 522, 443, 332, 195, 37, -133, -306, // 1352-1359
+	-474, -628, -762, -869, -947, -996, -1018, -1018, // 1360-1367
+	-1001, -976, -949, -927, -917, -921, -940, -972, // 1368-1375
+	-1014, -1059, -1101, -1131, -1145, -1135, -1102, -1043, // 1376-1383
+	-962, -862, -753, -640, -534, -442, -370, -324, // 1384-1391
+	-305, -313, -346, -398, -464, -535, -606, -670, // 1392-1399
+	-721, -756, -771, -769, -749, -713, -667, -614, // 1400-1407
+	-559, -506, -459, -420, -390, -371, -361, -357, // 1408-1415
+	-357, -359, -359, -353, -342, -323, -296, -261, // 1416-1423
+	-217, -164, -102, -31, 50, 145, 254, 380, // 1424-1431
+	523, 686, 867, 1065, 1276, 1498, 1727, 1955, // 1432-1439
+	2179, 2394, 2596, 2782, 2947, 3091, 3212, 3308, // 1440-1447
+	3379, 3423, 3442, 3435, 3402, 3345, 3267, 3170, // 1448-1455
+	3059, 2937, 2809, 2681, 2556, 2440, 2336, 2245, // 1456-1463
+	2170, 2111, 2068, 2037, 2017, 2004, 1994, 1981, // 1464-1471
+	1961, 1927, 1876, 1803, 1703, 1575, 1418, 1231, // 1472-1479
+	1017, 780, 525, 256, -20, -299, -575, -845, // 1480-1487
+	-1107, -1356, -1594, -1817, -2025, -2217, -2390, -2543, // 1488-1495
+	-2673, -2780, -2862, -2920, -2955, -2970, -2969, -2957, // 1496-1503
+	-2938, -2918, -2901, -2889, -2886, -2890, -2899, -2911, // 1504-1511
+	-2921, -2924, -2914, -2888, -2842, -2773, -2680, -2563, // 1512-1519
+	-2424, -2264, -2088, -1897, -1695, -1484, -1266, -1041, // 1520-1527
+	-812, -578, -342, -102, 138, 378, 613, 841, // 1528-1535
+	1058, 1260, 1444, 1605, 1743, 1856, 1945, 2012, // 1536-1543
+	2059, 2091, 2109, 2119, 2123, 2123, 2121, 2119, // 1544-1551
+	2117, 2117, 2119, 2122, 2128, 2138, 2152, 2169, // 1552-1559
+	2190, 2215, 2244, 2274, 2305, 2334, 2360, 2380, // 1560-1567
+	2391, 2390, 2374, 2340, 2285, 2208, 2106, 1981, // 1568-1575
+	1832, 1664, 1481, 1288, 1091, 897, 712, 541, // 1576-1583
+	386, 249, 130, 26, -67, -153, -235, -318, // 1584-1591
+	-402, -488, -575, -660, -740, -813, -877, -931, // 1592-1599
+	-975, -1010, -1040, -1068, -1095, -1124, -1155, -1188, // 1600-1607
+	-1222, -1252, -1276, -1290, -1289, -1269, -1230, -1169, // 1608-1615
+	-1086, -983, -860, -719, -564, -398, -224, -44, // 1616-1623
+	140, 324, 506, 685, 856, 1020, 1173, 1313, // 1624-1631
+	1438, 1547, 1638, 1711, 1765, 1800, 1815, 1813, // 1632-1639
+	1796, 1767, 1731, 1691, 1654, 1625, 1611, 1617, // 1640-1647
+	1646, 1701, 1782, 1887, 2012, 2150, 2295, 2438, // 1648-1655
+	2572, 2688, 2781, 2847, 2885, 2894, 2875, 2831, // 1656-1663
+	2767, 2686, 2591, 2487, 2376, 2260, 2142, 2022, // 1664-1671
+	1901, 1780, 1659, 1540, 1423, 1312, 1208, 1114, // 1672-1679
+	1033, 966, 916, 885, 869, 868, 879, 897, // 1680-1687
+	916, 933, 944, 945, 933, 909, 872, 823, // 1688-1695
+	763, 692, 610, 516, 408, 283, 140, -25, // 1696-1703
+	-211, -418, -643, -882, -1130, -1380, -1625, -1856, // 1704-1711
+	-2068, -2257, -2420, -2553, -2658, -2736, -2791, -2825, // 1712-1719
+	-2842, -2845, -2838, -2822, -2800, -2774, -2742, -2708, // 1720-1727
+	-2670, -2631, -2589, -2545, -2501, -2455, -2408, -2360, // 1728-1735
+	-2310, -2260, -2208, -2152, -2092, -2026, -1950, -1864, // 1736-1743
+	-1765, -1651, -1520, -1372, -1210, -1035, -852, -665, // 1744-1751
+	-481, -306, -144, -2, 118, 213, 284, 331, // 1752-1759
+	358, 366, 359, 341, 315, 284, 250, 214, // 1760-1767
+	180, 147, 121, 102, 91, 93, 108, 138, // 1768-1775
+	183, 243, 315, 397, 487, 580, 672, 761, // 1776-1783
+	842, 913, 973, 1022, 1059, 1086, 1103, 1113, // 1784-1791
+	1119, 1120, 1119, 1117, 1114, 1110, 1105, 1099, // 1792-1799
+	1094, 1090, 1089, 1091, 1100, 1117, 1142, 1176, // 1800-1807
+	1220, 1272, 1331, 1394, 1459, 1522, 1581, 1631, // 1808-1815
+	1671, 1698, 1710, 1708, 1690, 1660, 1619, 1569, // 1816-1823
+	1514, 1457, 1400, 1346, 1296, 1250, 1209, 1172, // 1824-1831
+	1136, 1101, 1066, 1029, 990, 948, 904, 860, // 1832-1839
+	816, 775, 739, 709, 687, 672, 665, 664, // 1840-1847
+	666, 669, 669, 662, 646, 618, 575, 518, // 1848-1855
+	446, 362, 266, 162, 52, -60, -173, -285, // 1856-1863
+	-395, -503, -608, -710, -812, -911, -1009, -1105, // 1864-1871
+	-1199, -1290, -1377, -1459, -1537, -1610, -1677, -1738, // 1872-1879
+	-1793, -1842, -1885, -1921, -1952, -1978, -1999, -2017, // 1880-1887
+	-2032, -2046, -2059, -2070, -2081, -2090, -2095, -2094, // 1888-1895
+	-2085, -2064, -2031, -1982, -1916, -1835, -1738, -1627, // 1896-1903
+	-1505, -1374, -1235, -1093, -946, -797, -645, -490, // 1904-1911
+	-331, -167, 1, 172, 344, 515, 683, 846, // 1912-1919
+	1000, 1146, 1283, 1411, 1531, 1646, 1758, 1867, // 1920-1927
+	1976, 2083, 2188, 2289, 2382, 2464, 2533, 2584, // 1928-1935
+	2616, 2628, 2620, 2593, 2552, 2499, 2438, 2374, // 1936-1943
+	2310, 2249, 2193, 2142, 2096, 2055, 2016, 1977, // 1944-1951
+	1936, 1892, 1843, 1789, 1729, 1662, 1590, 1513, // 1952-1959
+	1432, 1345, 1254, 1158, 1054, 942, 820, 688, // 1960-1967
+	545, 390, 225, 50, -131, -315, -498, -677, // 1968-1975
+	-846, -1001, -1137, -1253, -1346, -1415, -1461, -1488, // 1976-1983
+	-1496, -1489, -1473, -1450, -1422, -1390, -1356, -1319, // 1984-1991
+	-1275, -1224, -1162, -1089, -1002, -902, -789, -667, // 1992-1999
+	-536, -403, -268, -137, -11, 108, 219, 324, // 2000-2007
+	423, 518, 611, 705, 801, 900, 1003, 1107, // 2008-2015
+	1212, 1316, 1417, 1514, 1603, 1686, 1762, 1832, // 2016-2023
+	1897, 1958, 2015, 2071, 2123, 2174, 2223, 2269, // 2024-2031
+	2313, 2354, 2392, 2428, 2463, 2498, 2535, 2574, // 2032-2039
+	2618, 2667, 2719, 2777, 2838, 2901, 2965, 3029, // 2040-2047
+	3089, 3147, 3201, 3251, 3296, 3337, 3372, 3402, // 2048-2055
+	3426, 3442, 3449, 3446, 3429, 3398, 3351, 3286, // 2056-2063
+	3202, 3099, 2977, 2833, 2671, 2489, 2291, 2079, // 2064-2071
+	1854, 1621, 1385, 1150, 921, 702, 498, 312, // 2072-2079
+	146, 0, -127, -238, -336, -425, -509, -595, // 2080-2087
+	-682, -776, -876, -985, -1101, -1222, -1347, -1476, // 2088-2095
+	-1606, -1734, -1860, -1982, -2099, -2208, -2307, -2396, // 2096-2103
+	-2472, -2533, -2577, -2601, -2604, -2586, -2545, -2481, // 2104-2111
+	-2396, -2292, -2170, -2034, -1888, -1734, -1576, -1419, // 2112-2119
+	-1265, -1115, -974, -841, -719, -606, -505, -413, // 2120-2127
+	-331, -258, -193, -134, -80, -29, 21, 71, // 2128-2135
+	125, 185, 254, 335, 430, 542, 672, 819, // 2136-2143
+	984, 1163, 1355, 1555, 1760, 1966, 2167, 2361, // 2144-2151
+	2545, 2718, 2877, 3021, 3151, 3267, 3368, 3455, // 2152-2159
+	3526, 3583, 3624, 3649, 3657, 3648, 3623, 3585, // 2160-2167
+	3535, 3477, 3414, 3349, 3286, 3230, 3181, 3144, // 2168-2175
+	3116, 3099, 3090, 3087, 3088, 3088, 3083, 3068, // 2176-2183
+	3039, 2994, 2931, 2847, 2742, 2619, 2478, 2324, // 2184-2191
+	2159, 1988, 1813, 1639, 1466, 1296, 1133, 976, // 2192-2199
+	826, 684, 550, 426, 313, 212, 124, 49, // 2200-2207
+	-11, -58, -90, -111, -120, -121, -114, -103, // 2208-2215
+	-89, -75, -64, -57, -58, -69, -91, -126, // 2216-2223
+	-174, -236, -310, -397, -490, -589, -688, -784, // 2224-2231
+	-872, -948, -1009, -1054, -1081, -1091, -1084, -1063, // 2232-2239
+	-1031, -990, -945, -899, -856, -818, -787, -766, // 2240-2247
+	-755, -755, -764, -780, -802, -826, -849, -870, // 2248-2255
+	-884, -890, -886, -871, -845, -807, -758, -699, // 2256-2263
+	-631, -554, -467, -372, -268, -155, -34, 95, // 2264-2271
+	232, 373, 519, 668, 817, 965, 1112, 1255, // 2272-2279
+	1394, 1527, 1653, 1772, 1881, 1979, 2063, 2132, // 2280-2287
+	2185, 2221, 2241, 2247, 2242, 2229, 2213, 2200, // 2288-2295
+	2193, 2198, 2216, 2250, 2300, 2365, 2442, 2528, // 2296-2303
+	2617, 2705, 2788, 2860, 2917, 2956, 2973, 2966, // 2304-2311
+	2934, 2875, 2791, 2681, 2546, 2389, 2213, 2020, // 2312-2319
+	1814, 1598, 1377, 1155, 935, 722, 517, 325, // 2320-2327
+	146, -17, -165, -298, -418, -525, -624, -716, // 2328-2335
+	-805, -895, -987, -1083, -1185, -1292, -1403, -1517, // 2336-2343
+	-1632, -1745, -1853, -1955, -2049, -2134, -2210, -2278, // 2344-2351
+	-2337, -2388, -2433, -2470, -2501, -2524, -2538, -2543, // 2352-2359
+	-2537, -2517, -2485, -2440, -2382, -2312, -2231, -2142, // 2360-2367
+	-2046, -1945, -1842, -1737, -1635, -1534, -1437, -1342, // 2368-2375
+	-1249, -1157, -1064, -968, -867, -759, -642, -515, // 2376-2383
+	-377, -228, -67, 104, 287, 481, 685, 900, // 2384-2391
+	1126, 1360, 1603, 1853, 2106, 2359, 2610, 2853, // 2392-2399
+	3087, 3305, 3507, 3689, 3850, 3991, 4111, 4212, // 2400-2407
+	4295, 4361, 4414, 4453, 4481, 4498, 4506, 4504, // 2408-2415
+	4494, 4476, 4450, 4418, 4380, 4336, 4289, 4237, // 2416-2423
+	4181, 4120, 4054, 3982, 3903, 3814, 3714, 3603, // 2424-2431
+	3477, 3339, 3185, 3016, 2832, 2635, 2425, 2203, // 2432-2439
+	1970, 1728, 1477, 1219, 953, 683, 409, 132, // 2440-2447
+	-145, -421, -694, -961, -1218, -1463, -1693, -1904, // 2448-2455
+	-2092, -2257, -2396, -2509, -2599, -2665, -2713, -2747, // 2456-2463
+	-2772, -2794, -2817, -2847, -2888, -2941, -3008, -3088, // 2464-2471
+	-3178, -3274, -3372, -3467, -3553, -3623, -3675, -3702, // 2472-2479
+	-3703, -3677, -3625, -3548, -3448, -3331, -3202, -3064, // 2480-2487
+	-2923, -2782, -2644, -2512, -2387, -2269, -2156, -2047, // 2488-2495
+	-1939, -1829, -1716, -1594, -1464, -1322, -1169, -1003, // 2496-2503
+	-824, -634, -433, -224, -6, 219, 450, 686, // 2504-2511
+	927, 1172, 1421, 1672, 1925, 2180, 2435, 2689, // 2512-2519
+	2942, 3191, 3435, 3673, 3903, 4122, 4328, 4518, // 2520-2527
+	4690, 4840, 4966, 5065, 5134, 5172, 5178, 5152, // 2528-2535
+	5096, 5011, 4901, 4771, 4624, 4464, 4297, 4126, // 2536-2543
+	3953, 3780, 3608, 3437, 3266, 3093, 2917, 2735, // 2544-2551
+	2547, 2351, 2147, 1936, 1719, 1496, 1271, 1043, // 2552-2559
+	815, 589, 363, 140, -80, -298, -512, -722, // 2560-2567
+	-927, -1126, -1319, -1502, -1675, -1837, -1986, -2120, // 2568-2575
+	-2238, -2341, -2427, -2496, -2549, -2585, -2607, -2615, // 2576-2583
+	-2611, -2596, -2571, -2538, -2498, -2451, -2400, -2343, // 2584-2591
+	-2282, -2216, -2145, -2069, -1988, -1902, -1812, -1716, // 2592-2599
+	-1616, -1512, -1404, -1292, -1176, -1056, -929, -796, // 2600-2607
+	-655, -504, -343, -170, 14, 209, 413, 623, // 2608-2615
+	838, 1054, 1269, 1478, 1681, 1874, 2057, 2229, // 2616-2623
+	2389, 2537, 2673, 2798, 2911, 3012, 3103, 3183, // 2624-2631
+	3253, 3314, 3367, 3415, 3458, 3499, 3538, 3578, // 2632-2639
+	3620, 3662, 3705, 3747, 3786, 3819, 3844, 3857, // 2640-2647
+	3856, 3838, 3803, 3748, 3674, 3581, 3470, 3344, // 2648-2655
+	3203, 3050, 2887, 2715, 2535, 2348, 2155, 1958, // 2656-2663
+	1754, 1547, 1336, 1120, 903, 685, 467, 250, // 2664-2671
+	39, -166, -362, -546, -716, -870, -1007, -1125, // 2672-2679
+	-1227, -1313, -1386, -1450, -1509, -1567, -1627, -1693, // 2680-2687
+	-1766, -1847, -1937, -2032, -2132, -2231, -2328, -2417, // 2688-2695
+	-2495, -2560, -2609, -2641, -2656, -2654, -2637, -2606, // 2696-2703
+	-2563, -2510, -2450, -2383, -2312, -2238, -2162, -2085, // 2704-2711
+	-2009, -1934, -1862, -1793, -1727, -1664, -1603, -1542, // 2712-2719
+	-1479, -1411, -1336, -1249, -1151, -1037, -908, -763, // 2720-2727
+	-603, -431, -250, -61, 131, 322, 510, 694, // 2728-2735
+	871, 1042, 1206, 1366, 1521, 1673, 1825, 1976, // 2736-2743
+	2127, 2278, 2427, 2572, 2712, 2845, 2969, 3082, // 2744-2751
+	3185, 3275, 3356, 3426, 3489, 3545, 3597, 3645, // 2752-2759
+	3690, 3732, 3772, 3807, 3836, 3859, 3872, 3873, // 2760-2767
+	3863, 3838, 3799, 3745, 3679, 3600, 3511, 3414, // 2768-2775
+	3311, 3204, 3095, 2985, 2874, 2762, 2648, 2531, // 2776-2783
+	2412, 2289, 2164, 2037, 1911, 1786, 1665, 1548, // 2784-2791
+	1438, 1333, 1233, 1135, 1037, 936, 830, 714, // 2792-2799
+	587, 448, 298, 139, -26, -195, -363, -527, // 2800-2807
+	-682, -827, -960, -1079, -1187, -1281, -1365, -1439, // 2808-2815
+	-1503, -1559, -1608, -1647, -1677, -1698, -1708, -1707, // 2816-2823
+	-1695, -1672, -1639, -1598, -1551, -1500, -1448, -1398, // 2824-2831
+	-1350, -1309, -1275, -1248, -1229, -1216, -1207, -1201, // 2832-2839
+	-1197, -1191, -1182, -1167, -1147, -1120, -1086, -1044, // 2840-2847
+	-994, -936, -869, -795, -713, -622, -522, -413, // 2848-2855
+	-297, -173, -44, 90, 225, 361, 494, 623, // 2856-2863
+	746, 861, 968, 1067, 1158, 1241, 1317, 1388, // 2864-2871
+	1455, 1520, 1583, 1647, 1712, 1779, 1849, 1921, // 2872-2879
+	1995, 2071, 2148, 2224, 2297, 2367, 2431, 2489, // 2880-2887
+	2539, 2579, 2608, 2626, 2631, 2623, 2603, 2569, // 2888-2895
+	2524, 2467, 2401, 2326, 2244, 2156, 2065, 1971, // 2896-2903
+	1876, 1781, 1685, 1590, 1495, 1400, 1304, 1206, // 2904-2911
+	1106, 1003, 896, 787, 676, 563, 450, 340, // 2912-2919
+	232, 129, 32, -58, -142, -221, -295, -366, // 2920-2927
+	-436, -507, -581, -660, -747, -840, -941, -1049, // 2928-2935
+	-1161, -1276, -1390, -1499, -1599, -1687, -1761, -1816, // 2936-2943
+	-1851, -1867, -1861, -1838, -1798, -1743, -1677, -1601, // 2944-2951
+	-1520, -1436, -1350, -1265, -1183, -1103, -1029, -960, // 2952-2959
+	-897, -839, -787, -740, -698, -657, -618, -577, // 2960-2967
+	-532, -482, -424, -355, -275, -183, -76, 46, // 2968-2975
+	182, 333, 497, 674, 861, 1057, 1259, 1464, // 2976-2983
+	1668, 1870, 2065, 2250, 2423, 2581, 2722, 2845, // 2984-2991
+	2949, 3034, 3101, 3150, 3184, 3203, 3210, 3206, // 2992-2999
+	3194, 3175, 3150, 3122, 3091, 3059, 3025, 2989, // 3000-3007
+	2952, 2911, 2866, 2815, 2757, 2689, 2611, 2522, // 3008-3015
+	2422, 2310, 2187, 2053, 1909, 1757, 1597, 1430, // 3016-3023
+	1259, 1083, 904, 722, 540, 357, 174, -7, // 3024-3031
+	-186, -361, -531, -694, -848, -993, -1128, -1252, // 3032-3039
+	-1365, -1466, -1559, -1642, -1718, -1786, -1848, -1905, // 3040-3047
+	-1958, -2005, -2047, -2082, -2112, -2135, -2151, -2161, // 3048-3055
+	-2164, -2162, -2154, -2144, -2131, -2116, -2100, -2083, // 3056-3063
+	-2064, -2045, -2024, -2000, -1973, -1943, -1907, -1867, // 3064-3071
+	-1819, -1764, -1701, -1629, -1547, -1456, -1355, -1244, // 3072-3079
+	-1125, -998, -866, -731, -594, -457, -320, -187, // 3080-3087
+	-55, 73, 199, 323, 448, 573, 700, 830, // 3088-3095
+	963, 1099, 1238, 1379, 1522, 1665, 1807, 1947, // 3096-3103
+	2083, 2215, 2339, 2456, 2563, 2659, 2744, 2814, // 3104-3111
+	2870, 2911, 2936, 2946, 2940, 2919, 2885, 2839, // 3112-3119
+	2783, 2717, 2645, 2569, 2490, 2409, 2329, 2249, // 3120-3127
+	2171, 2096, 2022, 1951, 1881, 1811, 1741, 1669, // 3128-3135
+	1596, 1520, 1439, 1354, 1263, 1167, 1064, 954, // 3136-3143
+	837, 712, 580, 441, 296, 146, -8, -164, // 3144-3151
+	-319, -472, -622, -764, -899, -1024, -1139, -1244, // 3152-3159
+	-1339, -1424, -1500, -1568, -1628, -1681, -1728, -1769, // 3160-3167
+	-1804, -1832, -1853, -1867, -1873, -1871, -1861, -1842, // 3168-3175
+	-1814, -1779, -1737, -1688, -1635, -1576, -1513, -1446, // 3176-3183
+	-1376, -1302, -1224, -1141, -1054, -960, -861, -756, // 3184-3191
+	-645, -528, -407, -281, -152, -20, 115, 252, // 3192-3199
+	391, 531, 673, 817, 962, 1107, 1251, 1392, // 3200-3207
+	1528, 1658, 1778, 1888, 1984, 2066, 2133, 2185, // 3208-3215
+	2224, 2250, 2266, 2273, 2274, 2270, 2263, 2254, // 3216-3223
+	2245, 2234, 2222, 2209, 2192, 2173, 2149, 2120, // 3224-3231
+	2085, 2043, 1995, 1940, 1877, 1807, 1729, 1645, // 3232-3239
+	1553, 1455, 1349, 1236, 1117, 992, 863, 731, // 3240-3247
+	599, 468, 342, 222, 112, 13, -75, -151, // 3248-3255
+	-217, -273, -322, -368, -412, -458, -508, -563, // 3256-3263
+	-625, -695, -771, -855, -943, -1036, -1132, -1230, // 3264-3271
+	-1329, -1426, -1521, -1613, -1701, -1783, -1859, -1925, // 3272-3279
+	-1981, -2025, -2055, -2071, -2070, -2054, -2020, -1972, // 3280-3287
+	-1908, -1832, -1744, -1648, -1545, -1437, -1326, -1214, // 3288-3295
+	-1104, -997, -895, -799, -711, -632, -561, -500, // 3296-3303
+	-448, -402, -362, -325, -290, -253, -212, -165, // 3304-3311
+	-111, -48, 25, 107, 198, 298, 403, 514, // 3312-3319
+	626, 740, 851, 958, 1059, 1153, 1238, 1314, // 3320-3327
+	1379, 1435, 1479, 1514, 1539, 1556, 1565, 1568, // 3328-3335
+	1567, 1563, 1557, 1552, 1548, 1546, 1548, 1552, // 3336-3343
+	1560, 1572, 1585, 1601, 1618, 1635, 1653, 1671, // 3344-3351
+	1688, 1704, 1718, 1731, 1741, 1747, 1750, 1746, // 3352-3359
+	1734, 1714, 1685, 1646, 1595, 1534, 1462, 1381, // 3360-3367
+	1291, 1194, 1090, 982, 871, 760, 649, 542, // 3368-3375
+	439, 342, 252, 169, 93, 24, -40, -100, // 3376-3383
+	-156, -210, -264, -318, -373, -430, -487, -546, // 3384-3391
+	-604, -662, -719, -773, -825, -875, -921, -964, // 3392-3399
+	-1004, -1038, -1068, -1092, -1110, -1119, -1121, -1114, // 3400-3407
+	-1099, -1076, -1046, -1012, -973, -933, -892, -854, // 3408-3415
+	-817, -782, -750, -720, -691, -662, -632, -601, // 3416-3423
+	-568, -533, -495, -457, -419, -381, -345, -311, // 3424-3431
+	-281, -254, -231, -211, -192, -173, -154, -134, // 3432-3439
+	-109, -80, -46, -7, 38, 88, 141, 198, // 3440-3447
+	257, 317, 376, 434, 489, 541, 588, 631, // 3448-3455
+	667, 697, 721, 739, 751, 757, 759, 757, // 3456-3463
+	751, 741, 729, 715, 698, 680, 660, 639, // 3464-3471
+	618, 598, 580, 563, 550, 540, 534, 531, // 3472-3479
+	530, 531, 531, 531, 527, 519, 506, 488, // 3480-3487
+	464, 436, 403, 367, 329, 291, 253, 215, // 3488-3495
+	178, 143, 110, 78, 46, 17, -12, -40, // 3496-3503
+	-67, -92, -115, -136, -154, -169, -181, -191, // 3504-3511
+	-198, -202, -205, -207, -208, -211, -215, -219, // 3512-3519
+	-225, -234, -244, -256, -269, -285, -302, -320, // 3520-3527
+	-339, -358, -377, -395, -410, -421, -427, -427, // 3528-3535
+	-420, -406, -383, -352, -314, -271, -222, -171, // 3536-3543
+	-117, -65, -13, 35, 79, 119, 155, 188, // 3544-3551
+	218, 248, 278, 311, 348, 389, 437, 491, // 3552-3559
+	550, 614, 681, 749, 817, 881, 941, 994, // 3560-3567
+	1040, 1077, 1106, 1129, 1145, 1157, 1166, 1174, // 3568-3575
+	1182, 1189, 1198, 1205, 1213, 1217, 1219, 1217, // 3576-3583
+	1209, 1196, 1177, 1153, 1123, 1088, 1051, 1011, // 3584-3591
+	971, 931, 893, 857, 824, 794, 767, 743, // 3592-3599
+	721, 699, 677, 652, 625, 591, 551, 503, // 3600-3607
+	447, 380, 304, 219, 126, 27, -76, -182, // 3608-3615
+	-287, -389, -486, -576, -658, -730, -793, -847, // 3616-3623
+	-893, -932, -967, -998, -1028, -1057, -1088, -1120, // 3624-3631
+	-1155, -1190, -1227, -1263, -1299, -1332, -1363, -1388, // 3632-3639
+	-1409, -1425, -1434, -1435, -1429, -1415, -1392, -1359, // 3640-3647
+	-1316, -1263, -1199, -1125, -1040, -947, -846, -738, // 3648-3655
+	-625, -509, -393, -276, -161, -47, 63, 170, // 3656-3663
+	274, 375, 471, 563, 650, 732, 808, 877, // 3664-3671
+	939, 993, 1040, 1079, 1112, 1139, 1161, 1179, // 3672-3679
+	1194, 1208, 1221, 1235, 1250, 1266, 1284, 1305, // 3680-3687
+	1327, 1350, 1375, 1400, 1426, 1452, 1478, 1502, // 3688-3695
+	1525, 1545, 1563, 1575, 1582, 1582, 1574, 1557, // 3696-3703
+	1531, 1495, 1450, 1396, 1336, 1270, 1203, 1136, // 3704-3711
+	1071, 1011, 957, 910, 871, 838, 811, 789, // 3712-3719
+	770, 753, 735, 716, 694, 669, 640, 608, // 3720-3727
+	572, 532, 488, 439, 386, 328, 266, 201, // 3728-3735
+	131, 59, -14, -87, -160, -232, -300, -364, // 3736-3743
+	-424, -479, -529, -572, -609, -638, -659, -672, // 3744-3751
+	-676, -670, -654, -630, -596, -556, -508, -456, // 3752-3759
+	-400, -344, -288, -234, -186, -142, -104, -73, // 3760-3767
+	-49, -32, -18, -8, 0, 10, 22, 39, // 3768-3775
+	63, 95, 134, 182, 237, 299, 364, 431, // 3776-3783
+	498, 562, 621, 674, 719, 756, 785, 806, // 3784-3791
+	820, 828, 833, 834, 834, 833, 833, 834, // 3792-3799
+	837, 842, 851, 862, 874, 887, 900, 913, // 3800-3807
+	923, 930, 933, 932, 926, 916, 903, 888, // 3808-3815
+	871, 854, 839, 827, 818, 812, 809, 809, // 3816-3823
+	810, 811, 810, 805, 795, 778, 753, 720, // 3824-3831
+	678, 630, 575, 515, 453, 391, 331, 274, // 3832-3839
+	221, 174, 133, 98, 69, 45, 26, 12, // 3840-3847
+	1, -6, -10, -12, -10, -7, -3, 2, // 3848-3855
+	8, 12, 15, 16, 16, 14, 11, 7, // 3856-3863
+	5, 5, 9, 16, 30, 50, 75, 108, // 3864-3871
+	147, 193, 244, 299, 359, 422, 488, 556, // 3872-3879
+	626, 697, 767, 837, 905, 971, 1034, 1092, // 3880-3887
+	1146, 1195, 1238, 1275, 1306, 1330, 1348, 1360, // 3888-3895
+	1366, 1367, 1361, 1351, 1338, 1321, 1303, 1283, // 3896-3903
+	1264, 1246, 1230, 1216, 1204, 1195, 1187, 1179, // 3904-3911
+	1172, 1162, 1151, 1137, 1120, 1099, 1074, 1046, // 3912-3919
+	1015, 982, 948, 913, 877, 842, 807, 772, // 3920-3927
+	737, 704, 672, 640, 610, 582, 556, 532, // 3928-3935
+	511, 491, 475, 461, 449, 439, 429, 419, // 3936-3943
+	410, 399, 387, 374, 361, 348, 336, 326, // 3944-3951
+	320, 318, 322, 331, 347, 370, 398, 432, // 3952-3959
+	472, 515, 561, 608, 655, 701, 745, 785, // 3960-3967
+	822, 852, 877, 896, 909, 916, 918, 915, // 3968-3975
+	908, 900, 889, 878, 867, 857, 847, 839, // 3976-3983
+	832, 826, 821, 817, 815, 814, 814, 816, // 3984-3991
+	820, 826, 833, 842, 852, 863, 875, 888, // 3992-3999
+	901, 914, 927, 940, 953, 965, 974, 980, // 4000-4007
+	983, 981, 974, 962, 944, 922, 896, 867, // 4008-4015
+	838, 810, 784, 764, 749, 740, 739, 744, // 4016-4023
+	754, 769, 786, 803, 819, 831, 839, 841, // 4024-4031
+	836, 826, 811, 792, 770, 747, 723, 699, // 4032-4039
+	677, 657, 639, 622, 607, 593, 580, 567, // 4040-4047
+	554, 542, 529, 516, 504, 491, 479, 468, // 4048-4055
+	457, 449, 442, 437, 435, 437, 442, 448, // 4056-4063
+	457, 468, 479, 489, 498, 503, 505, 503, // 4064-4071
+	497, 487, 474, 460, 445, 430, 417, 406, // 4072-4079
+	399, 395, 394, 396, 400, 406, 412, 419, // 4080-4087
+	426, 432, 439, 446, 454, 463, 474, 488, // 4088-4095
+	504, 522, 542, 564, 587, 610, 633, 656, // 4096-4103
+	679, 702, 725, 749, 774, 802, 833, 866, // 4104-4111
+	902, 941, 983, 1026, 1070, 1114, 1157, 1199, // 4112-4119
+	1240, 1278, 1314, 1347, 1378, 1407, 1432, 1456, // 4120-4127
+	1475, 1492, 1504, 1512, 1516, 1515, 1508, 1497, // 4128-4135
+	1481, 1459, 1433, 1404, 1371, 1336, 1298, 1260, // 4136-4143
+	1221, 1183, 1146, 1111, 1077, 1047, 1020, 995, // 4144-4151
+	974, 957, 943, 933, 925, 920, 918, 917, // 4152-4159
+	916, 914, 910, 902, 890, 871, 844, 810, // 4160-4167
+	768, 720, 668, 612, 556, 501, 450, 406, // 4168-4175
+	368, 339, 319, 308, 305, 309, 319, 334, // 4176-4183
+	353, 374, 396, 418, 439, 459, 476, 491, // 4184-4191
+	501, 508, 509, 504, 494, 476, 451, 421, // 4192-4199
+	383, 341, 293, 243, 191, 139, 89, 42, // 4200-4207
+	-1, -38, -68, -92, -108, -117, -120, -116, // 4208-4215
+	-105, -90, -69, -45, -17, 14, 45, 77, // 4216-4223
+	108, 138, 166, 191, 213, 232, 248, 262, // 4224-4231
+	275, 287, 300, 314, 331, 351, 375, 402, // 4232-4239
+	434, 468, 504, 542, 581, 620, 659, 695, // 4240-4247
+	730, 762, 791, 818, 840, 859, 873, 884, // 4248-4255
+	892, 896, 898, 898, 899, 899, 901, 904, // 4256-4263
+	910, 918, 927, 938, 949, 960, 970, 978, // 4264-4271
+	983, 986, 984, 979, 971, 960, 945, 928, // 4272-4279
+	910, 889, 867, 845, 821, 795, 769, 741, // 4280-4287
+	711, 678, 644, 607, 567, 526, 483, 439, // 4288-4295
+	394, 349, 305, 263, 222, 184, 148, 114, // 4296-4303
+	81, 50, 21, -7, -35, -61, -85, -108, // 4304-4311
+	-128, -145, -160, -172, -182, -188, -191, -192, // 4312-4319
+	-190, -187, -181, -172, -162, -148, -132, -112, // 4320-4327
+	-89, -61, -30, 5, 44, 86, 131, 178, // 4328-4335
+	227, 276, 325, 373, 420, 464, 506, 545, // 4336-4343
+	581, 613, 643, 671, 696, 718, 738, 757, // 4344-4351
+	774, 791, 806, 821, 836, 851, 866, 882, // 4352-4359
+	898, 915, 932, 949, 965, 980, 993, 1003, // 4360-4367
+	1009, 1011, 1009, 1001, 988, 969, 946, 917, // 4368-4375
+	883, 845, 804, 759, 712, 664, 615, 565, // 4376-4383
+	516, 467, 420, 374, 329, 287, 246, 207, // 4384-4391
+	170, 135, 101, 68, 36, 4, -28, -59, // 4392-4399
+	-92, -126, -162, -199, -239, -280, -324, -368, // 4400-4407
+	-414, -459, -503, -546, -586, -622, -655, -683, // 4408-4415
+	-708, -727, -742, -753, -761, -766, -769, -770, // 4416-4423
+	-769, -769, -767, -765, -762, -758, -752, -745, // 4424-4431
+	-735, -722, -705, -684, -661, -633, -603, -569, // 4432-4439
+	-534, -499, -463, -429, -396, -365, -335, -306, // 4440-4447
+	-278, -250, -220, -189, -155, -118, -77, -34, // 4448-4455
+	13, 62, 115, 171, 228, 288, 350, 413, // 4456-4463
+	476, 539, 602, 661, 718, 769, 814, 853, // 4464-4471
+	884, 907, 922, 929, 929, 925, 916, 904, // 4472-4479
+	891, 877, 865, 853, 844, 836, 830, 826, // 4480-4487
+	823, 821, 820, 820, 820, 820, 819, 817, // 4488-4495
+	814, 809, 800, 787, 768, 744, 713, 675, // 4496-4503
+	629, 576, 516, 450, 379, 304, 226, 145, // 4504-4511
+	64, -18, -97, -175, -249, -319, -385, -444, // 4512-4519
+	-498, -545, -586, -621, -651, -678, -701, -723, // 4520-4527
+	-745, -767, -792, -820, -850, -883, -920, -959, // 4528-4535
+	-999, -1039, -1079, -1118, -1154, -1187, -1215, -1240, // 4536-4543
+	-1259, -1274, -1283, -1287, -1286, -1279, -1268, -1252, // 4544-4551
+	-1231, -1207, -1179, -1148, -1114, -1077, -1037, -995, // 4552-4559
+	-952, -907, -861, -815, -769, -725, -682, -641, // 4560-4567
+	-602, -564, -530, -496, -464, -432, -401, -368, // 4568-4575
+	-335, -300, -264, -227, -187, -146, -104, -60, // 4576-4583
+	-15, 32, 80, 131, 182, 236, 290, 345, // 4584-4591
+	400, 453, 504, 550, 592, 627, 655, 675, // 4592-4599
+	686, 689, 684, 671, 651, 625, 595, 562, // 4600-4607
+	526, 488, 451, 414, 379, 345, 314, 285, // 4608-4615
+	260, 238, 219, 203, 190, 178, 167, 156, // 4616-4623
+	144, 130, 112, 92, 67, 39, 9, -24, // 4624-4631
+	-57, -90, -121, -150, -177, -201, -222, -243, // 4632-4639
+	-263, -284, -308, -336, -368, -404, -444, -488, // 4640-4647
+	-536, -585, -634, -682, -728, -772, -811, -846, // 4648-4655
+	-877, -902, -924, -941, -955, -967, -977, -986, // 4656-4663
+	-995, -1004, -1014, -1026, -1040, -1056, -1072, -1090, // 4664-4671
+	-1108, -1125, -1139, -1151, -1159, -1161, -1158, -1148, // 4672-4679
+	-1132, -1109, -1080, -1048, -1011, -971, -929, -886, // 4680-4687
+	-842, -799, -756, -713, -671, -629, -588, -548, // 4688-4695
+	-509, -470, -431, -394, -358, -323, -289, -255, // 4696-4703
+	-221, -188, -155, -121, -85, -49, -10, 30, // 4704-4711
+	73, 117, 162, 209, 255, 302, 347, 390, // 4712-4719
+	432, 470, 506, 538, 567, 592, 614, 632, // 4720-4727
+	647, 659, 667, 672, 674, 673, 669, 663, // 4728-4735
+	654, 644, 633, 622, 610, 599, 588, 579, // 4736-4743
+	571, 563, 555, 546, 535, 521, 503, 479, // 4744-4751
+	449, 412, 368, 318, 262, 201, 137, 69, // 4752-4759
+	1, -68, -136, -204, -269, -334, -397, -458, // 4760-4767
+	-518, -576, -633, -688, -741, -792, -841, -887, // 4768-4775
+	-931, -971, -1009, -1045, -1080, -1113, -1144, -1174, // 4776-4783
+	-1202, -1228, -1252, -1272, -1288, -1299, -1305, -1305, // 4784-4791
+	-1299, -1287, -1270, -1249, -1224, -1196, -1165, -1134, // 4792-4799
+	-1102, -1069, -1036, -1002, -968, -932, -894, -853, // 4800-4807
+	-809, -761, -710, -655, -596, -534, -470, -406, // 4808-4815
+	-341, -275, -211, -147, -84, -22, 38, 97, // 4816-4823
+	156, 213, 269, 325, 380, 434, 488, 542, // 4824-4831
+	594, 645, 694, 743, 789, 832, 871, 907, // 4832-4839
+	939, 966, 988, 1004, 1015, 1022, 1025, 1023, // 4840-4847
+	1018, 1011, 1003, 994, 986, 979, 974, 972, // 4848-4855
+	972, 975, 980, 987, 994, 1000, 1005, 1006, // 4856-4863
+	1002, 990, 970, 940, 899, 849, 787, 717, // 4864-4871
+	639, 555, 467, 378, 291, 206, 126, 51, // 4872-4879
+	-18, -82, -139, -192, -240, -286, -329, -370, // 4880-4887
+	-410, -448, -483, -517, -548, -577, -601, -623, // 4888-4895
+	-640, -654, -665, -673, -679, -684, -688, -692, // 4896-4903
+	-697, -703, -710, -717, -726, -734, -741, -747, // 4904-4911
+	-751, -752, -749, -742, -731, -714, -692, -665, // 4912-4919
+	-632, -593, -548, -499, -444, -386, -324, -259, // 4920-4927
+	-192, -124, -55, 14, 83, 152, 220, 286, // 4928-4935
+	352, 417, 481, 544, 606, 668, 728, 787, // 4936-4943
+	844, 899, 952, 1001, 1047, 1090, 1127, 1161, // 4944-4951
+	1191, 1216, 1238, 1257, 1273, 1287, 1298, 1308, // 4952-4959
+	1317, 1324, 1329, 1332, 1332, 1328, 1321, 1308, // 4960-4967
+	1290, 1266, 1237, 1203, 1163, 1118, 1069, 1016, // 4968-4975
+	960, 901, 841, 780, 719, 657, 597, 537, // 4976-4983
+	478, 421, 365, 311, 257, 205, 152, 100, // 4984-4991
+	47, -8, -64, -122, -183, -246, -311, -377, // 4992-4999
+	-444, -511, -577, -641, -702, -760, -813, -862, // 5000-5007
+	-906, -945, -979, -1007, -1030, -1048, -1062, -1071, // 5008-5015
+	-1078, -1081, -1083, -1083, -1081, -1080, -1078, -1076, // 5016-5023
+	-1073, -1069, -1065, -1057, -1047, -1032, -1012, -986, // 5024-5031
+	-953, -914, -867, -814, -755, -690, -622, -551, // 5032-5039
+	-479, -406, -334, -264, -195, -127, -62, 3, // 5040-5047
+	67, 133, 199, 267, 337, 410, 485, 562, // 5048-5055
+	641, 720, 800, 879, 955, 1028, 1097, 1160, // 5056-5063
+	1217, 1267, 1310, 1344, 1370, 1388, 1398, 1400, // 5064-5071
+	1395, 1385, 1372, 1356, 1341, 1326, 1314, 1305, // 5072-5079
+	1300, 1300, 1303, 1309, 1318, 1326, 1333, 1338, // 5080-5087
+	1340, 1338, 1331, 1319, 1303, 1282, 1258, 1231, // 5088-5095
+	1202, 1170, 1135, 1099, 1061, 1021, 977, 931, // 5096-5103
+	882, 829, 773, 714, 652, 588, 522, 456, // 5104-5111
+	390, 324, 260, 196, 135, 76, 19, -36, // 5112-5119
+	-88, -139, -188, -235, -281, -327, -372, -417, // 5120-5127
+	-461, -505, -547, -587, -625, -658, -688, -713, // 5128-5135
+	-733, -746, -755, -758, -756, -750, -739, -727, // 5136-5143
+	-713, -698, -684, -671, -660, -650, -643, -636, // 5144-5151
+	-629, -621, -610, -597, -578, -553, -522, -484, // 5152-5159
+	-439, -386, -328, -264, -196, -125, -53, 19, // 5160-5167
+	89, 157, 221, 281, 335, 383, 426, 462, // 5168-5175
+	493, 519, 539, 556, 569, 578, 584, 590, // 5176-5183
+	595, 600, 607, 616, 628, 646, 668, 695, // 5184-5191
+	727, 764, 805, 848, 893, 940, 985, 1030, // 5192-5199
+	1072, 1112, 1147, 1180, 1209, 1235, 1257, 1275, // 5200-5207
+	1291, 1303, 1310, 1314, 1314, 1308, 1298, 1282, // 5208-5215
+	1262, 1236, 1207, 1174, 1139, 1101, 1061, 1021, // 5216-5223
+	979, 937, 896, 856, 816, 778, 743, 710, // 5224-5231
+	681, 654, 630, 607, 587, 566, 544, 520, // 5232-5239
+	493, 461, 424, 382, 336, 284, 230, 173, // 5240-5247
+	116, 59, 5, -45, -91, -131, -164, -190, // 5248-5255
+	-208, -220, -225, -224, -218, -208, -195, -179, // 5256-5263
+	-162, -146, -131, -118, -107, -99, -93, -89, // 5264-5271
+	-87, -86, -85, -84, -80, -75, -67, -55, // 5272-5279
+	-39, -20, 4, 31, 63, 100, 140, 185, // 5280-5287
+	232, 284, 338, 396, 455, 515, 576, 637, // 5288-5295
+	697, 754, 809, 861, 908, 952, 991, 1026, // 5296-5303
+	1058, 1086, 1111, 1134, 1155, 1176, 1195, 1214, // 5304-5311
+	1232, 1250, 1268, 1285, 1301, 1316, 1330, 1344, // 5312-5319
+	1356, 1368, 1377, 1385, 1391, 1395, 1395, 1392, // 5320-5327
+	1384, 1372, 1357, 1338, 1315, 1289, 1260, 1228, // 5328-5335
+	1194, 1158, 1119, 1079, 1036, 992, 945, 897, // 5336-5343
+	845, 792, 737, 681, 622, 562, 502, 443, // 5344-5351
+	383, 326, 272, 222, 178, 139, 106, 80, // 5352-5359
+	61, 47, 37, 30, 24, 17, 8, -5, // 5360-5367
+	-23, -47, -76, -111, -150, -193, -239, -285, // 5368-5375
+	-331, -376, -417, -454, -487, -513, -531, -543, // 5376-5383
+	-547, -544, -533, -514, -488, -455, -417, -374, // 5384-5391
+	-327, -277, -226, -174, -122, -72, -23, 24, // 5392-5399
+	69, 112, 154, 195, 236, 276, 316, 358, // 5400-5407
+	400, 443, 488, 535, 583, 634, 685, 738, // 5408-5415
+	793, 849, 906, 963, 1020, 1077, 1131, 1183, // 5416-5423
+	1233, 1279, 1321, 1359, 1393, 1423, 1449, 1471, // 5424-5431
+	1490, 1506, 1518, 1528, 1535, 1539, 1541, 1541, // 5432-5439
+	1539, 1534, 1528, 1519, 1509, 1497, 1482, 1466, // 5440-5447
+	1448, 1428, 1405, 1379, 1352, 1321, 1288, 1253, // 5448-5455
+	1214, 1174, 1132, 1087, 1041, 993, 942, 888, // 5456-5463
+	831, 770, 706, 636, 562, 484, 401, 315, // 5464-5471
+	226, 136, 44, -46, -134, -220, -302, -379, // 5472-5479
+	-453, -522, -586, -647, -703, -755, -804, -850, // 5480-5487
+	-891, -928, -961, -989, -1012, -1029, -1040, -1046, // 5488-5495
+	-1045, -1039, -1027, -1010, -989, -964, -936, -904, // 5496-5503
+	-870, -833, -793, -749, -702, -650, -594, -532, // 5504-5511
+	-466, -396, -323, -247, -169, -91, -13, 64, // 5512-5519
+	139, 211, 280, 347, 411, 472, 530, 586, // 5520-5527
+	639, 691, 740, 788, 834, 878, 921, 961, // 5528-5535
+	1000, 1036, 1070, 1103, 1133, 1162, 1188, 1212, // 5536-5543
+	1233, 1250, 1264, 1273, 1277, 1276, 1271, 1261, // 5544-5551
+	1248, 1232, 1216, 1199, 1183, 1168, 1154, 1142, // 5552-5559
+	1131, 1120, 1109, 1096, 1081, 1062, 1038, 1009, // 5560-5567
+	974, 933, 887, 834, 777, 716, 652, 585, // 5568-5575
+	518, 450, 383, 317, 252, 188, 127, 67, // 5576-5583
+	8, -49, -104, -158, -210, -261, -310, -357, // 5584-5591
+	-401, -443, -484, -522, -558, -592, -624, -654, // 5592-5599
+	-681, -706, -729, -748, -764, -777, -786, -793, // 5600-5607
+	-796, -797, -795, -791, -785, -777, -768, -756, // 5608-5615
+	-744, -729, -712, -694, -673, -651, -627, -600, // 5616-5623
+	-572, -542, -511, -477, -441, -402, -361, -317, // 5624-5631
+	-270, -221, -169, -115, -59, -3, 54, 112, // 5632-5639
+	168, 222, 276, 327, 376, 421, 465, 506, // 5640-5647
+	545, 582, 618, 653, 687, 722, 757, 792, // 5648-5655
+	827, 863, 899, 934, 969, 1004, 1038, 1070, // 5656-5663
+	1101, 1131, 1158, 1182, 1204, 1222, 1236, 1246, // 5664-5671
+	1253, 1255, 1254, 1249, 1240, 1229, 1215, 1200, // 5672-5679
+	1181, 1161, 1139, 1115, 1088, 1057, 1023, 987, // 5680-5687
+	947, 904, 858, 810, 762, 712, 662, 611, // 5688-5695
+	561, 510, 459, 408, 356, 303, 249, 194, // 5696-5703
+	137, 81, 26, -29, -82, -132, -179, -221, // 5704-5711
+	-259, -293, -322, -346, -366, -383, -396, -407, // 5712-5719
+	-416, -422, -427, -429, -429, -428, -423, -416, // 5720-5727
+	-405, -391, -373, -352, -327, -298, -267, -233, // 5728-5735
+	-198, -161, -126, -91, -58, -28, 0, 24, // 5736-5743
+	46, 64, 81, 97, 113, 131, 151, 174, // 5744-5751
+	202, 236, 277, 323, 376, 435, 499, 566, // 5752-5759
+	636, 706, 776, 843, 906, 964, 1015, 1059, // 5760-5767
+	1095, 1124, 1144, 1158, 1165, 1167, 1165, 1159, // 5768-5775
+	1150, 1139, 1128, 1116, 1105, 1094, 1083, 1074, // 5776-5783
+	1066, 1059, 1054, 1050, 1047, 1045, 1045, 1044, // 5784-5791
+	1044, 1044, 1043, 1042, 1039, 1035, 1030, 1023, // 5792-5799
+	1014, 1005, 993, 982, 969, 956, 943, 929, // 5800-5807
+	915, 900, 884, 867, 849, 830, 810, 788, // 5808-5815
+	766, 743, 720, 697, 674, 650, 628, 604, // 5816-5823
+	581, 557, 533, 509, 485, 460, 437, 413, // 5824-5831
+	391, 370, 350, 330, 311, 294, 277, 259, // 5832-5839
+	241, 224, 206, 188, 170, 152, 134, 116, // 5840-5847
+	99, 83, 67, 52, 38, 26, 16, 10, // 5848-5855
+	6, 7, 12, 22, 37, 58, 83, 113, // 5856-5863
+	147, 184, 224, 265, 308, 350, 392, 432, // 5864-5871
+	471, 509, 545, 579, 612, 643, 673, 702, // 5872-5879
+	729, 755, 781, 805, 828, 851, 872, 894, // 5880-5887
+	914, 934, 953, 973, 991, 1009, 1027, 1043, // 5888-5895
+	1058, 1072, 1084, 1096, 1107, 1116, 1126, 1135, // 5896-5903
+	1145, 1155, 1165, 1176, 1186, 1196, 1206, 1212, // 5904-5911
+	1216, 1215, 1210, 1199, 1181, 1157, 1126, 1090, // 5912-5919
+	1047, 1000, 949, 895, 839, 781, 723, 666, // 5920-5927
+	609, 553, 500, 448, 398, 351, 307, 265, // 5928-5935
+	224, 185, 148, 111, 74, 37, -1, -40, // 5936-5943
+	-81, -123, -167, -210, -254, -297, -339, -377, // 5944-5951
+	-411, -441, -464, -481, -491, -494, -490, -480, // 5952-5959
+	-465, -445, -423, -399, -376, -353, -331, -312, // 5960-5967
+	-295, -280, -265, -251, -234, -215, -193, -166, // 5968-5975
+	-135, -99, -58, -12, 36, 87, 141, 196, // 5976-5983
+	253, 309, 366, 423, 479, 535, 589, 643, // 5984-5991
+	695, 745, 793, 838, 882, 923, 963, 1000, // 5992-5999
+	1036, 1069, 1102, 1132, 1161, 1188, 1212, 1233, // 6000-6007
+	1251, 1266, 1278, 1286, 1290, 1292, 1291, 1288, // 6008-6015
+	1283, 1276, 1269, 1260, 1252, 1243, 1234, 1225, // 6016-6023
+	1215, 1207, 1198, 1190, 1182, 1175, 1168, 1162, // 6024-6031
+	1157, 1151, 1145, 1137, 1127, 1114, 1097, 1076, // 6032-6039
+	1050, 1017, 980, 936, 886, 830, 770, 705, // 6040-6047
+	635, 564, 490, 416, 342, 269, 200, 134, // 6048-6055
+	74, 19, -30, -72, -108, -138, -162, -182, // 6056-6063
+	-198, -212, -224, -236, -250, -266, -284, -305, // 6064-6071
+	-330, -357, -387, -419, -453, -486, -519, -551, // 6072-6079
+	-581, -608, -631, -650, -665, -674, -678, -677, // 6080-6087
+	-671, -660, -643, -622, -597, -569, -537, -502, // 6088-6095
+	-465, -426, -386, -345, -303, -261, -217, -173, // 6096-6103
+	-128, -80, -31, 21, 75, 132, 191, 254, // 6104-6111
+	318, 384, 450, 515, 579, 641, 700, 755, // 6112-6119
+	808, 857, 902, 945, 987, 1028, 1070, 1112, // 6120-6127
+	1156, 1201, 1246, 1293, 1339, 1384, 1426, 1466, // 6128-6135
+	1500, 1529, 1553, 1570, 1581, 1584, 1581, 1570, // 6136-6143
+	1552, 1526, 1494, 1456, 1412, 1364, 1312, 1257, // 6144-6151
+	1203, 1148, 1095, 1044, 994, 946, 901, 857, // 6152-6159
+	815, 772, 729, 684, 638, 590, 538, 483, // 6160-6167
+	426, 365, 304, 242, 181, 121, 65, 12, // 6168-6175
+	-36, -79, -116, -148, -175, -196, -214, -227, // 6176-6183
+	-238, -247, -253, -258, -262, -264, -265, -264, // 6184-6191
+	-262, -259, -253, -246, -237, -226, -213, -199, // 6192-6199
+	-184, -167, -148, -127, -104, -79, -52, -23, // 6200-6207
+	10, 44, 81, 120, 161, 205, 250, 298, // 6208-6215
+	347, 397, 447, 498, 548, 597, 645, 689, // 6216-6223
+	731, 771, 806, 839, 869, 896, 921, 944, // 6224-6231
+	965, 985, 1003, 1019, 1034, 1047, 1057, 1066, // 6232-6239
+	1072, 1077, 1078, 1078, 1074, 1067, 1058, 1046, // 6240-6247
+	1032, 1015, 996, 977, 957, 936, 916, 898, // 6248-6255
+	880, 865, 851, 840, 830, 820, 812, 803, // 6256-6263
+	794, 782, 769, 752, 732, 707, 678, 646, // 6264-6271
+	610, 572, 531, 489, 447, 405, 365, 326, // 6272-6279
+	289, 255, 225, 197, 172, 150, 130, 113, // 6280-6287
+	97, 84, 71, 60, 50, 39, 28, 17, // 6288-6295
+	4, -11, -27, -46, -67, -89, -112, -135, // 6296-6303
+	-157, -177, -195, -210, -221, -229, -233, -234, // 6304-6311
+	-232, -227, -221, -213, -205, -196, -188, -180, // 6312-6319
+	-172, -164, -155, -146, -134, -121, -104, -83, // 6320-6327
+	-58, -27, 8, 47, 91, 140, 191, 244, // 6328-6335
+	299, 354, 408, 462, 513, 562, 608, 650, // 6336-6343
+	689, 726, 759, 789, 818, 845, 870, 895, // 6344-6351
+	920, 944, 969, 993, 1016, 1038, 1059, 1078, // 6352-6359
+	1094, 1107, 1116, 1120, 1120, 1116, 1107, 1094, // 6360-6367
+	1077, 1057, 1033, 1007, 980, 950, 920, 889, // 6368-6375
+	858, 826, 794, 762, 728, 693, 657, 620, // 6376-6383
+	580, 538, 494, 449, 402, 354, 305, 256, // 6384-6391
+	207, 158, 110, 63, 18, -26, -69, -109, // 6392-6399
+	-146, -181, -213, -244, -271, -296, -318, -340, // 6400-6407
+	-360, -380, -399, -418, -437, -455, -472, -488, // 6408-6415
+	-501, -512, -520, -525, -527, -526, -521, -514, // 6416-6423
+	-504, -491, -475, -455, -433, -407, -376, -341, // 6424-6431
+	-301, -257, -209, -158, -104, -48, 8, 63, // 6432-6439
+	117, 168, 216, 260, 299, 334, 363, 388, // 6440-6447
+	409, 426, 439, 450, 460, 469, 478, 488, // 6448-6455
+	501, 516, 533, 554, 578, 605, 633, 662, // 6456-6463
+	691, 719, 745, 768, 786, 800, 808, 812, // 6464-6471
+	811, 805, 796, 784, 770, 755, 739, 724, // 6472-6479
+	709, 694, 681, 669, 658, 648, 639, 630, // 6480-6487
+	621, 612, 604, 595, 586, 576, 566, 554, // 6488-6495
+	542, 529, 514, 498, 480, 461, 441, 419, // 6496-6503
+	396, 372, 347, 321, 295, 269, 242, 215, // 6504-6511
+	188, 160, 131, 101, 70, 38, 4, -32, // 6512-6519
+	-69, -107, -144, -182, -218, -253, -285, -314, // 6520-6527
+	-341, -363, -383, -399, -411, -421, -429, -434, // 6528-6535
+	-438, -442, -446, -449, -454, -459, -466, -473, // 6536-6543
+	-482, -492, -502, -512, -521, -530, -537, -541, // 6544-6551
+	-543, -540, -533, -520, -502, -478, -448, -414, // 6552-6559
+	-374, -331, -284, -235, -185, -134, -82, -31, // 6560-6567
+	20, 72, 124, 176, 229, 283, 338, 394, // 6568-6575
+	451, 508, 564, 620, 674, 726, 776, 823, // 6576-6583
+	867, 908, 947, 983, 1017, 1050, 1080, 1108, // 6584-6591
+	1135, 1160, 1183, 1204, 1222, 1237, 1249, 1258, // 6592-6599
+	1263, 1265, 1262, 1256, 1246, 1232, 1213, 1191, // 6600-6607
+	1164, 1133, 1098, 1059, 1016, 972, 924, 875, // 6608-6615
+	825, 775, 725, 675, 626, 578, 531, 486, // 6616-6623
+	443, 403, 365, 330, 298, 269, 242, 219, // 6624-6631
+	199, 181, 164, 149, 136, 123, 110, 98, // 6632-6639
+	85, 71, 56, 41, 26, 10, -5, -20, // 6640-6647
+	-32, -43, -50, -54, -54, -49, -41, -29, // 6648-6655
+	-12, 8, 31, 57, 85, 113, 142, 171, // 6656-6663
+	198, 224, 247, 267, 284, 299, 311, 322, // 6664-6671
+	332, 342, 352, 365, 379, 396, 415, 437, // 6672-6679
+	461, 487, 515, 543, 573, 602, 632, 661, // 6680-6687
+	689, 715, 739, 762, 782, 801, 818, 833, // 6688-6695
+	847, 859, 870, 881, 891, 901, 910, 919, // 6696-6703
+	927, 934, 940, 945, 948, 950, 949, 946, // 6704-6711
+	941, 932, 920, 906, 888, 867, 843, 816, // 6712-6719
+	787, 757, 725, 694, 663, 634, 608, 583, // 6720-6727
+	562, 543, 528, 514, 503, 494, 486, 479, // 6728-6735
+	472, 464, 456, 446, 435, 422, 407, 389, // 6736-6743
+	368, 344, 318, 288, 256, 222, 187, 151, // 6744-6751
+	114, 79, 45, 13, -17, -44, -68, -89, // 6752-6759
+	-109, -126, -142, -157, -170, -183, -194, -205, // 6760-6767
+	-214, -222, -229, -233, -236, -237, -235, -232, // 6768-6775
+	-226, -218, -209, -197, -183, -168, -151, -131, // 6776-6783
+	-111, -88, -64, -38, -10, 21, 53, 87, // 6784-6791
+	124, 163, 204, 248, 293, 341, 391, 443, // 6792-6799
+	497, 552, 608, 665, 722, 778, 833, 887, // 6800-6807
+	938, 986, 1031, 1072, 1108, 1140, 1167, 1189, // 6808-6815
+	1205, 1216, 1221, 1222, 1217, 1207, 1193, 1175, // 6816-6823
+	1154, 1131, 1105, 1080, 1053, 1028, 1004, 981, // 6824-6831
+	959, 938, 917, 896, 875, 851, 826, 798, // 6832-6839
+	767, 732, 694, 653, 608, 561, 512, 461, // 6840-6847
+	409, 357, 305, 255, 207, 162, 119, 80, // 6848-6855
+	45, 13, -16, -42, -66, -88, -110, -131, // 6856-6863
+	-154, -177, -203, -230, -260, -291, -324, -356, // 6864-6871
+	-389, -419, -447, -472, -493, -509, -520, -527, // 6872-6879
+	-529, -527, -520, -511, -497, -482, -465, -446, // 6880-6887
+	-425, -403, -379, -354, -327, -297, -267, -235, // 6888-6895
+	-202, -168, -132, -96, -60, -22, 15, 53, // 6896-6903
+	91, 129, 167, 205, 241, 276, 310, 343, // 6904-6911
+	374, 402, 428, 452, 474, 494, 512, 530, // 6912-6919
+	546, 562, 579, 597, 615, 633, 653, 673, // 6920-6927
+	694, 714, 734, 753, 770, 785, 797, 807, // 6928-6935
+	813, 817, 817, 815, 810, 802, 792, 779, // 6936-6943
+	763, 745, 724, 700, 675, 647, 618, 588, // 6944-6951
+	558, 528, 500, 473, 449, 427, 407, 390, // 6952-6959
+	375, 361, 348, 334, 319, 302, 283, 260, // 6960-6967
+	234, 204, 171, 134, 94, 52, 8, -37, // 6968-6975
+	-83, -130, -176, -222, -265, -308, -349, -388, // 6976-6983
+	-424, -458, -489, -517, -542, -564, -583, -598, // 6984-6991
+	-610, -619, -626, -630, -632, -631, -629, -625, // 6992-6999
+	-620, -613, -604, -593, -581, -567, -552, -536, // 7000-7007
+	-519, -500, -481, -460, -439, -417, -393, -367, // 7008-7015
+	-341, -313, -283, -252, -220, -186, -151, -114, // 7016-7023
+	-76, -36, 6, 50, 96, 145, 197, 252, // 7024-7031
+	309, 370, 433, 498, 564, 629, 692, 754, // 7032-7039
+	812, 866, 915, 960, 999, 1034, 1064, 1089, // 7040-7047
+	1111, 1129, 1142, 1154, 1162, 1169, 1173, 1176, // 7048-7055
+	1178, 1178, 1176, 1172, 1167, 1158, 1146, 1130, // 7056-7063
+	1110, 1086, 1056, 1023, 984, 943, 899, 853, // 7064-7071
+	807, 762, 717, 674, 633, 595, 558, 524, // 7072-7079
+	491, 458, 425, 393, 359, 324, 287, 249, // 7080-7087
+	210, 170, 130, 90, 51, 13, -24, -58, // 7088-7095
+	-90, -119, -144, -165, -183, -196, -204, -209, // 7096-7103
+	-209, -205, -199, -190, -178, -165, -150, -135, // 7104-7111
+	-119, -104, -89, -75, -61, -49, -37, -26, // 7112-7119
+	-16, -6, 3, 13, 23, 34, 47, 60, // 7120-7127
+	76, 95, 115, 139, 165, 193, 224, 256, // 7128-7135
+	289, 324, 359, 394, 428, 462, 495, 527, // 7136-7143
+	557, 586, 613, 639, 663, 686, 708, 729, // 7144-7151
+	750, 770, 791, 813, 835, 859, 883, 909, // 7152-7159
+	934, 959, 983, 1006, 1027, 1045, 1060, 1072, // 7160-7167
+	1080, 1083, 1083, 1078, 1068, 1055, 1038, 1018, // 7168-7175
+	995, 969, 941, 912, 881, 849, 817, 785, // 7176-7183
+	754, 724, 695, 668, 643, 619, 597, 577, // 7184-7191
+	556, 536, 516, 496, 475, 454, 434, 414, // 7192-7199
+	394, 375, 357, 341, 324, 309, 294, 279, // 7200-7207
+	264, 249, 233, 217, 200, 182, 163, 143, // 7208-7215
+	122, 99, 75, 50, 23, -4, -30, -56, // 7216-7223
+	-80, -102, -120, -136, -147, -154, -157, -155, // 7224-7231
+	-149, -140, -127, -111, -93, -73, -53, -32, // 7232-7239
+	-11, 10, 31, 51, 71, 92, 113, 136, // 7240-7247
+	160, 187, 216, 248, 284, 323, 366, 412, // 7248-7255
+	462, 515, 571, 628, 688, 749, 810, 870, // 7256-7263
+	930, 987, 1042, 1094, 1144, 1190, 1232, 1271, // 7264-7271
+	1306, 1337, 1364, 1388, 1407, 1422, 1433, 1438, // 7272-7279
+	1439, 1435, 1425, 1410, 1391, 1366, 1338, 1306, // 7280-7287
+	1271, 1234, 1196, 1158, 1119, 1082, 1044, 1009, // 7288-7295
+	974, 941, 909, 878, 848, 818, 789, 759, // 7296-7303
+	729, 697, 665, 632, 597, 561, 523, 484, // 7304-7311
+	444, 402, 359, 315, 270, 224, 177, 130, // 7312-7319
+	83, 37, -7, -50, -91, -129, -163, -194, // 7320-7327
+	-222, -245, -266, -282, -295, -305, -312, -316, // 7328-7335
+	-318, -318, -315, -310, -303, -294, -284, -272, // 7336-7343
+	-260, -248, -235, -222, -209, -194, -179, -162, // 7344-7351
+	-143, -122, -98, -70, -39, -5, 32, 71, // 7352-7359
+	112, 155, 198, 242, 285, 327, 369, 409, // 7360-7367
+	448, 485, 521, 555, 588, 619, 648, 675, // 7368-7375
+	700, 724, 747, 768, 788, 807, 826, 845, // 7376-7383
+	863, 882, 902, 921, 941, 961, 979, 997, // 7384-7391
+	1013, 1027, 1040, 1049, 1057, 1063, 1066, 1069, // 7392-7399
+	1070, 1070, 1069, 1067, 1064, 1060, 1056, 1051, // 7400-7407
+	1044, 1036, 1026, 1015, 1001, 984, 965, 944, // 7408-7415
+	919, 892, 862, 829, 794, 756, 717, 677, // 7416-7423
+	636, 595, 556, 517, 480, 445, 411, 379, // 7424-7431
+	348, 318, 288, 258, 226, 194, 161, 127, // 7432-7439
+	91, 54, 17, -21, -59, -97, -134, -171, // 7440-7447
+	-205, -238, -268, -295, -320, -342, -359, -374, // 7448-7455
+	-386, -395, -401, -405, -407, -406, -404, -399, // 7456-7463
+	-393, -385, -376, -365, -352, -337, -321, -303, // 7464-7471
+	-282, -258, -231, -201, -168, -132, -93, -53, // 7472-7479
+	-11, 32, 75, 117, 159, 199, 239, 277, // 7480-7487
+	314, 351, 387, 424, 461, 499, 539, 580, // 7488-7495
+	623, 666, 710, 754, 799, 842, 884, 925, // 7496-7503
+	963, 999, 1032, 1063, 1092, 1117, 1139, 1159, // 7504-7511
+	1175, 1189, 1199, 1206, 1210, 1210, 1207, 1202, // 7512-7519
+	1194, 1184, 1172, 1159, 1145, 1130, 1113, 1096, // 7520-7527
+	1078, 1058, 1038, 1017, 996, 974, 950, 927, // 7528-7535
+	903, 877, 852, 825, 797, 768, 737, 706, // 7536-7543
+	674, 641, 608, 574, 539, 505, 472, 441, // 7544-7551
+	411, 383, 359, 339, 321, 309, 299, 293, // 7552-7559
+	290, 289, 290, 291, 293, 295, 297, 298, // 7560-7567
+	298, 298, 296, 295, 293, 291, 289, 288, // 7568-7575
+	287, 286, 286, 286, 286, 287, 287, 288, // 7576-7583
+	289, 289, 289, 289, 289, 289, 289, 289, // 7584-7591
+	290, 291, 294, 297, 302, 309, 318, 328, // 7592-7599
+	341, 358, 376, 396, 419, 445, 472, 501, // 7600-7607
+	532, 563, 595, 625, 655, 683, 710, 734, // 7608-7615
+	756, 775, 792, 806, 817, 826, 834, 840, // 7616-7623
+	844, 847, 850, 853, 856, 859, 864, 869, // 7624-7631
+	875, 881, 886, 891, 895, 897, 896, 892, // 7632-7639
+	884, 873, 858, 840, 818, 794, 767, 739, // 7640-7647
+	709, 679, 649, 619, 589, 560, 531, 504, // 7648-7655
+	477, 450, 425, 400, 376, 354, 332, 310, // 7656-7663
+	290, 270, 250, 230, 211, 193, 174, 156, // 7664-7671
+	139, 123, 106, 90, 74, 58, 41, 22, // 7672-7679
+	2, -19, -42, -67, -93, -120, -147, -173, // 7680-7687
+	-199, -222, -243, -260, -275, -285, -292, -294, // 7688-7695
+	-292, -286, -276, -263, -245, -225, -202, -177, // 7696-7703
+	-148, -118, -86, -51, -16, 22, 60, 99, // 7704-7711
+	139, 179, 218, 257, 295, 332, 368, 402, // 7712-7719
+	435, 467, 498, 528, 557, 586, 615, 643, // 7720-7727
+	672, 700, 728, 756, 783, 810, 836, 861, // 7728-7735
+	884, 906, 926, 944, 959, 971, 980, 986, // 7736-7743
+	989, 990, 987, 982, 976, 967, 956, 944, // 7744-7751
+	931, 917, 902, 887, 871, 855, 838, 819, // 7752-7759
+	800, 779, 756, 730, 702, 671, 639, 604, // 7760-7767
+	566, 527, 487, 447, 406, 366, 326, 288, // 7768-7775
+	250, 214, 179, 146, 113, 80, 48, 17, // 7776-7783
+	-14, -45, -75, -106, -136, -167, -197, -227, // 7784-7791
+	-256, -285, -313, -340, -364, -387, -407, -425, // 7792-7799
+	-439, -451, -460, -466, -470, -472, -472, -470, // 7800-7807
+	-466, -462, -457, -451, -445, -438, -431, -424, // 7808-7815
+	-417, -410, -403, -395, -387, -378, -368, -356, // 7816-7823
+	-342, -324, -304, -280, -253, -223, -189, -153, // 7824-7831
+	-114, -74, -32, 11, 53, 94, 134, 171, // 7832-7839
+	207, 239, 269, 296, 320, 341, 360, 376, // 7840-7847
+	392, 406, 418, 430, 442, 454, 467, 480, // 7848-7855
+	493, 507, 522, 537, 552, 566, 580, 592, // 7856-7863
+	602, 611, 618, 623, 625, 626, 624, 620, // 7864-7871
+	615, 607, 598, 587, 575, 561, 545, 527, // 7872-7879
+	507, 485, 460, 433, 403, 371, 337, 302, // 7880-7887
+	265, 228, 191, 153, 116, 80, 44, 10, // 7888-7895
+	-24, -57, -89, -120, -151, -181, -211, -239, // 7896-7903
+	-268, -296, -323, -349, -375, -399, -422, -444, // 7904-7911
+	-464, -483, -502, -519, -536, -551, -566, -580, // 7912-7919
+	-593, -604, -614, -622, -626, -628, -627, -622, // 7920-7927
+	-614, -603, -588, -569, -548, -524, -497, -467, // 7928-7935
+	-437, -405, -371, -338, -304, -272, -241, -212, // 7936-7943
+	-185, -160, -137, -116, -97, -79, -61, -44, // 7944-7951
+	-26, -8, 12, 33, 56, 80, 106, 132, // 7952-7959
+	159, 187, 214, 242, 269, 295, 321, 346, // 7960-7967
+	370, 394, 417, 440, 462, 484, 505, 525, // 7968-7975
+	545, 563, 580, 596, 609, 620, 628, 634, // 7976-7983
+	636, 635, 631, 623, 612, 598, 581, 561, // 7984-7991
+	539, 515, 489, 462, 434, 406, 379, 351, // 7992-7999
+	325, 300, 277, 255, 233, 213, 194, 175, // 8000-8007
+	156, 137, 117, 96, 75, 53, 30, 7, // 8008-8015
+	-17, -41, -66, -89, -113, -136, -158, -178, // 8016-8023
+	-197, -215, -230, -243, -255, -265, -272, -278, // 8024-8031
+	-281, -283, -284, -282, -280, -276, -271, -265, // 8032-8039
+	-259, -252, -245, -238, -230, -223, -215, -207, // 8040-8047
+	-199, -191, -182, -173, -163, -153, -141, -128, // 8048-8055
+	-115, -99, -83, -65, -46, -26, -5, 17, // 8056-8063
+	40, 62, 85, 107, 128, 149, 169, 188, // 8064-8071
+	206, 222, 237, 251, 264, 275, 286, 296, // 8072-8079
+	304, 312, 319, 325, 330, 334, 338, 341, // 8080-8087
+	344, 346, 347, 348, 349, 350, 350, 350, // 8088-8095
+	350, 349, 348, 346, 343, 340, 336, 330, // 8096-8103
+	324, 317, 309, 300, 290, 280, 268, 255, // 8104-8111
+	242, 227, 211, 194, 176, 157, 136, 115, // 8112-8119
+	94, 73, 51, 30, 9, -11, -30, -47, // 8120-8127
+	-63, -78, -91, -102, -111, -119, -126, -131, // 8128-8135
+	-136, -139, -143, -146, -149, -152, -155, -158, // 8136-8143
+	-162, -166, -171, -175, -180, -184, -188, -192, // 8144-8151
+	-194, -196, -196, -195, -192, -188, -183, -176, // 8152-8159
+	-169, -160, -150, -140, -129, -118, -105, -93, // 8160-8167
+	-80, -66, -51, -36, -20, -4, 13, 30, // 8168-8175
+	48, 66, 83, 101, 118, 134, 151, 166, // 8176-8183
+	180, 194, 207, 220, 233, 245, 257, 268, // 8184-8191
+	280, 292, 303, 315, 327, 339, 350, 361, // 8192-8199
+	372, 382, 391, 399, 407, 413, 417, 421, // 8200-8207
+	422, 423, 421, 418, 413, 407, 399, 389, // 8208-8215
+	378, 365, 351, 335, 319, 302, 285, 267, // 8216-8223
+	249, 232, 215, 198, 182, 167, 152, 138, // 8224-8231
+	124, 111, 98, 84, 70, 56, 42, 27, // 8232-8239
+	12, -3, -19, -36, -52, -69, -86, -103, // 8240-8247
+	-120, -137, -154, -170, -186, -202, -217, -232, // 8248-8255
+	-246, -258, -270, -281, -291, -300, -307, -315, // 8256-8263
+	-321, -326, -331, -336, -339, -342, -345, -346, // 8264-8271
+	-346, -345, -343, -340, -335, -330, -322, -314, // 8272-8279
+	-305, -294, -283, -271, -258, -245, -232, -218, // 8280-8287
+	-203, -189, -175, -160, -146, -131, -117, -102, // 8288-8295
+	-88, -74, -61, -47, -34, -20, -7, 6, // 8296-8303
+	19, 32, 46, 59, 73, 86, 99, 112, // 8304-8311
+	125, 138, 149, 161, 171, 181, 190, 198, // 8312-8319
+	206, 213, 219, 224, 229, 233, 237, 240, // 8320-8327
+	242, 244, 246, 247, 247, 247, 246, 246, // 8328-8335
+	244, 242, 239, 235, 231, 226, 219, 212, // 8336-8343
+	204, 196, 186, 176, 165, 153, 141, 129, // 8344-8351
+	116, 103, 89, 76, 62, 49, 35, 21, // 8352-8359
+	8, -6, -19, -33, -47, -60, -73, -86, // 8360-8367
+	-98, -110, -122, -132, -142, -151, -159, -167, // 8368-8375
+	-173, -180, -185, -190, -195, -199, -203, -206, // 8376-8383
+	-209, -212, -215, -217, -219, -221, -222, -223, // 8384-8391
+	-223, -222, -221, -218, -215, -211, -206, -200, // 8392-8399
+	-194, -186, -178, -169, -160, -151, -141, -131, // 8400-8407
+	-121, -111, -100, -90, -79, -68, -58, -47, // 8408-8415
+	-36, -25, -14, -4, 7, 17, 28, 38, // 8416-8423
+	48, 58, 68, 77, 86, 96, 105, 114, // 8424-8431
+	122, 131, 139, 147, 155, 162, 169, 175, // 8432-8439
+	181, 186, 191, 195, 199, 202, 204, 205, // 8440-8447
+	206, 206, 205, 203, 201, 198, 195, 190, // 8448-8455
+	185, 180, 174, 167, 160, 153, 145, 136, // 8456-8463
+	127, 117, 107, 97, 86, 75, 63, 52, // 8464-8471
+	40, 29, 17, 5, -6, -18, -29, -40, // 8472-8479
+	-51, -61, -71, -81, -90, -99, -107, -115, // 8480-8487
+	-122, -129, -136, -141, -146, -151, -155, -159, // 8488-8495
+	-161, -163, -164, -165, -165, -164, -163, -161, // 8496-8503
+	-158, -154, -150, -146, -141, -135, -129, -123, // 8504-8511
+	-116, -109, -102, -95, -88, -80, -72, -64, // 8512-8519
+	-57, -49, -40, -32, -24, -15, -7, 2, // 8520-8527
+	11, 20, 29, 37, 46, 55, 64, 72, // 8528-8535
+	80, 88, 96, 104, 111, 118, 124, 130, // 8536-8543
+	136, 141, 146, 151, 154, 158, 161, 163, // 8544-8551
+	165, 166, 167, 167, 167, 166, 164, 163, // 8552-8559
+	160, 157, 153, 150, 145, 140, 135, 129, // 8560-8567
+	124, 117, 111, 104, 97, 90, 83, 76, // 8568-8575
+	69, 61, 54, 47, 39, 32, 24, 17, // 8576-8583
+	10, 2, -5, -11, -18, -25, -31, -37, // 8584-8591
+	-43, -49, -54, -60, -65, -69, -74, -78, // 8592-8599
+	-82, -85, -88, -91, -94, -96, -98, -99, // 8600-8607
+	-101, -101, -102, -102, -102, -102, -101, -100, // 8608-8615
+	-99, -97, -95, -92, -89, -86, -83, -79, // 8616-8623
+	-75, -70, -65, -60, -55, -49, -43, -37, // 8624-8631
+	-31, -24, -18, -11, -4, 3, 10, 17, // 8632-8639
+	24, 31, 38, 45, 51, 58, 64, 71, // 8640-8647
+	77, 83, 88, 94, 99, 103, 108, 112, // 8648-8655
+	116, 119, 122, 125, 127, 129, 130, 131, // 8656-8663
+	132, 132, 132, 132, 131, 130, 128, 126, // 8664-8671
+	124, 121, 118, 115, 111, 107, 103, 98, // 8672-8679
+	93, 88, 82, 76, 70, 64, 58, 51, // 8680-8687
+	45, 38, 31, 24, 17, 10, 3, -4, // 8688-8695
+	-11, -18, -25, -32, -39, -46, -52, -59, // 8696-8703
+	-65, -71, -77, -82, -88, -93, -98, -102, // 8704-8711
+	-107, -111, -115, -118, -121, -124, -127, -129, // 8712-8719
+	-131, -133, -134, -135, -136, -136, -137, -136, // 8720-8727
+	-136, -135, -134, -132, -130, -128, -126, -123, // 8728-8735
+	-120, -117, -114, -110, -106, -102, -98, -93, // 8736-8743
+	-89, -84, -79, -74, -68, -63, -57, -52, // 8744-8751
+	-46, -40, -34, -28, -23, -17, -11, -5, // 8752-8759
+	0, 6, 12, 17, 22, 27, 32, 37, // 8760-8767
+	42, 46, 50, 54, 58, 61, 64, 67, // 8768-8775
+	69, 72, 74, 75, 77, 78, 79, 79, // 8776-8783
+	79, 79, 79, 79, 78, 77, 76, 74, // 8784-8791
+	72, 71, 68, 66, 64, 61, 58, 55, // 8792-8799
+	52, 49, 46, 42, 39, 35, 32, 28, // 8800-8807
+	24, 21, 17, 13, 9, 6, 2, -2, // 8808-8815
+	-6, -9, -13, -16, -20, -23, -27, -30, // 8816-8823
+	-33, -36, -39, -42, -45, -47, -50, -52, // 8824-8831
+	-54, -56, -58, -60, -62, -63, -64, -65, // 8832-8839
+	-66, -67, -67, -67, -68, -67, -67, -67, // 8840-8847
+	-66, -65, -64, -63, -62, -61, -59, -58, // 8848-8855
+	-56, -54, -52, -50, -48, -46, -43, -41, // 8856-8863
+	-39, -36, -34, -31, -28, -26, -23, -20, // 8864-8871
+	-18, -15, -13, -10, -7, -5, -2, 0, // 8872-8879
+	3, 5, 7, 10, 12, 14, 16, 18, // 8880-8887
+	20, 22, 24, 25, 27, 28, 30, 31, // 8888-8895
+	32, 33, 34, 35, 36, 36, 37, 37, // 8896-8903
+	37, 37, 38, 37, 37, 37, 37, 36, // 8904-8911
+	35, 35, 34, 33, 32, 31, 29, 28, // 8912-8919
+	26, 25, 23, 22, 20, 18, 16, 14, // 8920-8927
+	12, 10, 8, 6, 4, 2, 0, -2, // 8928-8935
+	-3, -5, -7, -9, -11, -13, -14, -16, // 8936-8943
+	-17, -19, -20, -21, -22, -23, -24, -25, // 8944-8951
+	-26, -26, -27, -27, -27, -27, -27, -27, // 8952-8959
+	-27, -26, -26, -25, -24, -23, -22, -21, // 8960-8967
+	-19, -18, -16, -15, -13, -11, -9, -7, // 8968-8975
+	-5, -3, -1, 2, 4, 6, 9, 11, // 8976-8983
+	13, 16, 18, 20, 23, 25, 27, 29, // 8984-8991
+	31, 33, 35, 37, 39, 41, 42, 44, // 8992-8999
+	45, 46, 48, 49, 50, 50, 51, 52, // 9000-9007
+	52, 53, 53, 53, 53, 53, 52, 52, // 9008-9015
+	51, 51, 50, 49, 48, 47, 46, 45, // 9016-9023
+	43, 42, 40, 38, 37, 35, 33, 31, // 9024-9031
+	29, 27, 25, 23, 21, 18, 16, 14, // 9032-9039
+	12, 10, 7, 5, 3, 1, -1, -4, // 9040-9047
+	-6, -8, -10, -12, -13, -15, -17, -19, // 9048-9055
+	-20, -22, -23, -24, -25, -27, -27, -28, // 9056-9063
+	-29, -30, -30, -30, -30, -31, -30, -30, // 9064-9071
+	-30, -30, -29, -28, -28, -27, -26, -25, // 9072-9079
+	-24, -23, -21, -20, -19, -17, -16, -14, // 9080-9087
+	-12, -10, -9, -7, -5, -3, -1, 1, // 9088-9095
+	3, 5, 7, 9, 11, 13, 14, 16, // 9096-9103
+	18, 20, 21, 23, 25, 26, 28, 29, // 9104-9111
+	30, 32, 33, 34, 35, 36, 36, 37, // 9112-9119
+	38, 38, 38, 39, 39, 39, 38, 38, // 9120-9127
+	38, 37, 37, 36, 35, 34, 33, 32, // 9128-9135
+	31, 29, 28, 26, 25, 23, 21, 20, // 9136-9143
+	18, 16, 14, 11, 9, 7, 5, 3, // 9144-9151
+	0, -2, -4, -7, -9, -11, -13, -16, // 9152-9159
+	-18, -20, -22, -24, -26, -28, -30, -32, // 9160-9167
+	-33, -35, -37, -38, -39, -41, -42, -43, // 9168-9175
+	-44, -45, -46, -46, -47, -48, -48, -48, // 9176-9183
+	-48, -48, -48, -48, -48, -47, -47, -46, // 9184-9191
+	-45, -45, -44, -43, -41, -40, -39, -37, // 9192-9199
+	-36, -34, -33, -31, -29, -28, -26, -24, // 9200-9207
+	-22, -20, -18, -16, -14, -12, -11, -9, // 9208-9215
+	-7, -5, -3, -1, 1, 3, 4, 6, // 9216-9223
+	8, 9, 11, 12, 13, 15, 16, 17, // 9224-9231
+	18, 19, 19, 20, 21, 21, 22, 22, // 9232-9239
+	22, 22, 22, 22, 22, 22, 22, 22, // 9240-9247
+	21, 21, 20, 19, 19, 18, 17, 16, // 9248-9255
+	15, 14, 13, 12, 11, 10, 9, 8, // 9256-9263
+	7, 5, 4, 3, 2, 1, -1, -2, // 9264-9271
+	-3, -4, -5, -6, -7, -8, -9, -10, // 9272-9279
+	-11, -12, -13, -13, -14, -15, -15, -16, // 9280-9287
+	-16, -16, -17, -17, -17, -17, -18, -18, // 9288-9295
+	-18, -18, -17, -17, -17, -17, -17, -16, // 9296-9303
+	-16, -16, -15, -15, -14, -14, -13, -13, // 9304-9311
+	-12, -12, -11, -10, -10, -9, -8, -8, // 9312-9319
+	-7, -7, -6, -5, -5, -4, -3, -3, // 9320-9327
+	-2, -2, -1, -1, 0, 0, 1, 1, // 9328-9335
+	2, 2, 3, 3, 3, 4, 4, 4, // 9336-9343
+	4, 4, 5, 5, 5, 5, 5, 5, // 9344-9351
+	5, 5, 5, 5, 5, 5, 5, 5, // 9352-9359
+	5, 5, 4, 4, 4, 4, 4, 3, // 9360-9367
+	3, 3, 3, 3, 2, 2, 2, 2, // 9368-9375
+	1, 1, 1, 1, 1, 0, 0, 0, // 9376-9383
+	0, 0, -1, -1, -1, -1, -1, -1, // 9384-9391
+	-1, -1, -1, -2, -2, -2, -2, -2, // 9392-9399
+	-2, -2, -2, -2, -2, -2, -1, -1, // 9400-9407
+	-1, -1, -1, -1, -1, -1, -1, -1, // 9408-9415
+	-1, 0, 0, 0, 0, 0, 0, 0, // 9416-9423
+	0, 1, 1, 1, 1, 1, 1, 1, // 9424-9431
+	1, 1, 1, 1, 2, 2, 2, 2, // 9432-9439
+	2, 2, 2, 2, 2, 2, 2, 2, // 9440-9447
+	2, 2, 2, 2, 2, 1, 1, 1, // 9448-9455
+	1, 1, 1, 1, 1, 1, 1, 1, // 9456-9463
+	1, 1, 0, 0, 0, 0, 0, 0, // 9464-9471
+};
+
+static const int16_t val_hit_guitar_data[7513] = {
+	0, 0, 0, 0, 0, 2, 3, 7, // 0-7
+	5, 7, 18, 22, 29, 35, 39, 57, // 8-15
+	73, 85, 102, 117, 133, 161, 183, 204, // 16-23
+	233, 260, 278, 308, 346, 386, 412, 460, // 24-31
+	488, 529, 586, 628, 676, 729, 779, 825, // 32-39
+	881, 935, 989, 1049, 1110, 1160, 1214, 1281, // 40-47
+	1353, 1411, 1470, 1533, 1602, 1672, 1739, 1789, // 48-55
+	1860, 1953, 2002, 2063, 2155, 2237, 2304, 2390, // 56-63
+	2458, 2535, 2632, 2709, 2796, 2889, 2947, 3024, // 64-71
+	3142, 3250, 3313, 3395, 3505, 3614, 3704, 3816, // 72-79
+	3926, 3999, 4096, 4217, 4330, 4414, 4475, 4577, // 80-87
+	4697, 4753, 4828, 4938, 5029, 5119, 5184, 5272, // 88-95
+	5382, 5480, 5559, 5653, 5763, 5872, 5973, 6069, // 96-103
+	6169, 6276, 6390, 6479, 6576, 6689, 6789, 6864, // 104-111
+	6962, 7092, 7191, 7282, 7366, 7452, 7555, 7636, // 112-119
+	7708, 7801, 7884, 7968, 8053, 8125, 8210, 8314, // 120-127
+	8403, 8474, 8567, 8674, 8768, 8860, 8960, 9073, // 128-135
+	9177, 9261, 9340, 9456, 9565, 9650, 9716, 9791, // 136-143
+	9890, 9982, 10058, 10134, 10194, 10244, 10323, 10397, // 144-151
+	10451, 10491, 10536, 10586, 10633, 10670, 10708, 10738, // 152-159
+	10770, 10798, 10814, 10835, 10860, 10875, 10868, 10889, // 160-167
+	10897, 10881, 10870, 10890, 10886, 10864, 10856, 10838, // 168-175
+	10828, 10805, 10770, 10762, 10735, 10674, 10615, 10561, // 176-183
+	10511, 10445, 10380, 10319, 10241, 10161, 10102, 10058, // 184-191
+	10001, 9913, 9835, 9786, 9718, 9648, 9574, 9523, // 192-199
+	9474, 9396, 9341, 9304, 9273, 9218, 9141, 9092, // 200-207
+	9040, 8970, 8906, 8835, 8752, 8663, 8573, 8482, // 208-215
+	8378, 8269, 8160, 8038, 7922, 7805, 7683, 7589, // 216-223
+	7499, 7384, 7267, 7188, 7103, 6999, 6909, 6831, // 224-231
+	6713, 6610, 6521, 6433, 6340, 6243, 6120, 6009, // 232-239
+	5918, 5794, 5665, 5561, 5453, 5319, 5191, 5085, // 240-247
+	4967, 4858, 4758, 4617, 4500, 4391, 4267, 4155, // 248-255
+	4053, 3921, 3804, 3725, 3616, 3491, 3383, 3306, // 256-263
+	3166, 3039, 2958, 2821, 2681, 2576, 2465, 2342, // 264-271
+	2216, 2079, 1967, 1874, 1754, 1610, 1488, 1391, // 272-279
+	1278, 1153, 1032, 925, 824, 702, 572, 471, // 280-287
+	349, 225, 121, -21, -172, -312, -440, -578, // 288-295
+	-738, -906, -1063, -1217, -1377, -1541, -1707, -1863, // 296-303
+	-2035, -2215, -2364, -2515, -2684, -2852, -3002, -3142, // 304-311
+	-3292, -3440, -3577, -3719, -3841, -3969, -4097, -4215, // 312-319
+	-4326, -4459, -4580, -4685, -4813, -4945, -5063, -5184, // 320-327
+	-5322, -5441, -5561, -5695, -5824, -5961, -6082, -6209, // 328-335
+	-6338, -6470, -6606, -6749, -6877, -6988, -7123, -7273, // 336-343
+	-7416, -7532, -7675, -7812, -7928, -8055, -8175, -8301, // 344-351
+	-8427, -8549, -8654, -8762, -8899, -9023, -9118, -9227, // 352-359
+	-9346, -9451, -9545, -9640, -9741, -9844, -9940, -10028, // 360-367
+	-10113, -10199, -10283, -10378, -10444, -10503, -10583, -10665, // 368-375
+	-10725, -10792, -10875, -10935, -11010, -11081, -11128, -11206, // 376-383
+	-11279, -11333, -11390, -11439, -11496, -11560, -11618, -11673, // 384-391
+	-11719, -11768, -11826, -11894, -11953, -11995, -12053, -12114, // 392-399
+	-12167, -12208, -12240, -12294, -12344, -12360, -12384, -12416, // 400-407
+	-12447, -12469, -12493, -12521, -12545, -12562, -12568, -12580, // 408-415
+	-12616, -12623, -12606, -12618, -12633, -12651, -12631, -12621, // 416-423
+	-12637, -12642, -12619, -12620, -12623, -12606, -12611, -12619, // 424-431
+	-12607, -12597, -12608, -12622, -12607, -12586, -12583, -12574, // 432-439
+	-12564, -12545, -12519, -12494, -12472, -12435, -12390, -12358, // 440-447
+	-12332, -12286, -12234, -12194, -12152, -12106, -12068, -12029, // 448-455
+	-11983, -11921, -11862, -11830, -11775, -11714, -11661, -11614, // 456-463
+	-11560, -11493, -11425, -11377, -11320, -11232, -11154, -11091, // 464-471
+	-11009, -10919, -10841, -10771, -10685, -10591, -10499, -10412, // 472-479
+	-10333, -10240, -10142, -10050, -9952, -9859, -9770, -9671, // 480-487
+	-9566, -9465, -9364, -9256, -9148, -9042, -8934, -8824, // 488-495
+	-8707, -8578, -8450, -8332, -8210, -8069, -7913, -7772, // 496-503
+	-7643, -7494, -7345, -7203, -7061, -6906, -6756, -6622, // 504-511
+	-6472, -6316, -6173, -6034, -5901, -5746, -5590, -5462, // 512-519
+	-5330, -5178, -5023, -4873, -4723, -4566, -4400, -4239, // 520-527
+	-4081, -3907, -3733, -3573, -3412, -3234, -3053, -2887, // 528-535
+	-2719, -2538, -2367, -2199, -2022, -1849, -1673, -1494, // 536-543
+	-1323, -1142, -975, -796, -604, -440, -267, -84, // 544-551
+	77, 254, 447, 621, 795, 986, 1169, 1339, // 552-559
+	1527, 1724, 1917, 2105, 2292, 2496, 2705, 2908, // 560-567
+	3121, 3332, 3548, 3744, 3955, 4180, 4389, 4595, // 568-575
+	4813, 5023, 5226, 5452, 5667, 5876, 6092, 6313, // 576-583
+	6519, 6727, 6952, 7165, 7373, 7588, 7800, 7994, // 584-591
+	8207, 8424, 8620, 8821, 9034, 9224, 9420, 9628, // 592-599
+	9827, 10032, 10226, 10408, 10608, 10813, 10994, 11179, // 600-607
+	11360, 11539, 11721, 11887, 12057, 12233, 12406, 12559, // 608-615
+	12719, 12894, 13049, 13196, 13354, 13520, 13670, 13814, // 616-623
+	13967, 14118, 14259, 14415, 14548, 14676, 14821, 14949, // 624-631
+	15074, 15200, 15333, 15450, 15557, 15685, 15796, 15895, // 632-639
+	16009, 16120, 16209, 16306, 16412, 16506, 16594, 16680, // 640-647
+	16766, 16853, 16932, 17001, 17078, 17151, 17218, 17289, // 648-655
+	17354, 17413, 17467, 17531, 17596, 17645, 17698, 17745, // 656-663
+	17795, 17841, 17868, 17920, 17957, 17979, 17999, 18026, // 664-671
+	18052, 18073, 18084, 18092, 18098, 18100, 18097, 18092, // 672-679
+	18086, 18072, 18047, 18021, 17998, 17970, 17929, 17891, // 680-687
+	17853, 17805, 17749, 17703, 17651, 17593, 17542, 17478, // 688-695
+	17411, 17351, 17282, 17207, 17145, 17073, 16986, 16905, // 696-703
+	16828, 16742, 16654, 16563, 16475, 16381, 16270, 16177, // 704-711
+	16085, 15979, 15868, 15759, 15652, 15538, 15419, 15304, // 712-719
+	15189, 15065, 14935, 14808, 14682, 14557, 14420, 14282, // 720-727
+	14149, 14011, 13864, 13725, 13588, 13441, 13289, 13138, // 728-735
+	12978, 12828, 12678, 12511, 12353, 12187, 12008, 11854, // 736-743
+	11693, 11522, 11345, 11179, 11001, 10822, 10652, 10471, // 744-751
+	10290, 10105, 9916, 9724, 9535, 9343, 9143, 8948, // 752-759
+	8753, 8540, 8334, 8138, 7934, 7728, 7519, 7295, // 760-767
+	7093, 6889, 6664, 6447, 6238, 6018, 5787, 5571, // 768-775
+	5355, 5128, 4901, 4684, 4459, 4220, 4001, 3785, // 776-783
+	3559, 3331, 3105, 2876, 2657, 2440, 2212, 1994, // 784-791
+	1767, 1546, 1327, 1108, 890, 676, 450, 231, // 792-799
+	23, -198, -420, -635, -847, -1063, -1292, -1512, // 800-807
+	-1719, -1941, -2164, -2379, -2596, -2822, -3042, -3254, // 808-815
+	-3471, -3690, -3908, -4126, -4341, -4554, -4769, -4978, // 816-823
+	-5200, -5414, -5625, -5840, -6054, -6265, -6485, -6694, // 824-831
+	-6900, -7119, -7330, -7535, -7740, -7945, -8156, -8363, // 832-839
+	-8561, -8766, -8972, -9163, -9369, -9580, -9774, -9971, // 840-847
+	-10169, -10366, -10562, -10752, -10944, -11136, -11322, -11515, // 848-855
+	-11690, -11870, -12057, -12236, -12407, -12583, -12758, -12916, // 856-863
+	-13084, -13260, -13425, -13579, -13735, -13895, -14057, -14202, // 864-871
+	-14350, -14503, -14653, -14789, -14926, -15074, -15211, -15341, // 872-879
+	-15481, -15614, -15740, -15862, -15991, -16122, -16244, -16355, // 880-887
+	-16467, -16586, -16698, -16805, -16918, -17024, -17124, -17221, // 888-895
+	-17328, -17429, -17522, -17616, -17710, -17801, -17885, -17969, // 896-903
+	-18055, -18141, -18219, -18288, -18359, -18434, -18505, -18575, // 904-911
+	-18633, -18697, -18758, -18810, -18865, -18922, -18972, -19016, // 912-919
+	-19059, -19100, -19137, -19172, -19208, -19240, -19264, -19281, // 920-927
+	-19297, -19328, -19345, -19346, -19362, -19375, -19378, -19384, // 928-935
+	-19385, -19391, -19391, -19382, -19377, -19370, -19357, -19343, // 936-943
+	-19328, -19310, -19286, -19252, -19221, -19204, -19167, -19117, // 944-951
+	-19083, -19039, -18986, -18941, -18884, -18827, -18768, -18698, // 952-959
+	-18626, -18557, -18484, -18402, -18318, -18239, -18144, -18052, // 960-967
+	-17962, -17865, -17769, -17664, -17559, -17453, -17340, -17226, // 968-975
+	-17115, -16996, -16871, -16738, -16614, -16489, -16347, -16209, // 976-983
+	-16073, -15930, -15779, -15628, -15482, -15332, -15173, -15010, // 984-991
+	-14853, -14690, -14519, -14352, -14184, -14013, -13833, -13651, // 992-999
+	-13475, -13297, -13113, -12928, -12745, -12556, -12364, -12172, // 1000-1007
+	-11986, -11796, -11597, -11396, -11197, -10998, -10796, -10591, // 1008-1015
+	-10386, -10180, -9968, -9752, -9545, -9338, -9123, -8904, // 1016-1023
+	-8696, -8484, -8256, -8039, -7831, -7613, -7389, -7163, // 1024-1031
+	-6941, -6722, -6498, -6271, -6046, -5827, -5594, -5361, // 1032-1039
+	-5142, -4920, -4689, -4454, -4234, -4005, -3763, -3538, // 1040-1047
+	-3312, -3078, -2846, -2604, -2370, -2142, -1906, -1667, // 1048-1055
+	-1439, -1201, -959, -730, -502, -269, -38, 193, // 1056-1063
+	425, 654, 882, 1112, 1325, 1554, 1788, 2010, // 1064-1071
+	2227, 2444, 2667, 2887, 3095, 3314, 3533, 3739, // 1072-1079
+	3945, 4154, 4359, 4569, 4773, 4971, 5177, 5373, // 1080-1087
+	5562, 5766, 5966, 6157, 6342, 6532, 6723, 6900, // 1088-1095
+	7087, 7274, 7450, 7626, 7797, 7966, 8145, 8317, // 1096-1103
+	8479, 8645, 8807, 8970, 9129, 9288, 9448, 9602, // 1104-1111
+	9750, 9898, 10052, 10200, 10345, 10489, 10636, 10771, // 1112-1119
+	10905, 11051, 11190, 11324, 11456, 11591, 11715, 11847, // 1120-1127
+	11976, 12100, 12226, 12349, 12461, 12575, 12699, 12812, // 1128-1135
+	12924, 13034, 13137, 13250, 13352, 13456, 13562, 13664, // 1136-1143
+	13758, 13855, 13952, 14043, 14132, 14225, 14314, 14397, // 1144-1151
+	14474, 14556, 14642, 14722, 14795, 14876, 14945, 15013, // 1152-1159
+	15091, 15159, 15228, 15295, 15351, 15412, 15478, 15531, // 1160-1167
+	15583, 15641, 15693, 15736, 15783, 15831, 15879, 15920, // 1168-1175
+	15958, 15999, 16038, 16070, 16103, 16140, 16176, 16194, // 1176-1183
+	16221, 16250, 16271, 16291, 16311, 16330, 16346, 16358, // 1184-1191
+	16366, 16381, 16396, 16402, 16405, 16412, 16417, 16416, // 1192-1199
+	16417, 16422, 16412, 16406, 16403, 16391, 16380, 16369, // 1200-1207
+	16359, 16341, 16323, 16307, 16284, 16264, 16246, 16222, // 1208-1215
+	16191, 16163, 16137, 16103, 16069, 16038, 16004, 15961, // 1216-1223
+	15917, 15878, 15837, 15792, 15745, 15698, 15649, 15595, // 1224-1231
+	15541, 15489, 15439, 15378, 15314, 15253, 15193, 15127, // 1232-1239
+	15059, 14997, 14928, 14854, 14781, 14711, 14640, 14565, // 1240-1247
+	14488, 14412, 14332, 14248, 14168, 14090, 14007, 13917, // 1248-1255
+	13825, 13737, 13648, 13554, 13462, 13368, 13270, 13169, // 1256-1263
+	13070, 12973, 12876, 12769, 12662, 12561, 12452, 12341, // 1264-1271
+	12234, 12124, 12006, 11891, 11772, 11651, 11532, 11410, // 1272-1279
+	11284, 11158, 11031, 10896, 10759, 10633, 10497, 10353, // 1280-1287
+	10211, 10067, 9917, 9769, 9620, 9468, 9309, 9147, // 1288-1295
+	8987, 8828, 8661, 8496, 8332, 8161, 7988, 7813, // 1296-1303
+	7642, 7469, 7286, 7106, 6926, 6739, 6552, 6364, // 1304-1311
+	6176, 5986, 5790, 5591, 5396, 5203, 5004, 4802, // 1312-1319
+	4602, 4401, 4196, 3991, 3792, 3589, 3382, 3174, // 1320-1327
+	2966, 2763, 2557, 2351, 2143, 1940, 1735, 1526, // 1328-1335
+	1324, 1126, 922, 720, 522, 322, 123, -73, // 1336-1343
+	-269, -463, -656, -854, -1046, -1235, -1424, -1612, // 1344-1351
+	-1798, -1981, -2167, -2353, -2526, -2701, -2879, -3055, // 1352-1359
+	-3226, -3398, -3565, -3733, -3899, -4057, -4222, -4385, // 1360-1367
+	-4540, -4692, -4848, -4999, -5144, -5291, -5439, -5582, // 1368-1375
+	-5719, -5855, -5993, -6131, -6263, -6393, -6526, -6656, // 1376-1383
+	-6779, -6904, -7033, -7155, -7275, -7394, -7508, -7625, // 1384-1391
+	-7739, -7850, -7965, -8077, -8177, -8282, -8391, -8497, // 1392-1399
+	-8596, -8697, -8795, -8889, -8983, -9076, -9171, -9259, // 1400-1407
+	-9342, -9427, -9511, -9592, -9668, -9750, -9827, -9897, // 1408-1415
+	-9967, -10038, -10109, -10174, -10241, -10303, -10358, -10416, // 1416-1423
+	-10471, -10523, -10574, -10623, -10663, -10703, -10745, -10783, // 1424-1431
+	-10817, -10852, -10882, -10909, -10932, -10956, -10983, -11001, // 1432-1439
+	-11015, -11029, -11041, -11050, -11056, -11060, -11069, -11066, // 1440-1447
+	-11060, -11058, -11055, -11047, -11039, -11032, -11018, -11002, // 1448-1455
+	-10987, -10970, -10955, -10938, -10912, -10888, -10866, -10840, // 1456-1463
+	-10814, -10789, -10761, -10731, -10699, -10670, -10639, -10612, // 1464-1471
+	-10582, -10547, -10517, -10486, -10450, -10422, -10395, -10358, // 1472-1479
+	-10324, -10293, -10262, -10229, -10197, -10171, -10139, -10105, // 1480-1487
+	-10075, -10047, -10019, -9991, -9964, -9934, -9905, -9877, // 1488-1495
+	-9847, -9825, -9800, -9768, -9740, -9714, -9689, -9664, // 1496-1503
+	-9639, -9614, -9589, -9564, -9537, -9515, -9494, -9469, // 1504-1511
+	-9442, -9418, -9392, -9366, -9342, -9315, -9291, -9262, // 1512-1519
+	-9233, -9205, -9179, -9155, -9123, -9095, -9068, -9037, // 1520-1527
+	-9005, -8982, -8951, -8917, -8887, -8856, -8822, -8791, // 1528-1535
+	-8758, -8724, -8693, -8656, -8620, -8590, -8554, -8519, // 1536-1543
+	-8484, -8449, -8411, -8372, -8337, -8299, -8261, -8220, // 1544-1551
+	-8177, -8138, -8096, -8052, -8011, -7969, -7925, -7878, // 1552-1559
+	-7831, -7791, -7746, -7698, -7652, -7605, -7556, -7505, // 1560-1567
+	-7460, -7410, -7358, -7306, -7253, -7200, -7148, -7096, // 1568-1575
+	-7041, -6987, -6933, -6874, -6818, -6765, -6707, -6648, // 1576-1583
+	-6588, -6527, -6465, -6405, -6342, -6278, -6214, -6147, // 1584-1591
+	-6078, -6013, -5948, -5878, -5810, -5742, -5672, -5600, // 1592-1599
+	-5531, -5462, -5392, -5319, -5245, -5172, -5101, -5025, // 1600-1607
+	-4952, -4879, -4806, -4730, -4652, -4581, -4507, -4431, // 1608-1615
+	-4356, -4282, -4204, -4125, -4050, -3975, -3897, -3816, // 1616-1623
+	-3736, -3658, -3578, -3497, -3418, -3338, -3256, -3174, // 1624-1631
+	-3092, -3013, -2932, -2848, -2766, -2683, -2597, -2512, // 1632-1639
+	-2428, -2343, -2255, -2164, -2078, -1988, -1898, -1808, // 1640-1647
+	-1718, -1629, -1534, -1440, -1348, -1258, -1163, -1069, // 1648-1655
+	-975, -878, -781, -686, -591, -495, -398, -300, // 1656-1663
+	-202, -107, -13, 84, 178, 271, 369, 464, // 1664-1671
+	556, 647, 740, 836, 927, 1016, 1111, 1203, // 1672-1679
+	1290, 1379, 1469, 1557, 1646, 1730, 1814, 1898, // 1680-1687
+	1979, 2061, 2144, 2225, 2297, 2375, 2454, 2527, // 1688-1695
+	2601, 2673, 2744, 2812, 2880, 2943, 3009, 3074, // 1696-1703
+	3133, 3189, 3244, 3302, 3355, 3406, 3458, 3507, // 1704-1711
+	3552, 3598, 3644, 3688, 3729, 3769, 3808, 3845, // 1712-1719
+	3879, 3913, 3947, 3979, 4007, 4034, 4062, 4088, // 1720-1727
+	4112, 4137, 4161, 4182, 4202, 4220, 4239, 4261, // 1728-1735
+	4277, 4291, 4309, 4321, 4331, 4348, 4361, 4371, // 1736-1743
+	4379, 4389, 4397, 4406, 4415, 4423, 4429, 4432, // 1744-1751
+	4437, 4441, 4445, 4446, 4447, 4448, 4443, 4442, // 1752-1759
+	4440, 4435, 4431, 4426, 4418, 4408, 4401, 4395, // 1760-1767
+	4384, 4373, 4362, 4350, 4334, 4319, 4307, 4293, // 1768-1775
+	4273, 4254, 4238, 4218, 4197, 4179, 4161, 4136, // 1776-1783
+	4113, 4092, 4070, 4047, 4023, 3998, 3973, 3946, // 1784-1791
+	3918, 3893, 3868, 3840, 3810, 3782, 3755, 3727, // 1792-1799
+	3697, 3671, 3646, 3616, 3586, 3559, 3536, 3511, // 1800-1807
+	3482, 3456, 3432, 3406, 3381, 3359, 3339, 3316, // 1808-1815
+	3293, 3275, 3257, 3240, 3224, 3210, 3197, 3184, // 1816-1823
+	3169, 3160, 3154, 3146, 3137, 3130, 3126, 3123, // 1824-1831
+	3120, 3121, 3124, 3124, 3126, 3132, 3140, 3149, // 1832-1839
+	3158, 3171, 3184, 3196, 3210, 3228, 3248, 3267, // 1840-1847
+	3285, 3306, 3328, 3350, 3376, 3402, 3430, 3454, // 1848-1855
+	3480, 3511, 3542, 3572, 3602, 3635, 3664, 3696, // 1856-1863
+	3728, 3763, 3798, 3830, 3862, 3896, 3931, 3965, // 1864-1871
+	4003, 4037, 4071, 4109, 4142, 4178, 4215, 4252, // 1872-1879
+	4286, 4320, 4356, 4391, 4424, 4461, 4497, 4529, // 1880-1887
+	4562, 4597, 4632, 4666, 4701, 4734, 4767, 4800, // 1888-1895
+	4831, 4865, 4899, 4930, 4961, 4990, 5021, 5052, // 1896-1903
+	5082, 5113, 5143, 5171, 5197, 5226, 5257, 5285, // 1904-1911
+	5311, 5339, 5364, 5388, 5412, 5439, 5463, 5483, // 1912-1919
+	5503, 5525, 5544, 5562, 5582, 5601, 5618, 5630, // 1920-1927
+	5646, 5662, 5677, 5689, 5700, 5712, 5721, 5729, // 1928-1935
+	5738, 5745, 5752, 5757, 5760, 5764, 5768, 5770, // 1936-1943
+	5773, 5776, 5775, 5772, 5771, 5771, 5769, 5763, // 1944-1951
+	5758, 5754, 5745, 5736, 5730, 5723, 5711, 5698, // 1952-1959
+	5688, 5675, 5662, 5648, 5635, 5619, 5602, 5585, // 1960-1967
+	5567, 5551, 5532, 5511, 5490, 5470, 5447, 5423, // 1968-1975
+	5401, 5379, 5353, 5327, 5300, 5275, 5249, 5220, // 1976-1983
+	5191, 5165, 5133, 5101, 5070, 5038, 5007, 4971, // 1984-1991
+	4936, 4900, 4864, 4827, 4788, 4752, 4712, 4668, // 1992-1999
+	4627, 4586, 4541, 4498, 4453, 4406, 4357, 4306, // 2000-2007
+	4258, 4210, 4157, 4104, 4051, 3997, 3942, 3887, // 2008-2015
+	3832, 3777, 3719, 3659, 3602, 3546, 3485, 3426, // 2016-2023
+	3368, 3307, 3246, 3184, 3126, 3067, 3007, 2945, // 2024-2031
+	2885, 2828, 2769, 2710, 2653, 2596, 2537, 2480, // 2032-2039
+	2423, 2368, 2313, 2256, 2201, 2147, 2091, 2035, // 2040-2047
+	1986, 1934, 1881, 1828, 1778, 1729, 1679, 1631, // 2048-2055
+	1584, 1536, 1486, 1440, 1395, 1351, 1305, 1260, // 2056-2063
+	1216, 1171, 1129, 1087, 1046, 1006, 965, 923, // 2064-2071
+	883, 846, 808, 769, 731, 694, 656, 616, // 2072-2079
+	582, 547, 508, 473, 436, 399, 365, 330, // 2080-2087
+	296, 262, 227, 190, 158, 126, 91, 57, // 2088-2095
+	24, -11, -44, -77, -109, -140, -173, -208, // 2096-2103
+	-239, -270, -302, -333, -362, -393, -426, -457, // 2104-2111
+	-485, -515, -546, -577, -610, -641, -671, -701, // 2112-2119
+	-732, -764, -798, -830, -861, -894, -927, -959, // 2120-2127
+	-994, -1032, -1065, -1100, -1135, -1171, -1208, -1245, // 2128-2135
+	-1283, -1320, -1356, -1392, -1431, -1469, -1508, -1545, // 2136-2143
+	-1582, -1621, -1659, -1696, -1736, -1776, -1813, -1851, // 2144-2151
+	-1889, -1930, -1969, -2007, -2046, -2085, -2123, -2161, // 2152-2159
+	-2201, -2241, -2282, -2320, -2358, -2399, -2439, -2479, // 2160-2167
+	-2521, -2563, -2603, -2643, -2685, -2727, -2770, -2812, // 2168-2175
+	-2853, -2897, -2939, -2980, -3025, -3070, -3113, -3157, // 2176-2183
+	-3202, -3247, -3292, -3338, -3385, -3432, -3477, -3523, // 2184-2191
+	-3570, -3618, -3666, -3714, -3761, -3809, -3857, -3906, // 2192-2199
+	-3956, -4008, -4057, -4106, -4157, -4210, -4262, -4314, // 2200-2207
+	-4368, -4420, -4472, -4527, -4581, -4635, -4691, -4745, // 2208-2215
+	-4801, -4856, -4912, -4970, -5028, -5085, -5143, -5201, // 2216-2223
+	-5259, -5319, -5379, -5438, -5498, -5558, -5617, -5676, // 2224-2231
+	-5738, -5799, -5859, -5919, -5979, -6040, -6100, -6161, // 2232-2239
+	-6222, -6283, -6342, -6400, -6460, -6520, -6578, -6637, // 2240-2247
+	-6695, -6750, -6806, -6862, -6918, -6973, -7027, -7079, // 2248-2255
+	-7131, -7184, -7234, -7285, -7335, -7382, -7428, -7474, // 2256-2263
+	-7519, -7565, -7606, -7647, -7688, -7726, -7763, -7799, // 2264-2271
+	-7837, -7871, -7902, -7933, -7963, -7993, -8019, -8044, // 2272-2279
+	-8069, -8091, -8111, -8129, -8148, -8164, -8178, -8190, // 2280-2287
+	-8201, -8210, -8217, -8225, -8230, -8233, -8234, -8234, // 2288-2295
+	-8233, -8229, -8225, -8219, -8210, -8200, -8188, -8176, // 2296-2303
+	-8162, -8147, -8129, -8111, -8091, -8070, -8048, -8026, // 2304-2311
+	-8001, -7975, -7948, -7918, -7890, -7861, -7827, -7794, // 2312-2319
+	-7761, -7725, -7687, -7651, -7614, -7574, -7534, -7493, // 2320-2327
+	-7452, -7410, -7367, -7324, -7281, -7235, -7189, -7144, // 2328-2335
+	-7097, -7050, -7003, -6955, -6906, -6857, -6806, -6756, // 2336-2343
+	-6706, -6655, -6604, -6551, -6499, -6447, -6394, -6340, // 2344-2351
+	-6287, -6231, -6176, -6121, -6065, -6009, -5952, -5895, // 2352-2359
+	-5838, -5780, -5722, -5665, -5607, -5549, -5489, -5431, // 2360-2367
+	-5373, -5313, -5254, -5194, -5135, -5074, -5012, -4953, // 2368-2375
+	-4893, -4832, -4770, -4710, -4648, -4586, -4525, -4464, // 2376-2383
+	-4403, -4341, -4278, -4216, -4154, -4092, -4029, -3966, // 2384-2391
+	-3904, -3840, -3776, -3713, -3651, -3587, -3523, -3460, // 2392-2399
+	-3395, -3332, -3268, -3204, -3141, -3075, -3009, -2945, // 2400-2407
+	-2880, -2814, -2748, -2683, -2615, -2547, -2481, -2414, // 2408-2415
+	-2348, -2280, -2211, -2145, -2076, -2008, -1941, -1873, // 2416-2423
+	-1805, -1736, -1667, -1599, -1532, -1464, -1395, -1328, // 2424-2431
+	-1260, -1192, -1125, -1059, -993, -927, -860, -795, // 2432-2439
+	-730, -665, -600, -537, -472, -407, -344, -282, // 2440-2447
+	-219, -158, -96, -34, 26, 86, 146, 204, // 2448-2455
+	261, 320, 378, 434, 490, 545, 600, 656, // 2456-2463
+	710, 765, 818, 870, 920, 973, 1025, 1075, // 2464-2471
+	1125, 1175, 1222, 1270, 1318, 1366, 1413, 1460, // 2472-2479
+	1505, 1551, 1597, 1642, 1686, 1731, 1775, 1816, // 2480-2487
+	1859, 1903, 1945, 1987, 2027, 2069, 2110, 2150, // 2488-2495
+	2191, 2234, 2275, 2315, 2356, 2397, 2439, 2481, // 2496-2503
+	2523, 2565, 2606, 2647, 2689, 2733, 2775, 2817, // 2504-2511
+	2860, 2903, 2945, 2988, 3032, 3075, 3118, 3161, // 2512-2519
+	3203, 3247, 3290, 3333, 3376, 3419, 3461, 3502, // 2520-2527
+	3545, 3587, 3629, 3671, 3712, 3754, 3795, 3836, // 2528-2535
+	3877, 3919, 3959, 3999, 4038, 4077, 4118, 4156, // 2536-2543
+	4194, 4232, 4269, 4306, 4343, 4381, 4417, 4452, // 2544-2551
+	4487, 4522, 4557, 4590, 4624, 4658, 4689, 4719, // 2552-2559
+	4751, 4782, 4812, 4841, 4870, 4897, 4925, 4953, // 2560-2567
+	4980, 5006, 5032, 5057, 5082, 5107, 5130, 5154, // 2568-2575
+	5177, 5199, 5220, 5241, 5261, 5282, 5302, 5320, // 2576-2583
+	5338, 5356, 5373, 5390, 5408, 5424, 5440, 5455, // 2584-2591
+	5469, 5484, 5498, 5512, 5525, 5538, 5550, 5561, // 2592-2599
+	5574, 5586, 5597, 5607, 5619, 5629, 5638, 5650, // 2600-2607
+	5660, 5670, 5679, 5687, 5697, 5706, 5713, 5722, // 2608-2615
+	5730, 5737, 5743, 5750, 5758, 5765, 5771, 5776, // 2616-2623
+	5782, 5788, 5793, 5798, 5803, 5808, 5811, 5814, // 2624-2631
+	5818, 5822, 5824, 5826, 5829, 5829, 5830, 5832, // 2632-2639
+	5833, 5833, 5833, 5831, 5830, 5829, 5826, 5824, // 2640-2647
+	5821, 5816, 5810, 5805, 5800, 5793, 5785, 5778, // 2648-2655
+	5769, 5758, 5749, 5738, 5728, 5716, 5703, 5689, // 2656-2663
+	5676, 5661, 5646, 5630, 5614, 5596, 5577, 5558, // 2664-2671
+	5539, 5519, 5499, 5478, 5455, 5432, 5409, 5385, // 2672-2679
+	5361, 5337, 5310, 5283, 5256, 5229, 5200, 5170, // 2680-2687
+	5141, 5110, 5078, 5047, 5016, 4984, 4950, 4917, // 2688-2695
+	4884, 4849, 4815, 4780, 4746, 4710, 4673, 4637, // 2696-2703
+	4601, 4565, 4528, 4492, 4455, 4417, 4380, 4343, // 2704-2711
+	4307, 4270, 4233, 4196, 4160, 4123, 4086, 4051, // 2712-2719
+	4016, 3979, 3942, 3907, 3872, 3837, 3802, 3768, // 2720-2727
+	3734, 3700, 3667, 3634, 3603, 3571, 3539, 3508, // 2728-2735
+	3478, 3447, 3417, 3388, 3359, 3330, 3301, 3273, // 2736-2743
+	3246, 3220, 3193, 3166, 3141, 3115, 3090, 3067, // 2744-2751
+	3044, 3019, 2995, 2973, 2950, 2928, 2907, 2885, // 2752-2759
+	2864, 2842, 2821, 2801, 2782, 2763, 2743, 2723, // 2760-2767
+	2704, 2684, 2665, 2647, 2628, 2607, 2586, 2566, // 2768-2775
+	2546, 2525, 2503, 2481, 2458, 2434, 2411, 2388, // 2776-2783
+	2364, 2339, 2313, 2287, 2260, 2233, 2206, 2178, // 2784-2791
+	2149, 2119, 2089, 2058, 2028, 1997, 1965, 1932, // 2792-2799
+	1899, 1865, 1832, 1799, 1765, 1730, 1694, 1659, // 2800-2807
+	1622, 1586, 1550, 1512, 1474, 1435, 1397, 1358, // 2808-2815
+	1320, 1280, 1241, 1201, 1161, 1121, 1082, 1042, // 2816-2823
+	1002, 961, 920, 880, 839, 799, 758, 717, // 2824-2831
+	677, 635, 594, 554, 514, 473, 433, 393, // 2832-2839
+	352, 312, 272, 233, 193, 152, 112, 73, // 2840-2847
+	33, -6, -45, -84, -123, -163, -201, -238, // 2848-2855
+	-276, -314, -351, -388, -425, -462, -497, -532, // 2856-2863
+	-569, -605, -641, -675, -710, -744, -778, -812, // 2864-2871
+	-847, -880, -913, -945, -977, -1010, -1042, -1073, // 2872-2879
+	-1104, -1136, -1166, -1196, -1227, -1257, -1287, -1315, // 2880-2887
+	-1344, -1372, -1400, -1427, -1454, -1482, -1507, -1532, // 2888-2895
+	-1557, -1583, -1607, -1632, -1656, -1679, -1702, -1725, // 2896-2903
+	-1748, -1771, -1792, -1813, -1834, -1855, -1875, -1896, // 2904-2911
+	-1916, -1935, -1954, -1972, -1991, -2009, -2027, -2045, // 2912-2919
+	-2063, -2080, -2097, -2114, -2132, -2149, -2166, -2182, // 2920-2927
+	-2199, -2217, -2234, -2251, -2269, -2286, -2303, -2320, // 2928-2935
+	-2338, -2357, -2375, -2393, -2411, -2429, -2446, -2464, // 2936-2943
+	-2482, -2500, -2516, -2532, -2549, -2567, -2583, -2599, // 2944-2951
+	-2616, -2631, -2646, -2661, -2677, -2692, -2707, -2720, // 2952-2959
+	-2734, -2747, -2760, -2773, -2786, -2798, -2809, -2820, // 2960-2967
+	-2831, -2843, -2854, -2864, -2874, -2884, -2893, -2903, // 2968-2975
+	-2913, -2923, -2930, -2938, -2947, -2955, -2963, -2970, // 2976-2983
+	-2978, -2985, -2991, -2998, -3005, -3013, -3019, -3026, // 2984-2991
+	-3032, -3039, -3046, -3053, -3060, -3067, -3073, -3080, // 2992-2999
+	-3087, -3095, -3103, -3111, -3119, -3127, -3135, -3145, // 3000-3007
+	-3155, -3165, -3175, -3185, -3196, -3208, -3219, -3231, // 3008-3015
+	-3244, -3257, -3269, -3282, -3297, -3312, -3327, -3343, // 3016-3023
+	-3359, -3375, -3392, -3410, -3429, -3449, -3468, -3487, // 3024-3031
+	-3508, -3529, -3550, -3573, -3596, -3619, -3641, -3666, // 3032-3039
+	-3691, -3716, -3741, -3767, -3794, -3820, -3847, -3874, // 3040-3047
+	-3902, -3930, -3957, -3985, -4012, -4041, -4069, -4097, // 3048-3055
+	-4125, -4153, -4181, -4209, -4237, -4266, -4293, -4321, // 3056-3063
+	-4348, -4375, -4402, -4429, -4456, -4481, -4506, -4531, // 3064-3071
+	-4555, -4579, -4603, -4626, -4648, -4669, -4691, -4712, // 3072-3079
+	-4732, -4752, -4771, -4789, -4806, -4823, -4840, -4856, // 3080-3087
+	-4871, -4885, -4898, -4910, -4923, -4935, -4946, -4956, // 3088-3095
+	-4966, -4975, -4983, -4992, -5000, -5007, -5013, -5019, // 3096-3103
+	-5023, -5028, -5032, -5035, -5038, -5039, -5040, -5042, // 3104-3111
+	-5042, -5042, -5042, -5040, -5039, -5036, -5033, -5031, // 3112-3119
+	-5027, -5022, -5017, -5011, -5006, -4999, -4992, -4985, // 3120-3127
+	-4977, -4968, -4959, -4950, -4941, -4931, -4921, -4910, // 3128-3135
+	-4899, -4887, -4876, -4864, -4852, -4839, -4825, -4811, // 3136-3143
+	-4798, -4783, -4768, -4753, -4738, -4721, -4705, -4689, // 3144-3151
+	-4672, -4654, -4636, -4618, -4599, -4580, -4561, -4541, // 3152-3159
+	-4521, -4499, -4478, -4456, -4434, -4412, -4389, -4366, // 3160-3167
+	-4342, -4318, -4293, -4268, -4243, -4217, -4191, -4164, // 3168-3175
+	-4137, -4109, -4081, -4053, -4024, -3994, -3964, -3934, // 3176-3183
+	-3904, -3873, -3842, -3810, -3778, -3745, -3712, -3679, // 3184-3191
+	-3646, -3611, -3576, -3541, -3505, -3469, -3433, -3396, // 3192-3199
+	-3358, -3320, -3282, -3243, -3204, -3165, -3125, -3084, // 3200-3207
+	-3043, -3002, -2960, -2918, -2876, -2832, -2788, -2744, // 3208-3215
+	-2699, -2654, -2609, -2564, -2518, -2471, -2425, -2378, // 3216-3223
+	-2331, -2284, -2237, -2189, -2141, -2093, -2045, -1997, // 3224-3231
+	-1949, -1900, -1851, -1803, -1755, -1707, -1658, -1610, // 3232-3239
+	-1562, -1514, -1467, -1420, -1373, -1326, -1279, -1232, // 3240-3247
+	-1186, -1140, -1095, -1050, -1004, -959, -915, -872, // 3248-3255
+	-828, -786, -743, -701, -659, -618, -577, -537, // 3256-3263
+	-497, -457, -418, -379, -341, -302, -265, -228, // 3264-3271
+	-191, -154, -118, -82, -47, -12, 23, 58, // 3272-3279
+	92, 126, 159, 192, 225, 259, 291, 324, // 3280-3287
+	356, 388, 419, 451, 483, 514, 545, 576, // 3288-3295
+	606, 637, 668, 698, 729, 759, 789, 819, // 3296-3303
+	850, 880, 910, 940, 970, 1000, 1030, 1059, // 3304-3311
+	1089, 1119, 1148, 1177, 1207, 1236, 1266, 1295, // 3312-3319
+	1325, 1354, 1383, 1412, 1442, 1472, 1502, 1531, // 3320-3327
+	1561, 1591, 1621, 1652, 1683, 1713, 1744, 1775, // 3328-3335
+	1807, 1839, 1871, 1903, 1935, 1967, 2000, 2033, // 3336-3343
+	2066, 2098, 2131, 2164, 2197, 2229, 2262, 2295, // 3344-3351
+	2328, 2361, 2393, 2426, 2458, 2491, 2523, 2556, // 3352-3359
+	2588, 2620, 2652, 2684, 2715, 2747, 2778, 2809, // 3360-3367
+	2840, 2871, 2902, 2932, 2963, 2993, 3022, 3052, // 3368-3375
+	3082, 3111, 3140, 3169, 3197, 3226, 3254, 3281, // 3376-3383
+	3309, 3336, 3363, 3389, 3415, 3441, 3467, 3492, // 3384-3391
+	3518, 3542, 3567, 3591, 3615, 3639, 3663, 3685, // 3392-3399
+	3708, 3731, 3753, 3775, 3797, 3818, 3839, 3859, // 3400-3407
+	3880, 3900, 3920, 3940, 3959, 3978, 3997, 4016, // 3408-3415
+	4035, 4053, 4070, 4088, 4105, 4123, 4140, 4157, // 3416-3423
+	4173, 4190, 4206, 4222, 4238, 4254, 4270, 4286, // 3424-3431
+	4301, 4316, 4331, 4347, 4362, 4377, 4391, 4406, // 3432-3439
+	4420, 4434, 4448, 4463, 4477, 4490, 4504, 4517, // 3440-3447
+	4531, 4544, 4557, 4569, 4582, 4594, 4606, 4617, // 3448-3455
+	4629, 4640, 4651, 4661, 4671, 4681, 4691, 4700, // 3456-3463
+	4709, 4718, 4726, 4734, 4741, 4748, 4754, 4760, // 3464-3471
+	4766, 4770, 4775, 4779, 4782, 4785, 4787, 4788, // 3472-3479
+	4789, 4790, 4790, 4789, 4787, 4785, 4782, 4779, // 3480-3487
+	4775, 4771, 4765, 4759, 4752, 4745, 4737, 4729, // 3488-3495
+	4720, 4710, 4699, 4688, 4677, 4665, 4652, 4639, // 3496-3503
+	4625, 4610, 4595, 4580, 4564, 4547, 4530, 4513, // 3504-3511
+	4494, 4476, 4457, 4438, 4418, 4398, 4377, 4356, // 3512-3519
+	4335, 4313, 4292, 4270, 4247, 4224, 4201, 4178, // 3520-3527
+	4155, 4132, 4108, 4084, 4061, 4037, 4013, 3989, // 3528-3535
+	3965, 3941, 3917, 3893, 3870, 3846, 3822, 3799, // 3536-3543
+	3775, 3752, 3728, 3705, 3682, 3659, 3636, 3614, // 3544-3551
+	3592, 3569, 3547, 3525, 3503, 3482, 3460, 3439, // 3552-3559
+	3418, 3397, 3376, 3355, 3334, 3314, 3294, 3273, // 3560-3567
+	3253, 3233, 3214, 3194, 3175, 3155, 3136, 3117, // 3568-3575
+	3098, 3079, 3060, 3041, 3023, 3004, 2986, 2967, // 3576-3583
+	2949, 2931, 2913, 2895, 2877, 2859, 2841, 2823, // 3584-3591
+	2805, 2788, 2770, 2752, 2734, 2716, 2698, 2680, // 3592-3599
+	2662, 2643, 2625, 2606, 2587, 2567, 2548, 2528, // 3600-3607
+	2508, 2487, 2466, 2445, 2423, 2401, 2378, 2355, // 3608-3615
+	2332, 2308, 2284, 2259, 2234, 2209, 2183, 2157, // 3616-3623
+	2131, 2104, 2077, 2050, 2022, 1995, 1966, 1938, // 3624-3631
+	1909, 1880, 1850, 1821, 1791, 1760, 1730, 1699, // 3632-3639
+	1669, 1638, 1606, 1575, 1543, 1512, 1480, 1448, // 3640-3647
+	1416, 1383, 1351, 1319, 1286, 1254, 1221, 1189, // 3648-3655
+	1156, 1123, 1090, 1058, 1025, 992, 959, 926, // 3656-3663
+	894, 861, 828, 795, 763, 730, 698, 665, // 3664-3671
+	633, 600, 568, 536, 504, 471, 439, 407, // 3672-3679
+	375, 343, 311, 279, 247, 215, 184, 152, // 3680-3687
+	120, 89, 57, 26, -6, -37, -69, -100, // 3688-3695
+	-131, -162, -193, -224, -255, -285, -316, -347, // 3696-3703
+	-377, -407, -438, -468, -498, -528, -558, -587, // 3704-3711
+	-617, -646, -676, -705, -734, -763, -792, -820, // 3712-3719
+	-849, -877, -905, -934, -962, -989, -1017, -1045, // 3720-3727
+	-1072, -1099, -1126, -1153, -1179, -1206, -1232, -1258, // 3728-3735
+	-1284, -1309, -1335, -1360, -1385, -1409, -1434, -1458, // 3736-3743
+	-1482, -1506, -1529, -1552, -1575, -1597, -1620, -1641, // 3744-3751
+	-1663, -1684, -1705, -1726, -1746, -1766, -1785, -1804, // 3752-3759
+	-1823, -1841, -1859, -1876, -1893, -1910, -1926, -1942, // 3760-3767
+	-1958, -1973, -1988, -2002, -2017, -2031, -2045, -2059, // 3768-3775
+	-2073, -2086, -2100, -2114, -2127, -2141, -2155, -2168, // 3776-3783
+	-2182, -2195, -2209, -2223, -2236, -2249, -2263, -2276, // 3784-3791
+	-2289, -2302, -2315, -2328, -2341, -2353, -2366, -2378, // 3792-3799
+	-2390, -2402, -2414, -2425, -2437, -2448, -2459, -2470, // 3800-3807
+	-2481, -2492, -2503, -2513, -2523, -2534, -2544, -2554, // 3808-3815
+	-2564, -2574, -2583, -2593, -2603, -2612, -2622, -2631, // 3816-3823
+	-2640, -2649, -2658, -2667, -2676, -2685, -2694, -2702, // 3824-3831
+	-2711, -2720, -2728, -2737, -2745, -2753, -2762, -2770, // 3832-3839
+	-2779, -2787, -2795, -2804, -2812, -2821, -2829, -2838, // 3840-3847
+	-2847, -2855, -2864, -2873, -2882, -2891, -2900, -2910, // 3848-3855
+	-2919, -2928, -2938, -2947, -2957, -2967, -2977, -2987, // 3856-3863
+	-2997, -3007, -3018, -3029, -3039, -3050, -3062, -3073, // 3864-3871
+	-3085, -3096, -3108, -3120, -3133, -3145, -3158, -3171, // 3872-3879
+	-3185, -3198, -3212, -3226, -3240, -3254, -3268, -3283, // 3880-3887
+	-3298, -3313, -3328, -3344, -3359, -3375, -3391, -3406, // 3888-3895
+	-3422, -3438, -3455, -3471, -3487, -3504, -3520, -3536, // 3896-3903
+	-3553, -3569, -3586, -3602, -3619, -3635, -3652, -3668, // 3904-3911
+	-3684, -3700, -3716, -3732, -3748, -3764, -3780, -3795, // 3912-3919
+	-3811, -3826, -3841, -3855, -3870, -3884, -3898, -3912, // 3920-3927
+	-3925, -3938, -3951, -3964, -3976, -3988, -3999, -4010, // 3928-3935
+	-4021, -4031, -4042, -4051, -4061, -4070, -4078, -4087, // 3936-3943
+	-4095, -4102, -4109, -4116, -4123, -4129, -4135, -4140, // 3944-3951
+	-4145, -4149, -4153, -4157, -4160, -4163, -4166, -4168, // 3952-3959
+	-4169, -4170, -4171, -4171, -4171, -4170, -4169, -4167, // 3960-3967
+	-4165, -4163, -4160, -4156, -4152, -4148, -4143, -4137, // 3968-3975
+	-4132, -4125, -4119, -4112, -4104, -4096, -4088, -4079, // 3976-3983
+	-4070, -4060, -4050, -4040, -4029, -4018, -4006, -3994, // 3984-3991
+	-3982, -3969, -3956, -3943, -3929, -3915, -3900, -3885, // 3992-3999
+	-3870, -3854, -3838, -3822, -3805, -3788, -3770, -3752, // 4000-4007
+	-3734, -3715, -3696, -3676, -3656, -3636, -3615, -3594, // 4008-4015
+	-3572, -3550, -3528, -3505, -3482, -3458, -3435, -3410, // 4016-4023
+	-3386, -3361, -3335, -3310, -3284, -3257, -3230, -3203, // 4024-4031
+	-3176, -3148, -3120, -3092, -3063, -3034, -3005, -2976, // 4032-4039
+	-2946, -2916, -2886, -2856, -2825, -2795, -2764, -2732, // 4040-4047
+	-2701, -2670, -2638, -2606, -2574, -2542, -2510, -2477, // 4048-4055
+	-2445, -2412, -2380, -2347, -2314, -2281, -2248, -2215, // 4056-4063
+	-2181, -2148, -2115, -2081, -2048, -2014, -1980, -1947, // 4064-4071
+	-1913, -1879, -1845, -1812, -1778, -1744, -1710, -1676, // 4072-4079
+	-1643, -1609, -1575, -1542, -1508, -1475, -1441, -1408, // 4080-4087
+	-1375, -1341, -1308, -1276, -1243, -1210, -1178, -1145, // 4088-4095
+	-1113, -1081, -1049, -1017, -985, -954, -922, -891, // 4096-4103
+	-860, -829, -798, -767, -737, -706, -676, -646, // 4104-4111
+	-616, -586, -556, -527, -497, -468, -439, -409, // 4112-4119
+	-380, -352, -323, -294, -266, -237, -209, -180, // 4120-4127
+	-152, -124, -96, -68, -40, -12, 16, 43, // 4128-4135
+	71, 99, 126, 153, 181, 208, 235, 263, // 4136-4143
+	290, 317, 344, 371, 398, 425, 452, 478, // 4144-4151
+	505, 532, 558, 585, 611, 638, 664, 691, // 4152-4159
+	717, 743, 769, 796, 822, 848, 874, 900, // 4160-4167
+	926, 951, 977, 1003, 1029, 1054, 1080, 1105, // 4168-4175
+	1131, 1156, 1181, 1206, 1232, 1257, 1282, 1307, // 4176-4183
+	1332, 1357, 1382, 1407, 1432, 1457, 1482, 1508, // 4184-4191
+	1533, 1559, 1584, 1610, 1636, 1662, 1689, 1715, // 4192-4199
+	1741, 1768, 1794, 1821, 1848, 1875, 1901, 1928, // 4200-4207
+	1955, 1982, 2009, 2036, 2063, 2090, 2116, 2143, // 4208-4215
+	2170, 2197, 2223, 2250, 2276, 2303, 2329, 2355, // 4216-4223
+	2381, 2407, 2433, 2459, 2484, 2510, 2535, 2560, // 4224-4231
+	2585, 2610, 2635, 2659, 2683, 2707, 2731, 2755, // 4232-4239
+	2778, 2801, 2824, 2847, 2869, 2891, 2913, 2935, // 4240-4247
+	2956, 2977, 2998, 3018, 3038, 3058, 3078, 3097, // 4248-4255
+	3116, 3134, 3153, 3171, 3188, 3206, 3223, 3239, // 4256-4263
+	3256, 3272, 3288, 3303, 3318, 3333, 3347, 3362, // 4264-4271
+	3375, 3389, 3402, 3415, 3428, 3440, 3452, 3464, // 4272-4279
+	3476, 3487, 3498, 3509, 3520, 3530, 3540, 3550, // 4280-4287
+	3560, 3569, 3578, 3588, 3597, 3605, 3614, 3622, // 4288-4295
+	3631, 3639, 3647, 3655, 3662, 3670, 3677, 3685, // 4296-4303
+	3692, 3699, 3705, 3712, 3719, 3725, 3731, 3737, // 4304-4311
+	3743, 3749, 3755, 3760, 3765, 3770, 3775, 3780, // 4312-4319
+	3785, 3789, 3793, 3797, 3801, 3805, 3808, 3811, // 4320-4327
+	3814, 3817, 3820, 3822, 3824, 3826, 3827, 3829, // 4328-4335
+	3830, 3830, 3831, 3831, 3831, 3830, 3829, 3828, // 4336-4343
+	3827, 3825, 3822, 3820, 3817, 3814, 3810, 3806, // 4344-4351
+	3802, 3797, 3792, 3787, 3781, 3775, 3768, 3761, // 4352-4359
+	3754, 3746, 3738, 3730, 3721, 3712, 3703, 3693, // 4360-4367
+	3683, 3673, 3662, 3651, 3640, 3628, 3616, 3604, // 4368-4375
+	3591, 3579, 3566, 3552, 3539, 3525, 3511, 3497, // 4376-4383
+	3482, 3468, 3453, 3438, 3423, 3407, 3392, 3376, // 4384-4391
+	3360, 3345, 3329, 3313, 3297, 3281, 3264, 3248, // 4392-4399
+	3232, 3216, 3200, 3183, 3167, 3151, 3135, 3119, // 4400-4407
+	3103, 3087, 3071, 3055, 3039, 3023, 3008, 2992, // 4408-4415
+	2976, 2961, 2945, 2930, 2915, 2899, 2884, 2869, // 4416-4423
+	2854, 2839, 2824, 2809, 2795, 2780, 2765, 2751, // 4424-4431
+	2736, 2722, 2708, 2693, 2679, 2665, 2651, 2637, // 4432-4439
+	2623, 2609, 2595, 2581, 2568, 2554, 2540, 2527, // 4440-4447
+	2513, 2500, 2486, 2473, 2459, 2446, 2432, 2419, // 4448-4455
+	2405, 2392, 2379, 2365, 2352, 2338, 2325, 2311, // 4456-4463
+	2298, 2284, 2270, 2256, 2242, 2227, 2212, 2197, // 4464-4471
+	2182, 2167, 2151, 2135, 2118, 2102, 2085, 2067, // 4472-4479
+	2050, 2032, 2014, 1996, 1977, 1958, 1938, 1919, // 4480-4487
+	1899, 1879, 1858, 1837, 1816, 1795, 1773, 1752, // 4488-4495
+	1730, 1708, 1685, 1662, 1640, 1617, 1593, 1570, // 4496-4503
+	1546, 1522, 1498, 1474, 1450, 1425, 1400, 1376, // 4504-4511
+	1351, 1326, 1300, 1275, 1250, 1224, 1199, 1173, // 4512-4519
+	1147, 1122, 1096, 1070, 1043, 1017, 991, 964, // 4520-4527
+	938, 911, 885, 858, 831, 804, 777, 750, // 4528-4535
+	723, 696, 669, 641, 614, 587, 560, 532, // 4536-4543
+	505, 477, 450, 423, 395, 368, 340, 313, // 4544-4551
+	285, 258, 230, 203, 175, 148, 121, 93, // 4552-4559
+	66, 38, 11, -16, -43, -71, -98, -125, // 4560-4567
+	-152, -179, -206, -233, -259, -286, -312, -339, // 4568-4575
+	-365, -391, -417, -443, -469, -495, -520, -546, // 4576-4583
+	-571, -596, -621, -646, -671, -695, -720, -744, // 4584-4591
+	-768, -791, -815, -838, -862, -885, -907, -930, // 4592-4599
+	-952, -975, -997, -1018, -1040, -1061, -1082, -1103, // 4600-4607
+	-1124, -1144, -1164, -1184, -1204, -1223, -1242, -1261, // 4608-4615
+	-1279, -1298, -1315, -1333, -1350, -1367, -1384, -1401, // 4616-4623
+	-1417, -1432, -1448, -1463, -1478, -1492, -1506, -1520, // 4624-4631
+	-1533, -1546, -1559, -1572, -1584, -1596, -1607, -1619, // 4632-4639
+	-1630, -1641, -1651, -1662, -1672, -1682, -1692, -1702, // 4640-4647
+	-1712, -1722, -1732, -1742, -1752, -1762, -1772, -1782, // 4648-4655
+	-1792, -1802, -1812, -1822, -1832, -1843, -1853, -1863, // 4656-4663
+	-1873, -1884, -1894, -1904, -1914, -1924, -1934, -1944, // 4664-4671
+	-1954, -1964, -1974, -1984, -1994, -2004, -2014, -2024, // 4672-4679
+	-2034, -2043, -2053, -2063, -2072, -2082, -2092, -2101, // 4680-4687
+	-2111, -2120, -2130, -2139, -2149, -2158, -2168, -2177, // 4688-4695
+	-2186, -2196, -2205, -2214, -2224, -2233, -2242, -2251, // 4696-4703
+	-2260, -2270, -2279, -2288, -2297, -2306, -2315, -2324, // 4704-4711
+	-2333, -2342, -2351, -2360, -2370, -2379, -2388, -2397, // 4712-4719
+	-2406, -2415, -2424, -2433, -2443, -2452, -2461, -2471, // 4720-4727
+	-2480, -2489, -2499, -2509, -2518, -2528, -2538, -2548, // 4728-4735
+	-2558, -2568, -2578, -2588, -2598, -2609, -2619, -2630, // 4736-4743
+	-2641, -2651, -2662, -2673, -2684, -2696, -2707, -2718, // 4744-4751
+	-2730, -2742, -2753, -2765, -2777, -2789, -2801, -2813, // 4752-4759
+	-2825, -2838, -2850, -2862, -2875, -2887, -2900, -2912, // 4760-4767
+	-2925, -2937, -2950, -2962, -2975, -2988, -3000, -3013, // 4768-4775
+	-3025, -3038, -3050, -3063, -3075, -3088, -3100, -3112, // 4776-4783
+	-3125, -3137, -3149, -3161, -3172, -3184, -3195, -3207, // 4784-4791
+	-3218, -3229, -3239, -3250, -3260, -3270, -3279, -3289, // 4792-4799
+	-3298, -3307, -3316, -3324, -3332, -3340, -3347, -3354, // 4800-4807
+	-3361, -3367, -3373, -3379, -3384, -3389, -3394, -3398, // 4808-4815
+	-3402, -3405, -3408, -3411, -3414, -3415, -3417, -3418, // 4816-4823
+	-3419, -3419, -3419, -3419, -3418, -3417, -3415, -3413, // 4824-4831
+	-3410, -3407, -3404, -3400, -3396, -3391, -3386, -3381, // 4832-4839
+	-3375, -3369, -3362, -3355, -3348, -3340, -3331, -3323, // 4840-4847
+	-3314, -3304, -3295, -3284, -3274, -3263, -3252, -3240, // 4848-4855
+	-3228, -3216, -3204, -3191, -3178, -3164, -3151, -3137, // 4856-4863
+	-3122, -3108, -3093, -3078, -3063, -3047, -3031, -3015, // 4864-4871
+	-2998, -2982, -2965, -2947, -2930, -2912, -2894, -2876, // 4872-4879
+	-2857, -2838, -2819, -2800, -2780, -2760, -2740, -2719, // 4880-4887
+	-2698, -2677, -2656, -2634, -2613, -2591, -2568, -2546, // 4888-4895
+	-2523, -2500, -2477, -2453, -2430, -2406, -2382, -2358, // 4896-4903
+	-2333, -2309, -2284, -2259, -2234, -2209, -2184, -2158, // 4904-4911
+	-2132, -2107, -2081, -2055, -2029, -2003, -1977, -1950, // 4912-4919
+	-1924, -1898, -1871, -1845, -1818, -1792, -1765, -1738, // 4920-4927
+	-1712, -1685, -1658, -1631, -1605, -1578, -1551, -1524, // 4928-4935
+	-1497, -1471, -1444, -1417, -1391, -1364, -1338, -1311, // 4936-4943
+	-1285, -1258, -1232, -1206, -1180, -1153, -1127, -1102, // 4944-4951
+	-1076, -1050, -1025, -999, -974, -949, -923, -899, // 4952-4959
+	-874, -849, -824, -800, -776, -752, -728, -704, // 4960-4967
+	-680, -657, -634, -610, -587, -565, -542, -519, // 4968-4975
+	-497, -475, -453, -431, -409, -387, -366, -345, // 4976-4983
+	-323, -302, -281, -261, -240, -220, -199, -179, // 4984-4991
+	-159, -139, -119, -99, -79, -60, -40, -21, // 4992-4999
+	-2, 18, 37, 56, 75, 94, 112, 131, // 5000-5007
+	150, 168, 187, 205, 224, 242, 260, 279, // 5008-5015
+	297, 315, 333, 351, 369, 387, 405, 423, // 5016-5023
+	441, 459, 477, 494, 512, 530, 547, 565, // 5024-5031
+	582, 600, 617, 634, 652, 669, 686, 704, // 5032-5039
+	721, 738, 755, 772, 789, 806, 823, 839, // 5040-5047
+	856, 873, 890, 906, 923, 939, 956, 972, // 5048-5055
+	988, 1005, 1021, 1037, 1053, 1069, 1085, 1102, // 5056-5063
+	1118, 1134, 1150, 1166, 1182, 1198, 1215, 1231, // 5064-5071
+	1247, 1264, 1280, 1297, 1313, 1330, 1346, 1363, // 5072-5079
+	1379, 1396, 1412, 1429, 1445, 1462, 1478, 1494, // 5080-5087
+	1511, 1527, 1543, 1560, 1576, 1592, 1608, 1624, // 5088-5095
+	1639, 1655, 1671, 1686, 1702, 1717, 1732, 1747, // 5096-5103
+	1762, 1776, 1791, 1805, 1819, 1833, 1846, 1860, // 5104-5111
+	1873, 1886, 1899, 1911, 1924, 1936, 1948, 1959, // 5112-5119
+	1971, 1982, 1993, 2003, 2013, 2023, 2033, 2043, // 5120-5127
+	2052, 2061, 2069, 2078, 2086, 2093, 2101, 2108, // 5128-5135
+	2114, 2121, 2127, 2133, 2139, 2144, 2149, 2153, // 5136-5143
+	2158, 2162, 2166, 2169, 2172, 2175, 2178, 2180, // 5144-5151
+	2182, 2184, 2185, 2187, 2188, 2188, 2189, 2189, // 5152-5159
+	2189, 2189, 2188, 2188, 2187, 2186, 2184, 2183, // 5160-5167
+	2181, 2179, 2177, 2175, 2172, 2170, 2167, 2164, // 5168-5175
+	2161, 2157, 2154, 2150, 2146, 2142, 2138, 2133, // 5176-5183
+	2129, 2124, 2119, 2114, 2109, 2104, 2098, 2093, // 5184-5191
+	2087, 2081, 2075, 2069, 2062, 2056, 2049, 2042, // 5192-5199
+	2035, 2028, 2021, 2014, 2006, 1998, 1990, 1982, // 5200-5207
+	1974, 1966, 1957, 1949, 1940, 1931, 1921, 1912, // 5208-5215
+	1902, 1893, 1883, 1872, 1862, 1851, 1841, 1830, // 5216-5223
+	1819, 1807, 1796, 1784, 1772, 1760, 1748, 1736, // 5224-5231
+	1723, 1710, 1697, 1684, 1671, 1657, 1643, 1630, // 5232-5239
+	1616, 1601, 1587, 1572, 1558, 1543, 1528, 1513, // 5240-5247
+	1498, 1482, 1467, 1451, 1436, 1420, 1404, 1388, // 5248-5255
+	1372, 1356, 1340, 1323, 1307, 1291, 1274, 1258, // 5256-5263
+	1241, 1225, 1208, 1192, 1175, 1159, 1142, 1126, // 5264-5271
+	1109, 1093, 1076, 1060, 1044, 1027, 1011, 995, // 5272-5279
+	979, 963, 947, 932, 916, 900, 885, 870, // 5280-5287
+	854, 839, 824, 809, 794, 780, 765, 751, // 5288-5295
+	736, 722, 708, 694, 680, 666, 652, 639, // 5296-5303
+	625, 612, 598, 585, 572, 559, 546, 533, // 5304-5311
+	520, 507, 495, 482, 469, 457, 444, 432, // 5312-5319
+	419, 407, 395, 383, 370, 358, 346, 334, // 5320-5327
+	322, 310, 298, 286, 274, 262, 251, 239, // 5328-5335
+	227, 215, 203, 191, 180, 168, 156, 144, // 5336-5343
+	132, 120, 108, 96, 84, 72, 60, 47, // 5344-5351
+	35, 23, 10, -2, -15, -28, -40, -53, // 5352-5359
+	-66, -79, -92, -105, -118, -130, -143, -156, // 5360-5367
+	-169, -182, -195, -208, -221, -234, -246, -259, // 5368-5375
+	-272, -284, -297, -309, -321, -333, -346, -357, // 5376-5383
+	-369, -381, -392, -404, -415, -426, -437, -447, // 5384-5391
+	-458, -468, -478, -488, -498, -507, -516, -525, // 5392-5399
+	-534, -543, -551, -559, -567, -575, -582, -589, // 5400-5407
+	-596, -603, -609, -615, -621, -627, -632, -637, // 5408-5415
+	-642, -647, -651, -655, -659, -662, -666, -669, // 5416-5423
+	-672, -674, -677, -679, -681, -682, -684, -685, // 5424-5431
+	-686, -687, -687, -688, -688, -688, -688, -687, // 5432-5439
+	-687, -686, -685, -684, -683, -681, -680, -678, // 5440-5447
+	-676, -674, -672, -670, -667, -665, -662, -659, // 5448-5455
+	-656, -653, -650, -647, -643, -640, -636, -632, // 5456-5463
+	-628, -624, -620, -616, -611, -607, -602, -597, // 5464-5471
+	-592, -588, -583, -577, -572, -567, -561, -555, // 5472-5479
+	-550, -544, -538, -532, -526, -520, -513, -507, // 5480-5487
+	-500, -494, -487, -480, -474, -467, -460, -453, // 5488-5495
+	-445, -438, -431, -423, -416, -408, -401, -393, // 5496-5503
+	-385, -377, -369, -361, -353, -345, -337, -329, // 5504-5511
+	-321, -312, -304, -295, -287, -278, -270, -261, // 5512-5519
+	-253, -244, -236, -227, -218, -210, -201, -192, // 5520-5527
+	-184, -175, -167, -158, -149, -141, -132, -124, // 5528-5535
+	-115, -107, -98, -90, -82, -73, -65, -57, // 5536-5543
+	-49, -41, -33, -25, -17, -9, -1, 7, // 5544-5551
+	14, 22, 29, 36, 44, 51, 58, 64, // 5552-5559
+	71, 78, 84, 91, 97, 103, 109, 115, // 5560-5567
+	121, 127, 132, 138, 143, 148, 153, 158, // 5568-5575
+	163, 167, 172, 176, 180, 184, 188, 192, // 5576-5583
+	196, 200, 203, 206, 210, 213, 216, 219, // 5584-5591
+	221, 224, 227, 229, 232, 234, 236, 238, // 5592-5599
+	240, 242, 244, 246, 248, 249, 251, 252, // 5600-5607
+	254, 255, 257, 258, 259, 260, 261, 262, // 5608-5615
+	263, 264, 265, 266, 267, 268, 269, 270, // 5616-5623
+	270, 271, 272, 273, 274, 274, 275, 276, // 5624-5631
+	276, 277, 278, 279, 279, 280, 281, 282, // 5632-5639
+	283, 283, 284, 285, 286, 287, 288, 289, // 5640-5647
+	290, 290, 291, 292, 293, 294, 295, 296, // 5648-5655
+	297, 298, 299, 300, 301, 302, 303, 304, // 5656-5663
+	305, 306, 307, 308, 309, 310, 311, 312, // 5664-5671
+	313, 313, 314, 315, 316, 316, 317, 318, // 5672-5679
+	318, 319, 319, 320, 320, 321, 321, 321, // 5680-5687
+	321, 322, 322, 322, 322, 322, 322, 322, // 5688-5695
+	322, 322, 321, 321, 321, 320, 320, 319, // 5696-5703
+	319, 318, 318, 317, 316, 315, 314, 313, // 5704-5711
+	312, 311, 310, 309, 308, 307, 305, 304, // 5712-5719
+	303, 301, 300, 298, 297, 295, 293, 291, // 5720-5727
+	290, 288, 286, 284, 282, 280, 278, 276, // 5728-5735
+	274, 272, 269, 267, 265, 262, 260, 257, // 5736-5743
+	255, 252, 250, 247, 244, 241, 239, 236, // 5744-5751
+	233, 230, 227, 224, 221, 217, 214, 211, // 5752-5759
+	208, 204, 201, 198, 194, 190, 187, 183, // 5760-5767
+	179, 176, 172, 168, 164, 160, 156, 152, // 5768-5775
+	148, 144, 140, 135, 131, 127, 122, 118, // 5776-5783
+	113, 109, 104, 99, 95, 90, 85, 80, // 5784-5791
+	75, 70, 65, 60, 55, 50, 45, 39, // 5792-5799
+	34, 29, 23, 18, 12, 7, 1, -5, // 5800-5807
+	-11, -16, -22, -28, -34, -40, -46, -52, // 5808-5815
+	-58, -64, -70, -76, -82, -88, -94, -100, // 5816-5823
+	-107, -113, -119, -125, -131, -137, -144, -150, // 5824-5831
+	-156, -162, -168, -174, -180, -186, -193, -199, // 5832-5839
+	-204, -210, -216, -222, -228, -233, -239, -244, // 5840-5847
+	-250, -255, -260, -266, -271, -276, -280, -285, // 5848-5855
+	-290, -294, -299, -303, -307, -311, -315, -319, // 5856-5863
+	-323, -326, -329, -333, -336, -339, -342, -344, // 5864-5871
+	-347, -349, -351, -353, -355, -357, -359, -360, // 5872-5879
+	-361, -362, -363, -364, -365, -365, -366, -366, // 5880-5887
+	-366, -366, -366, -366, -365, -365, -364, -363, // 5888-5895
+	-362, -361, -360, -358, -357, -355, -354, -352, // 5896-5903
+	-350, -348, -346, -343, -341, -339, -336, -334, // 5904-5911
+	-331, -328, -325, -322, -319, -316, -313, -310, // 5912-5919
+	-307, -304, -300, -297, -293, -290, -286, -283, // 5920-5927
+	-279, -276, -272, -268, -264, -261, -257, -253, // 5928-5935
+	-249, -245, -241, -238, -234, -230, -226, -222, // 5936-5943
+	-218, -214, -210, -206, -202, -198, -194, -190, // 5944-5951
+	-186, -181, -177, -173, -169, -165, -161, -157, // 5952-5959
+	-153, -149, -145, -141, -137, -133, -129, -125, // 5960-5967
+	-121, -117, -113, -109, -105, -102, -98, -94, // 5968-5975
+	-90, -86, -82, -78, -75, -71, -67, -63, // 5976-5983
+	-60, -56, -52, -49, -45, -41, -38, -34, // 5984-5991
+	-31, -27, -24, -20, -17, -14, -10, -7, // 5992-5999
+	-4, -1, 2, 6, 9, 12, 15, 18, // 6000-6007
+	21, 24, 26, 29, 32, 35, 37, 40, // 6008-6015
+	42, 45, 47, 50, 52, 54, 57, 59, // 6016-6023
+	61, 63, 65, 67, 69, 71, 73, 75, // 6024-6031
+	77, 78, 80, 82, 83, 85, 86, 88, // 6032-6039
+	89, 91, 92, 93, 95, 96, 97, 98, // 6040-6047
+	99, 101, 102, 103, 104, 105, 106, 107, // 6048-6055
+	108, 109, 110, 110, 111, 112, 113, 114, // 6056-6063
+	115, 115, 116, 117, 118, 119, 120, 120, // 6064-6071
+	121, 122, 123, 124, 124, 125, 126, 127, // 6072-6079
+	128, 129, 130, 131, 132, 132, 133, 134, // 6080-6087
+	135, 136, 137, 138, 140, 141, 142, 143, // 6088-6095
+	144, 145, 146, 147, 148, 150, 151, 152, // 6096-6103
+	153, 154, 156, 157, 158, 159, 161, 162, // 6104-6111
+	163, 164, 165, 167, 168, 169, 170, 171, // 6112-6119
+	173, 174, 175, 176, 177, 178, 179, 180, // 6120-6127
+	181, 182, 183, 184, 185, 186, 187, 188, // 6128-6135
+	189, 189, 190, 191, 191, 192, 192, 193, // 6136-6143
+	193, 193, 194, 194, 194, 194, 195, 195, // 6144-6151
+	195, 195, 194, 194, 194, 194, 194, 193, // 6152-6159
+	193, 192, 192, 191, 190, 190, 189, 188, // 6160-6167
+	187, 186, 185, 184, 183, 182, 181, 180, // 6168-6175
+	179, 177, 176, 175, 173, 172, 170, 169, // 6176-6183
+	167, 165, 164, 162, 160, 158, 156, 154, // 6184-6191
+	153, 151, 149, 147, 144, 142, 140, 138, // 6192-6199
+	136, 134, 131, 129, 127, 124, 122, 120, // 6200-6207
+	117, 115, 112, 110, 107, 104, 102, 99, // 6208-6215
+	97, 94, 91, 88, 86, 83, 80, 77, // 6216-6223
+	74, 72, 69, 66, 63, 60, 57, 54, // 6224-6231
+	51, 48, 45, 42, 38, 35, 32, 29, // 6232-6239
+	26, 23, 20, 16, 13, 10, 7, 3, // 6240-6247
+	0, -3, -6, -10, -13, -16, -19, -23, // 6248-6255
+	-26, -29, -33, -36, -39, -42, -46, -49, // 6256-6263
+	-52, -55, -59, -62, -65, -68, -71, -74, // 6264-6271
+	-78, -81, -84, -87, -90, -93, -96, -99, // 6272-6279
+	-102, -104, -107, -110, -113, -116, -118, -121, // 6280-6287
+	-124, -126, -129, -131, -134, -136, -138, -141, // 6288-6295
+	-143, -145, -147, -149, -151, -153, -155, -157, // 6296-6303
+	-159, -161, -162, -164, -166, -167, -169, -170, // 6304-6311
+	-171, -173, -174, -175, -176, -177, -178, -179, // 6312-6319
+	-180, -181, -181, -182, -182, -183, -183, -184, // 6320-6327
+	-184, -184, -185, -185, -185, -185, -185, -185, // 6328-6335
+	-184, -184, -184, -183, -183, -183, -182, -181, // 6336-6343
+	-181, -180, -179, -178, -178, -177, -176, -175, // 6344-6351
+	-174, -173, -171, -170, -169, -168, -166, -165, // 6352-6359
+	-164, -162, -161, -159, -158, -156, -154, -153, // 6360-6367
+	-151, -149, -148, -146, -144, -143, -141, -139, // 6368-6375
+	-137, -135, -133, -131, -130, -128, -126, -124, // 6376-6383
+	-122, -120, -118, -116, -114, -112, -110, -108, // 6384-6391
+	-106, -104, -102, -100, -98, -96, -94, -92, // 6392-6399
+	-90, -88, -86, -84, -82, -80, -78, -76, // 6400-6407
+	-74, -72, -71, -69, -67, -65, -63, -61, // 6408-6415
+	-59, -57, -56, -54, -52, -50, -48, -47, // 6416-6423
+	-45, -43, -41, -40, -38, -36, -35, -33, // 6424-6431
+	-31, -30, -28, -26, -25, -23, -22, -20, // 6432-6439
+	-19, -17, -16, -14, -13, -11, -10, -8, // 6440-6447
+	-7, -5, -4, -3, -1, 0, 1, 3, // 6448-6455
+	4, 5, 6, 8, 9, 10, 11, 13, // 6456-6463
+	14, 15, 16, 17, 18, 19, 21, 22, // 6464-6471
+	23, 24, 25, 26, 27, 28, 29, 30, // 6472-6479
+	31, 32, 33, 34, 35, 35, 36, 37, // 6480-6487
+	38, 39, 40, 41, 42, 43, 43, 44, // 6488-6495
+	45, 46, 47, 48, 48, 49, 50, 51, // 6496-6503
+	52, 52, 53, 54, 55, 56, 56, 57, // 6504-6511
+	58, 59, 60, 60, 61, 62, 63, 64, // 6512-6519
+	65, 65, 66, 67, 68, 69, 69, 70, // 6520-6527
+	71, 72, 73, 73, 74, 75, 76, 77, // 6528-6535
+	78, 79, 79, 80, 81, 82, 83, 84, // 6536-6543
+	84, 85, 86, 87, 88, 89, 90, 90, // 6544-6551
+	91, 92, 93, 94, 95, 95, 96, 97, // 6552-6559
+	98, 99, 99, 100, 101, 102, 102, 103, // 6560-6567
+	104, 105, 105, 106, 107, 107, 108, 109, // 6568-6575
+	109, 110, 110, 111, 111, 112, 112, 113, // 6576-6583
+	113, 114, 114, 114, 115, 115, 115, 116, // 6584-6591
+	116, 116, 116, 116, 116, 116, 117, 117, // 6592-6599
+	116, 116, 116, 116, 116, 116, 116, 115, // 6600-6607
+	115, 115, 114, 114, 113, 113, 112, 112, // 6608-6615
+	111, 111, 110, 109, 108, 108, 107, 106, // 6616-6623
+	105, 104, 103, 102, 101, 100, 99, 98, // 6624-6631
+	97, 95, 94, 93, 92, 90, 89, 88, // 6632-6639
+	86, 85, 83, 82, 80, 79, 77, 76, // 6640-6647
+	74, 73, 71, 69, 68, 66, 64, 63, // 6648-6655
+	61, 59, 57, 56, 54, 52, 50, 48, // 6656-6663
+	46, 45, 43, 41, 39, 37, 35, 33, // 6664-6671
+	31, 30, 28, 26, 24, 22, 20, 18, // 6672-6679
+	16, 14, 12, 10, 8, 7, 5, 3, // 6680-6687
+	1, -1, -3, -5, -7, -9, -10, -12, // 6688-6695
+	-14, -16, -18, -20, -22, -23, -25, -27, // 6696-6703
+	-29, -30, -32, -34, -36, -37, -39, -41, // 6704-6711
+	-42, -44, -46, -47, -49, -51, -52, -54, // 6712-6719
+	-55, -57, -58, -60, -61, -63, -64, -65, // 6720-6727
+	-67, -68, -69, -71, -72, -73, -74, -76, // 6728-6735
+	-77, -78, -79, -80, -81, -82, -83, -84, // 6736-6743
+	-85, -86, -87, -88, -89, -90, -90, -91, // 6744-6751
+	-92, -93, -93, -94, -94, -95, -96, -96, // 6752-6759
+	-97, -97, -97, -98, -98, -99, -99, -99, // 6760-6767
+	-99, -100, -100, -100, -100, -100, -100, -100, // 6768-6775
+	-100, -100, -100, -100, -100, -100, -100, -99, // 6776-6783
+	-99, -99, -99, -98, -98, -98, -97, -97, // 6784-6791
+	-97, -96, -96, -95, -95, -94, -94, -93, // 6792-6799
+	-93, -92, -91, -91, -90, -89, -89, -88, // 6800-6807
+	-87, -87, -86, -85, -84, -84, -83, -82, // 6808-6815
+	-81, -80, -80, -79, -78, -77, -76, -75, // 6816-6823
+	-75, -74, -73, -72, -71, -70, -69, -68, // 6824-6831
+	-67, -66, -66, -65, -64, -63, -62, -61, // 6832-6839
+	-60, -59, -58, -57, -56, -55, -55, -54, // 6840-6847
+	-53, -52, -51, -50, -49, -48, -47, -46, // 6848-6855
+	-45, -45, -44, -43, -42, -41, -40, -39, // 6856-6863
+	-38, -38, -37, -36, -35, -34, -33, -32, // 6864-6871
+	-32, -31, -30, -29, -28, -27, -27, -26, // 6872-6879
+	-25, -24, -23, -23, -22, -21, -20, -19, // 6880-6887
+	-19, -18, -17, -16, -15, -15, -14, -13, // 6888-6895
+	-12, -12, -11, -10, -9, -9, -8, -7, // 6896-6903
+	-6, -6, -5, -4, -3, -3, -2, -1, // 6904-6911
+	0, 0, 1, 2, 2, 3, 4, 5, // 6912-6919
+	5, 6, 7, 8, 8, 9, 10, 10, // 6920-6927
+	11, 12, 13, 13, 14, 15, 15, 16, // 6928-6935
+	17, 17, 18, 19, 20, 20, 21, 22, // 6936-6943
+	22, 23, 24, 25, 25, 26, 27, 27, // 6944-6951
+	28, 29, 29, 30, 31, 32, 32, 33, // 6952-6959
+	34, 34, 35, 36, 36, 37, 38, 38, // 6960-6967
+	39, 40, 41, 41, 42, 43, 43, 44, // 6968-6975
+	45, 45, 46, 47, 47, 48, 49, 49, // 6976-6983
+	50, 51, 51, 52, 53, 53, 54, 55, // 6984-6991
+	55, 56, 57, 57, 58, 58, 59, 60, // 6992-6999
+	60, 61, 61, 62, 62, 63, 64, 64, // 7000-7007
+	65, 65, 66, 66, 67, 67, 67, 68, // 7008-7015
+	68, 69, 69, 70, 70, 70, 71, 71, // 7016-7023
+	71, 72, 72, 72, 72, 73, 73, 73, // 7024-7031
+	73, 73, 74, 74, 74, 74, 74, 74, // 7032-7039
+	74, 74, 74, 74, 74, 74, 74, 74, // 7040-7047
+	74, 74, 74, 73, 73, 73, 73, 72, // 7048-7055
+	72, 72, 71, 71, 71, 70, 70, 70, // 7056-7063
+	69, 69, 68, 68, 67, 67, 66, 65, // 7064-7071
+	65, 64, 64, 63, 62, 61, 61, 60, // 7072-7079
+	59, 58, 58, 57, 56, 55, 54, 53, // 7080-7087
+	53, 52, 51, 50, 49, 48, 47, 46, // 7088-7095
+	45, 44, 43, 42, 41, 40, 39, 38, // 7096-7103
+	37, 36, 35, 34, 32, 31, 30, 29, // 7104-7111
+	28, 27, 26, 25, 23, 22, 21, 20, // 7112-7119
+	19, 18, 17, 16, 14, 13, 12, 11, // 7120-7127
+	10, 9, 8, 6, 5, 4, 3, 2, // 7128-7135
+	1, 0, -1, -2, -3, -4, -5, -7, // 7136-7143
+	-8, -9, -10, -11, -12, -13, -14, -15, // 7144-7151
+	-16, -17, -18, -18, -19, -20, -21, -22, // 7152-7159
+	-23, -24, -25, -26, -26, -27, -28, -29, // 7160-7167
+	-30, -30, -31, -32, -33, -33, -34, -35, // 7168-7175
+	-35, -36, -37, -37, -38, -38, -39, -40, // 7176-7183
+	-40, -41, -41, -42, -42, -43, -43, -44, // 7184-7191
+	-44, -45, -45, -45, -46, -46, -47, -47, // 7192-7199
+	-47, -48, -48, -48, -48, -49, -49, -49, // 7200-7207
+	-49, -50, -50, -50, -50, -50, -50, -50, // 7208-7215
+	-51, -51, -51, -51, -51, -51, -51, -51, // 7216-7223
+	-51, -51, -51, -51, -51, -51, -51, -51, // 7224-7231
+	-51, -51, -50, -50, -50, -50, -50, -50, // 7232-7239
+	-50, -49, -49, -49, -49, -49, -48, -48, // 7240-7247
+	-48, -48, -48, -47, -47, -47, -47, -46, // 7248-7255
+	-46, -46, -45, -45, -44, -44, -43, -43, // 7256-7263
+	-42, -42, -41, -41, -40, -40, -39, -39, // 7264-7271
+	-38, -38, -37, -37, -37, -36, -36, -35, // 7272-7279
+	-35, -34, -34, -33, -33, -32, -32, -31, // 7280-7287
+	-31, -30, -30, -30, -29, -29, -28, -28, // 7288-7295
+	-27, -27, -26, -26, -26, -25, -25, -24, // 7296-7303
+	-24, -24, -23, -23, -22, -22, -22, -21, // 7304-7311
+	-21, -20, -20, -20, -19, -19, -18, -18, // 7312-7319
+	-18, -17, -17, -17, -16, -16, -16, -15, // 7320-7327
+	-15, -14, -14, -14, -13, -13, -13, -12, // 7328-7335
+	-12, -12, -11, -11, -11, -10, -10, -10, // 7336-7343
+	-10, -9, -9, -9, -8, -8, -8, -7, // 7344-7351
+	-7, -7, -6, -6, -6, -6, -5, -5, // 7352-7359
+	-5, -4, -4, -4, -4, -3, -3, -3, // 7360-7367
+	-2, -2, -2, -2, -1, -1, -1, -1, // 7368-7375
+	0, 0, 0, 0, 1, 1, 1, 1, // 7376-7383
+	2, 2, 2, 2, 2, 3, 3, 3, // 7384-7391
+	3, 3, 4, 4, 4, 4, 4, 5, // 7392-7399
+	5, 5, 5, 5, 5, 6, 6, 6, // 7400-7407
+	6, 6, 6, 6, 7, 7, 7, 7, // 7408-7415
+	7, 7, 7, 7, 7, 7, 8, 8, // 7416-7423
+	8, 8, 8, 8, 8, 8, 8, 8, // 7424-7431
+	8, 8, 8, 8, 8, 8, 8, 8, // 7432-7439
+	8, 8, 8, 8, 8, 8, 8, 8, // 7440-7447
+	8, 8, 8, 8, 8, 8, 8, 8, // 7448-7455
+	8, 8, 7, 7, 7, 7, 7, 7, // 7456-7463
+	7, 7, 7, 7, 6, 6, 6, 6, // 7464-7471
+	6, 6, 6, 6, 5, 5, 5, 5, // 7472-7479
+	5, 5, 5, 4, 4, 4, 4, 4, // 7480-7487
+	4, 4, 3, 3, 3, 3, 3, 3, // 7488-7495
+	2, 2, 2, 2, 2, 2, 1, 1, // 7496-7503
+	1, 1, 1, 1, 1, 0, 0, 0, // 7504-7511
+	0, // 7512-7512
+};
+
+const struct impulse_table impulse_body[] = {
+	{mallet_hit_tube_data, 16217},	// mallet_hit through the tube body
+	{mallet_hit_guitar_data, 9549},	// mallet_hit through the guitar body
+	{viola_hit_guitar_data, 9472},	// viola_hit through the guitar body
+	{val_hit_guitar_data, 7513},	// val_hit through the guitar body
+};
@@ -17,6 +17,9 @@ we do the low pass filtering on it (in this case simple averaging).
 */
 //-----------------------------------------------------------------------------
 
+#include <math.h>
+#include <string.h>
+
 #include "pmsynth.h"
 #include "utils.h"
 
@@ -26,7 +29,7 @@ we do the low pass filtering on it (in this case simple averaging).
 //-----------------------------------------------------------------------------
 
 // frequency to x scaling (xrange/fs)
-#define KS_FSCALE ((float)(1ULL << 32) / AUDIO_FS)
+#define KS_FSCALE ((float)(1ULL << 32) * audio_ts)
 
 #define KS_DELAY_MASK (KS_DELAY_SIZE - 1)
 #define KS_FRAC_BITS (32U - KS_DELAY_BITS)
@@ -87,7 +90,200 @@ void ks_ctrl_frequency(struct ks *osc, float freq) {
 }
 
 void ks_init(struct ks *osc) {
-	// do nothing
+	osc->x = 0;
+}
+
+//-----------------------------------------------------------------------------
+/*
+
+Karplus Strong with a delay line sized for the note
+
+The loop is an integer delay, a one zero loss filter and a first order
+allpass for the rest of the period:
+
+  y(n) = b0 * x(n) + b1 * x(n-1)
+  period = d + loss filter delay + frac, 0.1 <= frac < 1.1
+
+The allpass coefficient gives the exact phase delay at the fundamental.
+frac is kept away from 0, where the allpass has a pole near z = -1 and rings.
+The filters run once per sample, so their response is the same at any pitch.
+
+The loss filter sets the decay of the fundamental to the same rate for every
+note. Low notes need more loss than the averaging filter (b0 = b1) has at
+the fundamental, so it's scaled down. High notes need less, so the zero is
+moved towards 0 and the filter gets brighter (decay stretching, Jaffe and
+Smith). The gain is never above 1, so the loop is stable at every frequency.
+
+The delay line is a power of 2 from the delay line pool, so the read
+position wraps with a mask. A low note that doesn't fit the voice share of
+the pool runs the loop at a lower rate (ds), with the output held between
+the loop samples.
+
+*/
+//-----------------------------------------------------------------------------
+
+// lowest fractional delay for the allpass
+#define KSV_FRAC_MIN 0.1f
+
+// the lowest internal rate (as a divisor) when the delay line pool is short
+#define KSV_DOWNSAMPLE_MAX 8
+
+void ksv_gen(struct ksv *osc, float *out, size_t n) {
+	float am[n];
+	adsr_gen(&osc->adsr, am, n);
+	if (osc->delay == NULL) {
+		memset(out, 0, n * sizeof(float));
+		return;
+	}
+	dl_t *dl = osc->delay;
+	uint32_t mask = osc->size - 1;
+	uint32_t w = osc->w;
+	uint32_t r = w - osc->d;
+	float b0 = osc->b0;
+	float b1 = osc->b1;
+	float c = osc->c;
+	float x1 = osc->x1;
+	float ap_x1 = osc->ap_x1;
+	float ap_y1 = osc->ap_y1;
+	uint32_t ds = osc->ds;
+	uint32_t phase = osc->ds_phase;
+	for (size_t i = 0; i < n; i++) {
+		// the loop runs every ds samples, the output holds in between
+		if (phase == 0) {
+			float x = dl_rd(dl[r++ & mask], KSV_Q_SHIFT);
+			// loss filter
+			float y = b0 * x + b1 * x1;
+			x1 = x;
+			// allpass
+			float a = c * (y - ap_y1) + ap_x1;
+			ap_x1 = y;
+			ap_y1 = a;
+			dl[w++ & mask] = dl_wr(a, KSV_Q_SHIFT);
+		}
+		phase = (phase + 1 < ds) ? phase + 1 : 0;
+		out[i] = ap_y1;
+	}
+	osc->ds_phase = phase;
+	osc->w = w;
+	osc->x1 = x1;
+	osc->ap_x1 = ap_x1;
+	osc->ap_y1 = ap_y1;
+	block_mul(out, am, n);
+}
+
+//-----------------------------------------------------------------------------
+
+// set the loop delay and loss filter for the current frequency
+static void ksv_tune(struct ksv *osc) {
+	if (osc->delay == NULL || osc->freq <= 0.f) {
+		return;
+	}
+	// the loop runs at fs
+	float fs = audio_fs / (float)osc->ds;
+	float w = TAU * osc->freq / fs;
+	float q = sin_eval(0.5f * w);
+	// loop gain at the fundamental
+	float g = powf(osc->attenuate, KSV_DECAY_FREQ / osc->freq);
+	// The loss filter gain at w is 1 - 4 * s * (1 - s) * q^2 squared, where
+	// s = b1 / (b0 + b1). The averaging filter is s = 0.5.
+	float p = (1.f - g * g) / (4.f * q * q);
+	float s = 0.5f;
+	if (p < 0.25f) {
+		s = 0.5f - sqrtf(0.25f - p);
+		g = 1.f;
+	} else {
+		g /= cos_eval(0.5f * w);
+	}
+	osc->b0 = g * (1.f - s);
+	osc->b1 = g * s;
+	// loss filter phase delay at the fundamental (s for low notes)
+	float ld = atan2f(s * sin_eval(w), 1.f - s + s * cos_eval(w)) / w;
+	float period = fs / osc->freq - ld;
+	// the longest loop delay that fits the delay line
+	period = clampf(period, 1.f + KSV_FRAC_MIN, (float)(osc->size - 1) + KSV_FRAC_MIN);
+	uint32_t d = (uint32_t) (period - KSV_FRAC_MIN);
+	float frac = period - (float)d;
+	// allpass phase delay of frac at the fundamental
+	// (sin_eval is even, c is negative for frac > 1)
+	float c = sin_eval(0.5f * w * (1.f - frac)) / sin_eval(0.5f * w * (1.f + frac));
+	osc->d = d;
+	osc->c = (frac > 1.f) ? -c : c;
+}
+
+void ksv_pluck(struct ksv *osc) {
+	if (osc->delay == NULL) {
+		return;
+	}
+	// Fill one period behind the read position with random samples that
+	// sum to zero (see ks_pluck).
+	float sum = 0.f;
+	uint32_t mask = osc->size - 1;
+	uint32_t r = osc->w - osc->d;
+	for (uint32_t i = 0; i < osc->d - 1; i++) {
+		float val = rand_float();
+		float x = sum + val;
+		if (x > 1.f || x < -1.f) {
+			val = -val;
+		}
+		sum += val;
+		osc->delay[(r + i) & mask] = dl_wr(val, KSV_Q_SHIFT);
+	}
+	osc->delay[(r + osc->d - 1) & mask] = dl_wr(-sum, KSV_Q_SHIFT);
+	osc->x1 = 0.f;
+	osc->ap_x1 = 0.f;
+	osc->ap_y1 = 0.f;
+	osc->ds_phase = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void ksv_ctrl_attenuate(struct ksv *osc, float attenuate) {
+	osc->attenuate = attenuate;
+	ksv_tune(osc);
+}
+
+void ksv_ctrl_frequency(struct ksv *osc, float freq) {
+	osc->freq = freq;
+	ksv_tune(osc);
+}
+
+void ksv_init(struct ksv *osc) {
+	memset(osc, 0, sizeof(struct ksv));
+	osc->attenuate = 0.995f;
+	osc->ds = 1;
+}
+
+// Allocate the delay line for notes down to freq (Hz).
+// The loop runs at the highest rate that fits the voice share of the pool
+// (see dl_fits), the lowest rate takes whatever there is. Returns -1 if
+// there's no room at all, the voice is then silent.
+int ksv_alloc(struct ksv *osc, float freq) {
+	for (uint32_t ds = 1; ds <= KSV_DOWNSAMPLE_MAX; ds <<= 1) {
+		size_t size = dl_size(((uint32_t) (audio_fs / freq / ds) + 2) * sizeof(dl_t));
+		if (ds < KSV_DOWNSAMPLE_MAX && !dl_fits(size)) {
+			continue;
+		}
+		dl_t *buf = (size) ? dl_alloc(size) : NULL;
+		if (buf) {
+			memset(buf, 0, size);
+			osc->delay = buf;
+			osc->size = size / sizeof(dl_t);
+			osc->w = 0;
+			osc->ds = ds;
+			osc->ds_phase = 0;
+			ksv_tune(osc);
+			return 0;
+		}
+	}
+	DBG("no delay line memory for %d Hz\r\n", (int)freq);
+	return -1;
+}
+
+// stop the voice, it's silent until the next ksv_alloc
+void ksv_stop(struct ksv *osc) {
+	dl_free(osc->delay, osc->size * sizeof(dl_t));
+	osc->delay = NULL;
+	osc->size = 0;
 }
 
 //-----------------------------------------------------------------------------
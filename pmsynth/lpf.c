@@ -37,8 +37,8 @@ void svf_gen(struct svf *f, float *out, const float *in, size_t n) {
 
 // set the cutoff frequency
 void svf_ctrl_cutoff(struct svf *f, float cutoff) {
-	cutoff = clampf(cutoff, 0.f, 0.5f * AUDIO_FS);
-	f->kf = 2.f * sin_eval(PI * cutoff / AUDIO_FS);
+	cutoff = clampf(cutoff, 0.f, 0.5f * audio_fs);
+	f->kf = 2.f * sin_eval(PI * cutoff * audio_ts);
 }
 
 // set the resonance (0..1)
@@ -145,8 +145,8 @@ void svf2_gen_lpf(struct svf2 *f, float *out, const float *in, size_t n, uint16_
 
 // set the cutoff frequency
 void svf2_ctrl_cutoff(struct svf2 *f, float cutoff) {
-	cutoff = clampf(cutoff, 0.f, 0.5f * AUDIO_FS);
-	f->g = tan_eval(PI * cutoff / AUDIO_FS);
+	cutoff = clampf(cutoff, 0.f, 0.5f * audio_fs);
+	f->g = tan_eval(PI * cutoff * audio_ts);
 }
 
 // set the resonance (0..1)
@@ -0,0 +1,44 @@
+// generated by: ./mesh2modal -o mesh_modes.c -n 16 (don't edit)
+#include "pmsynth.h"
+
+// 8x8 membrane, boundary reflection -1.00, tuned to 300Hz
+static const struct modal_mode membrane_modes[] = {
+	{1.00000f, 1.000f, 1.00000f},
+	{1.56210f, 1.000f, -0.15448f},
+	{2.15583f, 1.000f, 0.71809f},
+	{2.71241f, 1.000f, -0.31464f},
+	{2.88074f, 1.000f, 0.20798f},
+	{3.20042f, 1.000f, 0.26686f},
+	{3.31825f, 1.000f, -0.19908f},
+	{3.59947f, 1.000f, -0.43101f},
+	{3.72814f, 1.000f, 0.17732f},
+	{4.07615f, 1.000f, -0.88382f},
+	{4.39693f, 1.000f, 0.15056f},
+	{4.50304f, 1.000f, -0.34517f},
+	{4.79561f, 1.000f, 0.17868f},
+	{5.08871f, 1.000f, -0.16851f},
+	{5.34971f, 1.000f, 0.29117f},
+	{5.68270f, 1.000f, 0.17740f},
+};
+const struct modal_set modal_membrane = {16, membrane_modes};
+
+// 8x8 plate, boundary reflection -1.00, tuned to 1378Hz
+static const struct modal_mode plate_modes[] = {
+	{1.00000f, 1.000f, 0.46388f},
+	{1.56503f, 1.000f, -1.00000f},
+	{1.97741f, 1.000f, 0.55945f},
+	{2.16616f, 1.000f, 0.39663f},
+	{2.48419f, 1.000f, -0.34867f},
+	{2.99729f, 1.000f, 0.42531f},
+	{3.36294f, 1.000f, -0.26498f},
+	{3.46781f, 1.000f, -0.37386f},
+	{3.65782f, 1.000f, -0.24645f},
+	{3.79358f, 1.000f, 0.23898f},
+	{3.97031f, 1.000f, 0.42432f},
+	{4.16372f, 1.000f, -0.88547f},
+	{4.35016f, 1.000f, 0.39423f},
+	{4.77613f, 1.000f, -0.28848f},
+	{5.10905f, 1.000f, 0.27482f},
+	{5.79574f, 1.000f, -0.32199f},
+};
+const struct modal_set modal_plate = {16, plate_modes};
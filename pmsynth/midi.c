@@ -22,8 +22,8 @@ float midi_map(uint8_t val, float a, float b) {
 
 // map a pitch bend value onto a note offset
 float midi_pitch_bend(uint16_t val) {
-	// 0..8192..16383 maps to -/+ 2 semitones
-	return (float)(val - 8192) * (2.f / 8192.f);
+	// 0..8192..16383 maps to -/+ MIDI_BEND_RANGE semitones
+	return (float)(val - 8192) * (MIDI_BEND_RANGE / 8192.f);
 }
 
 // midi note to frequency conversion
@@ -93,11 +93,18 @@ static void midi_note_on(struct midi_rx *midi) {
 	}
 	//DBG("note on ch %d note %d vel %d\r\n", chan, note, vel);
 	struct voice *v = voice_lookup(midi->pmsynth, chan, note);
+	// a re-strike of a ringing voice is already sounding, don't time it
+	int silent = (v == NULL) || !v->patch->ops->active(v);
 	if (!v) {
 		v = voice_alloc(midi->pmsynth, chan, note);
 	}
 	if (v) {
 		v->patch->ops->note_on(v, vel);
+		// time the note from rx to sound
+		if (silent) {
+			v->note_time = midi->time;
+			v->note_pending = 1;
+		}
 	}
 }
 
@@ -113,10 +120,17 @@ static void midi_control_change(struct midi_rx *midi) {
 		return;
 	}
 	//DBG("control change ch %d ctrl %d val %d\r\n", chan, ctrl, val);
+	if (ctrl == RATE_SELECT) {
+		// the main loop makes the change
+		select_samplerate(midi->pmsynth, val);
+		screen_post(SCREEN_VALUE, ctrl, val);
+		return;
+	}
 	struct patch *p = &midi->pmsynth->patches[chan];
-	if (p->ops) {
+	if (p->ops && !param_control_change(p, ctrl, val)) {
 		p->ops->control_change(p, ctrl, val);
 	}
+	screen_post(SCREEN_VALUE, ctrl, val);
 }
 
 // process a midi pitch wheel change
@@ -126,7 +140,7 @@ static void midi_pitch_wheel(struct midi_rx *midi) {
 	uint16_t val = (midi->arg1 << 7) | midi->arg0;
 	//DBG("pitch wheel ch %d val %d\r\n", chan, val);
 	struct patch *p = &midi->pmsynth->patches[chan];
-	if (p->ops) {
+	if (p->ops && !param_pitch_wheel(p, val) && p->ops->pitch_wheel) {
 		p->ops->pitch_wheel(p, val);
 	}
 }
@@ -180,6 +194,80 @@ static void midi_sysex_end(struct midi_rx *midi) {
 	DBG("sysex end\r\n");
 }
 
+//-----------------------------------------------------------------------------
+// timestamped messages
+
+// The time for a byte at the MIDI baud rate (start + 8 data + stop bits)
+#define MIDI_BYTE_TIME (10.f / 31250.f)	// seconds
+
+// no rx idle time is available
+#define MIDI_IDLE_NONE 0xffffffffU
+
+// queue a complete message to be applied at its render time
+static void midi_post(struct midi_rx *midi) {
+	uint32_t wr = midi->q_wr;
+	// system messages don't touch the voices, so handle them immediately
+	if (midi->status == 0) {
+		midi->func(midi);
+		return;
+	}
+	// the renderer owns the voices, so drop the message if the queue is full
+	if ((wr - midi->q_rd) >= MIDI_QUEUE_SIZE) {
+		midi->dropped += 1;
+		return;
+	}
+	struct midi_msg *m = &midi->queue[wr & (MIDI_QUEUE_SIZE - 1)];
+	m->time = midi->time + midi->latency;
+	m->func = midi->func;
+	m->status = midi->status;
+	m->arg0 = midi->arg0;
+	m->arg1 = midi->arg1;
+	// publish the message before the write index
+	__DMB();
+	midi->q_wr = wr + 1;
+}
+
+// apply the queued messages with a render time <= time
+void midi_apply(struct midi_rx *midi, uint32_t time) {
+	uint32_t rd = midi->q_rd;
+	while (rd != midi->q_wr) {
+		__DMB();
+		struct midi_msg *m = &midi->queue[rd & (MIDI_QUEUE_SIZE - 1)];
+		int32_t dt = (int32_t) (m->time - time);
+		if (dt > 0) {
+			break;
+		}
+		if (dt <= -AUDIO_SPLIT_SIZE) {
+			midi->late += 1;
+		}
+		// run the event function with the message arguments
+		struct midi_rx x;
+		x.pmsynth = midi->pmsynth;
+		x.time = m->time - midi->latency;
+		x.status = m->status;
+		x.arg0 = m->arg0;
+		x.arg1 = m->arg1;
+		m->func(&x);
+		rd += 1;
+		__DMB();
+		midi->q_rd = rd;
+	}
+}
+
+// return the number of samples (<= n) from time to the next queued message
+size_t midi_next(struct midi_rx *midi, uint32_t time, size_t n) {
+	uint32_t rd = midi->q_rd;
+	if (rd == midi->q_wr) {
+		return n;
+	}
+	__DMB();
+	int32_t dt = (int32_t) (midi->queue[rd & (MIDI_QUEUE_SIZE - 1)].time - time);
+	if (dt <= 0) {
+		return 0;
+	}
+	return ((size_t) dt < n) ? (size_t) dt : n;
+}
+
 //-----------------------------------------------------------------------------
 
 // midi rx states
@@ -192,9 +280,11 @@ enum {
 };
 
 // Receive a buffer of midi bytes
-static void midi_rxbuf(struct midi_rx *midi, uint8_t * buf, size_t n) {
+// The first byte was received at time t, then one byte every dt samples.
+static void midi_rxbuf(struct midi_rx *midi, const uint8_t * buf, size_t n, uint32_t t, float dt) {
 	for (size_t i = 0; i < n; i++) {
 		uint8_t c = buf[i];
+		midi->time = t + (uint32_t) ((float)i * dt);
 		if (c & 0x80) {
 			// status byte
 			// any non-realtime status byte will end the sysex mode
@@ -291,7 +381,7 @@ static void midi_rxbuf(struct midi_rx *midi, uint8_t * buf, size_t n) {
 				break;
 			case MIDI_RX_1OF1:
 				midi->arg0 = c;
-				midi->func(midi);
+				midi_post(midi);
 				midi->state = (midi->status) ? MIDI_RX_1OF1 : MIDI_RX_NULL;
 				break;
 			case MIDI_RX_1OF2:
@@ -300,7 +390,7 @@ static void midi_rxbuf(struct midi_rx *midi, uint8_t * buf, size_t n) {
 				break;
 			case MIDI_RX_2OF2:
 				midi->arg1 = c;
-				midi->func(midi);
+				midi_post(midi);
 				midi->state = (midi->status) ? MIDI_RX_1OF2 : MIDI_RX_NULL;
 				break;
 			case MIDI_RX_SYSEX:
@@ -317,8 +407,63 @@ static void midi_rxbuf(struct midi_rx *midi, uint8_t * buf, size_t n) {
 
 //-----------------------------------------------------------------------------
 
+// The serial rx line has gone idle.
+// time is the rx time, idx is the rx dma write index.
+void midi_rx_idle(struct midi_rx *midi, uint32_t time, uint32_t idx) {
+	midi->idle_time = time;
+	midi->idle_idx = idx;
+}
+
+// initialise the midi receiver
+void midi_rx_init(struct midi_rx *midi, struct pmsynth *s, uint32_t latency) {
+	midi->pmsynth = s;
+	midi->latency = latency;
+	midi->idle_idx = MIDI_IDLE_NONE;
+}
+
+// change the rx to render latency (in samples)
+// Called from the main loop with the renderer held off. The queued messages
+// keep their rx time.
+void midi_rx_latency(struct midi_rx *midi, uint32_t latency) {
+	for (uint32_t rd = midi->q_rd; rd != midi->q_wr; rd++) {
+		midi->queue[rd & (MIDI_QUEUE_SIZE - 1)].time += latency - midi->latency;
+	}
+	midi->latency = latency;
+}
+
 // Receive midi messages from a serial port.
 void midi_rx_serial(struct midi_rx *midi, struct usart_drv *serial) {
+	uint32_t now = audio_time(midi->pmsynth->audio);
+	if (serial->rx_dma_buf) {
+		// dma rx mode: parse the bytes in place
+		// The bytes are assumed to arrive back to back, with the last byte
+		// just received, or one byte time before the rx line went idle.
+		float dt = audio_fs * MIDI_BYTE_TIME;
+		size_t wr = usart_rx_dma_wr(serial);
+		size_t level = (wr - serial->rx_dma_rd) & (serial->rx_dma_size - 1);
+		if (level == 0) {
+			return;
+		}
+		uint32_t t = now;
+		if (wr == midi->idle_idx && (int32_t) (now - midi->idle_time) >= 0) {
+			t = midi->idle_time - (uint32_t) dt;
+			midi->idle_idx = MIDI_IDLE_NONE;
+		}
+		// time of the first byte
+		t -= (uint32_t) ((float)(level - 1) * dt);
+		while (level != 0) {
+			const uint8_t *buf;
+			size_t n = usart_rx_dma_peek(serial, &buf);
+			if (n > level) {
+				n = level;
+			}
+			midi_rxbuf(midi, buf, n, t, dt);
+			usart_rx_dma_consume(serial, n);
+			t += (uint32_t) ((float)n * dt);
+			level -= n;
+		}
+		return;
+	}
 	// Use a buffer size large enough to get all serial bytes in a single read.
 	// At the standard MIDI baud rate that's about 3 bytes/ms.
 	uint8_t buf[16];
@@ -328,7 +473,7 @@ void midi_rx_serial(struct midi_rx *midi, struct usart_drv *serial) {
 		n = usart_rxbuf(serial, buf, sizeof(buf));
 		if (n != 0) {
 			// write the buffer to the midi receiver
-			midi_rxbuf(midi, buf, n);
+			midi_rxbuf(midi, buf, n, now, 0.f);
 		}
 	} while (n == sizeof(buf));
 }
@@ -0,0 +1,203 @@
+//-----------------------------------------------------------------------------
+/*
+
+Modal Resonator Bank
+
+A struck plate, membrane or bar is a sum of decaying modes. Each mode is a
+two pole resonator
+
+  y(n) = b * x(n) + a1 * y(n-1) - a2 * y(n-2)
+
+with a1 = 2 * r * cos(w), a2 = r * r. The modes come from a table of
+frequency ratios, decay times and gains relative to the note (see
+modal_sets.c, and modes/mesh2modal for the 2d mesh tables). b is the gain * sin(w), so each
+mode rings with an amplitude of gain for a unit impulse at any pitch (before
+the level scaling).
+
+The state is stored as arrays across the modes. The modes are run in groups
+of MODAL_LANES over the whole block, with the group state in registers. The
+lanes of a group are independent, so the host compiler updates a group with
+one set of vector instructions. The M4 has no float vectors and runs pairs,
+which halves the output loads and stores and hides the multiply latency.
+Unused lanes have zero coefficients and stay silent.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include <math.h>
+#include <string.h>
+
+#include "pmsynth.h"
+#include "utils.h"
+
+#define DEBUG
+#include "logging.h"
+
+//-----------------------------------------------------------------------------
+
+// modes above this are dropped (radians per sample)
+#define MODAL_W_MAX (0.9f * PI)
+
+// exciter sample scaling
+#define MODAL_IN_SCALE 0.5f
+
+//-----------------------------------------------------------------------------
+
+// set the resonator coefficients for the current mode set, frequency and decay
+static void modal_tune(struct modal *m) {
+	const struct modal_set *set = m->set;
+	int n = 0;
+	if (set) {
+		// log of the amplitude decay per sample at the note frequency
+		float d = m->freq * audio_ts * logf(m->attenuate);
+		// The exciter samples are quieter at higher frequencies, the gain
+		// rises with the pitch to even out the level (as the 2d mesh does).
+		float k = MODAL_IN_SCALE * sin_eval(TAU * m->freq * audio_ts);
+		for (n = 0; n < set->n && n < MODAL_MAX; n++) {
+			const struct modal_mode *mm = &set->mode[n];
+			// the modes are in frequency order
+			float w = TAU * m->freq * mm->ratio * audio_ts;
+			if (w >= MODAL_W_MAX) {
+				break;
+			}
+			// cos(w) = 1 - 2 * sin^2(w / 2) is more accurate for low modes
+			float s = sin_eval(0.5f * w);
+			// damping shortens the decay of the upper modes by ratio^damping
+			float r = expf(d * powf(mm->ratio, m->damping) / mm->decay);
+			m->a1[n] = 2.f * r * (1.f - 2.f * s * s);
+			m->a2[n] = r * r;
+			m->b[n] = k * mm->gain * sin_eval(w);
+		}
+	}
+	m->n = n;
+	// clear the modes that aren't running
+	for (int j = n; j < MODAL_MAX; j++) {
+		m->y1[j] = 0.f;
+		m->y2[j] = 0.f;
+		m->a1[j] = 0.f;
+		m->a2[j] = 0.f;
+		m->b[j] = 0.f;
+	}
+}
+
+// return the number of modes to run, rounded up to the lanes
+static int modal_active(struct modal *m) {
+	// LOD_LOW only runs the lower half of the modes
+	int n = (m->lod == LOD_LOW) ? (m->n + 1) >> 1 : m->n;
+	return (n + MODAL_LANES - 1) & ~(MODAL_LANES - 1);
+}
+
+//-----------------------------------------------------------------------------
+
+// Run a group of modes starting at mode j and add them to the output.
+// x is the exciter (or NULL), the calls are inlined for each case.
+static inline void modal_group(struct modal *m, int j, const float *x, float *out, size_t n) {
+	float y1[MODAL_LANES], y2[MODAL_LANES];
+	float a1[MODAL_LANES], a2[MODAL_LANES], b[MODAL_LANES];
+	for (int k = 0; k < MODAL_LANES; k++) {
+		y1[k] = m->y1[j + k];
+		y2[k] = m->y2[j + k];
+		a1[k] = m->a1[j + k];
+		a2[k] = m->a2[j + k];
+		b[k] = m->b[j + k];
+	}
+	for (size_t i = 0; i < n; i++) {
+		float y[MODAL_LANES];
+		for (int k = 0; k < MODAL_LANES; k++) {
+			y[k] = a1[k] * y1[k] - a2[k] * y2[k];
+			if (x) {
+				y[k] += b[k] * x[i];
+			}
+			y2[k] = y1[k];
+			y1[k] = y[k];
+		}
+		float sum = 0.f;
+		for (int k = 0; k < MODAL_LANES; k++) {
+			sum += y[k];
+		}
+		out[i] += sum;
+	}
+	for (int k = 0; k < MODAL_LANES; k++) {
+		m->y1[j + k] = y1[k];
+		m->y2[j + k] = y2[k];
+	}
+}
+
+void modal_gen(struct modal *m, float *out, size_t n) {
+	int nm = modal_active(m);
+	memset(out, 0, n * sizeof(float));
+	if (m->estate == 1) {
+		// mallet hit
+		float x[n];
+		for (size_t i = 0; i < n; i++) {
+			x[i] = (m->estate == 1) ? m->vel * impulse_lookup(m->epos, m->impulse, &m->epos, &m->estate) : 0.f;
+		}
+		for (int j = 0; j < nm; j += MODAL_LANES) {
+			modal_group(m, j, x, out, n);
+		}
+	} else {
+		for (int j = 0; j < nm; j += MODAL_LANES) {
+			modal_group(m, j, NULL, out, n);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void modal_ctrl_lod(struct modal *m, int lod) {
+	if (lod == m->lod) {
+		return;
+	}
+	m->lod = lod;
+	if (lod == LOD_LOW) {
+		// the upper modes stop, so they restart from silence
+		for (int j = modal_active(m); j < MODAL_MAX; j++) {
+			m->y1[j] = 0.f;
+			m->y2[j] = 0.f;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void modal_pluck(struct modal *m) {
+	// sets a flag for modal_gen to begin adding the exciter sample
+	m->estate = 1;
+	m->epos = 0;
+}
+
+void modal_set_velocity(struct modal *m, float vel) {
+	m->vel = vel;
+}
+
+//-----------------------------------------------------------------------------
+
+void modal_ctrl_set(struct modal *m, const struct modal_set *set) {
+	m->set = set;
+	modal_tune(m);
+}
+
+// attenuate is the decay per period of the note (0..1]
+void modal_ctrl_attenuate(struct modal *m, float attenuate) {
+	m->attenuate = clampf(attenuate, 0.01f, 1.f);
+	modal_tune(m);
+}
+
+// damping is 0 (the mode set decays) to 1 (decay / ratio)
+void modal_ctrl_damping(struct modal *m, float damping) {
+	m->damping = damping;
+	modal_tune(m);
+}
+
+void modal_ctrl_frequency(struct modal *m, float freq) {
+	m->freq = freq;
+	modal_tune(m);
+}
+
+void modal_init(struct modal *m) {
+	memset(m, 0, sizeof(struct modal));
+	m->attenuate = 0.99f;
+	m->vel = 1.f;
+}
+
+//-----------------------------------------------------------------------------
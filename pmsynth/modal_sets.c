@@ -0,0 +1,91 @@
+//-----------------------------------------------------------------------------
+/*
+
+Modal Resonator Mode Sets
+
+Frequency ratio, decay time ratio and gain for each mode, relative to the
+note (see modal.c). The 2d mesh sets are generated in mesh_modes.c.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "pmsynth.h"
+
+//-----------------------------------------------------------------------------
+// Uniform bar, free at both ends (glockenspiel, vibraphone without tuning).
+// The ratios are (b(n) / b(1))^2 where cos(b) * cosh(b) = 1. Struck near the
+// middle (0.45) and picked up near the end (0.1), the gains are the product
+// of the mode shapes / ratio. The upper modes decay as 1 / sqrt(ratio).
+
+static const struct modal_mode bar_modes[] = {
+	{1.0000f, 1.000f, 1.000f},
+	{2.7565f, 0.602f, 0.069f},
+	{5.4039f, 0.430f, 0.019f},
+	{8.9330f, 0.335f, 0.048f},
+	{13.3443f, 0.274f, -0.053f},
+	{18.6379f, 0.232f, -0.062f},
+	{24.8138f, 0.201f, 0.023f},
+	{31.8719f, 0.177f, 0.044f},
+	{39.8123f, 0.158f, -0.002f},
+	{48.6350f, 0.143f, -0.018f},
+	{58.3399f, 0.131f, -0.002f},
+	{80.3966f, 0.112f, -0.003f},
+	{92.7483f, 0.104f, 0.008f},
+	{105.9823f, 0.097f, 0.009f},
+	{120.0986f, 0.091f, -0.007f},
+};
+
+const struct modal_set modal_bar = {15, bar_modes};
+
+//-----------------------------------------------------------------------------
+// Church bell, tuned so the nominal is the note (the strike note is heard
+// near the nominal). The partials are hum, prime, tierce, quint, nominal,
+// deciem, undeciem, duodeciem, upper octave and above (Rossing, The Science
+// of Sound). The hum and prime ring on after the strike has gone. The gains
+// are scaled for about the same level as the bar.
+
+static const struct modal_mode bell_modes[] = {
+	{0.2500f, 3.000f, 0.180f},	// hum
+	{0.5000f, 2.000f, 0.150f},	// prime
+	{0.5915f, 1.600f, 0.240f},	// tierce
+	{0.7530f, 1.300f, 0.120f},	// quint
+	{1.0000f, 1.000f, 0.300f},	// nominal
+	{1.2570f, 0.800f, 0.135f},	// deciem
+	{1.3310f, 0.750f, 0.120f},	// undeciem
+	{1.5055f, 0.600f, 0.105f},	// duodeciem
+	{2.0830f, 0.500f, 0.090f},	// upper octave
+	{2.7165f, 0.400f, 0.060f},
+	{3.3980f, 0.350f, 0.045f},
+	{4.1075f, 0.300f, 0.030f},
+};
+
+const struct modal_set modal_bell = {12, bell_modes};
+
+//-----------------------------------------------------------------------------
+// Thin square plate, simply supported (the analytic form of the "square
+// plate" banded waveguides). The modes are at (m^2 + n^2) / 2, the (m, n)
+// and (n, m) pairs are merged. Struck at (0.31, 0.23) and picked up at
+// (0.62, 0.71). The upper modes decay as 1 / sqrt(ratio).
+
+static const struct modal_mode square_plate_modes[] = {
+	{1.0000f, 1.000f, 0.938f},
+	{2.5000f, 0.632f, -1.000f},
+	{4.0000f, 0.500f, 0.357f},
+	{5.0000f, 0.447f, 0.095f},
+	{6.5000f, 0.392f, -0.043f},
+	{8.5000f, 0.343f, -0.073f},
+	{9.0000f, 0.333f, -0.008f},
+	{10.0000f, 0.316f, 0.135f},
+	{12.5000f, 0.283f, -0.044f},
+	{13.0000f, 0.277f, 0.091f},
+	{14.5000f, 0.263f, -0.093f},
+	{16.0000f, 0.250f, -0.012f},
+	{17.0000f, 0.243f, 0.008f},
+	{18.5000f, 0.232f, -0.044f},
+	{20.0000f, 0.224f, 0.014f},
+	{20.5000f, 0.221f, -0.031f},
+};
+
+const struct modal_set modal_square_plate = {16, square_plate_modes};
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,188 @@
+//-----------------------------------------------------------------------------
+/*
+
+Patch Parameters
+
+A knob sweep sends a stream of control changes, often several per block.
+Updating the voices for each one is wasteful (some updates, like the adsr
+coefficients, are expensive) so the control change just records the value.
+The renderer applies the latest values once per block.
+
+Smoothed parameters don't jump to the new value. They ramp linearly towards
+it, one step per block, which avoids the zipper noise from a coarse midi
+control. The voice updates for a ramp run every "interval" blocks (and at
+the end of the ramp) so a parameter with an expensive update can move
+smoothly without re-deriving everything on every block.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "pmsynth.h"
+
+//-----------------------------------------------------------------------------
+
+// map a control value onto the parameter range
+static float param_map(const struct param *pr, uint16_t val) {
+	if (pr->curve == PARAM_BEND) {
+		return midi_pitch_bend(val);
+	}
+	float x = midi_map(val, pr->a, pr->b);
+	if (pr->curve == PARAM_LOG) {
+		x = logmap(x);
+	}
+	return x;
+}
+
+//-----------------------------------------------------------------------------
+// global parameters
+
+// output filter cutoff
+void param_set_cutoff(struct patch *p, float x) {
+	svf2_ctrl_cutoff(&p->pmsynth->opf, x);
+}
+
+// output filter resonance
+void param_set_resonance(struct patch *p, float x) {
+	svf2_ctrl_resonance(&p->pmsynth->opf, x);
+}
+
+//-----------------------------------------------------------------------------
+
+// record a new value for a control, return !=0 if the patch has the parameter
+// A control may drive more than one parameter.
+static int param_set(struct patch *p, uint8_t ctrl, uint16_t val) {
+	const struct param *pr = p->ops->params;
+	int found = 0;
+	if (pr == NULL) {
+		return 0;
+	}
+	for (int i = 0; i < PARAM_MAX && pr[i].ctrl != 0xff; i++) {
+		if (pr[i].ctrl == ctrl) {
+			p->param_val[i] = val;
+			p->dirty |= (1U << i);
+			found = 1;
+		}
+	}
+	return found;
+}
+
+// record a control change
+int param_control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
+	return param_set(p, ctrl, val);
+}
+
+// record a pitch wheel change
+int param_pitch_wheel(struct patch *p, uint16_t val) {
+	return param_set(p, PARAM_PITCH_WHEEL, val);
+}
+
+//-----------------------------------------------------------------------------
+
+// add a voice update function to the set (if it isn't there)
+static int param_add_update(void (**update) (struct voice *), int n, void (*func) (struct voice *)) {
+	if (func == NULL) {
+		return n;
+	}
+	for (int k = 0; k < n; k++) {
+		if (update[k] == func) {
+			return n;
+		}
+	}
+	update[n] = func;
+	return n + 1;
+}
+
+// apply the parameter changes for a patch
+static void param_apply_patch(struct pmsynth *s, struct patch *p) {
+	const struct param *pr = p->ops->params;
+	uint32_t dirty = p->dirty;
+	void (*update[PARAM_MAX]) (struct voice *);
+	int n = 0;
+
+	p->dirty = 0;
+	p->blocks += 1;
+
+	// new values: set the target, then jump or start a ramp
+	for (int j = 0; dirty != 0; j++, dirty >>= 1) {
+		if ((dirty & 1) == 0) {
+			continue;
+		}
+		float x = param_map(&pr[j], p->param_val[j]);
+		if (pr[j].ramp && pr[j].ofs >= 0) {
+			p->param_target[j] = x;
+			p->param_ramp[j] = pr[j].ramp;
+			p->ramping |= (1U << j);
+			continue;
+		}
+		if (pr[j].ofs >= 0) {
+			*(float *)&p->state[pr[j].ofs] = x;
+		}
+		if (pr[j].set) {
+			pr[j].set(p, x);
+		}
+		n = param_add_update(update, n, pr[j].update);
+	}
+
+	// step the ramps
+	uint32_t ramping = p->ramping;
+	for (int j = 0; ramping != 0; j++, ramping >>= 1) {
+		if ((ramping & 1) == 0) {
+			continue;
+		}
+		float *x = (float *)&p->state[pr[j].ofs];
+		int k = p->param_ramp[j];
+		*x += (p->param_target[j] - *x) / (float)k;
+		p->param_ramp[j] = --k;
+		if (k == 0) {
+			*x = p->param_target[j];
+			p->ramping &= ~(1U << j);
+		} else if (pr[j].interval > 1 && (p->blocks % pr[j].interval) != 0) {
+			// not due for an update
+			continue;
+		}
+		if (pr[j].set) {
+			pr[j].set(p, *x);
+		}
+		n = param_add_update(update, n, pr[j].update);
+	}
+
+	if (n == 0) {
+		return;
+	}
+	// update the voices using this patch
+	for (int j = 0; j < NUM_VOICES; j++) {
+		struct voice *v = &s->voices[j];
+		if (v->patch == p) {
+			for (int k = 0; k < n; k++) {
+				update[k](v);
+			}
+		}
+	}
+}
+
+// Re-derive the patch level state from the current parameter values.
+// Called after the patch init, and when the sample rate changes.
+void param_refresh(struct patch *p) {
+	const struct param *pr = p->ops->params;
+	if (pr == NULL) {
+		return;
+	}
+	for (int i = 0; i < PARAM_MAX && pr[i].ctrl != 0xff; i++) {
+		if (pr[i].set && pr[i].ofs >= 0) {
+			pr[i].set(p, *(float *)&p->state[pr[i].ofs]);
+		}
+	}
+}
+
+// apply the changed and ramping parameters for all patches
+// This is called once per block by the renderer.
+void param_apply(struct pmsynth *s) {
+	for (int i = 0; i < NUM_CHANNELS; i++) {
+		struct patch *p = &s->patches[i];
+		if (p->dirty | p->ramping) {
+			param_apply_patch(s, p);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
@@ -41,11 +41,29 @@ struct p_state {
 	int impulse_type;
 	int impulse_solo;
 	int resonator_type;
+	int retrigger;		// strike ringing voices in place
+	struct adsr env;	// envelope constants for new voices
+	struct pan gain;	// pan gains for new voices
 };
 
 _Static_assert(sizeof(struct v_state) <= VOICE_STATE_SIZE, "sizeof(struct v_state) > VOICE_STATE_SIZE");
 _Static_assert(sizeof(struct p_state) <= PATCH_STATE_SIZE, "sizeof(struct p_state) > PATCH_STATE_SIZE");
 
+//-----------------------------------------------------------------------------
+// patch level updates
+// The envelope and pan constants are derived once for the patch and copied
+// into the voices.
+
+static void set_adsr(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	adsr_update(&ps->env, ps->a, ps->d, ps->s, ps->r);
+}
+
+static void set_pan(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	pan_ctrl(&ps->gain, ps->vol, ps->pan);
+}
+
 //-----------------------------------------------------------------------------
 // control functions
 #define FREQ_OFFSET_ADJUST 0.25f
@@ -71,13 +89,13 @@ static void ctrl_attenuate(struct voice *v) {
 static void ctrl_pan(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	pan_ctrl(&vs->pan, ps->vol, ps->pan);
+	vs->pan = ps->gain;
 }
 
 static void ctrl_adsr(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	adsr_update(&vs->wgb.adsr, ps->a, ps->d, ps->s, ps->r);
+	adsr_copy(&vs->wgb.adsr, &ps->env);
 }
 
 static void ctrl_mode_mix_amt(struct voice *v) {
@@ -121,50 +139,53 @@ static void ctrl_resonator_type(struct voice *v) {
 
 // start the patch
 static void start(struct voice *v) {
-	DBG("p10 start v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	memset(vs, 0, sizeof(struct v_state));
-
-	adsr_init(&vs->wgb.adsr, ps->a, ps->d, ps->s, ps->r);
+	// wgb_init clears the model state (note_on sets the tuning and excitation)
 	wgb_init(&vs->wgb);
-	pan_init(&vs->pan);
+	// the delay lines have room for the pitch wheel
+	wgb_alloc(&vs->wgb, midi_to_frequency((float)v->note - MIDI_BEND_RANGE + FREQ_OFFSET_ADJUST));
+	vs->wgb.adsr = ps->env;
+	vs->pan = ps->gain;
 
-	ctrl_brightness(v);
-	ctrl_harm_coef(v);
-	ctrl_frequency(v);
 	ctrl_attenuate(v);
 	ctrl_mode_mix_amt(v);
-	ctrl_pan(v);
-	ctrl_reflection(v);
-	ctrl_impulse_solo(v);
-	ctrl_impulse_type(v);
-	
-
 }
 
 // stop the patch
 static void stop(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
-	DBG("p10 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	//DBG("p10 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	adsr_idle(&vs->wgb.adsr);
+	wgb_stop(&vs->wgb);
 }
 
 // note on
 static void note_on(struct voice *v, uint8_t vel) {
 	//DBG("p10 note on v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
-	//struct p_state *ps = (struct p_state *)v->patch->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	// restart a voice that went quiet
+	if (vs->wgb.mode[0].delay == NULL) {
+		start(v);
+	}
 	gpio_set(IO_LED_AMBER);
-	adsr_attack(&vs->wgb.adsr);
+	// a repeated note re-strikes the ringing bar
+	vs->wgb.retrigger = ps->retrigger;
+	if (ps->retrigger && adsr_is_active(&vs->wgb.adsr)) {
+		adsr_retrigger(&vs->wgb.adsr);
+	} else {
+		adsr_attack(&vs->wgb.adsr);
+	}
 	wgb_set_velocity(&vs->wgb, (float)vel / 127.f);
 	ctrl_brightness(v);
 	ctrl_impulse_type(v);
 	ctrl_impulse_solo(v);
 	ctrl_harm_coef(v);
-	ctrl_frequency(v);
-	ctrl_reflection(v);
 	ctrl_resonator_type(v);
+	ctrl_reflection(v);
+	// the mode tuning depends on all of the above
+	ctrl_frequency(v);
 	wgb_pluck(&vs->wgb);
 }
 
@@ -176,15 +197,22 @@ static void note_off(struct voice *v, uint8_t vel) {
 }
 
 // return !=0 if the patch is active
+// (a quiet voice has given its delay lines back)
 static int active(struct voice *v) {
-	return 1;
+	struct v_state *vs = (struct v_state *)v->state;
+	return vs->wgb.mode[0].delay != NULL;
 }
 
 // generate samples
 static void generate(struct voice *v, float *out_l, float *out_r, size_t n) {
 	struct v_state *vs = (struct v_state *)v->state;
 	float out[n];
+	wgb_ctrl_lod(&vs->wgb, voice_lod(v, &vs->wgb.adsr));
 	wgb_gen(&vs->wgb, out, n);
+	// give the delay lines back to the pool once the voice is quiet
+	if (voice_silent(&vs->wgb.adsr, out, n)) {
+		wgb_stop(&vs->wgb);
+	}
 	block_copy(out_l, out, n);
 	block_mul_k(out_l, vs->pan.vol_l, n);
 	//block_copy(out_r, out, n);
@@ -209,6 +237,7 @@ static void init(struct patch *p) {
 	ps->mode_mix_amt = 0.1f;
 	ps->h_coef = 0.f;
 	ps->resonator_type = 3;
+	ps->retrigger = 1;
 }
 
 static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
@@ -218,45 +247,6 @@ static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	DBG("p10 ctrl %d val %d\r\n", ctrl, val);
 
 	switch (ctrl) {
-	case VOLUME_SLIDER:		// volume
-		ps->vol = midi_map(val, 0.f, 1.0f);
-		update = 1;
-		break;
-	case MODWHEEL:		// filter cutoff
-		svf2_ctrl_cutoff(&p->pmsynth->opf, logmap(midi_map(val, 1.0f, 0.0f)));
-		break;
-	case KNOB_1: 		// filter resonance
-		svf2_ctrl_resonance(&p->pmsynth->opf, midi_map(val, 0.f, 0.98f));
-		break;
-	case KNOB_2: // reflection adjust
-		//ps->reflection_adjust = midi_map(val, 0.0f, 0.00001f);
-		ps->brightness = midi_map(val,0.0f, 1.0f);
-		update = 2;
-		break;
-	case KNOB_4: // harmonic mod
-		ps->h_coef = midi_map(val, -1.0f, 1.0f);
-		update = 4;
-		break;
-	case KNOB_3: // mode mixing
-		ps->mode_mix_amt = midi_map(val, 0.0f, 1.0f);
-		update = 3;
-		break;
-	case KNOB_5:
-		ps->a = midi_map(val, 0.0f, 0.5f);
-		update = 7;
-		break;
-	case KNOB_6:
-		ps->d = midi_map(val, 0.02f, 1.f);
-		update = 7;
-		break;
-	case KNOB_7:
-		ps->s = midi_map(val, 0.0f, 1.f);
-		update = 7;
-		break;
-	case KNOB_8:
-		ps->r = midi_map(val, 0.0f, 1.f);
-		update = 7;
-		break;
 	case BUTTON_1:
 		ps->resonator_type = 0;
 		goto_next_patch(p);
@@ -309,38 +299,38 @@ static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	case BUTTON_7: //panic button!
 		stop_voices(p);
 		break;
+	case BUTTON_8: //retrigger in place (toggle)
+		ps->retrigger ^= 1;
+		break;
 	default:
 		break;
 	}
-	if (update == 1) {
-		update_voices(p, ctrl_pan);
-	}
-	if (update == 2) {
-		update_voices(p, ctrl_reflection);
-	}
-	if (update == 3) {
-		update_voices(p, ctrl_mode_mix_amt);
-	}
-	if (update == 4) {
-		update_voices(p, ctrl_harm_coef);
-	}
 	if (update == 6) {
 		update_voices(p, ctrl_resonator_type);
 	}
-	if (update == 7) {
-		update_voices(p, ctrl_adsr);
-	}
 	if (update == 8) {
 		update_voices(p, ctrl_brightness);
 	}
 }
 
-static void pitch_wheel(struct patch *p, uint16_t val) {
-	struct p_state *ps = (struct p_state *)p->state;
-	DBG("p10 pitch %d\r\n", val);
-	ps->bend = midi_pitch_bend(val);
-	update_voices(p, ctrl_frequency);
-}
+//-----------------------------------------------------------------------------
+// parameters
+
+static const struct param params[] = {
+	{VOLUME_SLIDER, PARAM_LINEAR, PARAM_STATE(vol), 0.f, 1.f, set_pan, ctrl_pan, PARAM_RAMP, 2},
+	{MODWHEEL, PARAM_LOG, -1, 1.f, 0.f, param_set_cutoff, NULL, 0, 0},	// filter cutoff
+	{KNOB_1, PARAM_LINEAR, -1, 0.f, 0.98f, param_set_resonance, NULL, 0, 0},	// filter resonance
+	{KNOB_2, PARAM_LINEAR, PARAM_STATE(brightness), 0.f, 1.f, NULL, ctrl_brightness, PARAM_RAMP, 1},
+	{KNOB_3, PARAM_LINEAR, PARAM_STATE(mode_mix_amt), 0.f, 1.f, NULL, ctrl_mode_mix_amt, PARAM_RAMP, 1},
+	{KNOB_4, PARAM_LINEAR, PARAM_STATE(h_coef), -1.f, 1.f, NULL, ctrl_harm_coef, PARAM_RAMP, 1},
+	{KNOB_5, PARAM_LINEAR, PARAM_STATE(a), 0.f, 0.5f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_6, PARAM_LINEAR, PARAM_STATE(d), 0.02f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_7, PARAM_LINEAR, PARAM_STATE(s), 0.f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_8, PARAM_LINEAR, PARAM_STATE(r), 0.f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{PARAM_PITCH_WHEEL, PARAM_BEND, PARAM_STATE(bend), 0.f, 0.f, NULL, ctrl_frequency, PARAM_RAMP, 4},
+	PARAM_END,
+};
+_Static_assert(sizeof(params) / sizeof(params[0]) <= PARAM_MAX + 1, "more than PARAM_MAX params");
 
 //-----------------------------------------------------------------------------
 
@@ -353,7 +343,7 @@ const struct patch_ops patch10 = {
 	.generate = generate,
 	.init = init,
 	.control_change = control_change,
-	.pitch_wheel = pitch_wheel,
+	.params = params,
 };
 
 //-----------------------------------------------------------------------------
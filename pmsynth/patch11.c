@@ -0,0 +1,238 @@
+//-----------------------------------------------------------------------------
+/*
+
+Patch 11
+
+Modal resonator bank (bars, bells and plates)
+
+*/
+//-----------------------------------------------------------------------------
+
+#include <assert.h>
+#include <string.h>
+
+#include "pmsynth.h"
+
+#define DEBUG
+#include "logging.h"
+
+//-----------------------------------------------------------------------------
+
+struct v_state {
+	struct modal modal;
+	struct pan pan;
+};
+
+struct p_state {
+	float vol;		// volume
+	float pan;		// left/right pan
+	float bend;		// pitch bend
+	float attenuate;	// decay per period
+	float damping;		// extra decay of the upper modes
+	int impulse_type;
+	int resonator_type;	// index into presets
+	struct pan gain;	// pan gains for new voices
+};
+
+_Static_assert(sizeof(struct v_state) <= VOICE_STATE_SIZE, "sizeof(struct v_state) > VOICE_STATE_SIZE");
+_Static_assert(sizeof(struct p_state) <= PATCH_STATE_SIZE, "sizeof(struct p_state) > PATCH_STATE_SIZE");
+
+//-----------------------------------------------------------------------------
+// resonator presets
+
+struct modal_preset {
+	const struct modal_set *modes;
+	float attenuate;
+	int display;		// resonator type for the display
+};
+
+static const struct modal_preset presets[] = {
+	{&modal_bar, 0.995f, 9},	// bar
+	{&modal_bell, 0.998f, 10},	// bell
+	{&modal_square_plate, 0.99f, 11},	// square plate
+	{&modal_membrane, 0.93f, 7},	// 2d mesh membrane
+	{&modal_plate, 0.99f, 8},	// 2d mesh plate
+};
+
+#define NUM_PRESETS (sizeof(presets) / sizeof(struct modal_preset))
+
+//-----------------------------------------------------------------------------
+// patch level updates
+
+static void set_pan(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	pan_ctrl(&ps->gain, ps->vol, ps->pan);
+}
+
+//-----------------------------------------------------------------------------
+// control functions
+
+static void ctrl_frequency(struct voice *v) {
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	modal_ctrl_frequency(&vs->modal, midi_to_frequency((float)v->note - ps->bend));
+}
+
+static void ctrl_attenuate(struct voice *v) {
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	modal_ctrl_attenuate(&vs->modal, ps->attenuate);
+}
+
+static void ctrl_damping(struct voice *v) {
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	modal_ctrl_damping(&vs->modal, ps->damping);
+}
+
+static void ctrl_pan(struct voice *v) {
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	vs->pan = ps->gain;
+}
+
+static void ctrl_resonator_type(struct voice *v) {
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	modal_ctrl_set(&vs->modal, presets[ps->resonator_type].modes);
+	ctrl_attenuate(v);
+}
+
+//-----------------------------------------------------------------------------
+// voice operations
+
+// start the patch
+static void start(struct voice *v) {
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	modal_init(&vs->modal);
+	vs->pan = ps->gain;
+
+	ctrl_damping(v);
+	ctrl_resonator_type(v);
+	ctrl_frequency(v);
+}
+
+// stop the patch
+static void stop(struct voice *v) {
+	//DBG("p11 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+}
+
+// note on
+static void note_on(struct voice *v, uint8_t vel) {
+	//DBG("p11 note on v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	gpio_set(IO_LED_AMBER);
+	// a repeated note strikes the ringing modes
+	vs->modal.impulse = ps->impulse_type;
+	modal_set_velocity(&vs->modal, (float)vel / 127.f);
+	modal_pluck(&vs->modal);
+}
+
+// note off
+static void note_off(struct voice *v, uint8_t vel) {
+	gpio_clr(IO_LED_AMBER);
+}
+
+// return !=0 if the patch is active
+static int active(struct voice *v) {
+	return 1;
+}
+
+// generate samples
+static void generate(struct voice *v, float *out_l, float *out_r, size_t n) {
+	struct v_state *vs = (struct v_state *)v->state;
+	float out[n];
+	modal_ctrl_lod(&vs->modal, voice_lod(v, NULL));
+	modal_gen(&vs->modal, out, n);
+	block_copy(out_l, out, n);
+	block_mul_k(out_l, vs->pan.vol_l, n);
+}
+
+//-----------------------------------------------------------------------------
+// global operations
+
+static void init(struct patch *p) {
+	struct p_state *ps = (struct p_state *)p->state;
+	ps->vol = 1.f;
+	ps->pan = 0.5f;
+	ps->bend = 0.f;
+	ps->damping = 0.f;
+	ps->impulse_type = 0;
+	ps->resonator_type = 0;
+	ps->attenuate = presets[0].attenuate;
+}
+
+static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
+	struct p_state *ps = (struct p_state *)p->state;
+	int update = 0;
+
+	DBG("p11 ctrl %d val %d\r\n", ctrl, val);
+
+	switch (ctrl) {
+	case BUTTON_1:
+		goto_next_patch(p);
+		break;
+	case BUTTON_2:		// goto next mode set
+		ps->resonator_type += 1;
+		if (ps->resonator_type >= (int)NUM_PRESETS) {
+			ps->resonator_type = 0;
+		}
+		ps->attenuate = presets[ps->resonator_type].attenuate;
+		current_resonator_type = presets[ps->resonator_type].display;
+		update_resonator();
+		update = 1;
+		break;
+	case BUTTON_3:		// goto next impulse sample
+		ps->impulse_type += 1;
+		if (ps->impulse_type > NUM_IMPULSES) {
+			ps->impulse_type = 0;
+		}
+		break;
+	case BUTTON_4:		// goto previous impulse sample
+		ps->impulse_type -= 1;
+		if (ps->impulse_type < 0) {
+			ps->impulse_type = NUM_IMPULSES;
+		}
+		break;
+	case BUTTON_7:		// panic button!
+		stop_voices(p);
+		break;
+	default:
+		break;
+	}
+	if (update == 1) {
+		update_voices(p, ctrl_resonator_type);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// parameters
+
+static const struct param params[] = {
+	{VOLUME_SLIDER, PARAM_LINEAR, PARAM_STATE(vol), 0.f, 1.f, set_pan, ctrl_pan, PARAM_RAMP, 2},
+	{MODWHEEL, PARAM_LOG, -1, 1.f, 0.f, param_set_cutoff, NULL, 0, 0},	// filter cutoff
+	{KNOB_1, PARAM_LINEAR, -1, 0.f, 0.98f, param_set_resonance, NULL, 0, 0},	// filter resonance
+	{KNOB_2, PARAM_LINEAR, PARAM_STATE(attenuate), 0.9f, 1.f, NULL, ctrl_attenuate, PARAM_RAMP, 2},
+	{KNOB_3, PARAM_LINEAR, PARAM_STATE(damping), 0.f, 1.f, NULL, ctrl_damping, PARAM_RAMP, 2},
+	{PARAM_PITCH_WHEEL, PARAM_BEND, PARAM_STATE(bend), 0.f, 0.f, NULL, ctrl_frequency, PARAM_RAMP, 4},
+	PARAM_END,
+};
+_Static_assert(sizeof(params) / sizeof(params[0]) <= PARAM_MAX + 1, "more than PARAM_MAX params");
+
+//-----------------------------------------------------------------------------
+
+const struct patch_ops patch11 = {
+	.start = start,
+	.stop = stop,
+	.note_on = note_on,
+	.note_off = note_off,
+	.active = active,
+	.generate = generate,
+	.init = init,
+	.control_change = control_change,
+	.params = params,
+};
+
+//-----------------------------------------------------------------------------
@@ -5,6 +5,8 @@ Patch 2
 
 Karplus Strong Testing
 
+The delay line is sized for the note (see ksv in ks.c).
+
 */
 //-----------------------------------------------------------------------------
 
@@ -20,7 +22,7 @@ Karplus Strong Testing
 //-----------------------------------------------------------------------------
 
 struct v_state {
-	struct ks ks;
+	struct ksv ks;
 	struct pan pan;
 };
 
@@ -33,36 +35,53 @@ struct p_state {
 	float d;
 	float s;
 	float r;
+	struct adsr env;	// envelope constants for new voices
+	struct pan gain;	// pan gains for new voices
 };
 
 _Static_assert(sizeof(struct v_state) <= VOICE_STATE_SIZE, "sizeof(struct v_state) > VOICE_STATE_SIZE");
 _Static_assert(sizeof(struct p_state) <= PATCH_STATE_SIZE, "sizeof(struct p_state) > PATCH_STATE_SIZE");
 
+//-----------------------------------------------------------------------------
+// patch level updates
+// The envelope and pan constants are derived once for the patch and copied
+// into the voices.
+
+static void set_adsr(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	adsr_update(&ps->env, ps->a, ps->d, ps->s, ps->r);
+}
+
+static void set_pan(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	pan_ctrl(&ps->gain, ps->vol, ps->pan);
+}
+
 //-----------------------------------------------------------------------------
 // control functions
 
 static void ctrl_frequency(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	ks_ctrl_frequency(&vs->ks, midi_to_frequency((float)v->note - ps->bend));
+	ksv_ctrl_frequency(&vs->ks, midi_to_frequency((float)v->note - ps->bend));
 }
 
 static void ctrl_attenuate(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	ks_ctrl_attenuate(&vs->ks, ps->attenuate);
+	ksv_ctrl_attenuate(&vs->ks, ps->attenuate);
 }
 
 static void ctrl_pan(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	pan_ctrl(&vs->pan, ps->vol, ps->pan);
+	vs->pan = ps->gain;
 }
 
 static void ctrl_adsr(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	adsr_update(&vs->ks.adsr, ps->a, ps->d, ps->s, ps->r);
+	adsr_copy(&vs->ks.adsr, &ps->env);
 }
 
 //-----------------------------------------------------------------------------
@@ -70,35 +89,39 @@ static void ctrl_adsr(struct voice *v) {
 
 // start the patch
 static void start(struct voice *v) {
-	DBG("p2 start v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
-	memset(vs, 0, sizeof(struct v_state));
 	struct p_state *ps = (struct p_state *)v->patch->state;
-
-	adsr_init(&vs->ks.adsr, ps->a, ps->d, ps->s, ps->r);
-	ks_init(&vs->ks);
-	pan_init(&vs->pan);
+	// the delay line is filled by the pluck
+	ksv_init(&vs->ks);
+	// it has room for the pitch wheel
+	ksv_alloc(&vs->ks, midi_to_frequency((float)v->note - MIDI_BEND_RANGE));
+	vs->ks.adsr = ps->env;
+	vs->pan = ps->gain;
 
 	ctrl_frequency(v);
 	ctrl_attenuate(v);
-	ctrl_pan(v);
 
 }
 
 // stop the patch
 static void stop(struct voice *v) {
-	DBG("p2 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	//DBG("p2 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
 	adsr_idle(&vs->ks.adsr);
+	ksv_stop(&vs->ks);
 }
 
 // note on
 static void note_on(struct voice *v, uint8_t vel) {
 	struct v_state *vs = (struct v_state *)v->state;
 	//DBG("p2 note on v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	// restart a voice that went quiet
+	if (vs->ks.delay == NULL) {
+		start(v);
+	}
 	gpio_set(IO_LED_AMBER);
 	adsr_attack(&vs->ks.adsr);
-	ks_pluck(&vs->ks);
+	ksv_pluck(&vs->ks);
 }
 
 // note off
@@ -109,15 +132,21 @@ static void note_off(struct voice *v, uint8_t vel) {
 }
 
 // return !=0 if the patch is active
+// (a quiet voice has given its delay lines back)
 static int active(struct voice *v) {
-	return 1;
+	struct v_state *vs = (struct v_state *)v->state;
+	return vs->ks.delay != NULL;
 }
 
 // generate samples
 static void generate(struct voice *v, float *out_l, float *out_r, size_t n) {
 	struct v_state *vs = (struct v_state *)v->state;
 	float out[n];
-	ks_gen(&vs->ks, out, n);
+	ksv_gen(&vs->ks, out, n);
+	// give the delay lines back to the pool once the voice is quiet
+	if (voice_silent(&vs->ks.adsr, out, n)) {
+		ksv_stop(&vs->ks);
+	}
 	pan_gen(&vs->pan, out_l, out_r, out, n);
 }
 
@@ -137,45 +166,12 @@ static void init(struct patch *p) {
 }
 
 static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
-	struct p_state *ps = (struct p_state *)p->state;
-	int update = 0;
-
 	DBG("p2 ctrl %d val %d\r\n", ctrl, val);
 
 	switch (ctrl) {
-	case VOLUME_SLIDER:		// volume
-		ps->vol = midi_map(val, 0.f, 1.0f);
-		update = 1;
-		break;
-	case MODWHEEL:		// filter cutoff
-		svf2_ctrl_cutoff(&p->pmsynth->opf, logmap(midi_map(val, 1.0f, 0.0f)));
-		break;
-	case KNOB_1: 		// filter resonance
-		svf2_ctrl_resonance(&p->pmsynth->opf, midi_map(val, 0.f, 0.98f));
-		break;
-	case KNOB_2:
-		ps->attenuate = midi_map(val, 0.87f, 1.f);
-		update = 2;
-		break;
 	case 97:
 		goto_next_patch(p);
 		break;
-	case KNOB_5:
-		ps->a = midi_map(val, 0.0f, 0.5f);
-		update = 7;
-		break;
-	case KNOB_6:
-		ps->d = midi_map(val, 0.02f, 1.f);
-		update = 7;
-		break;
-	case KNOB_7:
-		ps->s = midi_map(val, 0.0f, 1.f);
-		update = 7;
-		break;
-	case KNOB_8:
-		ps->r = midi_map(val, 0.0f, 1.f);
-		update = 7;
-		break;
 	case BUTTON_6: //play demo song
 		switch(p->pmsynth->seq0.m0.s_state){
 			case 0:
@@ -195,23 +191,24 @@ static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	default:
 		break;
 	}
-	if (update == 1) {
-		update_voices(p, ctrl_pan);
-	}
-	if (update == 2) {
-		update_voices(p, ctrl_attenuate);
-	}
-	if (update == 7) {
-		update_voices(p, ctrl_adsr);
-	}
 }
 
-static void pitch_wheel(struct patch *p, uint16_t val) {
-	struct p_state *ps = (struct p_state *)p->state;
-	DBG("p2 pitch %d\r\n", val);
-	ps->bend = midi_pitch_bend(val);
-	update_voices(p, ctrl_frequency);
-}
+//-----------------------------------------------------------------------------
+// parameters
+
+static const struct param params[] = {
+	{VOLUME_SLIDER, PARAM_LINEAR, PARAM_STATE(vol), 0.f, 1.f, set_pan, ctrl_pan, PARAM_RAMP, 2},
+	{MODWHEEL, PARAM_LOG, -1, 1.f, 0.f, param_set_cutoff, NULL, 0, 0},	// filter cutoff
+	{KNOB_1, PARAM_LINEAR, -1, 0.f, 0.98f, param_set_resonance, NULL, 0, 0},	// filter resonance
+	{KNOB_2, PARAM_LINEAR, PARAM_STATE(attenuate), 0.87f, 1.f, NULL, ctrl_attenuate, PARAM_RAMP, 1},
+	{KNOB_5, PARAM_LINEAR, PARAM_STATE(a), 0.f, 0.5f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_6, PARAM_LINEAR, PARAM_STATE(d), 0.02f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_7, PARAM_LINEAR, PARAM_STATE(s), 0.f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_8, PARAM_LINEAR, PARAM_STATE(r), 0.f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{PARAM_PITCH_WHEEL, PARAM_BEND, PARAM_STATE(bend), 0.f, 0.f, NULL, ctrl_frequency, PARAM_RAMP, 1},
+	PARAM_END,
+};
+_Static_assert(sizeof(params) / sizeof(params[0]) <= PARAM_MAX + 1, "more than PARAM_MAX params");
 
 //-----------------------------------------------------------------------------
 
@@ -224,7 +221,7 @@ const struct patch_ops patch2 = {
 	.generate = generate,
 	.init = init,
 	.control_change = control_change,
-	.pitch_wheel = pitch_wheel,
+	.params = params,
 };
 
 //-----------------------------------------------------------------------------
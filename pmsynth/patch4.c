@@ -7,6 +7,7 @@ Goom Voice - using the original code
 //-----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <math.h>
 #include <string.h>
 
 #include "pmsynth.h"
@@ -20,7 +21,10 @@ Goom Voice - using the original code
 // k = math.log(fs/(440.0*math.pow(2.0,-0.75))/128.0)/math.log(2.0)*4096.0
 // fs = 72e6 / 2048 = 35156.25 Hz -> k = 287 (goom original)
 // fs = 44099.507 Hz -> k = 1627
-#define TUNING_K 1627
+// It's derived when the sample rate changes and kept in the patch state.
+static int tuning_k(void) {
+	return (int)(log2f(audio_fs * (1.f / (440.f * 0.59460356f * 128.f))) * 4096.f + 0.5f);
+}
 
 //-----------------------------------------------------------------------------
 
@@ -75,6 +79,7 @@ struct p_state {
 	unsigned char ctrl[24];	// 7-bit control values
 	unsigned char sus;	// sustain pedal position
 	short pbend;		// pitch bend position
+	int tuning_k;		// tuning for the sample rate (see tuning_k)
 };
 
 _Static_assert(sizeof(struct v_state) <= VOICE_STATE_SIZE, "sizeof(struct v_state) > VOICE_STATE_SIZE");
@@ -275,7 +280,7 @@ static void setfreqvol(struct voice *v, unsigned char *ct) {
 	// oscillator 0 frequency
 	u = ((vs->note & 0x7f) << 12) / 12;	// pitch of note, Q12 in octaves, middle C =5
 	u += ps->pbend / 12;	// gives +/- 2 semitones
-	u -= TUNING_K;
+	u -= ps->tuning_k;
 	f = (exptab0[(u & 0xfc0) >> 6] * exptab1[u & 0x3f]) >> (10 - (u >> 12));	// convert to linear frequency
 	vs->o0dph = f;
 
@@ -303,9 +308,9 @@ static void setfreqvol(struct voice *v, unsigned char *ct) {
 
 	// oscillator 1 frequency
 	if (ct[7] > 0x60)
-		u = -0x1000 - TUNING_K;	// fixed "low" frequency
+		u = -0x1000 - ps->tuning_k;	// fixed "low" frequency
 	else if (ct[7] > 0x20)
-		u = 0x3000 - TUNING_K;	// fixed "high" frequency
+		u = 0x3000 - ps->tuning_k;	// fixed "high" frequency
 	u += (ct[2] << 7) + (ct[3] << 3) - 0x2200;
 	f = (exptab0[(u & 0xfc0) >> 6] * exptab1[u & 0x3f]) >> (10 - (u >> 12));
 	vs->o1dph = f;
@@ -493,9 +498,15 @@ static void init(struct patch *p) {
 	struct p_state *ps = (struct p_state *)p->state;
 	// default all the controls to midway (64)
 	memset(ps->ctrl, 64, sizeof(ps->ctrl));
+	ps->tuning_k = tuning_k();
 	procctrl(p);
 }
 
+static void rate_change(struct patch *p) {
+	struct p_state *ps = (struct p_state *)p->state;
+	ps->tuning_k = tuning_k();
+}
+
 static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	struct p_state *ps = (struct p_state *)p->state;
 	int update = 0;
@@ -540,6 +551,7 @@ const struct patch_ops patch4 = {
 	.init = init,
 	.control_change = control_change,
 	.pitch_wheel = pitch_wheel,
+	.rate_change = rate_change,
 };
 
 //-----------------------------------------------------------------------------
@@ -43,24 +43,35 @@ struct p_state {
 	float r;
 	int impulse_type;
 	int impulse_solo;
+	int retrigger;		// strike ringing voices in place
+	struct adsr env;	// envelope constants for new voices
+	struct pan gain;	// pan gains for new voices
 };
 
 _Static_assert(sizeof(struct v_state) <= VOICE_STATE_SIZE, "sizeof(struct v_state) > VOICE_STATE_SIZE");
 _Static_assert(sizeof(struct p_state) <= PATCH_STATE_SIZE, "sizeof(struct p_state) > PATCH_STATE_SIZE");
 
+//-----------------------------------------------------------------------------
+// patch level updates
+// The envelope and pan constants are derived once for the patch and copied
+// into the voices.
+
+static void set_adsr(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	adsr_update(&ps->env, ps->a, ps->d, ps->s, ps->r);
+}
+
+static void set_pan(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	pan_ctrl(&ps->gain, ps->vol, ps->pan);
+}
+
 //-----------------------------------------------------------------------------
 // control functions
 
 static void ctrl_frequency(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	//if (v->note < 57){
-	if (v->note < 48){
-		wg_set_samplerate(&vs->wg,2); // halve sample rate
-	}
-	if (v->note < 33){
-		wg_set_samplerate(&vs->wg,4); // quarter sample rate
-	}
 	wg_ctrl_frequency(&vs->wg, midi_to_frequency((float)v->note - ps->bend));
 }
 
@@ -79,7 +90,7 @@ static void ctrl_stiffness(struct voice *v) {
 static void ctrl_pan(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	pan_ctrl(&vs->pan, ps->vol, ps->pan);
+	vs->pan = ps->gain;
 }
 
 static void ctrl_exciter_loc(struct voice *v) {
@@ -102,7 +113,7 @@ static void ctrl_exciter_type(struct voice *v) {
 static void ctrl_adsr(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	adsr_update(&vs->wg.adsr, ps->a, ps->d, ps->s, ps->r);
+	adsr_copy(&vs->wg.adsr, &ps->env);
 }
 
 static void ctrl_impulse_type(struct voice *v) {
@@ -117,43 +128,48 @@ static void ctrl_impulse_type(struct voice *v) {
 
 // start the patch
 static void start(struct voice *v) {
-	DBG("p7 start v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	memset(vs, 0, sizeof(struct v_state));
-	adsr_init(&vs->wg.adsr, ps->a, ps->d, ps->s, ps->r);
+	// wg_init clears the model state (note_on sets the excitation)
 	wg_init(&vs->wg);
-	pan_init(&vs->pan);
+	// the delay lines have room for the pitch wheel, wg_alloc picks the rate
+	wg_alloc(&vs->wg, midi_to_frequency((float)v->note - MIDI_BEND_RANGE));
+	vs->wg.adsr = ps->env;
+	vs->pan = ps->gain;
 
 	ctrl_frequency(v);
-	ctrl_reflection(v);
 	ctrl_stiffness(v);
-	ctrl_pan(v);
-	ctrl_impulse_solo(v);
 	ctrl_exciter_type(v);
-	ctrl_impulse_type(v);
 }
 
 // stop the patch
 static void stop(struct voice *v) {
-	DBG("p7 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	//DBG("p7 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
 	wg_ctrl_reflection(&vs->wg,0.0f);
 	adsr_idle(&vs->wg.adsr);
+	wg_stop(&vs->wg);
 }
 
 // note on
 static void note_on(struct voice *v, uint8_t vel) {
-	DBG("p7 note on v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	//DBG("p7 note on v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	gpio_set(IO_LED_AMBER); // flash the led when a note comes in
 	//gpio_set(IO_ATTACK_LED);
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	adsr_attack(&vs->wg.adsr);
+	// restart a voice that went quiet
+	if (vs->wg.delay_l == NULL) {
+		start(v);
+	}
+	// a repeated note re-strikes the ringing string
+	vs->wg.retrigger = ps->retrigger;
+	if (ps->retrigger && adsr_is_active(&vs->wg.adsr)) {
+		adsr_retrigger(&vs->wg.adsr);
+	} else {
+		adsr_attack(&vs->wg.adsr);
+	}
 
-	
-	// notes below C2 can't be processed as they make the delay line too large
-	if (v->note > 24){
 	// reflection
 	wg_ctrl_impulse_type(&vs->wg,ps->impulse_type);
 	wg_ctrl_reflection(&vs->wg,ps->reflection);
@@ -163,12 +179,8 @@ static void note_on(struct voice *v, uint8_t vel) {
 	wg_ctrl_impulse_solo(&vs->wg,ps->impulse_solo);
 	// position
 	wg_ctrl_pos(&vs->wg, ps->exciter_loc);
+	// (a voice that didn't get delay line memory stays silent)
 	wg_excite(&vs->wg);
-	
-	
-	} else{
-		DBG("note too low to handle!");
-	}
 }
 
 // note off
@@ -183,15 +195,22 @@ static void note_off(struct voice *v, uint8_t vel) {
 }
 
 // return !=0 if the patch is active
+// (a quiet voice has given its delay lines back)
 static int active(struct voice *v) {
-	return 1;
+	struct v_state *vs = (struct v_state *)v->state;
+	return vs->wg.delay_l != NULL;
 }
 
 // generate samples
 static void generate(struct voice *v, float *out_l, float *out_r, size_t n) {
 	struct v_state *vs = (struct v_state *)v->state;
 	float out[n];
+	wg_ctrl_lod(&vs->wg, voice_lod(v, &vs->wg.adsr));
 	wg_gen(&vs->wg, out, n);
+	// give the delay lines back to the pool once the voice is quiet
+	if (voice_silent(&vs->wg.adsr, out, n)) {
+		wg_stop(&vs->wg);
+	}
 	block_copy(out_l, out, n);
 	block_mul_k(out_l, vs->pan.vol_l, n);
 	//block_copy(out_r, out, n);
@@ -218,6 +237,7 @@ static void init(struct patch *p) {
 	ps->r = 1.0f;
 	ps->impulse_type = 0;
 	ps->impulse_solo = 0;
+	ps->retrigger = 1;
 }
 
 static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
@@ -227,44 +247,6 @@ static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	DBG("p7 ctrl %d val %d\r\n", ctrl, val);
 
 	switch (ctrl) {
-	case VOLUME_SLIDER:		// volume
-		ps->vol = midi_map(val, 0.f, 1.0f);
-		update = 1;
-		break;
-	case MODWHEEL:		// filter cutoff
-		svf2_ctrl_cutoff(&p->pmsynth->opf, logmap(midi_map(val, 1.0f, 0.0f)));
-		break;
-	case KNOB_1: 		// filter resonance
-		svf2_ctrl_resonance(&p->pmsynth->opf, midi_map(val, 0.f, 0.98f));
-		break;
-	case KNOB_2:
-		ps->reflection = midi_map(val, -0.95f, -1.0f);
-		update = 2;
-		break;
-	case KNOB_3:
-		ps->stiffness = midi_map(val, 0.0f, 1.0f);
-		update = 3;
-		break;
-	case KNOB_4:
-		ps->exciter_loc = midi_map(val, 0.08f, 0.5f);
-		update = 4;
-		break;
-	case KNOB_5:
-		ps->a = midi_map(val, 0.0f, 0.5f);
-		update = 7;
-		break;
-	case KNOB_6:
-		ps->d = midi_map(val, 0.02f, 1.f);
-		update = 7;
-		break;
-	case KNOB_7:
-		ps->s = midi_map(val, 0.0f, 1.f);
-		update = 7;
-		break;
-	case KNOB_8:
-		ps->r = midi_map(val, 0.0f, 1.f);
-		update = 7;
-		break;
 	case BUTTON_1:
 		ps->exciter_type = 0;
 		current_resonator_type = 3;
@@ -318,42 +300,42 @@ static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	case BUTTON_7: //panic button!
 		stop_voices(p);
 		break;
+	case BUTTON_8: //retrigger in place (toggle)
+		ps->retrigger ^= 1;
+		break;
 	default:
 		break;
 	}
-	if (update == 1) {
-		update_voices(p, ctrl_pan);
-	}
-	if (update == 2) {
-		update_voices(p, ctrl_reflection);
-	}
-	if (update == 3) {
-		update_voices(p, ctrl_stiffness);
-	}
-	if (update == 4) {
-		update_voices(p, ctrl_exciter_loc);
-	}
 	if (update == 5) {
 		update_voices(p, ctrl_impulse_solo);
 	}
 	if (update == 6) {
 		update_voices(p, ctrl_exciter_type);
 	}
-	if (update == 7) {
-		update_voices(p, ctrl_adsr);
-	}
 	if (update == 8) {
 		update_voices(p, ctrl_impulse_type);
 	}
 }
 
-static void pitch_wheel(struct patch *p, uint16_t val) {
-	struct p_state *ps = (struct p_state *)p->state;
-	DBG("p7 pitch %d\r\n", val);
-	ps->bend = midi_pitch_bend(val);
-	update_voices(p, ctrl_frequency);
-}
 
+//-----------------------------------------------------------------------------
+// parameters
+
+static const struct param params[] = {
+	{VOLUME_SLIDER, PARAM_LINEAR, PARAM_STATE(vol), 0.f, 1.f, set_pan, ctrl_pan, PARAM_RAMP, 2},
+	{MODWHEEL, PARAM_LOG, -1, 1.f, 0.f, param_set_cutoff, NULL, 0, 0},	// filter cutoff
+	{KNOB_1, PARAM_LINEAR, -1, 0.f, 0.98f, param_set_resonance, NULL, 0, 0},	// filter resonance
+	{KNOB_2, PARAM_LINEAR, PARAM_STATE(reflection), -0.95f, -1.f, NULL, ctrl_reflection, PARAM_RAMP, 1},
+	{KNOB_3, PARAM_LINEAR, PARAM_STATE(stiffness), 0.f, 1.f, NULL, ctrl_stiffness, PARAM_RAMP, 1},
+	{KNOB_4, PARAM_LINEAR, PARAM_STATE(exciter_loc), 0.08f, 0.5f, NULL, ctrl_exciter_loc, PARAM_RAMP, 1},
+	{KNOB_5, PARAM_LINEAR, PARAM_STATE(a), 0.f, 0.5f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_6, PARAM_LINEAR, PARAM_STATE(d), 0.02f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_7, PARAM_LINEAR, PARAM_STATE(s), 0.f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_8, PARAM_LINEAR, PARAM_STATE(r), 0.f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{PARAM_PITCH_WHEEL, PARAM_BEND, PARAM_STATE(bend), 0.f, 0.f, NULL, ctrl_frequency, PARAM_RAMP, 2},
+	PARAM_END,
+};
+_Static_assert(sizeof(params) / sizeof(params[0]) <= PARAM_MAX + 1, "more than PARAM_MAX params");
 
 //-----------------------------------------------------------------------------
 
@@ -366,7 +348,7 @@ const struct patch_ops patch7 = {
 	.generate = generate,
 	.init = init,
 	.control_change = control_change,
-	.pitch_wheel = pitch_wheel,
+	.params = params,
 };
 
 //-----------------------------------------------------------------------------
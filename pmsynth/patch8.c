@@ -3,7 +3,11 @@
 
 Patch 8
 
-2D waveguide
+2D waveguide mesh (8x8 membrane and plate)
+
+The presets are rendered with modal resonator banks taken from the mesh (see
+modes/mesh2modal) by default. The mesh itself costs more but follows the
+excite and pickup position knobs.
 
 */
 //-----------------------------------------------------------------------------
@@ -15,12 +19,20 @@ Patch 8
 
 #define DEBUG
 #include "logging.h"
-//#include "display.h"
 
 //-----------------------------------------------------------------------------
 
+enum {
+	ENGINE_MODAL,
+	ENGINE_MESH,
+};
+
 struct v_state {
-	struct wg_2d wg_2d;
+	union {
+		struct wg_2d wg_2d;
+		struct modal modal;
+	};
+	int engine;		// ENGINE_MODAL, ENGINE_MESH (from note on)
 	struct pan pan;
 };
 
@@ -28,31 +40,102 @@ struct p_state {
 	float vol;		// volume
 	float pan;		// left/right pan
 	float bend;		// pitch bend
-	float attenuate;
+	float attenuate;	// decay per period
+	float ex, ey;		// excite position
+	float px, py;		// pickup position
+	int impulse_type;
+	int resonator_type;	// MESH_MEMBRANE, MESH_PLATE
+	int engine;		// ENGINE_MODAL, ENGINE_MESH for new voices
+	struct pan gain;	// pan gains for new voices
 };
 
 _Static_assert(sizeof(struct v_state) <= VOICE_STATE_SIZE, "sizeof(struct v_state) > VOICE_STATE_SIZE");
 _Static_assert(sizeof(struct p_state) <= PATCH_STATE_SIZE, "sizeof(struct p_state) > PATCH_STATE_SIZE");
 
+//-----------------------------------------------------------------------------
+// resonator presets
+// The membrane is struck near the middle and dies away quickly, the plate is
+// struck and picked up towards the edges (more of the upper modes) and rings.
+
+enum {
+	MESH_MEMBRANE,
+	MESH_PLATE,
+	MESH_PRESETS,
+};
+
+struct mesh_preset {
+	float attenuate;
+	float ex, ey;
+	float px, py;
+	const struct modal_set *modes;	// for the preset positions
+};
+
+static const struct mesh_preset presets[MESH_PRESETS] = {
+	{0.93f, 0.45f, 0.4f, 0.6f, 0.55f, &modal_membrane},	// membrane
+	{0.99f, 0.15f, 0.3f, 0.85f, 0.7f, &modal_plate},	// plate
+};
+
+static void set_preset(struct p_state *ps) {
+	const struct mesh_preset *m = &presets[ps->resonator_type];
+	ps->attenuate = m->attenuate;
+	ps->ex = m->ex;
+	ps->ey = m->ey;
+	ps->px = m->px;
+	ps->py = m->py;
+}
+
+//-----------------------------------------------------------------------------
+// patch level updates
+
+static void set_pan(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	pan_ctrl(&ps->gain, ps->vol, ps->pan);
+}
+
 //-----------------------------------------------------------------------------
 // control functions
 
 static void ctrl_frequency(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	wg_2d_ctrl_frequency(&vs->wg_2d, midi_to_frequency((float)v->note + ps->bend));
+	float freq = midi_to_frequency((float)v->note - ps->bend);
+	if (vs->engine == ENGINE_MODAL) {
+		modal_ctrl_frequency(&vs->modal, freq);
+	} else {
+		wg_2d_ctrl_frequency(&vs->wg_2d, freq);
+	}
 }
 
 static void ctrl_attenuate(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	wg_2d_ctrl_attenuate(&vs->wg_2d, ps->attenuate);
+	if (vs->engine == ENGINE_MODAL) {
+		modal_ctrl_attenuate(&vs->modal, ps->attenuate);
+	} else {
+		wg_2d_ctrl_attenuate(&vs->wg_2d, ps->attenuate);
+	}
+}
+
+static void ctrl_position(struct voice *v) {
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	if (vs->engine == ENGINE_MODAL) {
+		// the modes are for the preset positions
+		modal_ctrl_set(&vs->modal, presets[ps->resonator_type].modes);
+	} else {
+		wg_2d_ctrl_position(&vs->wg_2d, ps->ex, ps->ey, ps->px, ps->py);
+	}
 }
 
 static void ctrl_pan(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	pan_ctrl(&vs->pan, ps->vol, ps->pan);
+	vs->pan = ps->gain;
+}
+
+static void ctrl_resonator_type(struct voice *v) {
+	ctrl_position(v);
+	ctrl_attenuate(v);
 }
 
 //-----------------------------------------------------------------------------
@@ -60,30 +143,42 @@ static void ctrl_pan(struct voice *v) {
 
 // start the patch
 static void start(struct voice *v) {
-	DBG("p2 start v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
-	memset(vs, 0, sizeof(struct v_state));
-
-	wg_2d_init(&vs->wg_2d);
-	pan_init(&vs->pan);
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	vs->engine = ps->engine;
+	if (vs->engine == ENGINE_MODAL) {
+		modal_init(&vs->modal);
+	} else {
+		wg_2d_init(&vs->wg_2d);
+	}
+	vs->pan = ps->gain;
 
-	ctrl_frequency(v);
+	ctrl_position(v);
 	ctrl_attenuate(v);
-	ctrl_pan(v);
-
+	ctrl_frequency(v);
 }
 
 // stop the patch
 static void stop(struct voice *v) {
-	DBG("p8 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	//DBG("p8 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 }
 
 // note on
 static void note_on(struct voice *v, uint8_t vel) {
-	//DBG("p2 note on v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	//DBG("p8 note on v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
 	gpio_set(IO_LED_AMBER);
-	wg_2d_pluck(&vs->wg_2d);
+	// a repeated note strikes the ringing mesh
+	if (vs->engine == ENGINE_MODAL) {
+		vs->modal.impulse = ps->impulse_type;
+		modal_set_velocity(&vs->modal, (float)vel / 127.f);
+		modal_pluck(&vs->modal);
+	} else {
+		vs->wg_2d.impulse = ps->impulse_type;
+		wg_2d_set_velocity(&vs->wg_2d, (float)vel / 127.f);
+		wg_2d_pluck(&vs->wg_2d);
+	}
 }
 
 // note off
@@ -100,8 +195,15 @@ static int active(struct voice *v) {
 static void generate(struct voice *v, float *out_l, float *out_r, size_t n) {
 	struct v_state *vs = (struct v_state *)v->state;
 	float out[n];
-	wg_2d_gen(&vs->wg_2d, out, n);
-	pan_gen(&vs->pan, out_l, out_r, out, n);
+	if (vs->engine == ENGINE_MODAL) {
+		modal_ctrl_lod(&vs->modal, voice_lod(v, NULL));
+		modal_gen(&vs->modal, out, n);
+	} else {
+		wg_2d_ctrl_lod(&vs->wg_2d, voice_lod(v, NULL));
+		wg_2d_gen(&vs->wg_2d, out, n);
+	}
+	block_copy(out_l, out, n);
+	block_mul_k(out_l, vs->pan.vol_l, n);
 }
 
 //-----------------------------------------------------------------------------
@@ -112,45 +214,75 @@ static void init(struct patch *p) {
 	ps->vol = 1.f;
 	ps->pan = 0.5f;
 	ps->bend = 0.f;
-	ps->attenuate = 0.99f;
+	ps->impulse_type = 0;
+	ps->resonator_type = MESH_MEMBRANE;
+	ps->engine = ENGINE_MODAL;
+	set_preset(ps);
 }
 
 static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	struct p_state *ps = (struct p_state *)p->state;
 	int update = 0;
 
-	DBG("p2 ctrl %d val %d\r\n", ctrl, val);
+	DBG("p8 ctrl %d val %d\r\n", ctrl, val);
 
 	switch (ctrl) {
-	case 1:		// volume
-		ps->vol = midi_map(val, 0.f, 1.5f);
-		update = 1;
+	case BUTTON_1:
+		goto_next_patch(p);
 		break;
-	case 2:		// left/right pan
-		ps->pan = midi_map(val, 0.f, 1.f);
+	case BUTTON_2:		// membrane/plate
+		ps->resonator_type += 1;
+		if (ps->resonator_type >= MESH_PRESETS) {
+			ps->resonator_type = MESH_MEMBRANE;
+		}
+		set_preset(ps);
+		current_resonator_type = 7 + ps->resonator_type;	// membrane, plate
+		update_resonator();
 		update = 1;
 		break;
-	case 5:
-		ps->attenuate = midi_map(val, 0.87f, 1.f);
-		update = 2;
+	case BUTTON_3:		// goto next impulse sample
+		ps->impulse_type += 1;
+		if (ps->impulse_type > NUM_IMPULSES) {
+			ps->impulse_type = 0;
+		}
+		break;
+	case BUTTON_4:		// goto previous impulse sample
+		ps->impulse_type -= 1;
+		if (ps->impulse_type < 0) {
+			ps->impulse_type = NUM_IMPULSES;
+		}
+		break;
+	case BUTTON_5:		// modal/mesh (toggle, for new notes)
+		ps->engine = (ps->engine == ENGINE_MODAL) ? ENGINE_MESH : ENGINE_MODAL;
+		DBG("p8 engine %s\r\n", (ps->engine == ENGINE_MODAL) ? "modal" : "mesh");
+		break;
+	case BUTTON_7:		// panic button!
+		stop_voices(p);
 		break;
 	default:
 		break;
 	}
 	if (update == 1) {
-		update_voices(p, ctrl_pan);
-	}
-	if (update == 2) {
-		update_voices(p, ctrl_attenuate);
+		update_voices(p, ctrl_resonator_type);
 	}
 }
 
-static void pitch_wheel(struct patch *p, uint16_t val) {
-	struct p_state *ps = (struct p_state *)p->state;
-	DBG("p8 pitch %d\r\n", val);
-	ps->bend = midi_pitch_bend(val);
-	update_voices(p, ctrl_frequency);
-}
+//-----------------------------------------------------------------------------
+// parameters
+
+static const struct param params[] = {
+	{VOLUME_SLIDER, PARAM_LINEAR, PARAM_STATE(vol), 0.f, 1.f, set_pan, ctrl_pan, PARAM_RAMP, 2},
+	{MODWHEEL, PARAM_LOG, -1, 1.f, 0.f, param_set_cutoff, NULL, 0, 0},	// filter cutoff
+	{KNOB_1, PARAM_LINEAR, -1, 0.f, 0.98f, param_set_resonance, NULL, 0, 0},	// filter resonance
+	{KNOB_2, PARAM_LINEAR, PARAM_STATE(attenuate), 0.87f, 1.f, NULL, ctrl_attenuate, PARAM_RAMP, 2},
+	{KNOB_3, PARAM_LINEAR, PARAM_STATE(ex), 0.f, 1.f, NULL, ctrl_position, 0, 0},
+	{KNOB_4, PARAM_LINEAR, PARAM_STATE(ey), 0.f, 1.f, NULL, ctrl_position, 0, 0},
+	{KNOB_5, PARAM_LINEAR, PARAM_STATE(px), 0.f, 1.f, NULL, ctrl_position, 0, 0},
+	{KNOB_6, PARAM_LINEAR, PARAM_STATE(py), 0.f, 1.f, NULL, ctrl_position, 0, 0},
+	{PARAM_PITCH_WHEEL, PARAM_BEND, PARAM_STATE(bend), 0.f, 0.f, NULL, ctrl_frequency, PARAM_RAMP, 4},
+	PARAM_END,
+};
+_Static_assert(sizeof(params) / sizeof(params[0]) <= PARAM_MAX + 1, "more than PARAM_MAX params");
 
 //-----------------------------------------------------------------------------
 
@@ -163,7 +295,7 @@ const struct patch_ops patch8 = {
 	.generate = generate,
 	.init = init,
 	.control_change = control_change,
-	.pitch_wheel = pitch_wheel,
+	.params = params,
 };
 
 //-----------------------------------------------------------------------------
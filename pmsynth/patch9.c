@@ -5,6 +5,8 @@ Patch 9
 
 Waveguide woodwind instrument
 
+BUTTON_2 selects the jet nonlinearity (the exp table or the cubic).
+
 */
 //-----------------------------------------------------------------------------
 
@@ -38,36 +40,48 @@ struct p_state {
 	float r_2;
 	float vibrato_amt;
 	float noise_amt;
+	int jet;		// jet nonlinearity (WW_JET_*)
+	struct adsr env;	// envelope constants for new voices
+	struct pan gain;	// pan gains for new voices
 };
 
 _Static_assert(sizeof(struct v_state) <= VOICE_STATE_SIZE, "sizeof(struct v_state) > VOICE_STATE_SIZE");
 _Static_assert(sizeof(struct p_state) <= PATCH_STATE_SIZE, "sizeof(struct p_state) > PATCH_STATE_SIZE");
 
+//-----------------------------------------------------------------------------
+// patch level updates
+// The envelope and pan constants are derived once for the patch and copied
+// into the voices.
+
+static void set_adsr(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	adsr_update(&ps->env, ps->a, ps->d, ps->s, ps->r);
+}
+
+static void set_pan(struct patch *p, float x) {
+	struct p_state *ps = (struct p_state *)p->state;
+	pan_ctrl(&ps->gain, ps->vol, ps->pan);
+}
+
 //-----------------------------------------------------------------------------
 // control functions
 
 static void ctrl_frequency(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	if (v->note < 60){
-		ww_set_samplerate(&vs->ww,2); // halve sample rate
-	}
-	if (v->note < 41){
-		ww_set_samplerate(&vs->ww,4); // quarter sample rate
-	}
 	ww_ctrl_frequency(&vs->ww, midi_to_frequency((float)v->note - ps->bend));
 }
 
 static void ctrl_pan(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	pan_ctrl(&vs->pan, ps->vol, ps->pan);
+	vs->pan = ps->gain;
 }
 
 static void ctrl_adsr(struct voice *v) {
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	adsr_update(&vs->ww.adsr, ps->a, ps->d, ps->s, ps->r);
+	adsr_copy(&vs->ww.adsr, &ps->env);
 }
 
 static void ctrl_coefs(struct voice *v) {
@@ -82,6 +96,12 @@ static void ctrl_vib_noise(struct voice *v) {
 	ww_update_vib_noise(&vs->ww, ps->vibrato_amt, ps->noise_amt);
 }
 
+static void ctrl_jet(struct voice *v) {
+	struct v_state *vs = (struct v_state *)v->state;
+	struct p_state *ps = (struct p_state *)v->patch->state;
+	ww_ctrl_jet(&vs->ww, ps->jet);
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -89,37 +109,41 @@ static void ctrl_vib_noise(struct voice *v) {
 
 // start the patch
 static void start(struct voice *v) {
-	DBG("p9 start v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
 	struct p_state *ps = (struct p_state *)v->patch->state;
-	memset(vs, 0, sizeof(struct v_state));
-
-	adsr_init(&vs->ww.adsr, ps->a, ps->d, ps->s, ps->r);
-	//adsr_init(&vs->ww.adsr, 0.2f, 2.0f, 1.0f, 1.0f);
+	// ww_init clears the model state
+	ww_init(&vs->ww);
+	// the delay lines have room for the pitch wheel, ww_alloc picks the rate
+	ww_alloc(&vs->ww, midi_to_frequency((float)v->note - MIDI_BEND_RANGE));
+	vs->ww.adsr = ps->env;
 	noise_init(&vs->ww.ns);
 	sin_init(&vs->ww.vibrato);
 	sin_ctrl_frequency(&vs->ww.vibrato, 50);
-	ww_init(&vs->ww);
-	pan_init(&vs->pan);
+	vs->pan = ps->gain;
 
 	ctrl_frequency(v);
-	ctrl_pan(v);
 	ctrl_coefs(v);
 	ctrl_vib_noise(v);
+	ctrl_jet(v);
 
 }
 
 // stop the patch
 static void stop(struct voice *v) {
-	DBG("p9 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
+	//DBG("p9 stop v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
 	adsr_release(&vs->ww.adsr);
+	ww_stop(&vs->ww);
 }
 
 // note on
 static void note_on(struct voice *v, uint8_t vel) {
 	//DBG("p9 note on v%d c%d n%d\r\n", v->idx, v->channel, v->note);
 	struct v_state *vs = (struct v_state *)v->state;
+	// restart a voice that went quiet
+	if (vs->ww.dl_1 == NULL) {
+		start(v);
+	}
 	ww_set_velocity(&vs->ww, (float)vel / 127.f);
 	gpio_set(IO_LED_AMBER);
 	adsr_attack(&vs->ww.adsr);
@@ -134,15 +158,22 @@ static void note_off(struct voice *v, uint8_t vel) {
 }
 
 // return !=0 if the patch is active
+// (a quiet voice has given its delay lines back)
 static int active(struct voice *v) {
-	return 1;
+	struct v_state *vs = (struct v_state *)v->state;
+	return vs->ww.dl_1 != NULL;
 }
 
 // generate samples
 static void generate(struct voice *v, float *out_l, float *out_r, size_t n) {
 	struct v_state *vs = (struct v_state *)v->state;
 	float out[n];
+	ww_ctrl_lod(&vs->ww, voice_lod(v, &vs->ww.adsr));
 	ww_gen(&vs->ww, out, n);
+	// give the delay lines back to the pool once the voice is quiet
+	if (voice_silent(&vs->ww.adsr, out, n)) {
+		ww_stop(&vs->ww);
+	}
 	block_copy(out_l, out, n);
 	block_mul_k(out_l, vs->pan.vol_l, n);
 	//block_copy(out_r, out, n);
@@ -167,58 +198,25 @@ static void init(struct patch *p) {
 	ps->r_2 = 0.53f;
 	ps->vibrato_amt = 0.008f;
 	ps->noise_amt = 0.0085f;
+	ps->jet = WW_JET_EXP;
 }
 
 static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	struct p_state *ps = (struct p_state *)p->state;
-	int update = 0;
-
 	DBG("p9 ctrl %d val %d\r\n", ctrl, val);
 
 	switch (ctrl) {
-	case VOLUME_SLIDER:		// volume
-		ps->vol = midi_map(val, 0.f, 0.2f);
-		update = 1;
-		break;
-	case MODWHEEL:		// filter cutoff
-		svf2_ctrl_cutoff(&p->pmsynth->opf, logmap(midi_map(val, 1.0f, 0.0f)));
-		break;
-	case KNOB_1: 		// filter resonance
-		svf2_ctrl_resonance(&p->pmsynth->opf, midi_map(val, 0.f, 0.98f));
-		break;
-	case KNOB_2:
-		ps->r_1 = midi_map(val, 0.0f, 0.8f);
-		ps->r_2 = midi_map(val, 0.2f, 0.46f);
-		update = 4;
-		break;
-	case KNOB_3:
-		ps->lp_filter_coef = midi_map(val, 0.0f, 1.0f);
-		update = 4;
-		break;
-	case KNOB_4:
-		ps->vibrato_amt = midi_map(val, 0.008f, 0.2f);
-		ps->noise_amt = midi_map(val, 0.0085f, 0.09f);
-		update = 5;
-		break;
-	case KNOB_5:
-		ps->a = midi_map(val, 0.0f, 3.f);
-		update = 3;
-		break;
-	case KNOB_6:
-		ps->d = midi_map(val, 0.02f, 1.f);
-		update = 3;
-		break;
-	case KNOB_7:
-		ps->s = midi_map(val, 0.0f, 1.f);
-		update = 3;
-		break;
-	case KNOB_8:
-		ps->r = midi_map(val, 0.0f, 50.f);
-		update = 3;
-		break;
 	case BUTTON_1:
 		goto_next_patch(p);
 		break;
+	case BUTTON_2: //jet nonlinearity
+		ps->jet += 1;
+		if (ps->jet >= WW_JET_NUM) {
+			ps->jet = WW_JET_EXP;
+		}
+		DBG("p9 jet %s\r\n", (ps->jet == WW_JET_EXP) ? "exp" : "cubic");
+		update_voices(p, ctrl_jet);
+		break;
 	case BUTTON_6: //play demo song
 		switch(p->pmsynth->seq0.m0.s_state){
 			case 0:
@@ -238,27 +236,28 @@ static void control_change(struct patch *p, uint8_t ctrl, uint8_t val) {
 	default:
 		break;
 	}
-
-	if (update == 1) {
-		update_voices(p, ctrl_pan);
-	}
-	if (update == 3) {
-		update_voices(p, ctrl_adsr);
-	}
-	if (update == 4) {
-		update_voices(p, ctrl_coefs);
-	}
-	if (update == 5) {
-		update_voices(p, ctrl_vib_noise);
-	}
 }
 
-static void pitch_wheel(struct patch *p, uint16_t val) {
-	struct p_state *ps = (struct p_state *)p->state;
-	DBG("p9 pitch %d\r\n", val);
-	ps->bend = midi_pitch_bend(val);
-	update_voices(p, ctrl_frequency);
-}
+//-----------------------------------------------------------------------------
+// parameters
+
+static const struct param params[] = {
+	{VOLUME_SLIDER, PARAM_LINEAR, PARAM_STATE(vol), 0.f, 0.2f, set_pan, ctrl_pan, PARAM_RAMP, 2},
+	{MODWHEEL, PARAM_LOG, -1, 1.f, 0.f, param_set_cutoff, NULL, 0, 0},	// filter cutoff
+	{KNOB_1, PARAM_LINEAR, -1, 0.f, 0.98f, param_set_resonance, NULL, 0, 0},	// filter resonance
+	{KNOB_2, PARAM_LINEAR, PARAM_STATE(r_1), 0.f, 0.8f, NULL, ctrl_coefs, PARAM_RAMP, 1},
+	{KNOB_2, PARAM_LINEAR, PARAM_STATE(r_2), 0.2f, 0.46f, NULL, ctrl_coefs, PARAM_RAMP, 1},
+	{KNOB_3, PARAM_LINEAR, PARAM_STATE(lp_filter_coef), 0.f, 1.f, NULL, ctrl_coefs, PARAM_RAMP, 1},
+	{KNOB_4, PARAM_LINEAR, PARAM_STATE(vibrato_amt), 0.008f, 0.2f, NULL, ctrl_vib_noise, PARAM_RAMP, 1},
+	{KNOB_4, PARAM_LINEAR, PARAM_STATE(noise_amt), 0.0085f, 0.09f, NULL, ctrl_vib_noise, PARAM_RAMP, 1},
+	{KNOB_5, PARAM_LINEAR, PARAM_STATE(a), 0.f, 3.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_6, PARAM_LINEAR, PARAM_STATE(d), 0.02f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_7, PARAM_LINEAR, PARAM_STATE(s), 0.f, 1.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{KNOB_8, PARAM_LINEAR, PARAM_STATE(r), 0.f, 50.f, set_adsr, ctrl_adsr, PARAM_RAMP, 4},
+	{PARAM_PITCH_WHEEL, PARAM_BEND, PARAM_STATE(bend), 0.f, 0.f, NULL, ctrl_frequency, PARAM_RAMP, 2},
+	PARAM_END,
+};
+_Static_assert(sizeof(params) / sizeof(params[0]) <= PARAM_MAX + 1, "more than PARAM_MAX params");
 
 //-----------------------------------------------------------------------------
 
@@ -271,7 +270,7 @@ const struct patch_ops patch9 = {
 	.generate = generate,
 	.init = init,
 	.control_change = control_change,
-	.pitch_wheel = pitch_wheel,
+	.params = params,
 };
 
 //-----------------------------------------------------------------------------
@@ -13,6 +13,11 @@ Physical Modelling Synthesizer
 #define DEBUG
 #include "logging.h"
 
+//-----------------------------------------------------------------------------
+
+// channel of the silent patch (patch6), used to clear the voices
+#define DUMMY_CHANNEL 6
+
 //-----------------------------------------------------------------------------
 // voice operations
 
@@ -53,6 +58,9 @@ struct voice *voice_alloc(struct pmsynth *s, uint8_t channel, uint8_t note) {
 	// setup the new voice
 	v->note = note;
 	v->channel = channel;
+	v->lod = LOD_FULL;
+	v->level = 0.f;
+	v->note_pending = 0;
 	v->patch = &s->patches[channel];
 	v->patch->ops->start(v);
 	return v;
@@ -60,16 +68,20 @@ struct voice *voice_alloc(struct pmsynth *s, uint8_t channel, uint8_t note) {
 }
 
 // stops all voices
+// This frees their delay lines, so it holds off the renderer if it's called
+// from the main loop.
 void stop_voices(struct patch *p) {
+	uint32_t lock = audio_render_lock();
 	for (int i = 0; i < NUM_VOICES; i++) {
 		struct voice *v = &p->pmsynth->voices[i];
 		if (v->patch == p) {
 			v->patch->ops->stop(v);
 		}
 
-		voice_alloc(p->pmsynth, 5, 42); // overwrites all voices with a dummy voice (channel 5)
+		voice_alloc(p->pmsynth, DUMMY_CHANNEL, 42); // overwrites all voices with a silent dummy voice
 	}
 	p->pmsynth->voice_idx = 0;
+	audio_render_unlock(lock);
 }
 
 
@@ -83,6 +95,31 @@ void update_voices(struct patch *p, void (*func) (struct voice *)) {
 	}
 }
 
+// Choose the level of detail for a voice.
+// e is the voice envelope (or NULL). An attacking voice is always rendered at
+// full quality and a releasing voice at low quality. Otherwise it depends on
+// the voice level relative to the loudest voice, with some hysteresis.
+int voice_lod(struct voice *v, struct adsr *e) {
+	float ref = v->patch->pmsynth->level_max;
+	if (e && adsr_is_attacking(e)) {
+		v->lod = LOD_FULL;
+	} else if (e && adsr_is_releasing(e)) {
+		v->lod = LOD_LOW;
+	} else if (v->level < ref * LOD_QUIET) {
+		v->lod = LOD_LOW;
+	} else if (v->level > ref * LOD_LOUD) {
+		v->lod = LOD_FULL;
+	}
+	return v->lod;
+}
+
+// Return !=0 if a voice has finished its release and gone quiet.
+// e is the voice envelope, out the block it just generated. The patch then
+// gives the delay lines back to the pool (and restarts on the next note on).
+int voice_silent(struct adsr *e, const float *out, size_t n) {
+	return !adsr_is_active(e) && block_peak(out, n) < VOICE_SILENT;
+}
+
 //-----------------------------------------------------------------------------
 // key events
 
@@ -101,30 +138,73 @@ static void key_up_handler(struct pmsynth *s, struct event *e) {
 //-----------------------------------------------------------------------------
 // midi events
 
-// Currently unused.
-// Serial MIDI events are handled as they are read from the buffer.
-// MIDI events from USB might use this....
+// The serial rx line has gone idle at the end of a burst of midi bytes.
+// The main loop also polls the serial port, this just makes sure a burst
+// is parsed promptly.
+// MIDI events from USB might also use this....
 
 // handle a midi event
 static void midi_handler(struct pmsynth *s, struct event *e) {
-	DBG("midi %06x\r\n", EVENT_MIDI(e->type));
+	midi_rx_idle(&s->midi_rx0, (uint32_t) (uintptr_t) e->ptr, EVENT_MIDI(e->type));
+	midi_rx_serial(&s->midi_rx0, s->serial);
 }
 
 //-----------------------------------------------------------------------------
-// audio request events
+// latency statistics
 
-// handle an audio request event
-static void audio_handler(struct pmsynth *s, struct event *e) {
-	size_t n = EVENT_BLOCK_SIZE(e->type);
-	int16_t *dst = e->ptr;
+// record a latency measurement
+static void latency_add(struct latency *l, uint32_t x) {
+	if (l->n == 0 || x < l->min) {
+		l->min = x;
+	}
+	if (x > l->max) {
+		l->max = x;
+	}
+	l->sum += x;
+	l->n += 1;
+}
 
-	//DBG("audio %08x %08x\r\n", e->type, e->ptr);
+// display the latency statistics
+static void latency_stats(const char *name, struct latency *l) {
+	if (l->n == 0) {
+		return;
+	}
+	float k = 1e6f / audio_fs;
+	DBG("%s latency min %d avg %d max %d us (%d)\r\n", name, (int)((float)l->min * k),
+	    (int)((float)l->sum * k / (float)l->n), (int)((float)l->max * k), l->n);
+}
 
-	// clear the output buffers
-	float out_l[n], out_r[n];
-	memset(out_l, 0, n * sizeof(float));
-	memset(out_r, 0, n * sizeof(float));
+//-----------------------------------------------------------------------------
+// audio events
+
+// handle a block played event
+static void audio_handler(struct pmsynth *s, struct event *e) {
+	// record some realtime stats
+	audio_stats(s->audio, EVENT_AUDIO_FILL(e->type));
+	if ((s->audio->stats.buffers & ((1 << 10) - 1)) == 0) {
+		event_stats();
+		snap_stats();
+		dl_pool_stats();
+		latency_stats("note", &s->note_latency);
+		DBG("midi late %d dropped %d\r\n", s->midi_rx0.late, s->midi_rx0.dropped);
+	}
+}
+
+// A midi note on is timed from the arrival of its last byte to the
+// playback of the first non-zero sample from the voice.
+static void note_latency(struct pmsynth *s, struct voice *v, const float *buf, size_t n, uint32_t t) {
+	for (size_t i = 0; i < n; i++) {
+		if (buf[i] != 0.f) {
+			latency_add(&s->note_latency, t + i - v->note_time);
+			v->note_pending = 0;
+			return;
+		}
+	}
+}
 
+// generate and accumulate samples for all the active voices
+// t is the playback time of the first sample
+static void audio_generate(struct pmsynth *s, float *out_l, float *out_r, size_t n, uint32_t t) {
 	for (int i = 0; i < NUM_VOICES; i++) {
 		struct voice *v = &s->voices[i];
 		struct patch *p = v->patch;
@@ -132,11 +212,53 @@ static void audio_handler(struct pmsynth *s, struct event *e) {
 			// generate left/right samples
 			float buf_l[n], buf_r[n];
 			p->ops->generate(v, buf_l, buf_r, n);
+			if (v->note_pending) {
+				note_latency(s, v, buf_l, n, t);
+			}
+			// track the voice levels for the level of detail
+			v->level = block_peak(buf_l, n);
+			if (v->level > s->level_peak) {
+				s->level_peak = v->level;
+			}
 			// accumulate in the output buffers
 			block_add(out_l, buf_l, n);
 			//block_add(out_r, buf_r, n);
 		}
 	}
+}
+
+// render a block of samples into the dma buffer
+static void audio_render(struct pmsynth *s, int16_t *dst, size_t n) {
+	// playback time of the first sample
+	uint32_t t = audio_render_time(s->audio);
+
+	// clear the output buffers
+	float out_l[n], out_r[n];
+	memset(out_l, 0, n * sizeof(float));
+	memset(out_r, 0, n * sizeof(float));
+
+	// split the block at midi and sequencer events
+	size_t i = 0;
+	while (i < n) {
+		midi_apply(&s->midi_rx0, t + i);
+		size_t k = midi_next(&s->midi_rx0, t + i, n - i);
+		k = seq_next(&s->seq0, k);
+		// round up to the split size
+		k = (k + AUDIO_SPLIT_SIZE - 1) & ~(AUDIO_SPLIT_SIZE - 1);
+		if (k == 0) {
+			k = AUDIO_SPLIT_SIZE;
+		}
+		audio_generate(s, &out_l[i], &out_r[i], k, t + i);
+		seq_advance(&s->seq0, k);
+		i += k;
+	}
+	// control changes made during this block take effect from the next one
+	param_apply(s);
+
+	// the loudest voice in this block is the reference for the next one
+	s->level_max = s->level_peak;
+	s->level_peak = 0.f;
+
 	// apply output lowpass filter
 	svf2_gen_lpf(&s->opf, out_l, out_l, n, FILT_LOW_PASS);
 	//svf2_gen_lpf(&s->opf, out_r, out_r, n, FILT_LOW_PASS);
@@ -145,8 +267,24 @@ static void audio_handler(struct pmsynth *s, struct event *e) {
 	// write the samples to the dma buffer
 	//audio_wr(dst, n, out_l, out_r);
 	audio_wr(dst, n, out_l, out_l); // TODO - just mono for now!
-	// record some realtime stats
-	audio_stats(s->audio, dst);
+}
+
+// Render ahead while there is room in the audio ring.
+// This runs in the PendSV handler, triggered by the audio dma callback. It
+// preempts the main loop, so midi parsing and screen updates can't make the
+// audio late. The renderer owns the voices, patches and sequencer: the main
+// loop hands midi messages over with the midi queue, and screen updates
+// come back with update_screen(). Sample rate changes go the other way, the
+// renderer sets s->rate and the main loop makes the change.
+void pmsynth_render(struct pmsynth *s) {
+	while (1) {
+		int16_t *dst = audio_ring_wr(s->audio);
+		if (dst == NULL) {
+			break;
+		}
+		audio_render(s, dst, AUDIO_BLOCK_SIZE);
+		audio_ring_commit(s->audio);
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -167,7 +305,6 @@ int pmsynth_run(struct pmsynth *s) {
 				midi_handler(s, &e);
 				break;
 			case EVENT_TYPE_AUDIO:
-				seq_exec(&s->seq0);
 				audio_handler(s, &e);
 				break;
 			default:
@@ -175,14 +312,79 @@ int pmsynth_run(struct pmsynth *s) {
 				break;
 			}
 		}
+		// sample rate changes restart the i2s and dma, so they aren't
+		// made by the renderer
+		if (s->rate != s->audio->rate) {
+			pmsynth_set_rate(s, s->rate);
+		}
 		// get and process serial midi messages
 		midi_rx_serial(&s->midi_rx0, s->serial);
+		// draw any screen changes
+		update_screen();
 	}
 	return 0;
 }
 
 //-----------------------------------------------------------------------------
 
+// Channel messages are rendered a fixed time after they are received.
+// That's the render-ahead depth plus a block for the parsing.
+static uint32_t midi_latency(struct pmsynth *s) {
+	return (s->audio->ring.depth + 1) * AUDIO_BLOCK_SIZE;
+}
+
+// change the engine sample rate
+// Rate dependent voice state is derived when a voice starts, so stop the
+// current voices and re-derive any global rate dependent state.
+// Called from the main loop, the renderer is held off for the change.
+int pmsynth_set_rate(struct pmsynth *s, uint32_t rate) {
+	int rc = 0;
+
+	if (rate == s->audio->rate) {
+		return 0;
+	}
+	uint32_t lock = audio_render_lock();
+	for (int i = 0; i < NUM_VOICES; i++) {
+		struct voice *v = &s->voices[i];
+		if (v->patch) {
+			v->patch->ops->stop(v);
+		}
+	}
+	snap_init();
+	rc = audio_set_rate(s->audio, rate);
+	if (rc != 0) {
+		DBG("audio_set_rate failed %d\r\n", rc);
+		goto exit;
+	}
+	midi_rx_latency(&s->midi_rx0, midi_latency(s));
+	svf2_ctrl_cutoff(&s->opf, 12000.0f);
+	for (int i = 0; i < NUM_CHANNELS; i++) {
+		struct patch *p = &s->patches[i];
+		if (p->ops) {
+			param_refresh(p);
+			if (p->ops->rate_change) {
+				p->ops->rate_change(p);
+			}
+		}
+	}
+	DBG("sample rate %d Hz\r\n", rate);
+
+ exit:
+	audio_render_unlock(lock);
+	return rc;
+}
+
+// change the render-ahead depth (in blocks)
+// Called from the main loop, the midi latency follows the depth.
+void pmsynth_ring_depth(struct pmsynth *s, uint32_t depth) {
+	uint32_t lock = audio_render_lock();
+	audio_ring_depth(s->audio, depth);
+	midi_rx_latency(&s->midi_rx0, midi_latency(s));
+	audio_render_unlock(lock);
+}
+
+//-----------------------------------------------------------------------------
+
 // initialise the pmsynth state
 int pmsynth_init(struct pmsynth *s, struct audio_drv *audio, struct usart_drv *serial) {
 	int rc = 0;
@@ -190,9 +392,10 @@ int pmsynth_init(struct pmsynth *s, struct audio_drv *audio, struct usart_drv *s
 	memset(s, 0, sizeof(struct pmsynth));
 	s->audio = audio;
 	s->serial = serial;
+	s->rate = audio->rate;
 
-	// setup the midi receivers.
-	s->midi_rx0.pmsynth = s;
+	// setup the midi receivers
+	midi_rx_init(&s->midi_rx0, s, midi_latency(s));
 
 	rc = event_init();
 	if (rc != 0) {
@@ -200,21 +403,21 @@ int pmsynth_init(struct pmsynth *s, struct audio_drv *audio, struct usart_drv *s
 		goto exit;
 	}
 
-	// setting polyphony
-	update_polyphony();
-
+	snap_init();
+	dl_pool_init();
 
 	// setup the patch operations
 	s->patches[0].ops = &patch7;
 	s->patches[1].ops = &patch10;
 	s->patches[2].ops = &patch9;
 	s->patches[3].ops = &patch2;
-	s->patches[5].ops = &patch6;
+	s->patches[4].ops = &patch8;
+	s->patches[5].ops = &patch11;
+	s->patches[DUMMY_CHANNEL].ops = &patch6;
 	//s->patches[3].ops = &patch3;
 	//s->patches[4].ops = &patch5;
 	//s->patches[5].ops = &patch6;
 	//s->patches[0].ops = &patch4;
-	//s->patches[7].ops = &patch8;
 	//s->patches[8].ops = &patch9;
 
 
@@ -226,6 +429,7 @@ int pmsynth_init(struct pmsynth *s, struct audio_drv *audio, struct usart_drv *s
 			p->pmsynth = s;
 			memset(p->state, 0, PATCH_STATE_SIZE);
 			p->ops->init(p);
+			param_refresh(p);
 		}
 	}
 
@@ -240,6 +444,11 @@ int pmsynth_init(struct pmsynth *s, struct audio_drv *audio, struct usart_drv *s
 	svf2_ctrl_resonance(&s->opf,0.0f);
 	svf2_ctrl_cutoff(&s->opf, 12000.0f); // init lowpass at 12kHz
 
+	// measure the polyphony each patch can manage, then set it
+	pmsynth_calibrate(s);
+	update_polyphony(s);
+
+	screen_init();
 	update_patch();
 	update_exciter();
 	update_resonator();
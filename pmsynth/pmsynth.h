@@ -19,8 +19,6 @@ Physical Modelling Synthesizer
 
 //-----------------------------------------------------------------------------
 
-#define AUDIO_TS (1.f/AUDIO_FS)
-
 #define PI (3.1415927f)
 #define TAU (2.f * PI)
 #define INV_TAU (1.f/TAU)
@@ -51,10 +49,18 @@ Physical Modelling Synthesizer
 #define BUTTON_7 45
 #define BUTTON_8 36
 
+// sample rate of the current patch: 22050, 32000, 44100, 48000 Hz across
+// the control range
+#define RATE_SELECT 70
+
 // number of simultaneous voices
 #define NUM_VOICES 12 // Max number of voices (polyphony)
 
-#define NUM_IMPULSES 4 // Number of impulse samples saved on device
+// The recorded impulses are 0..4, the impulses through an instrument body
+// (commuted synthesis, see impulses/commute) follow them.
+#define IMPULSE_BODY 5 // first body impulse
+#define NUM_BODY_IMPULSES 4
+#define NUM_IMPULSES (IMPULSE_BODY + NUM_BODY_IMPULSES - 1) // highest impulse sample
 
 int current_patch_no; // what midi channel patch is currently playing
 int current_exciter_type; // for screen
@@ -77,6 +83,254 @@ void block_add(float *out, float *buf, size_t n);
 void block_add_k(float *out, float k, size_t n);
 void block_copy(float *dst, const float *src, size_t n);
 void block_copy_mul_k(float *dst, const float *src, float k, size_t n);
+float block_peak(const float *buf, size_t n);
+
+//-----------------------------------------------------------------------------
+// fixed point operations
+// The fixed point models use the Cortex-M4 dual 16-bit instructions. The C
+// versions are the reference for a host build and give the same results, so
+// the models can be checked bit exactly off target.
+
+// coefficients are Q15, samples are 16-bit with a per model format
+// convert a float to a Q15 coefficient (saturated)
+static inline int16_t q15(float x) {
+	if (x >= 1.f) {
+		return 32767;
+	}
+	if (x <= -1.f) {
+		return -32768;
+	}
+	return (int16_t) (x * 32768.f);
+}
+
+// convert a float to a Q31 coefficient (saturated)
+static inline int32_t q31(float x) {
+	if (x >= 1.f) {
+		return 0x7fffffff;
+	}
+	if (x <= -1.f) {
+		return -0x7fffffff - 1;
+	}
+	return (int32_t) (x * 2147483648.f);
+}
+
+// convert a float to a 16-bit sample with shift fraction bits (rounded, saturated)
+static inline int16_t q_sample(float x, int shift) {
+	x *= (float)(1 << shift);
+	if (x >= 32767.f) {
+		return 32767;
+	}
+	if (x <= -32768.f) {
+		return -32768;
+	}
+	return (int16_t) (x + ((x < 0.f) ? -0.5f : 0.5f));
+}
+
+// pack two 16-bit values, x in the bottom half and y in the top half
+static inline uint32_t q_pack(int16_t x, int16_t y) {
+	return (uint32_t) (uint16_t) x | ((uint32_t) (uint16_t) y << 16);
+}
+
+// Pack a (1 - x, x) pair of Q15 mix coefficients for q_smlad().
+// They sum to exactly 1.0, so a mix in a feedback loop doesn't lose level.
+static inline uint32_t q_mix(float x) {
+	int32_t k = (int32_t) (x * 32768.f + 0.5f);
+	if (k < 1) {
+		k = 1;
+	}
+	if (k > 32767) {
+		k = 32767;
+	}
+	return q_pack(32768 - k, k);
+}
+
+#if defined(__ARM_FEATURE_DSP)
+
+// dual multiply and accumulate: x.bottom * y.bottom + x.top * y.top + acc
+static inline int32_t q_smlad(uint32_t x, uint32_t y, int32_t acc) {
+	return (int32_t) __SMLAD(x, y, (uint32_t) acc);
+}
+
+// saturate to a signed 16-bit value
+static inline int32_t q_sat16(int32_t x) {
+	return __SSAT(x, 16);
+}
+
+#else
+
+static inline int32_t q_smlad(uint32_t x, uint32_t y, int32_t acc) {
+	int64_t lo = (int64_t) (int16_t) x *(int16_t) y;
+	int64_t hi = (int64_t) (int16_t) (x >> 16) * (int16_t) (y >> 16);
+	return (int32_t) (uint32_t) (lo + hi + acc);
+}
+
+static inline int32_t q_sat16(int32_t x) {
+	if (x > 32767) {
+		return 32767;
+	}
+	if (x < -32768) {
+		return -32768;
+	}
+	return x;
+}
+
+#endif
+
+// rounding constant for a Q15 product
+#define Q15_ROUND (1 << 14)
+
+// Q31 multiply (smull)
+static inline int32_t q31_mul(int32_t x, int32_t k) {
+	return (int32_t) (((int64_t) x * k) >> 31);
+}
+
+//-----------------------------------------------------------------------------
+// delay line storage
+// DL_FORMAT selects how the float models store their delay lines. The 16-bit
+// formats halve the delay line memory and traffic of a voice. The kernels
+// convert the samples as they read and write them.
+// DL_INT16 is fixed point with one scale (fraction bits) per model, see
+// WG_Q_SHIFT, WGB_Q_SHIFT, KSV_Q_SHIFT and WW_Q_SHIFT. The string, bar and
+// Karplus Strong loops lose energy on each pass and the woodwind jet limits
+// its loop, so the delay line peaks are bounded by the model and a fixed
+// scale covers them (pmsynth/test/dlformat_test.c checks this).
+// DL_HALF is IEEE half precision, converted with vcvtb/vcvtt on the target
+// (build with -mfp16-format=ieee) and in software on the host.
+
+#define DL_FLOAT 0
+#define DL_INT16 1
+#define DL_HALF 2
+
+#ifndef DL_FORMAT
+#define DL_FORMAT DL_FLOAT
+#endif
+
+// read a 16-bit fixed point sample with shift fraction bits
+static inline float dl16_rd(int16_t x, int shift) {
+	return (float)x * (1.f / (float)(1 << shift));
+}
+
+#if DL_FORMAT == DL_INT16
+
+typedef int16_t dl_t;
+
+static inline float dl_rd(dl_t x, int shift) {
+	return dl16_rd(x, shift);
+}
+
+static inline dl_t dl_wr(float x, int shift) {
+	return q_sample(x, shift);
+}
+
+#elif DL_FORMAT == DL_HALF && defined(__ARM_FP16_FORMAT_IEEE)
+
+typedef __fp16 dl_t;
+
+static inline float dl_rd(dl_t x, int shift) {
+	return (float)x;
+}
+
+static inline dl_t dl_wr(float x, int shift) {
+	return (dl_t) x;
+}
+
+#elif DL_FORMAT == DL_HALF
+
+typedef uint16_t dl_t;
+
+// half to float (software)
+static inline float dl_rd(dl_t x, int shift) {
+	union {
+		uint32_t u;
+		float f;
+	} v;
+	uint32_t sign = (uint32_t) (x & 0x8000) << 16;
+	uint32_t e = (x >> 10) & 0x1f;
+	uint32_t m = x & 0x3ff;
+	if (e == 0) {
+		// zero or subnormal (m * 2^-24)
+		v.f = (float)m * (1.f / 16777216.f);
+		v.u |= sign;
+	} else if (e == 31) {
+		v.u = sign | 0x7f800000 | (m << 13);
+	} else {
+		v.u = sign | ((e + 112) << 23) | (m << 13);
+	}
+	return v.f;
+}
+
+// float to half, round to nearest even (software)
+static inline dl_t dl_wr(float x, int shift) {
+	union {
+		float f;
+		uint32_t u;
+	} v = {x};
+	uint32_t sign = (v.u >> 16) & 0x8000;
+	int32_t e = (int32_t) ((v.u >> 23) & 0xff) - 112;
+	uint32_t m = v.u & 0x7fffff;
+	if (e >= 31) {
+		// overflow to infinity
+		return sign | 0x7c00;
+	}
+	if (e <= 0) {
+		// subnormal or zero
+		if (e < -10) {
+			return sign;
+		}
+		m |= 0x800000;
+		uint32_t shift_m = 14 - e;
+		uint32_t h = m >> shift_m;
+		uint32_t rem = m & ((1U << shift_m) - 1);
+		uint32_t half = 1U << (shift_m - 1);
+		if (rem > half || (rem == half && (h & 1))) {
+			h += 1;
+		}
+		return sign | h;
+	}
+	uint32_t h = ((uint32_t) e << 10) | (m >> 13);
+	uint32_t rem = m & 0x1fff;
+	if (rem > 0x1000 || (rem == 0x1000 && (h & 1))) {
+		// may carry into the exponent, which is correct
+		h += 1;
+	}
+	return sign | h;
+}
+
+#else
+
+typedef float dl_t;
+
+static inline float dl_rd(dl_t x, int shift) {
+	return x;
+}
+
+static inline dl_t dl_wr(float x, int shift) {
+	return x;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// delay line memory pool
+// The waveguide voices take their delay lines from a shared pool when they
+// start, sized for the note. Blocks are powers of two from DL_BLOCK_MIN
+// bytes up to the whole pool. The pool and the snapshot cache share the
+// core coupled memory.
+
+#define DL_POOL_BITS 15		// pool size (32KiB)
+#define DL_POOL_SIZE (1U << DL_POOL_BITS)
+#define DL_BLOCK_BITS 5		// smallest block (32 bytes)
+#define DL_BLOCK_MIN (1U << DL_BLOCK_BITS)
+#define DL_VOICE_BITS 11	// delay line budget for each voice (2KiB)
+#define DL_VOICE_SIZE (1U << DL_VOICE_BITS)
+
+void dl_pool_init(void);
+void *dl_alloc(size_t size);
+void dl_free(void *ptr, size_t size);
+size_t dl_size(size_t size);
+int dl_fits(size_t size);
+void dl_rotate(void *buf, size_t len, size_t ofs, size_t size);
+void dl_pool_stats(void);
 
 //-----------------------------------------------------------------------------
 // power functions
@@ -124,6 +378,7 @@ struct sin {
 	uint32_t xstep;		// current x-step
 };
 
+float cos_lookup(uint32_t x);
 float sin_eval(float x);
 float cos_eval(float x);
 float tan_eval(float x);
@@ -164,6 +419,7 @@ struct adsr {
 
 // generators
 void adsr_gen(struct adsr *e, float *out, size_t n);
+float adsr_sample(struct adsr *e);
 
 // envelopes
 void adsr_init(struct adsr *e, float a, float d, float s, float r);
@@ -171,14 +427,18 @@ void ad_init(struct adsr *e, float a, float d);
 
 // modulation
 void adsr_update(struct adsr *e, float a, float d, float s, float r);
+void adsr_copy(struct adsr *e, const struct adsr *src);
 
 // actions
 void adsr_attack(struct adsr *e);
+void adsr_retrigger(struct adsr *e);
 void adsr_release(struct adsr *e);
 void adsr_idle(struct adsr *e);
 
 // state
 int adsr_is_active(struct adsr *e);
+int adsr_is_attacking(struct adsr *e);
+int adsr_is_releasing(struct adsr *e);
 
 //-----------------------------------------------------------------------------
 // Karplus Strong
@@ -201,19 +461,55 @@ void ks_ctrl_attenuate(struct ks *osc, float attenuate);
 void ks_pluck(struct ks *osc);
 void ks_gen(struct ks *osc, float *out, size_t n);
 
+// Karplus Strong with a delay line sized for the note
+
+#define KSV_Q_SHIFT 14		// DL_INT16 scale, Q14 (+/- 2.0)
+#define KSV_DECAY_FREQ 440.f	// attenuate is the decay per period at this frequency
+
+struct ksv {
+	dl_t *delay;		// delay line (from the pool)
+	uint32_t size;		// delay line length (power of 2)
+	uint32_t w;		// write position
+	uint32_t d;		// integer part of the loop delay
+	float c;		// allpass coefficient (fractional part of the loop delay)
+	float b0, b1;		// loss filter coefficients
+	float x1;		// loss filter x(n-1)
+	float ap_x1;		// allpass x(n-1)
+	float ap_y1;		// allpass y(n-1) (and the held output)
+	uint32_t ds;		// the loop runs every ds samples
+	uint32_t ds_phase;	// samples since the last loop step (across blocks)
+	float freq;		// base frequency
+	float attenuate;	// decay per period at KSV_DECAY_FREQ
+	struct adsr adsr;
+};
+
+void ksv_init(struct ksv *osc);
+int ksv_alloc(struct ksv *osc, float freq);
+void ksv_stop(struct ksv *osc);
+void ksv_ctrl_frequency(struct ksv *osc, float freq);
+void ksv_ctrl_attenuate(struct ksv *osc, float attenuate);
+void ksv_pluck(struct ksv *osc);
+void ksv_gen(struct ksv *osc, float *out, size_t n);
+
 
 //-----------------------------------------------------------------------------
 // Woodwind synth
 
-#define WW_DELAY_BITS (8U)
-#define WW_DELAY_SIZE (1U << WW_DELAY_BITS)
+#define WW_Q_SHIFT 13		// DL_INT16 scale, Q13 (+/- 4.0)
+
+// jet nonlinearities (selected per patch)
+enum {
+	WW_JET_EXP,		// x - x * 2^x (interpolated table)
+	WW_JET_CUBIC,		// x - x^3 (polynomial)
+	WW_JET_NUM,
+};
 
+// The delay lines are allocated from the pool by ww_alloc(), and are
+// cleared as the note uses them.
 struct ww {
 	float freq;		// base frequency
 	float flute_out_old;
 	float dl_1_out; // output value from delay line 1
-	float dl_1[WW_DELAY_SIZE];
-	float dl_2[WW_DELAY_SIZE];
 	float dl_1_len_total;
 	float dl_2_len_total;
 	float dl_1_len_frac;
@@ -231,67 +527,143 @@ struct ww {
 	float dc_filt_in;
 	float dc_filt_out;
 	uint32_t downsample_amt; // downsampling by halving the length of the delay line
+	uint32_t downsample_base; // downsampling for the note (before the lod)
+	uint32_t ds_phase; // samples since the last model step (across blocks)
+	float hold; // output held between model steps
+	int lod; // level of detail
 	float r_1; // reflection coefs
 	float r_2;
 	float lp_filter_coef;
 	float noise_amt;
 	float vibrato_amt;
 	float velocity;
-
+	int jet; // jet nonlinearity (WW_JET_*)
+	uint32_t clear_len_1; // delay line samples cleared since ww_alloc
+	uint32_t clear_len_2;
+	uint32_t dl_size; // allocated length of each delay line
+	dl_t *dl_1;
+	dl_t *dl_2;
 };
 
 void ww_init(struct ww *osc);
+int ww_alloc(struct ww *osc, float freq);
+void ww_stop(struct ww *osc);
 void ww_set_velocity(struct ww *osc, float velocity);
 void ww_set_samplerate(struct ww *osc, float downsample_amt);
 void ww_ctrl_frequency(struct ww *osc, float freq);
 void ww_ctrl_attenuate(struct ww *osc, float attenuate);
 void ww_update_vib_noise(struct ww *osc, float vibrato_amt, float noise_amt);
 void ww_update_coefficients(struct ww *osc, float lp_filter_coef, float r_1, float r_2);
+void ww_ctrl_jet(struct ww *osc, int jet);
 void ww_blow(struct ww *osc);
 void ww_gen(struct ww *osc, float *out, size_t n);
+void ww_ctrl_lod(struct ww *osc, int lod);
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// 2D waveguide
+// 2D waveguide mesh
 
-#define MESH_LENGTH 8 
-#define MESH_WIDTH 8
-
-struct junction {
-	float vJ; // junction velocity
-	float vN; // velocity going north into junction
-	float vS; // velocity going south into junction
-	float vE; // velocity going east into junction
-	float vW; // velocity going west into junction
-	float vN1; // temp variables
-	float vS1;
-	float vE1;
-	float vW1;
-};
+#define MESH_SIZE 8		// junctions on each side
+#define MESH_SIZE_LOD 4		// junctions on each side for LOD_LOW
+#define MESH_STRIDE (MESH_SIZE + 2)	// row length, with a border column on each side
+#define MESH_CELLS (MESH_STRIDE * (MESH_SIZE + 2))
 
 struct wg_2d {
-	float freq;		// base frequency
-	float delay[KS_DELAY_SIZE];
-	float k;		// attenuation and averaging constant 0 to 0.5
-	uint32_t x;		// phase position
-	uint32_t xstep;		// phase step per sample
-	struct junction mesh[MESH_LENGTH][MESH_WIDTH];
+	float u[2][MESH_CELLS];	// junction values at n and n-1, the borders are zero
+	float a1;		// neighbour coefficient
+	float a0;		// centre coefficient
+	float g;		// loss per update
+	float k;		// exciter gain
+	float freq;		// fundamental frequency
+	float attenuate;	// decay per period
+	float ex, ey;		// excite position (0..1)
+	float px, py;		// pickup position (0..1)
+	float vel;		// velocity
+	uint16_t eidx;		// excite cell
+	uint16_t pidx;		// pickup cell
+	uint8_t cur;		// plane holding the junction values at n
+	uint8_t lod;		// level of detail
 
 	int estate; // excitement state (1 = excited, 0 = not)
 	uint32_t epos; // excitation sample position (in wavetable)
-	uint16_t einc; //how much to increment exciter sample pointer
-	uint16_t ephase; //phase for increment exciter sample pointer
 	int impulse;
 };
 
 void wg_2d_init(struct wg_2d *osc);
 void wg_2d_ctrl_frequency(struct wg_2d *osc, float freq);
 void wg_2d_ctrl_attenuate(struct wg_2d *osc, float attenuate);
+void wg_2d_ctrl_position(struct wg_2d *osc, float ex, float ey, float px, float py);
+void wg_2d_set_velocity(struct wg_2d *osc, float vel);
 void wg_2d_pluck(struct wg_2d *osc);
 void wg_2d_gen(struct wg_2d *osc, float *out, size_t n);
+void wg_2d_ctrl_lod(struct wg_2d *osc, int lod);
 // exciter
 float impulse_gen_2d(struct wg_2d *osc);
 
+//-----------------------------------------------------------------------------
+// modal resonator bank
+
+#define MODAL_MAX 24		// modes per voice
+
+// Modes updated together (a power of 2 that divides MODAL_MAX).
+// The host vectorises 4 at a time, the M4 runs pairs.
+#ifndef MODAL_LANES
+#if defined(__arm__)
+#define MODAL_LANES 2
+#else
+#define MODAL_LANES 4
+#endif
+#endif
+
+// a mode, relative to the note
+struct modal_mode {
+	float ratio;		// frequency ratio
+	float decay;		// t60 ratio
+	float gain;		// impulse response amplitude
+};
+
+struct modal_set {
+	int n;			// number of modes
+	const struct modal_mode *mode;
+};
+
+// mode sets
+extern const struct modal_set modal_membrane;
+extern const struct modal_set modal_plate;
+extern const struct modal_set modal_bar;
+extern const struct modal_set modal_bell;
+extern const struct modal_set modal_square_plate;
+
+struct modal {
+	// two pole resonators: y(n) = b * x(n) + a1 * y(n-1) - a2 * y(n-2)
+	float y1[MODAL_MAX];	// y(n-1)
+	float y2[MODAL_MAX];	// y(n-2)
+	float a1[MODAL_MAX];	// 2 * r * cos(w)
+	float a2[MODAL_MAX];	// r * r
+	float b[MODAL_MAX];	// gain * sin(w)
+	const struct modal_set *set;
+	float freq;		// note frequency
+	float attenuate;	// decay per period of the note
+	float damping;		// extra decay of the upper modes
+	float vel;		// velocity
+	int n;			// modes below nyquist
+	int lod;		// level of detail
+
+	int estate; // excitement state (1 = excited, 0 = not)
+	uint32_t epos; // excitation sample position (in wavetable)
+	int impulse;
+};
+
+void modal_init(struct modal *m);
+void modal_ctrl_set(struct modal *m, const struct modal_set *set);
+void modal_ctrl_frequency(struct modal *m, float freq);
+void modal_ctrl_attenuate(struct modal *m, float attenuate);
+void modal_ctrl_damping(struct modal *m, float damping);
+void modal_set_velocity(struct modal *m, float vel);
+void modal_pluck(struct modal *m);
+void modal_gen(struct modal *m, float *out, size_t n);
+void modal_ctrl_lod(struct modal *m, int lod);
+
 
 //-----------------------------------------------------------------------------
 // Filters
@@ -347,11 +719,28 @@ struct seq {
 };
 
 int seq_init(struct seq *s);
-void seq_exec(struct seq *s);
+size_t seq_next(struct seq *s, size_t n);
+void seq_advance(struct seq *s, size_t n);
 
 //-----------------------------------------------------------------------------
 // midi
 
+// Channel messages are timestamped on receipt and applied by the renderer
+// at (timestamp + latency), so they take effect on the exact sample.
+#define MIDI_QUEUE_SIZE 64	// must be a power of 2
+#define MIDI_BEND_RANGE 2.f	// pitch wheel range (+/- semitones)
+
+struct midi_rx;
+
+// timestamped midi message
+struct midi_msg {
+	uint32_t time;		// render time (in samples)
+	void (*func) (struct midi_rx * midi);	// event function
+	uint8_t status;		// message status byte
+	uint8_t arg0;		// message byte 0
+	uint8_t arg1;		// message byte 1
+};
+
 // midi message receiver
 struct midi_rx {
 	struct pmsynth *pmsynth;	// pointer back to the parent pmsynth state
@@ -360,9 +749,23 @@ struct midi_rx {
 	uint8_t status;		// message status byte
 	uint8_t arg0;		// message byte 0
 	uint8_t arg1;		// message byte 1
+	uint32_t time;		// rx time of the current byte (in samples)
+	uint32_t latency;	// rx to render latency (in samples), 0 = apply at the next block
+	uint32_t idle_time;	// rx time of the last rx line idle
+	uint32_t idle_idx;	// rx dma index at the last rx line idle
+	struct midi_msg queue[MIDI_QUEUE_SIZE];	// messages waiting to be rendered
+	volatile uint32_t q_rd;	// queue read index (renderer)
+	volatile uint32_t q_wr;	// queue write index (receiver)
+	uint32_t late;		// number of messages applied after their time
+	uint32_t dropped;	// number of messages dropped (queue full)
 };
 
+void midi_rx_init(struct midi_rx *midi, struct pmsynth *s, uint32_t latency);
+void midi_rx_latency(struct midi_rx *midi, uint32_t latency);
 void midi_rx_serial(struct midi_rx *midi, struct usart_drv *serial);
+void midi_rx_idle(struct midi_rx *midi, uint32_t time, uint32_t idx);
+void midi_apply(struct midi_rx *midi, uint32_t time);
+size_t midi_next(struct midi_rx *midi, uint32_t time, size_t n);
 float midi_map(uint8_t val, float a, float b);
 float midi_to_frequency(float note);
 float midi_pitch_bend(uint16_t val);
@@ -380,9 +783,10 @@ float midi_pitch_bend(uint16_t val);
 // key number in the lower 8 bits
 #define EVENT_KEY(x) ((x) & 0xffU)
 // midi message in the lower 3 bytes
+// (serial rx idle: the rx dma index, the event pointer is the rx time)
 #define EVENT_MIDI(x) ((x) & 0xffffffU)
-// audio block size in the lower 16 bits
-#define EVENT_BLOCK_SIZE(x) ((x) & 0xffffU)
+// audio render-ahead margin (in blocks) in the lower 16 bits
+#define EVENT_AUDIO_FILL(x) ((x) & 0xffffU)
 
 struct event {
 	uint32_t type;		// the event type
@@ -392,18 +796,34 @@ struct event {
 int event_init(void);
 int event_rd(struct event *event);
 int event_wr(uint32_t type, void *ptr);
+void event_stats(void);
 
 //-----------------------------------------------------------------------------
 // voices
 
-//#define VOICE_STATE_SIZE 1024
-#define VOICE_STATE_SIZE 4096
-// had to make this larger 
+// The waveguide delay lines are in the delay line pool, the largest voice
+// state is now the 2d mesh.
+#define VOICE_STATE_SIZE 1024
+
+// Level of detail: voices in their release tail, or well below the loudest
+// voice, are rendered with a cheaper version of their model.
+enum {
+	LOD_FULL,		// full quality
+	LOD_LOW,		// reduced rate/modes/grid
+};
+
+#define LOD_QUIET (0.0316f)	// -30dB from the loudest voice, go to LOD_LOW
+#define LOD_LOUD (0.1f)		// -20dB from the loudest voice, back to LOD_FULL
+#define VOICE_SILENT (1e-4f)	// -80dB, a released voice below this is stopped
 
 struct voice {
 	int idx;		// index in table
 	uint8_t note;		// current note
 	uint8_t channel;	// current channel
+	uint8_t lod;		// level of detail
+	float level;		// peak output level of the last generate
+	uint8_t note_pending;	// waiting for the first sound of a midi note on
+	uint32_t note_time;	// rx time of the midi note on (latency measurement)
 	struct patch *patch;	// patch in use
 	uint8_t state[VOICE_STATE_SIZE];	// per voice state
 };
@@ -412,6 +832,53 @@ struct voice *voice_lookup(struct pmsynth *s, uint8_t channel, uint8_t note);
 struct voice *voice_alloc(struct pmsynth *s, uint8_t channel, uint8_t note);
 void stop_voices(struct patch *p);
 void update_voices(struct patch *p, void (*func) (struct voice *));
+int voice_lod(struct voice *v, struct adsr *e);
+int voice_silent(struct adsr *e, const float *out, size_t n);
+
+//-----------------------------------------------------------------------------
+// patch parameters
+
+// Continuous controls are described by a per patch table. A control change
+// just records the value and sets a dirty bit. Once per block the renderer
+// maps the latest value of each dirty parameter into the patch state and
+// runs each distinct voice update function once on the patch's voices.
+// Smoothed parameters ramp to the new value over a number of blocks. The
+// voice updates for a ramp can run less often than every block, so the
+// expensive ones (delay lengths, envelope coefficients) run at a bounded rate.
+
+#define PARAM_MAX 16		// parameters per patch (the tables are checked with _Static_assert)
+#define PARAM_RAMP 8		// default ramp length (blocks)
+#define PARAM_PITCH_WHEEL 0x80	// pseudo control number for the pitch wheel
+
+// value curves
+enum {
+	PARAM_LINEAR,		// a..b
+	PARAM_LOG,		// logmap(a..b), 200Hz..15kHz
+	PARAM_BEND,		// 14 bit pitch wheel, semitones
+};
+
+struct param {
+	uint8_t ctrl;		// midi control number
+	uint8_t curve;		// value curve
+	int16_t ofs;		// offset of the float in the patch state (-1 = none)
+	float a, b;		// value range
+	void (*set) (struct patch * p, float x);	// patch level update (or NULL)
+	void (*update) (struct voice * v);	// per voice update (or NULL)
+	uint8_t ramp;		// ramp length in blocks (0 = jump, needs ofs >= 0)
+	uint8_t interval;	// blocks between voice updates while ramping (0 = 1)
+};
+
+// offset of a float in the patch state
+#define PARAM_STATE(x) offsetof(struct p_state, x)
+// table terminator
+#define PARAM_END {.ctrl = 0xff}
+
+int param_control_change(struct patch *p, uint8_t ctrl, uint8_t val);
+int param_pitch_wheel(struct patch *p, uint16_t val);
+void param_apply(struct pmsynth *s);
+void param_set_cutoff(struct patch *p, float x);
+void param_set_resonance(struct patch *p, float x);
+void param_refresh(struct patch *p);
 
 //-----------------------------------------------------------------------------
 // patches
@@ -428,7 +895,10 @@ struct patch_ops {
 	// patch functions
 	void (*init) (struct patch * p);
 	void (*control_change) (struct patch * p, uint8_t ctrl, uint8_t val);
-	void (*pitch_wheel) (struct patch * p, uint16_t val);
+	void (*pitch_wheel) (struct patch * p, uint16_t val);	// (or NULL for a PARAM_PITCH_WHEEL parameter)
+	void (*rate_change) (struct patch * p);	// re-derive rate dependent patch state (or NULL)
+	// continuous control parameters (or NULL)
+	const struct param *params;
 };
 
 #define PATCH_STATE_SIZE 128
@@ -437,6 +907,12 @@ struct patch {
 	struct pmsynth *pmsynth;	// pointer back to the parent pmsynth state
 	const struct patch_ops *ops;
 	uint8_t state[PATCH_STATE_SIZE];	// per patch state
+	uint32_t dirty;		// parameters changed since the last block
+	uint32_t ramping;	// parameters moving towards their target
+	uint32_t blocks;	// block counter for the ramp update interval
+	uint16_t param_val[PARAM_MAX];	// latest control value for each parameter
+	uint8_t param_ramp[PARAM_MAX];	// blocks left in each ramp
+	float param_target[PARAM_MAX];	// ramp target values
 };
 
 // implemented patches
@@ -451,6 +927,7 @@ extern const struct patch_ops patch7;
 extern const struct patch_ops patch8;
 extern const struct patch_ops patch9;
 extern const struct patch_ops patch10;
+extern const struct patch_ops patch11;
 
 //-----------------------------------------------------------------------------
 
@@ -458,6 +935,17 @@ extern const struct patch_ops patch10;
 // number of concurrent channels
 #define NUM_CHANNELS 16
 
+// latency statistics (in samples)
+struct latency {
+	uint32_t n;		// number of measurements
+	uint32_t min, max;
+	uint32_t sum;
+};
+
+// Blocks are split at event boundaries, quantised to this many samples.
+// The block operations are unrolled x4, so this must be a multiple of 4.
+#define AUDIO_SPLIT_SIZE 4
+
 struct pmsynth {
 	struct audio_drv *audio;	// audio output
 	struct usart_drv *serial;	// serial port for midi interface
@@ -467,21 +955,133 @@ struct pmsynth {
 	struct voice voices[NUM_VOICES];	// voices
 	int voice_idx;		// FIXME round robin voice allocation
 	struct svf2 opf; // filter for the output
+	volatile uint32_t rate;	// requested sample rate, applied by the main loop
+	float level_max;	// loudest voice level in the last block (lod reference)
+	float level_peak;	// loudest voice level in this block
+	struct latency note_latency;	// midi note on to sound latency
+	uint8_t polyphony[NUM_CHANNELS];	// calibrated voices per channel (0 = not calibrated)
 };
 
 int pmsynth_init(struct pmsynth *s, struct audio_drv *audio, struct usart_drv *midi);
 int pmsynth_run(struct pmsynth *s);
+void pmsynth_render(struct pmsynth *s);
+int pmsynth_set_rate(struct pmsynth *s, uint32_t rate);
+void pmsynth_ring_depth(struct pmsynth *s, uint32_t depth);
+
+//-----------------------------------------------------------------------------
+// polyphony calibration
+
+// fraction of the block period the voices may use
+#ifndef CALIBRATE_MARGIN
+#define CALIBRATE_MARGIN 0.7f
+#endif
+
+void pmsynth_calibrate(struct pmsynth *s);
+
+//-----------------------------------------------------------------------------
+// excitation snapshot cache
+// A note on for a silent waveguide always evolves the same way until the
+// impulse has been injected. The first note records the output and the
+// model state at the end of the impulse. Later notes with the same key play
+// back the output and restore the state.
+
+// The cache is off by default. The entries (about 16KiB each) share the ccm
+// with the delay line pool and only 2 fit next to it. The key includes the
+// note frequency, so 2 entries only help a repeated note. The pool has to
+// keep its size for the voice budgets. Build with SNAP_ENTRIES=2 to try it.
+#ifndef SNAP_ENTRIES
+#define SNAP_ENTRIES 0		// number of cached snapshots (0 = no cache)
+#endif
+#define SNAP_OUT_SIZE 6144	// longest excitation (samples)
+#define SNAP_KEY_SIZE 8
+
+enum {
+	SNAP_IDLE,
+	SNAP_PLAY,		// playing back a snapshot
+	SNAP_RECORD,		// recording a snapshot
+};
+
+// model identifiers
+enum {
+	SNAP_WG = 1,
+	SNAP_WGB,
+};
+
+// everything the excitation depends on
+struct snap_key {
+	uint32_t model;
+	uint32_t k[SNAP_KEY_SIZE];
+};
+
+// per voice snapshot state
+struct snap {
+	void *entry;		// entry being played or recorded
+	uint32_t gen;		// entry generation (changes if it is reused)
+	uint16_t idx;		// output sample index
+	uint8_t mode;		// SNAP_IDLE, SNAP_PLAY, SNAP_RECORD
+};
+
+// float key values are compared as bits
+static inline uint32_t snap_float(float x) {
+	union {
+		float f;
+		uint32_t u;
+	} v = {x};
+	return v.u;
+}
+
+void snap_init(void);
+int snap_lookup(struct snap *sn, const struct snap_key *key);
+const void *snap_state(struct snap *sn);
+size_t snap_play(struct snap *sn, float *out, size_t n, float k);
+void snap_record(struct snap *sn, float x);
+void *snap_finish(struct snap *sn, const struct snap_key *key);
+void snap_cancel(struct snap *sn);
+void snap_stats(void);
 
 //-----------------------------------------------------------------------------
 // Waveguide synth
 
-#define WG_DELAY_BITS (8U) //increased from 7
-#define WG_DELAY_SIZE (1U << WG_DELAY_BITS) // this is the max delay size
+#define WG_SNAP_LEN 256		// longest delay line a snapshot holds
+
+// WG_Q15 builds the 1D and banded waveguides in fixed point: the delay lines
+// are 16-bit and the kernels use saturating 16-bit arithmetic.
+#ifndef WG_Q15
+#define WG_Q15 0
+#endif
+
+// fixed point delay line formats
+#define WG_Q_SHIFT 14		// 1D string, Q14 (+/- 2.0)
+#define WGB_Q_SHIFT 13		// banded modes, Q13 (+/- 4.0)
+
+// The float kernels use the DL_FORMAT storage (the shifts are the DL_INT16
+// scales), the fixed point kernels are always 16-bit.
+#if WG_Q15
+typedef int16_t wg_t;		// waveguide delay line sample
+
+static inline float wg_rd(wg_t x, int shift) {
+	return dl16_rd(x, shift);
+}
 
+static inline wg_t wg_wr(float x, int shift) {
+	return q_sample(x, shift);
+}
+#else
+typedef dl_t wg_t;
+
+static inline float wg_rd(wg_t x, int shift) {
+	return dl_rd(x, shift);
+}
+
+static inline wg_t wg_wr(float x, int shift) {
+	return dl_wr(x, shift);
+}
+#endif
+
+// The delay lines are allocated from the pool by wg_alloc(), and are
+// cleared as the note uses them.
 struct wg {
 	float freq;		// base frequency
-	float delay_l[WG_DELAY_SIZE];		// left travelling wave
-	float delay_r[WG_DELAY_SIZE];		//right travelling wave
 	float r;		// reflection constant
 	uint32_t epos; // excitation sample position (in wavetable)
 	int estate; // excitement state (1 = excited, 0 = not)
@@ -490,6 +1090,7 @@ struct wg {
 	uint32_t delay_len; // length of delay line
 	float delay_len_frac; // extra fractional delay length
 	float delay_len_total; // total fractional delay length
+	float out_frac; // output scaling (from the full rate delay_len_frac)
 	float a; // all-pass filter coefficient
 	uint32_t excite_pos;// excitement location
 	float excite_loc; // percentage location of exciter
@@ -505,15 +1106,28 @@ struct wg {
 	float ap_stiff; // all pass filter "stiffness"
 	float velocity;
 	uint32_t downsample_amt; // downsampling by halving the length of the delay line
+	uint32_t downsample_base; // downsampling for the note (before the lod)
+	uint32_t ds_phase; // samples since the last model step (across blocks)
+	float hold; // output held between model steps
+	float hold_y; // model output held between model steps (for the snapshot)
+	int lod; // level of detail
 	float lp_coef_a; //not implemented - for breath control
 	float lp_coef_b;
 	int tube; //positive or negative reflection?
 	struct adsr adsr;
 	int impulse; // what impulse should we use to excite the waveguide?
 	int impulse_solo; // should i solo the impulse?
+	int fresh; // silent since wg_init
+	int retrigger; // strike a ringing string in place
+	struct snap snap; // excitation snapshot
+	uint32_t clear_len; // delay line samples cleared since wg_alloc
+	uint32_t delay_size; // allocated length of each delay line
+	wg_t *delay_l;		// left travelling wave
+	wg_t *delay_r;		//right travelling wave
 };
 
 void wg_init(struct wg *osc);
+int wg_alloc(struct wg *osc, float freq);
 void wg_ctrl_frequency(struct wg *osc, float freq);
 void wg_ctrl_reflection(struct wg *osc, float reflection);
 void wg_ctrl_stiffness(struct wg *osc, float stiffness);
@@ -525,10 +1139,19 @@ void wg_gen(struct wg *osc, float *out, size_t n);
 void wg_set_samplerate(struct wg *osc, float downsample_amt);
 void wg_exciter_type(struct wg *osc, int exciter_type);
 void wg_ctrl_impulse_type(struct wg *osc, int impulse);
+void wg_ctrl_lod(struct wg *osc, int lod);
+void wg_stop(struct wg *osc);
 //
 //-----------------------------------------------------------------------------
 //exciter
 
+struct impulse_table {
+	const int16_t *data;
+	uint16_t len;
+};
+
+extern const struct impulse_table impulse_body[NUM_BODY_IMPULSES];
+
 float impulse_lookup(int16_t x, int impulse, uint32_t *epos, int *estate);
 float impulse_gen(struct wg *osc);
 
@@ -536,13 +1159,14 @@ float impulse_gen(struct wg *osc);
 //-----------------------------------------------------------------------------
 // banded waveguide synth
 
-#define WGB_DELAY_BITS (8U)
-#define WGB_DELAY_SIZE (1U << WGB_DELAY_BITS)
+#define WGB_SNAP_LEN 256	// longest mode delay line a snapshot holds
 #define NUM_MODES (3) // 3 modes (reduced from 4)
+#define WGB_LOD_MODES (1) // modes used at LOD_LOW
 
+// As for the 1D waveguide, the delay lines are allocated from the pool and
+// cleared as they are used.
 struct mode {
 	float freq_coef; // frequency coefficient of this mode (eg 1 = base freq)
-	float delay[WGB_DELAY_SIZE];
 	struct svf2 bpf; // bandpass for each mode
 	uint32_t dl_ptr_in;
 	uint32_t dl_ptr_out;
@@ -550,16 +1174,22 @@ struct mode {
 	uint32_t dl_ptr_lin_tuner_2;
 	uint32_t delay_len;
 	uint32_t downsample_amt;
+	uint32_t ds_phase; // samples since the last step of this mode (across blocks)
 	float mix_factor;
 	float delay_len_frac;
 	float delay_len_total;
+	uint32_t clear_len; // delay line samples cleared since wgb_alloc
+#if WG_Q15
+	int32_t ic1, ic2; // fixed point bandpass state (Q24)
+#endif
+	uint32_t delay_size; // allocated length of the delay line
+	wg_t *delay;
 };
 
 struct wgb {
 	uint32_t epos; // excitation sample position (in wavetable)
 	int estate; // excitement state (1 = excited, 0 = not)
 	float freq;		// base frequency
-	struct mode mode[NUM_MODES];
 	float bp_res; // bp filter coef
 	struct adsr adsr;
 	float velocity;
@@ -571,11 +1201,20 @@ struct wgb {
 	float reflection_adjust;
 	float impulse_solo;
 	int resonator_type;
+	int lod; // level of detail
+	size_t num_modes; // modes being generated
+	int fade; // fading out the upper modes
+	float prev; // previous output sample (before the envelope)
+	int fresh; // silent since wgb_init
+	int retrigger; // strike a ringing bar in place
+	struct snap snap; // excitation snapshot
+	struct mode mode[NUM_MODES];
 };
 // for exciter!
 float impulse_gen_wgb(struct wgb *osc);
 
 void wgb_init(struct wgb *osc);
+int wgb_alloc(struct wgb *osc, float freq);
 void wgb_ctrl_frequency(struct wgb *osc, float freq);
 void wgb_ctrl_attenuate(struct wgb *osc, float attenuate);
 void wgb_pluck(struct wgb *osc);
@@ -589,6 +1228,8 @@ void wgb_ctrl_impulse_solo(struct wgb *osc, int impulse_solo);
 void wgb_ctrl_impulse_type(struct wgb *osc, int impulse);
 void wgb_ctrl_brightness(struct wgb *osc, float brightness) ;
 void wgb_ctrl_resonator_type(struct wgb *osc, int resonator_type);
+void wgb_ctrl_lod(struct wgb *osc, int lod);
+void wgb_stop(struct wgb *osc);
 
 //-----------------------------------------------------------------------------
 // Handler functions
@@ -596,8 +1237,22 @@ void wgb_ctrl_resonator_type(struct wgb *osc, int resonator_type);
 void goto_next_patch(struct patch *p);
 void update_resonator();
 void update_patch();
-void update_polyphony();
+void update_polyphony(struct pmsynth *s);
+void update_samplerate(struct pmsynth *s);
+void select_samplerate(struct pmsynth *s, uint8_t val);
 void update_exciter();
+void update_screen(void);
+void screen_init(void);
+
+// screen update messages
+enum {
+	SCREEN_PATCH,		// val = patch number
+	SCREEN_EXCITER,		// val = exciter type
+	SCREEN_RESONATOR,	// val = resonator type
+	SCREEN_VALUE,		// id = midi control, val = value
+};
+
+void screen_post(int type, int id, int val);
 
 //-----------------------------------------------------------------------------
 
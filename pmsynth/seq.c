@@ -3,8 +3,9 @@
 
 Note Sequencer
 
-The sequencer clock is the rate blocks of audio samples are sent to the audio CODEC.
+The sequencer clock is the audio sample rate.
 This is divided down to give the desired beats per minute.
+The renderer splits audio blocks at ticks, so notes start on the exact sample.
 Each beat is a quarter note. Each beat is divided into TICKS_PER_BEAT ticks.
 Note durations are specified with a tick count.
 
@@ -20,7 +21,6 @@ Note durations are specified with a tick count.
 
 #define TICKS_PER_BEAT (16)
 #define SECS_PER_MIN (60.f)
-#define SECS_PER_BLOCK (AUDIO_BLOCK_SIZE / AUDIO_FS)
 
 //-----------------------------------------------------------------------------
 // Note durations
@@ -302,12 +302,25 @@ static uint8_t tune[] = {
 
 //-----------------------------------------------------------------------------
 
-void seq_exec(struct seq *s) {
+// return the number of samples (<= n) until the next tick
+size_t seq_next(struct seq *s, size_t n) {
+	if (s->m0.s_state == S_STATE_STOP) {
+		return n;
+	}
+	float k = (s->secs_per_tick - s->tick_error) * audio_fs;
+	if (k <= 0.f) {
+		return 0;
+	}
+	return (k < (float)n) ? (size_t) k + 1 : n;
+}
+
+// advance the sequencer by n samples
+void seq_advance(struct seq *s, size_t n) {
 	// The desired BPM will generally not correspond to an integral number
-	// of audio blocks, so accumulate an error and tick when needed.
+	// of audio samples, so accumulate an error and tick when needed.
 	// ie- Bresenham style.
-	s->tick_error += SECS_PER_BLOCK;
-	if (s->tick_error > s->secs_per_tick) {
+	s->tick_error += (float)n * audio_ts;
+	if (s->tick_error >= s->secs_per_tick) {
 		s->tick_error -= s->secs_per_tick;
 		// tick...
 		s->ticks++;
@@ -323,9 +336,6 @@ int seq_init(struct seq *s) {
 	s->secs_per_tick = SECS_PER_MIN / (s->beats_per_min * (float)TICKS_PER_BEAT);
 	DBG("secs_per_tick %08x\r\n", *(uint32_t *) & s->secs_per_tick);
 
-	float secs_per_block = SECS_PER_BLOCK;
-	DBG("secs_per_block %08x\r\n", *(uint32_t *) & secs_per_block);
-
 	s->m0.prog = tune;
 	s->m0.s_state = S_STATE_RUN;
 	s->m0.s_state = S_STATE_STOP;
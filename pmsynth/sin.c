@@ -58,7 +58,7 @@ static const int32_t COS_LUT_data[COS_LUT_SIZE << 1] = {
 #define COS_SCALE (1.f/(float)(1U << 30))
 
 // frequency to x scaling (xrange/fs)
-#define FREQ_SCALE ((float)(1ULL << 32) / AUDIO_FS)
+#define FREQ_SCALE ((float)(1ULL << 32) * audio_ts)
 
 //-----------------------------------------------------------------------------
 
@@ -5197,6 +5197,19 @@ float impulse_lookup(int16_t x, int impulse, uint32_t *epos, int *estate) {
 		break;
 	
 	default:
+		if (impulse >= IMPULSE_BODY && impulse <= NUM_IMPULSES) {
+			// impulse through an instrument body
+			const struct impulse_table *t = &impulse_body[impulse - IMPULSE_BODY];
+			y = t->data[x];
+
+			*epos +=1;
+
+			if (*epos >= (uint32_t)t->len - 4) {
+				*epos = 0;
+				*estate = 0;
+			}
+			break;
+		}
 		y = mallet_hit_LUT_data[x];
 		break;
 	}
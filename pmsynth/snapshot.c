@@ -0,0 +1,228 @@
+//-----------------------------------------------------------------------------
+/*
+
+Excitation Snapshot Cache
+
+When a silent waveguide is excited, the output and the state at the end of
+the impulse depend only on the model parameters. The model passes those as
+a key on note on. A miss records the output (Q12, pre velocity) and then the
+model state when the impulse finishes. A hit plays the output back and the
+model restores the state, so the note skips the excitation. Velocity only
+scales the output of these models, so it's applied on playback and isn't
+part of the key.
+
+The entries are reused least recently used first. An entry isn't evicted
+while it's being recorded, but it may be while it's being played. A voice
+that loses its entry stops playback early and carries on from the state it
+restored.
+
+The cache shares the 64KiB core coupled memory with the delay line pool
+(32KiB), so at most 2 entries fit. The total is checked at compile time.
+That's too few to be worth the memory, so the cache is off by default
+(SNAP_ENTRIES 0, see pmsynth.h).
+
+*/
+//-----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "pmsynth.h"
+
+#define DEBUG
+#include "logging.h"
+
+//-----------------------------------------------------------------------------
+
+// the largest model state (the banded waveguide modes and delay lines)
+#define SNAP_STATE_SIZE (NUM_MODES * (sizeof(struct mode) + WGB_SNAP_LEN * sizeof(wg_t)) + 4 * sizeof(uint32_t))
+
+// output sample scaling (Q12, +/- 8.0)
+#define SNAP_SHIFT 12
+#define SNAP_SCALE ((float)(1 << SNAP_SHIFT))
+
+// core coupled memory size (the cache and the delay line pool)
+#define SNAP_CCM_SIZE (64U << 10)
+
+enum {
+	ENTRY_EMPTY,
+	ENTRY_RECORDING,
+	ENTRY_VALID,
+};
+
+struct snap_entry {
+	struct snap_key key;
+	uint32_t gen;		// incremented when the entry is reused
+	uint32_t used;		// time of last use
+	uint16_t len;		// output samples
+	uint8_t state;		// ENTRY_EMPTY, ENTRY_RECORDING, ENTRY_VALID
+	int16_t out[SNAP_OUT_SIZE];	// output samples
+	uint8_t data[SNAP_STATE_SIZE] ALIGN(4);	// model state
+};
+
+_Static_assert(SNAP_ENTRIES * sizeof(struct snap_entry) + DL_POOL_SIZE <= SNAP_CCM_SIZE, "the snapshot cache and the delay line pool don't fit in the ccm");
+
+#if SNAP_ENTRIES > 0
+static struct snap_entry snap_cache[SNAP_ENTRIES] CCMRAM;
+#endif
+
+static uint32_t snap_time;	// lookup counter (lru time)
+static uint32_t snap_lookups;
+static uint32_t snap_hits;
+static uint32_t snap_records;
+static uint32_t snap_discards;
+
+//-----------------------------------------------------------------------------
+
+// discard the snapshot being recorded
+static void snap_discard(struct snap_entry *e) {
+	e->state = ENTRY_EMPTY;
+	e->used = 0;
+	snap_discards += 1;
+}
+
+// Lookup a snapshot for a silent voice being excited.
+// Return SNAP_PLAY for a hit (restore the state from snap_state() and play
+// the output), SNAP_RECORD for a miss that should be recorded, or SNAP_IDLE.
+int snap_lookup(struct snap *sn, const struct snap_key *key) {
+	sn->entry = NULL;
+	sn->idx = 0;
+	sn->mode = SNAP_IDLE;
+#if SNAP_ENTRIES > 0
+	struct snap_entry *victim = NULL;
+	snap_time += 1;
+	snap_lookups += 1;
+	for (int i = 0; i < SNAP_ENTRIES; i++) {
+		struct snap_entry *e = &snap_cache[i];
+		int match = (e->state != ENTRY_EMPTY) && (memcmp(&e->key, key, sizeof(struct snap_key)) == 0);
+		if (e->state == ENTRY_VALID && match) {
+			e->used = snap_time;
+			snap_hits += 1;
+			sn->entry = e;
+			sn->gen = e->gen;
+			sn->mode = SNAP_PLAY;
+			return SNAP_PLAY;
+		}
+		if (e->state == ENTRY_RECORDING) {
+			if (match) {
+				// another voice is recording this one
+				return SNAP_IDLE;
+			}
+			continue;
+		}
+		if (victim == NULL || e->used < victim->used) {
+			victim = e;
+		}
+	}
+	if (victim) {
+		victim->key = *key;
+		victim->gen += 1;
+		victim->used = snap_time;
+		victim->len = 0;
+		victim->state = ENTRY_RECORDING;
+		sn->entry = victim;
+		sn->gen = victim->gen;
+		sn->mode = SNAP_RECORD;
+	}
+#endif
+	return sn->mode;
+}
+
+// return the model state for a hit
+const void *snap_state(struct snap *sn) {
+	struct snap_entry *e = sn->entry;
+	return e->data;
+}
+
+// Play back up to n output samples scaled by k.
+// Returns the number of samples. Playback is finished when mode is SNAP_IDLE.
+size_t snap_play(struct snap *sn, float *out, size_t n, float k) {
+	struct snap_entry *e = sn->entry;
+	size_t m = 0;
+	if (e->gen == sn->gen) {
+		m = e->len - sn->idx;
+		if (m > n) {
+			m = n;
+		}
+		const int16_t *src = &e->out[sn->idx];
+		k *= 1.f / SNAP_SCALE;
+		for (size_t i = 0; i < m; i++) {
+			out[i] = k * (float)src[i];
+		}
+		sn->idx += m;
+	}
+	if (e->gen != sn->gen || sn->idx >= e->len) {
+		sn->entry = NULL;
+		sn->mode = SNAP_IDLE;
+	}
+	return m;
+}
+
+// record an output sample
+void snap_record(struct snap *sn, float x) {
+	struct snap_entry *e = sn->entry;
+	if (sn->idx >= SNAP_OUT_SIZE) {
+		// the excitation is too long to cache
+		snap_cancel(sn);
+		return;
+	}
+	e->out[sn->idx++] = q_sample(x, SNAP_SHIFT);
+}
+
+// The excitation has finished.
+// key is the current model key, if it changed during the recording the
+// snapshot is discarded. Otherwise return the buffer for the model state.
+void *snap_finish(struct snap *sn, const struct snap_key *key) {
+	struct snap_entry *e = sn->entry;
+	sn->entry = NULL;
+	sn->mode = SNAP_IDLE;
+	if (sn->idx == 0 || memcmp(&e->key, key, sizeof(struct snap_key)) != 0) {
+		snap_discard(e);
+		return NULL;
+	}
+	e->len = sn->idx;
+	e->state = ENTRY_VALID;
+	snap_records += 1;
+	return e->data;
+}
+
+// stop playing or recording (the voice is being stopped)
+void snap_cancel(struct snap *sn) {
+	if (sn->mode == SNAP_RECORD) {
+		snap_discard(sn->entry);
+	}
+	sn->entry = NULL;
+	sn->mode = SNAP_IDLE;
+}
+
+//-----------------------------------------------------------------------------
+
+// display the cache statistics
+void snap_stats(void) {
+	if (SNAP_ENTRIES == 0) {
+		return;
+	}
+	uint32_t rate = (snap_lookups) ? (100 * snap_hits) / snap_lookups : 0;
+	DBG("snapshots %d x %d bytes, hits %d/%d (%d%%), recorded %d discarded %d\r\n",
+	    SNAP_ENTRIES, (int)sizeof(struct snap_entry), snap_hits, snap_lookups, rate, snap_records, snap_discards);
+}
+
+// Empty the cache.
+// Called at startup (the ccm isn't cleared) and when the sample rate changes.
+// Any voices using the cache must be stopped first.
+void snap_init(void) {
+#if SNAP_ENTRIES > 0
+	for (int i = 0; i < SNAP_ENTRIES; i++) {
+		struct snap_entry *e = &snap_cache[i];
+		e->gen += 1;
+		e->used = 0;
+		e->state = ENTRY_EMPTY;
+	}
+#endif
+	snap_time = 0;
+	snap_lookups = 0;
+	snap_hits = 0;
+	snap_records = 0;
+	snap_discards = 0;
+}
+
+//-----------------------------------------------------------------------------
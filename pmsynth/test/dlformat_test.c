@@ -0,0 +1,225 @@
+//-----------------------------------------------------------------------------
+/*
+
+Delay Line Format Test (host)
+
+The test is built for each DL_FORMAT. The float build (dl_ref) renders a
+string, a bar, a Karplus Strong string and a woodwind note and writes the
+outputs and the delay line peaks to a file. The int16 (dl_int16) and half
+(dl_half) builds render the same notes and check them against the float
+output.
+
+The int16 format has a fixed scale per model, so the test also checks that
+the float delay line peaks are inside the range of that scale. The woodwind
+oscillates, and a small change in its loop moves the phase of the output.
+So it's compared by its delay line peak rather than sample by sample.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "model.h"
+#include "utils.h"
+
+//-----------------------------------------------------------------------------
+
+// 0.5 secs of each note, in whole blocks
+#define RENDER_LEN (MODEL_FS / 2 / AUDIO_BLOCK_SIZE * AUDIO_BLOCK_SIZE)
+
+enum {
+	MODEL_STRING,
+	MODEL_BANDED,
+	MODEL_KSV,
+	MODEL_WW,
+	NUM_MODELS,
+};
+
+struct result {
+	float out[NUM_MODELS][RENDER_LEN];
+	float peak[NUM_MODELS];	// largest delay line sample
+};
+
+static struct result res;
+
+//-----------------------------------------------------------------------------
+
+// track the largest delay line sample
+static void dl_peak(float *peak, const dl_t *x, size_t n, int shift) {
+	for (size_t i = 0; i < n; i++) {
+		float y = fabsf(dl_rd(x[i], shift));
+		if (y > *peak) {
+			*peak = y;
+		}
+	}
+}
+
+static void render_string(float *out, float *peak) {
+	static struct wg osc;
+	wg_init(&osc);
+	wg_alloc(&osc, mtof(45.f));
+	adsr_init(&osc.adsr, 0.f, 1.f, 1.f, 1.f);
+	wg_ctrl_frequency(&osc, mtof(45.f));
+	wg_exciter_type(&osc, 0);
+	wg_ctrl_impulse_type(&osc, 0);
+	wg_ctrl_reflection(&osc, -0.99f);
+	wg_ctrl_stiffness(&osc, 1.f);
+	wg_ctrl_pos(&osc, 0.25f);
+	wg_set_velocity(&osc, 1.f);
+	adsr_attack(&osc.adsr);
+	wg_excite(&osc);
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		wg_gen(&osc, &out[i], AUDIO_BLOCK_SIZE);
+		dl_peak(peak, osc.delay_l, 2 * osc.delay_size, WG_Q_SHIFT);
+	}
+	wg_stop(&osc);
+}
+
+static void render_banded(float *out, float *peak) {
+	static struct wgb osc;
+	wgb_init(&osc);
+	wgb_alloc(&osc, mtof(57.f));
+	adsr_init(&osc.adsr, 0.f, 1.f, 1.f, 1.f);
+	wgb_ctrl_frequency(&osc, mtof(57.f));
+	wgb_ctrl_attenuate(&osc, 0.99f);
+	wgb_ctrl_brightness(&osc, 1.f);
+	wgb_ctrl_mode_mix_amt(&osc, 0.1f);
+	wgb_ctrl_harmonic_mod(&osc, 0.f);
+	wgb_ctrl_resonator_type(&osc, 3);
+	wgb_set_velocity(&osc, 1.f);
+	adsr_attack(&osc.adsr);
+	wgb_pluck(&osc);
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		wgb_gen(&osc, &out[i], AUDIO_BLOCK_SIZE);
+		for (int j = 0; j < NUM_MODES; j++) {
+			dl_peak(peak, osc.mode[j].delay, osc.mode[j].delay_size, WGB_Q_SHIFT);
+		}
+	}
+	wgb_stop(&osc);
+}
+
+static void render_ksv(float *out, float *peak) {
+	static struct ksv osc;
+	rand_init(1);
+	ksv_init(&osc);
+	ksv_alloc(&osc, mtof(45.f));
+	adsr_init(&osc.adsr, 0.f, 1.f, 1.f, 1.f);
+	ksv_ctrl_frequency(&osc, mtof(45.f));
+	ksv_ctrl_attenuate(&osc, 0.995f);
+	adsr_attack(&osc.adsr);
+	ksv_pluck(&osc);
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		ksv_gen(&osc, &out[i], AUDIO_BLOCK_SIZE);
+		dl_peak(peak, osc.delay, osc.size, KSV_Q_SHIFT);
+	}
+	ksv_stop(&osc);
+}
+
+// blow a note (patch 9 defaults)
+static void render_ww(float *out, float *peak) {
+	static struct ww osc;
+	rand_init(1);
+	ww_init(&osc);
+	ww_alloc(&osc, mtof(57.f));
+	adsr_init(&osc.adsr, 0.1f, 2.f, 1.f, 1.f);
+	sin_init(&osc.vibrato);
+	sin_ctrl_frequency(&osc.vibrato, 50.f);
+	ww_ctrl_frequency(&osc, mtof(57.f));
+	ww_update_coefficients(&osc, 0.6f, 0.42f, 0.53f);
+	ww_update_vib_noise(&osc, 0.008f, 0.0085f);
+	ww_ctrl_jet(&osc, WW_JET_EXP);
+	ww_set_velocity(&osc, 1.f);
+	adsr_attack(&osc.adsr);
+	ww_blow(&osc);
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		ww_gen(&osc, &out[i], AUDIO_BLOCK_SIZE);
+		dl_peak(peak, osc.dl_1, 2 * osc.dl_size, WW_Q_SHIFT);
+	}
+	ww_stop(&osc);
+}
+
+static void render(struct result *r) {
+	dl_pool_init();
+	snap_init();
+	render_string(r->out[MODEL_STRING], &r->peak[MODEL_STRING]);
+	render_banded(r->out[MODEL_BANDED], &r->peak[MODEL_BANDED]);
+	render_ksv(r->out[MODEL_KSV], &r->peak[MODEL_KSV]);
+	render_ww(r->out[MODEL_WW], &r->peak[MODEL_WW]);
+}
+
+//-----------------------------------------------------------------------------
+
+#if DL_FORMAT == DL_FLOAT
+
+int main(int argc, char *argv[]) {
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <reference file>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	render(&res);
+	FILE *f = fopen(argv[1], "wb");
+	if (f == NULL) {
+		perror(argv[1]);
+		return EXIT_FAILURE;
+	}
+	fwrite(&res, sizeof(struct result), 1, f);
+	fclose(f);
+	return EXIT_SUCCESS;
+}
+
+#else
+
+static const char *model_name[NUM_MODELS] = { "string", "banded", "ksv", "woodwind" };
+
+// int16 scale of each model
+static const int model_shift[NUM_MODELS] = { WG_Q_SHIFT, WGB_Q_SHIFT, KSV_Q_SHIFT, WW_Q_SHIFT };
+
+// error bounds (dB), the woodwind is checked by its peak
+static const double int16_snr_min[NUM_MODELS] = { 43.0, 49.0, 65.0, 0.0 };
+static const double half_snr_min[NUM_MODELS] = { 59.0, 60.0, 60.0, 0.0 };
+#define WW_PEAK_ERR 0.001	// relative
+
+int main(int argc, char *argv[]) {
+	static struct result ref;
+	const char *fmt = (DL_FORMAT == DL_INT16) ? "int16" : "half";
+	const double *snr_min = (DL_FORMAT == DL_INT16) ? int16_snr_min : half_snr_min;
+	int rc = 0;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <reference file>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	FILE *f = fopen(argv[1], "rb");
+	if (f == NULL) {
+		perror(argv[1]);
+		return EXIT_FAILURE;
+	}
+	size_t n = fread(&ref, sizeof(struct result), 1, f);
+	fclose(f);
+	if (n != 1) {
+		fprintf(stderr, "%s: short reference\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	render(&res);
+	for (int i = 0; i < NUM_MODELS; i++) {
+		const char *name = model_name[i];
+		if (DL_FORMAT == DL_INT16) {
+			// the float peak must fit the fixed scale of the model
+			float range = (float)(1 << (15 - model_shift[i]));
+			rc |= check(ref.peak[i] < range, "%s float delay line peak %.3f, Q%d range %.1f", name, ref.peak[i], model_shift[i], range);
+		}
+		if (i == MODEL_WW) {
+			double err = fabs(res.peak[i] - ref.peak[i]) / ref.peak[i];
+			rc |= check(err <= WW_PEAK_ERR, "%s %s delay line peak %.4f vs float %.4f (%.3f%%)", name, fmt, res.peak[i], ref.peak[i], 100.0 * err);
+		} else {
+			double snr = snr_db(ref.out[i], res.out[i], RENDER_LEN);
+			rc |= check(snr >= snr_min[i], "%s %s vs float %.1f dB (min %.0f dB)", name, fmt, snr, snr_min[i]);
+		}
+	}
+
+	printf("%s\n", (rc == 0) ? "PASS" : "FAIL");
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------------
+/*
+
+Delay Line Pool Test (host)
+
+Each model allocates delay lines for NUM_VOICES low notes, as the patches
+do on note on. Every voice must get its delay lines (within its budget,
+at a lower rate if need be), and the pool must be empty again once they
+are stopped. A lone low voice can take more than its budget and must run
+at the full rate, or at the highest rate the pool allows. A Karplus Strong voice that has to run at a lower rate must
+stay in tune.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "model.h"
+
+//-----------------------------------------------------------------------------
+
+#define LOW_NOTE 23		// lowest note of the voices
+#define PITCH_LEN (MODEL_FS / 2 / AUDIO_BLOCK_SIZE * AUDIO_BLOCK_SIZE)	// samples for a pitch measurement
+#define PITCH_ERR 2.0		// cents
+
+static struct wg wg[NUM_VOICES];
+static struct ww ww[NUM_VOICES];
+static struct wgb wgb[NUM_VOICES];
+static struct ksv ksv[NUM_VOICES];
+
+static float buf[PITCH_LEN];
+
+//-----------------------------------------------------------------------------
+// the models, as the patches allocate them
+
+struct model {
+	const char *name;
+	int (*alloc)(int i, float note);	// returns the downsampling, or -1
+	void (*stop)(int i);
+	int lone_ds;		// downsampling of a lone voice on LOW_NOTE
+};
+
+static int wg_start(int i, float note) {
+	wg_init(&wg[i]);
+	return (wg_alloc(&wg[i], mtof(note - MIDI_BEND_RANGE)) == 0) ? (int)wg[i].downsample_amt : -1;
+}
+
+static void wg_end(int i) {
+	wg_stop(&wg[i]);
+}
+
+static int ww_start(int i, float note) {
+	ww_init(&ww[i]);
+	return (ww_alloc(&ww[i], mtof(note - MIDI_BEND_RANGE)) == 0) ? (int)ww[i].downsample_amt : -1;
+}
+
+static void ww_end(int i) {
+	ww_stop(&ww[i]);
+}
+
+// the mode rates are set with the frequency
+static int wgb_start(int i, float note) {
+	wgb_init(&wgb[i]);
+	if (wgb_alloc(&wgb[i], mtof(note - MIDI_BEND_RANGE)) != 0) {
+		return -1;
+	}
+	wgb_ctrl_frequency(&wgb[i], mtof(note));
+	return (int)wgb[i].mode[0].downsample_amt;
+}
+
+static void wgb_end(int i) {
+	wgb_stop(&wgb[i]);
+}
+
+static int ksv_start(int i, float note) {
+	ksv_init(&ksv[i]);
+	return (ksv_alloc(&ksv[i], mtof(note - MIDI_BEND_RANGE)) == 0) ? (int)ksv[i].ds : -1;
+}
+
+static void ksv_end(int i) {
+	ksv_stop(&ksv[i]);
+}
+
+// A voice can go over its budget while the pool keeps a budget for each of
+// the other voices, that's 10KiB. The three wgb modes on LOW_NOTE need 24KiB
+// at the full rate, so they run at a quarter rate.
+static const struct model models[] = {
+	{"wg", wg_start, wg_end, 1},
+	{"ww", ww_start, ww_end, 1},
+	{"wgb", wgb_start, wgb_end, 4},
+	{"ksv", ksv_start, ksv_end, 1},
+};
+
+#define NUM_MODELS (sizeof(models) / sizeof(struct model))
+
+//-----------------------------------------------------------------------------
+
+// the whole pool is free
+static int pool_empty(void) {
+	void *x = dl_alloc(DL_POOL_SIZE);
+	if (x == NULL) {
+		return 0;
+	}
+	dl_free(x, DL_POOL_SIZE);
+	return 1;
+}
+
+static int test_voices(const struct model *m) {
+	char rates[4 * NUM_VOICES + 1];
+	int ok = 1;
+	int n = 0;
+	for (int i = 0; i < NUM_VOICES; i++) {
+		int ds = m->alloc(i, (float)(LOW_NOTE + i));
+		ok &= (ds > 0);
+		n += snprintf(&rates[n], sizeof(rates) - n, " %d", ds);
+	}
+	int rc = check(ok, "%s notes %d..%d all get delay lines, downsampling%s", m->name, LOW_NOTE, LOW_NOTE + NUM_VOICES - 1, rates);
+	for (int i = 0; i < NUM_VOICES; i++) {
+		m->stop(i);
+	}
+	rc |= check(pool_empty(), "%s pool is empty after the voices stop", m->name);
+	return rc;
+}
+
+static int test_lone(const struct model *m) {
+	int ds = m->alloc(0, (float)LOW_NOTE);
+	m->stop(0);
+	return check(ds == m->lone_ds, "%s lone voice on note %d downsampling %d (want %d)", m->name, LOW_NOTE, ds, m->lone_ds);
+}
+
+// pitch of a ksv voice with half the pool taken
+static int test_ksv_pitch(float note) {
+	dl_pool_init();
+	void *hog = dl_alloc(DL_POOL_SIZE / 2);
+	struct ksv *k = &ksv[0];
+	ksv_init(k);
+	ksv_alloc(k, mtof(note - MIDI_BEND_RANGE));
+	adsr_init(&k->adsr, 0.f, 1.f, 1.f, 1.f);
+	ksv_ctrl_frequency(k, mtof(note));
+	ksv_ctrl_attenuate(k, 0.995f);
+	adsr_attack(&k->adsr);
+	ksv_pluck(k);
+	for (size_t i = 0; i < PITCH_LEN; i += AUDIO_BLOCK_SIZE) {
+		ksv_gen(k, &buf[i], AUDIO_BLOCK_SIZE);
+	}
+	// skip the attack
+	double f = pitch_hz(&buf[PITCH_LEN / 8], PITCH_LEN * 7 / 8, mtof(note) * 0.7f, mtof(note) * 1.4f);
+	double c = cents(f, mtof(note));
+	int rc = check(k->ds > 1 && fabs(c) <= PITCH_ERR, "ksv note %.0f downsampling %d: %.2f Hz, %+.2f cents", note, (int)k->ds, f, c);
+	ksv_stop(k);
+	dl_free(hog, DL_POOL_SIZE / 2);
+	return rc;
+}
+
+//-----------------------------------------------------------------------------
+
+int main(void) {
+	int rc = 0;
+	dl_pool_init();
+	for (size_t i = 0; i < NUM_MODELS; i++) {
+		rc |= test_voices(&models[i]);
+		rc |= test_lone(&models[i]);
+	}
+	rc |= test_ksv_pitch(30.f);
+	rc |= test_ksv_pitch(40.f);
+	dl_pool_stats();
+	printf("%s\n", (rc == 0) ? "PASS" : "FAIL");
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
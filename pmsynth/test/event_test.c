@@ -0,0 +1,122 @@
+//-----------------------------------------------------------------------------
+/*
+
+Event Queue Stress Test (host)
+
+One thread per producer (audio, midi, keys) writes numbered events as fast
+as it can, and the consumer thread drains them with event_rd(), as the ISRs
+and the main loop do on the target. The consumer checks that each producer's
+events arrive once each, in order, with the event data they were written
+with. A producer retries when its queue is full, so the overflow counts in
+the stats are the number of times it found the queue full. The threads
+yield when they can't make progress, so the test also runs on one core.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "host.h"
+
+//-----------------------------------------------------------------------------
+
+#define NUM_PRODUCERS 3
+#define EVENTS_PER_PRODUCER 2000000U
+
+static const uint32_t producer_type[NUM_PRODUCERS] = {
+	EVENT_TYPE_AUDIO,
+	EVENT_TYPE_MIDI,
+	EVENT_TYPE_KEY_DN,
+};
+
+static uint32_t producer_full[NUM_PRODUCERS];
+
+//-----------------------------------------------------------------------------
+
+static void *producer(void *arg) {
+	int id = (int)(uintptr_t) arg;
+	uint32_t type = producer_type[id];
+	for (uint32_t i = 0; i < EVENTS_PER_PRODUCER; i++) {
+		// the sequence number goes in the type and (inverted) the pointer
+		uint32_t seq = i & 0xffffffU;
+		while (event_wr(type | seq, (void *)(uintptr_t) ~i)) {
+			producer_full[id] += 1;
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+// return the producer for an event type
+static int producer_id(uint32_t type) {
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		if (EVENT_TYPE(type) == producer_type[i]) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static int consume(void) {
+	uint32_t count[NUM_PRODUCERS] = { 0 };
+	uint32_t total = 0;
+	struct event e;
+	while (total < NUM_PRODUCERS * EVENTS_PER_PRODUCER) {
+		if (event_rd(&e)) {
+			sched_yield();
+			continue;
+		}
+		int id = producer_id(e.type);
+		if (id < 0) {
+			printf("bad event type 0x%08x\n", e.type);
+			return -1;
+		}
+		uint32_t i = count[id];
+		if ((e.type & 0xffffffU) != (i & 0xffffffU) || (uint32_t) (uintptr_t) e.ptr != ~i) {
+			printf("producer %d event %u: got 0x%08x %p\n", id, i, e.type, e.ptr);
+			return -1;
+		}
+		count[id] += 1;
+		total += 1;
+	}
+	// nothing extra
+	if (!event_rd(&e)) {
+		printf("unexpected event 0x%08x\n", e.type);
+		return -1;
+	}
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+int main(void) {
+	pthread_t tid[NUM_PRODUCERS];
+	struct timespec t0, t1;
+
+	event_init();
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		pthread_create(&tid[i], NULL, producer, (void *)(uintptr_t) i);
+	}
+	int rc = consume();
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		pthread_join(tid[i], NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	double secs = (double)(t1.tv_sec - t0.tv_sec) + 1e-9 * (double)(t1.tv_nsec - t0.tv_nsec);
+	double n = (double)NUM_PRODUCERS * EVENTS_PER_PRODUCER;
+	event_stats();
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		printf("producer %d found the queue full %u times\n", i, producer_full[i]);
+	}
+	printf("%.0f events in %.2fs, %.1f Mevents/s, %.1f ns/event\n", n, secs, 1e-6 * n / secs, 1e9 * secs / n);
+	printf("%s\n", (rc == 0) ? "PASS" : "FAIL");
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
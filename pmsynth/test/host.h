@@ -0,0 +1,61 @@
+//-----------------------------------------------------------------------------
+/*
+
+Host stand-in for pmsynth.h and logging.h
+
+The host tests build the synth modules with this header included first
+(-include host.h). It defines the include guards of the target headers, so
+they are skipped, and has the declarations the modules under test need (a
+copy of the events section of pmsynth.h), with the barriers mapped onto the
+compiler's atomics.
+
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef HOST_H
+#define HOST_H
+
+// skip the target headers
+#define PMSYNTH_H
+#define LOGGING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+//-----------------------------------------------------------------------------
+// cmsis
+
+#define __DMB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+//-----------------------------------------------------------------------------
+// logging
+
+// this is included before the modules define DEBUG, so always log
+#define DBG(...) printf(__VA_ARGS__)
+
+//-----------------------------------------------------------------------------
+// events
+
+// event type in the upper 8 bits
+#define EVENT_TYPE(x) ((x) & 0xff000000U)
+#define EVENT_TYPE_KEY_DN (1U << 24)
+#define EVENT_TYPE_KEY_UP (2U << 24)
+#define EVENT_TYPE_MIDI (3U << 24)
+#define EVENT_TYPE_AUDIO (4U << 24)
+
+struct event {
+	uint32_t type;		// the event type
+	void *ptr;		// pointer to event data (or data itself)
+};
+
+int event_init(void);
+int event_rd(struct event *event);
+int event_wr(uint32_t type, void *ptr);
+void event_stats(void);
+
+//-----------------------------------------------------------------------------
+
+#endif				// HOST_H
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,65 @@
+//-----------------------------------------------------------------------------
+/*
+
+Karplus Strong Pitch Test (host)
+
+A ksv voice at the full rate must be in tune across the range of the
+patch, from the low E of a bass (41Hz) to 3.5kHz. The integer delay, the
+loss filter delay and the allpass make up the period, so an error in any of
+them shows up as a pitch error.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "model.h"
+
+//-----------------------------------------------------------------------------
+
+#define PITCH_LEN (MODEL_FS / 2 / AUDIO_BLOCK_SIZE * AUDIO_BLOCK_SIZE)	// samples for a pitch measurement
+#define PITCH_ERR 2.0		// cents
+
+static const float freqs[] = {
+	41.f, 55.f, 82.4f, 110.f, 196.f, 261.6f, 440.f, 659.3f, 880.f,
+	1318.5f, 1760.f, 2349.3f, 2793.8f, 3136.f, 3500.f,
+};
+
+#define NUM_FREQS (sizeof(freqs) / sizeof(float))
+
+static struct ksv ksv;
+static float buf[PITCH_LEN];
+
+//-----------------------------------------------------------------------------
+
+static int test_pitch(float freq) {
+	struct ksv *k = &ksv;
+	ksv_init(k);
+	ksv_alloc(k, freq * powf(2.f, -MIDI_BEND_RANGE / 12.f));
+	adsr_init(&k->adsr, 0.f, 1.f, 1.f, 1.f);
+	ksv_ctrl_frequency(k, freq);
+	ksv_ctrl_attenuate(k, 0.995f);
+	adsr_attack(&k->adsr);
+	ksv_pluck(k);
+	for (size_t i = 0; i < PITCH_LEN; i += AUDIO_BLOCK_SIZE) {
+		ksv_gen(k, &buf[i], AUDIO_BLOCK_SIZE);
+	}
+	// skip the attack
+	double f = pitch_hz(&buf[PITCH_LEN / 8], PITCH_LEN * 7 / 8, freq * 0.7f, freq * 1.4f);
+	double c = cents(f, freq);
+	int rc = check(k->ds == 1 && fabs(c) <= PITCH_ERR, "ksv %.1f Hz downsampling %d: %.2f Hz, %+.2f cents", freq, (int)k->ds, f, c);
+	ksv_stop(k);
+	return rc;
+}
+
+//-----------------------------------------------------------------------------
+
+int main(void) {
+	int rc = 0;
+	dl_pool_init();
+	for (size_t i = 0; i < NUM_FREQS; i++) {
+		rc |= test_pitch(freqs[i]);
+	}
+	printf("%s\n", (rc == 0) ? "PASS" : "FAIL");
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
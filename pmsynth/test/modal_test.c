@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+/*
+
+Modal Resonator Bank Test (host)
+
+modal_gen() runs the modes in groups of MODAL_LANES. This test checks it
+against a reference that runs one mode per pass over the block, for each of
+the mode sets, and reports the time per mode-sample of both on a ringing
+16 mode voice. The timing depends on the host and isn't checked.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "model.h"
+
+//-----------------------------------------------------------------------------
+
+// 0.5 secs of each note, in whole blocks
+#define RENDER_LEN (MODEL_FS / 2 / AUDIO_BLOCK_SIZE * AUDIO_BLOCK_SIZE)
+
+#define MODAL_ERR 1e-5f		// relative to the peak, float rounding
+#define TIME_BLOCKS 20000	// blocks for the timing
+
+static const struct {
+	const char *name;
+	const struct modal_set *set;
+	float attenuate;
+} sets[] = {
+	{"bar", &modal_bar, 0.995f},
+	{"bell", &modal_bell, 0.998f},
+	{"square plate", &modal_square_plate, 0.99f},
+	{"membrane", &modal_membrane, 0.93f},
+	{"plate", &modal_plate, 0.99f},
+};
+
+#define NUM_SETS (sizeof(sets) / sizeof(sets[0]))
+
+static float out[2][RENDER_LEN];
+
+//-----------------------------------------------------------------------------
+
+// reference kernel, one mode per pass
+static void ref_gen(struct modal *m, float *buf, size_t n) {
+	float x[n];
+	for (size_t i = 0; i < n; i++) {
+		x[i] = (m->estate == 1) ? m->vel * impulse_lookup(m->epos, m->impulse, &m->epos, &m->estate) : 0.f;
+	}
+	memset(buf, 0, n * sizeof(float));
+	for (int j = 0; j < m->n; j++) {
+		float y1 = m->y1[j];
+		float y2 = m->y2[j];
+		for (size_t i = 0; i < n; i++) {
+			float y = m->a1[j] * y1 - m->a2[j] * y2 + m->b[j] * x[i];
+			y2 = y1;
+			y1 = y;
+			buf[i] += y;
+		}
+		m->y1[j] = y1;
+		m->y2[j] = y2;
+	}
+}
+
+static void strike(struct modal *m, int set, float note) {
+	modal_init(m);
+	modal_ctrl_set(m, sets[set].set);
+	modal_ctrl_attenuate(m, sets[set].attenuate);
+	modal_ctrl_frequency(m, mtof(note));
+	modal_set_velocity(m, 100.f / 127.f);
+	modal_pluck(m);
+}
+
+static int test_set(int set) {
+	static struct modal m, r;
+	strike(&m, set, 48.f);
+	r = m;
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		modal_gen(&m, &out[0][i], AUDIO_BLOCK_SIZE);
+		ref_gen(&r, &out[1][i], AUDIO_BLOCK_SIZE);
+	}
+	float peak = 0.f, err = 0.f;
+	for (size_t i = 0; i < RENDER_LEN; i++) {
+		peak = fmaxf(peak, fabsf(out[1][i]));
+		err = fmaxf(err, fabsf(out[0][i] - out[1][i]));
+	}
+	return check(peak > 0.f && err <= MODAL_ERR * peak, "%s (%d modes) max error %.2e of peak %.3f", sets[set].name, m.n, err, peak);
+}
+
+// time a ringing voice
+static double time_gen(void (*gen)(struct modal *, float *, size_t), struct modal *m) {
+	float buf[AUDIO_BLOCK_SIZE];
+	double t0 = secs();
+	for (int i = 0; i < TIME_BLOCKS; i++) {
+		gen(m, buf, AUDIO_BLOCK_SIZE);
+	}
+	return secs() - t0;
+}
+
+static void report_time(int set) {
+	static struct modal m, r;
+	strike(&m, set, 48.f);
+	// ring for a while, then keep the modes from decaying away
+	float buf[AUDIO_BLOCK_SIZE];
+	for (int i = 0; i < 64; i++) {
+		modal_gen(&m, buf, AUDIO_BLOCK_SIZE);
+	}
+	for (int j = 0; j < m.n; j++) {
+		m.a2[j] = 1.f;
+	}
+	r = m;
+	double t = time_gen(modal_gen, &m);
+	double tr = time_gen(ref_gen, &r);
+	double k = 1e9 / ((double)TIME_BLOCKS * AUDIO_BLOCK_SIZE * m.n);
+	printf("%s %d modes: %.2f ns per mode-sample (%d lanes), %.2f ns one mode per pass\n", sets[set].name, m.n, t * k, MODAL_LANES, tr * k);
+}
+
+//-----------------------------------------------------------------------------
+
+int main(void) {
+	int rc = 0;
+	for (size_t i = 0; i < NUM_SETS; i++) {
+		rc |= test_set(i);
+	}
+	report_time(NUM_SETS - 1);
+	printf("%s\n", (rc == 0) ? "PASS" : "FAIL");
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
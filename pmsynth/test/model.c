@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+/*
+
+Host Support for the Model Tests
+
+*/
+//-----------------------------------------------------------------------------
+
+#include <stdarg.h>
+#include <time.h>
+
+#include "model.h"
+
+//-----------------------------------------------------------------------------
+// the audio driver and logging globals the models use
+
+float audio_fs = (float)MODEL_FS;
+float audio_ts = 1.f / (float)MODEL_FS;
+
+void log_printf(char *format_msg, ...) {
+	va_list args;
+	va_start(args, format_msg);
+	vprintf(format_msg, args);
+	va_end(args);
+}
+
+//-----------------------------------------------------------------------------
+
+double snr_db(const float *ref, const float *x, size_t n) {
+	double s = 0.0, e = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		double d = (double)x[i] - (double)ref[i];
+		s += (double)ref[i] * (double)ref[i];
+		e += d * d;
+	}
+	if (e == 0.0) {
+		return INFINITY;
+	}
+	return 10.0 * log10(s / e);
+}
+
+// autocorrelation at a lag
+static double acf(const float *x, size_t n, size_t lag) {
+	double c = 0.0;
+	for (size_t i = 0; i + lag < n; i++) {
+		c += (double)x[i] * (double)x[i + lag];
+	}
+	return c / (double)(n - lag);
+}
+
+// magnitude of the Hann windowed spectrum of x at f (Hz)
+static double dft_mag(const float *x, size_t n, double f) {
+	double w = 2.0 * M_PI * f / audio_fs;
+	double re = 0.0, im = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		double h = 0.5 - 0.5 * cos(2.0 * M_PI * (double)i / (double)n);
+		re += h * (double)x[i] * cos(w * (double)i);
+		im -= h * (double)x[i] * sin(w * (double)i);
+	}
+	return sqrt(re * re + im * im);
+}
+
+// The autocorrelation peak gives the period to about a sample, that's a
+// few cents at high notes, and the partials of a stiff or allpass tuned
+// loop aren't harmonic. The pitch is refined to the spectrum peak of the
+// fundamental.
+double pitch_hz(const float *x, size_t n, float lo, float hi) {
+	size_t lag0 = (size_t)(audio_fs / hi);
+	size_t lag1 = (size_t)(audio_fs / lo) + 1;
+	size_t best = lag0;
+	double cbest = -INFINITY;
+	for (size_t lag = lag0; lag <= lag1; lag++) {
+		double c = acf(x, n, lag);
+		if (c > cbest) {
+			cbest = c;
+			best = lag;
+		}
+	}
+	// search the main lobe around the period, then narrow it down
+	double f0 = audio_fs / ((double)best + 0.5);
+	double f1 = audio_fs / ((double)best - 0.5);
+	double step = 0.25 * audio_fs / (double)n;
+	double f = f0;
+	double mbest = -INFINITY;
+	for (double x0 = f0; x0 <= f1; x0 += step) {
+		double m = dft_mag(x, n, x0);
+		if (m > mbest) {
+			mbest = m;
+			f = x0;
+		}
+	}
+	while (step > 1e-4 * f) {
+		step *= 0.5;
+		double m0 = dft_mag(x, n, f - step);
+		double m1 = dft_mag(x, n, f + step);
+		if (m0 > mbest && m0 >= m1) {
+			mbest = m0;
+			f -= step;
+		} else if (m1 > mbest) {
+			mbest = m1;
+			f += step;
+		}
+	}
+	return f;
+}
+
+double secs(void) {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}
+
+int check(int ok, const char *fmt, ...) {
+	va_list args;
+	va_start(args, fmt);
+	printf("%s: ", ok ? "ok" : "FAIL");
+	vprintf(fmt, args);
+	printf("\n");
+	va_end(args);
+	return ok ? 0 : -1;
+}
+
+//-----------------------------------------------------------------------------
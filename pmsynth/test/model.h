@@ -0,0 +1,53 @@
+//-----------------------------------------------------------------------------
+/*
+
+Host Support for the Model Tests
+
+The model tests build the synth models with the target headers. model.c has
+the audio and logging globals the models use, and some measurements to
+compare their outputs.
+
+*/
+//-----------------------------------------------------------------------------
+
+#ifndef MODEL_H
+#define MODEL_H
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pmsynth.h"
+
+//-----------------------------------------------------------------------------
+
+#define MODEL_FS 44100		// sample rate of the tests (Hz)
+
+// midi note to frequency (Hz)
+static inline float mtof(float note) {
+	return 440.f * powf(2.f, (note - 69.f) / 12.f);
+}
+
+// a frequency ratio in cents
+static inline double cents(double f, double ref) {
+	return 1200. * log2(f / ref);
+}
+
+// signal to error ratio of x against the reference (dB)
+double snr_db(const float *ref, const float *x, size_t n);
+
+// pitch of x (Hz), the fundamental searched from lo to hi Hz
+double pitch_hz(const float *x, size_t n, float lo, float hi);
+
+// monotonic time (secs)
+double secs(void);
+
+// report a check, returns 0 if it passed
+int check(int ok, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+//-----------------------------------------------------------------------------
+
+#endif				// MODEL_H
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,163 @@
+//-----------------------------------------------------------------------------
+/*
+
+Fixed Point Waveguide Test (host)
+
+The test is built twice. The float build (q15_ref) renders the string and
+banded waveguides with the patch 7 and patch 10 defaults and writes them to
+a file. The WG_Q15 build (q15_test) renders the same notes with the fixed
+point kernels, which use the C reference of the dual 16-bit operations on
+the host, and checks their error against the float output over the decay.
+
+It also checks that a full scale bridge reflection saturates rather than
+wrapping in the int16 delay line.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "model.h"
+
+//-----------------------------------------------------------------------------
+
+// 0.5 secs of decay, in whole blocks
+#define RENDER_LEN (MODEL_FS / 2 / AUDIO_BLOCK_SIZE * AUDIO_BLOCK_SIZE)
+
+// error bounds of the fixed point kernels (dB)
+#define STRING_SNR_MIN 42.0
+#define BANDED_SNR_MIN 55.0
+
+static float string_out[RENDER_LEN];
+static float banded_out[RENDER_LEN];
+
+//-----------------------------------------------------------------------------
+
+// strike a string (patch 7 defaults)
+static void render_string(float *out, float note) {
+	static struct wg osc;
+	wg_init(&osc);
+	wg_alloc(&osc, mtof(note));
+	adsr_init(&osc.adsr, 0.f, 1.f, 1.f, 1.f);
+	wg_ctrl_frequency(&osc, mtof(note));
+	wg_exciter_type(&osc, 0);
+	wg_ctrl_impulse_type(&osc, 0);
+	wg_ctrl_reflection(&osc, -0.99f);
+	wg_ctrl_stiffness(&osc, 1.f);
+	wg_ctrl_pos(&osc, 0.25f);
+	wg_set_velocity(&osc, 100.f / 127.f);
+	adsr_attack(&osc.adsr);
+	wg_excite(&osc);
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		wg_gen(&osc, &out[i], AUDIO_BLOCK_SIZE);
+	}
+	wg_stop(&osc);
+}
+
+// pluck a bar (patch 10 defaults)
+static void render_banded(float *out, float note) {
+	static struct wgb osc;
+	wgb_init(&osc);
+	wgb_alloc(&osc, mtof(note));
+	adsr_init(&osc.adsr, 0.f, 1.f, 1.f, 1.f);
+	wgb_ctrl_frequency(&osc, mtof(note));
+	wgb_ctrl_attenuate(&osc, 0.99f);
+	wgb_ctrl_brightness(&osc, 1.f);
+	wgb_ctrl_mode_mix_amt(&osc, 0.1f);
+	wgb_ctrl_harmonic_mod(&osc, 0.f);
+	wgb_ctrl_resonator_type(&osc, 3);
+	wgb_set_velocity(&osc, 100.f / 127.f);
+	adsr_attack(&osc.adsr);
+	wgb_pluck(&osc);
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		wgb_gen(&osc, &out[i], AUDIO_BLOCK_SIZE);
+	}
+	wgb_stop(&osc);
+}
+
+static void render(void) {
+	dl_pool_init();
+	snap_init();
+	render_string(string_out, 45.f);
+	render_banded(banded_out, 57.f);
+}
+
+//-----------------------------------------------------------------------------
+
+#if !WG_Q15
+
+int main(int argc, char *argv[]) {
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <reference file>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	render();
+	FILE *f = fopen(argv[1], "wb");
+	if (f == NULL) {
+		perror(argv[1]);
+		return EXIT_FAILURE;
+	}
+	fwrite(string_out, sizeof(float), RENDER_LEN, f);
+	fwrite(banded_out, sizeof(float), RENDER_LEN, f);
+	fclose(f);
+	return EXIT_SUCCESS;
+}
+
+#else
+
+// A reflection of -1 is -32768 in Q15, so a full scale -32768 at the nut
+// reflects to +32768 at the bridge, which must saturate to 32767.
+static int test_saturation(void) {
+	static struct wg osc;
+	float out[1];
+	dl_pool_init();
+	wg_init(&osc);
+	wg_alloc(&osc, mtof(45.f));
+	adsr_init(&osc.adsr, 0.f, 1.f, 1.f, 1.f);
+	wg_ctrl_frequency(&osc, mtof(45.f));
+	wg_exciter_type(&osc, 0);
+	wg_ctrl_pos(&osc, 0.25f);
+	adsr_attack(&osc.adsr);
+	wg_excite(&osc);
+	osc.estate = 0;
+	osc.r = -1.f;
+	osc.delay_r[osc.nut_pos] = -32768;
+	uint32_t bridge = osc.bridge_pos;
+	wg_gen(&osc, out, 1);
+	int16_t x = osc.delay_l[bridge];
+	wg_stop(&osc);
+	return check(x == 32767, "bridge reflection of -32768 by -1 gives %d", x);
+}
+
+int main(int argc, char *argv[]) {
+	static float ref[2][RENDER_LEN];
+	int rc = 0;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <reference file>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	FILE *f = fopen(argv[1], "rb");
+	if (f == NULL) {
+		perror(argv[1]);
+		return EXIT_FAILURE;
+	}
+	size_t n = fread(ref, sizeof(float), 2 * RENDER_LEN, f);
+	fclose(f);
+	if (n != 2 * RENDER_LEN) {
+		fprintf(stderr, "%s: short reference\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	render();
+	double snr = snr_db(ref[0], string_out, RENDER_LEN);
+	rc |= check(snr >= STRING_SNR_MIN, "string q15 vs float %.1f dB (min %.0f dB)", snr, STRING_SNR_MIN);
+	snr = snr_db(ref[1], banded_out, RENDER_LEN);
+	rc |= check(snr >= BANDED_SNR_MIN, "banded q15 vs float %.1f dB (min %.0f dB)", snr, BANDED_SNR_MIN);
+	rc |= test_saturation();
+
+	printf("%s\n", (rc == 0) ? "PASS" : "FAIL");
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
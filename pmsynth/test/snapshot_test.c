@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+/*
+
+Excitation Snapshot Test (host)
+
+The cache is off in the default build, so this test builds it with
+SNAP_ENTRIES=2. It strikes a string and a bar twice. The first note misses
+and records the excitation, the second note hits and plays it back. The
+outputs must match within the Q12 quantisation of the recorded output while
+it plays back, and exactly once the voice carries on from the restored
+state.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "model.h"
+
+//-----------------------------------------------------------------------------
+
+#if SNAP_ENTRIES == 0
+#error "build with SNAP_ENTRIES > 0"
+#endif
+
+#define RENDER_LEN (8192 + 8 * AUDIO_BLOCK_SIZE)	// the excitation and some decay
+#define VELOCITY (100.f / 127.f)
+
+// Both models scale their output by this level after the snapshot, so a
+// hit is within half a Q12 step of it (and float rounding).
+#define LEVEL (VELOCITY / 0.8f + 0.2f)
+#define SNAP_ERR_MAX (1.001f * 0.5f * LEVEL / 4096.f)
+
+static float out[2][RENDER_LEN];
+
+//-----------------------------------------------------------------------------
+
+// strike a string with the hi-hat impulse, return the snapshot mode
+static int render_string(float *buf) {
+	static struct wg osc;
+	wg_init(&osc);
+	wg_alloc(&osc, mtof(57.f));
+	adsr_init(&osc.adsr, 0.f, 1.f, 1.f, 1.f);
+	wg_ctrl_frequency(&osc, mtof(57.f));
+	wg_exciter_type(&osc, 0);
+	wg_ctrl_impulse_type(&osc, 3);
+	wg_ctrl_reflection(&osc, -0.99f);
+	wg_ctrl_stiffness(&osc, 1.f);
+	wg_ctrl_pos(&osc, 0.25f);
+	wg_set_velocity(&osc, VELOCITY);
+	adsr_attack(&osc.adsr);
+	wg_excite(&osc);
+	int mode = osc.snap.mode;
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		wg_gen(&osc, &buf[i], AUDIO_BLOCK_SIZE);
+	}
+	wg_stop(&osc);
+	return mode;
+}
+
+// pluck a bar with the hi-hat impulse, return the snapshot mode
+static int render_banded(float *buf) {
+	static struct wgb osc;
+	wgb_init(&osc);
+	wgb_alloc(&osc, mtof(57.f));
+	adsr_init(&osc.adsr, 0.f, 1.f, 1.f, 1.f);
+	wgb_ctrl_frequency(&osc, mtof(57.f));
+	wgb_ctrl_impulse_type(&osc, 3);
+	wgb_ctrl_attenuate(&osc, 0.99f);
+	wgb_ctrl_brightness(&osc, 1.f);
+	wgb_ctrl_mode_mix_amt(&osc, 0.1f);
+	wgb_ctrl_harmonic_mod(&osc, 0.f);
+	wgb_ctrl_resonator_type(&osc, 3);
+	wgb_set_velocity(&osc, VELOCITY);
+	adsr_attack(&osc.adsr);
+	wgb_pluck(&osc);
+	int mode = osc.snap.mode;
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		wgb_gen(&osc, &buf[i], AUDIO_BLOCK_SIZE);
+	}
+	wgb_stop(&osc);
+	return mode;
+}
+
+// compare a hit against the recorded note
+static int compare(const char *name, int (*render)(float *)) {
+	int rc = 0;
+	int mode0 = render(out[0]);
+	int mode1 = render(out[1]);
+	rc |= check(mode0 == SNAP_RECORD && mode1 == SNAP_PLAY, "%s first note records, second plays back", name);
+	// the playback is up to the last sample that differs by more than float rounding
+	float err = 0.f;
+	size_t last = 0;
+	for (size_t i = 0; i < RENDER_LEN; i++) {
+		float d = fabsf(out[1][i] - out[0][i]);
+		if (d > err) {
+			err = d;
+		}
+		if (d > 1e-6f) {
+			last = i + 1;
+		}
+	}
+	rc |= check(err <= SNAP_ERR_MAX, "%s hit vs miss max error %.2e (max %.2e)", name, err, SNAP_ERR_MAX);
+	rc |= check(last <= 6144 + AUDIO_BLOCK_SIZE, "%s outputs match (1e-6) after %d samples", name, (int)last);
+	return rc;
+}
+
+//-----------------------------------------------------------------------------
+
+int main(void) {
+	int rc = 0;
+	dl_pool_init();
+	snap_init();
+	rc |= compare("string", render_string);
+	rc |= compare("banded", render_banded);
+	snap_stats();
+	printf("%s\n", (rc == 0) ? "PASS" : "FAIL");
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
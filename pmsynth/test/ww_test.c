@@ -0,0 +1,158 @@
+//-----------------------------------------------------------------------------
+/*
+
+Woodwind Test (host)
+
+ww_gen() carries the downsampling phase and the held output across calls,
+so the output must be the same for any block length. This test renders a
+note in whole blocks, in 4 sample chunks and in random chunks at each
+downsampling from 1 to 8 and checks they are identical.
+
+The WW_JET_EXP table replaced x - x * pow2(x) in the loop. The note is
+rendered again with a reference loop that has the pow2 jet, the levels
+must match, and the time per sample of both is reported. The timing
+depends on the host and isn't checked.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include "model.h"
+#include "utils.h"
+
+//-----------------------------------------------------------------------------
+
+// 0.5 secs of the note, in whole blocks
+#define RENDER_LEN (MODEL_FS / 2 / AUDIO_BLOCK_SIZE * AUDIO_BLOCK_SIZE)
+
+#define NOTE 72.f		// C5
+#define DS_MAX 8		// highest downsampling tested
+#define LEVEL_ERR 0.5		// dB, table jet vs pow2 jet
+#define TIME_BLOCKS 20000	// blocks for the timing
+
+static struct ww ww;
+static float out[3][RENDER_LEN];
+
+//-----------------------------------------------------------------------------
+
+// start a note with the patch 9 defaults
+static void blow(struct ww *w, uint32_t ds) {
+	ww_init(w);
+	ww_alloc(w, mtof(NOTE - MIDI_BEND_RANGE));
+	ww_set_samplerate(w, (float)ds);
+	ww_ctrl_frequency(w, mtof(NOTE));
+	adsr_init(&w->adsr, 0.1f, 2.f, 1.f, 1.f);
+	sin_init(&w->vibrato);
+	sin_ctrl_frequency(&w->vibrato, 50.f);
+	ww_update_coefficients(w, 0.6f, 0.42f, 0.53f);
+	ww_update_vib_noise(w, 0.008f, 0.0085f);
+	ww_ctrl_jet(w, WW_JET_EXP);
+	ww_set_velocity(w, 0.8f);
+	rand_init(1);
+	adsr_attack(&w->adsr);
+	ww_blow(w);
+}
+
+// render a note in chunks of the given length, 0 for random lengths
+static void render(float *buf, uint32_t ds, size_t chunk) {
+	blow(&ww, ds);
+	srand(ds);
+	for (size_t i = 0; i < RENDER_LEN;) {
+		size_t k = (chunk) ? chunk : 1 + (size_t)rand() % AUDIO_BLOCK_SIZE;
+		if (k > RENDER_LEN - i) {
+			k = RENDER_LEN - i;
+		}
+		ww_gen(&ww, &buf[i], k);
+		i += k;
+	}
+	ww_stop(&ww);
+}
+
+static int test_chunks(uint32_t ds) {
+	render(out[0], ds, AUDIO_BLOCK_SIZE);
+	render(out[1], ds, 4);
+	render(out[2], ds, 0);
+	int same_4 = memcmp(out[0], out[1], sizeof(out[0])) == 0;
+	int same_rand = memcmp(out[0], out[2], sizeof(out[0])) == 0;
+	return check(same_4 && same_rand, "ww downsampling %d: 4 sample chunks %s, random chunks %s", (int)ds, same_4 ? "identical" : "differ", same_rand ? "identical" : "differ");
+}
+
+//-----------------------------------------------------------------------------
+
+// reference loop, ww_gen at the full rate with the pow2 jet
+static void ref_gen(struct ww *w, float *buf, size_t n) {
+	float k = w->velocity / 0.8f + 0.2f;
+	for (size_t i = 0; i < n; i++) {
+		float am = adsr_sample(&w->adsr);
+		float breath = am * (1.f + w->noise_amt * rand_float()) + w->vibrato_amt * cos_lookup(w->vibrato.x);
+		w->vibrato.x += w->vibrato.xstep;
+		w->dl_2[w->dl_2_ptr_in] = dl_wr(breath + w->r_1 * w->dl_1_out, WW_Q_SHIFT);
+		w->dl_2_ptr_in = (w->dl_2_ptr_in == w->dl_2_len) ? 0 : w->dl_2_ptr_in + 1;
+		w->dl_2_ptr_out = (w->dl_2_ptr_out == w->dl_2_len) ? 0 : w->dl_2_ptr_out + 1;
+		float reed_out = dl_rd(w->dl_2[w->dl_2_ptr_out], WW_Q_SHIFT);
+		reed_out = reed_out - pow2(reed_out) * reed_out + w->r_2 * w->dl_1_out;
+		w->flute_out_old += w->lp_filter_coef * (reed_out - w->flute_out_old);
+		w->dl_1[w->dl_1_ptr_in] = dl_wr(w->flute_out_old, WW_Q_SHIFT);
+		w->dl_1_ptr_in = (w->dl_1_ptr_in == w->dl_1_len) ? 0 : w->dl_1_ptr_in + 1;
+		w->dl_1_ptr_out = (w->dl_1_ptr_out == w->dl_1_len) ? 0 : w->dl_1_ptr_out + 1;
+		w->dl_1_out = dl_rd(w->dl_1[w->dl_1_ptr_out], WW_Q_SHIFT);
+		w->dc_filt_out = w->flute_out_old - w->dc_filt_in + 0.99f * w->dc_filt_out;
+		w->dc_filt_in = w->flute_out_old;
+		buf[i] = k * w->dc_filt_out;
+	}
+}
+
+// rms level of a note, skipping the attack (dB)
+static double level_db(const float *x) {
+	double s = 0.0;
+	for (size_t i = RENDER_LEN / 4; i < RENDER_LEN; i++) {
+		s += (double)x[i] * (double)x[i];
+	}
+	return 10.0 * log10(s / (double)(RENDER_LEN - RENDER_LEN / 4));
+}
+
+// time a blowing voice (ns per sample)
+static double time_gen(void (*gen)(struct ww *, float *, size_t)) {
+	float buf[AUDIO_BLOCK_SIZE];
+	blow(&ww, 1);
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		gen(&ww, buf, AUDIO_BLOCK_SIZE);
+	}
+	double t0 = secs();
+	for (int i = 0; i < TIME_BLOCKS; i++) {
+		gen(&ww, buf, AUDIO_BLOCK_SIZE);
+	}
+	double t = secs() - t0;
+	ww_stop(&ww);
+	return 1e9 * t / ((double)TIME_BLOCKS * AUDIO_BLOCK_SIZE);
+}
+
+static int test_jet(void) {
+	render(out[0], 1, AUDIO_BLOCK_SIZE);
+	blow(&ww, 1);
+	for (size_t i = 0; i < RENDER_LEN; i += AUDIO_BLOCK_SIZE) {
+		ref_gen(&ww, &out[1][i], AUDIO_BLOCK_SIZE);
+	}
+	ww_stop(&ww);
+	double l0 = level_db(out[0]);
+	double l1 = level_db(out[1]);
+	int rc = check(fabs(l0 - l1) <= LEVEL_ERR, "ww table jet level %.2f dB, pow2 jet %.2f dB", l0, l1);
+	double t0 = time_gen(ww_gen);
+	double t1 = time_gen(ref_gen);
+	printf("ww table jet %.2f ns/sample, pow2 jet %.2f ns/sample (%.2fx)\n", t0, t1, t1 / t0);
+	return rc;
+}
+
+//-----------------------------------------------------------------------------
+
+int main(void) {
+	int rc = 0;
+	dl_pool_init();
+	for (uint32_t ds = 1; ds <= DS_MAX; ds++) {
+		rc |= test_chunks(ds);
+	}
+	rc |= test_jet();
+	printf("%s\n", (rc == 0) ? "PASS" : "FAIL");
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//-----------------------------------------------------------------------------
@@ -6,6 +6,8 @@ Waveguide synth
 */
 //-----------------------------------------------------------------------------
 
+#include <string.h>
+
 #include "pmsynth.h"
 #include "utils.h"
 
@@ -17,55 +19,137 @@ Waveguide synth
 // location of pickup (where the output is extracted from the delay line)
 #define WG_PICKUP_POS 4
 
+// shortest delay line for LOD_LOW
+#define WG_LOD_MIN_LEN 16
+
+// the lowest internal rate (as a divisor) when the delay line pool is short
+#define WG_DOWNSAMPLE_MAX 8
+
 //-----------------------------------------------------------------------------
 
 
-void wg_gen(struct wg *osc, float *out, size_t n) {
-	float am[n];
-	adsr_gen(&osc->adsr, am, n);
-	for (size_t i = 0; i < n; i++) {
-		// pointer edition
+//-----------------------------------------------------------------------------
+// excitation snapshots
+
+// the model state at the end of the excitation
+struct wg_snap {
+	wg_t delay_l[WG_SNAP_LEN];
+	wg_t delay_r[WG_SNAP_LEN];
+	uint32_t x_pos_l, x_pos_r;
+	uint32_t x_pos_l_2, x_pos_r_2;
+	uint32_t bridge_pos, nut_pos, pickup_pos;
+	uint32_t epos;
+	int estate;
+};
+
+// the parameters the excitation depends on
+static void wg_snap_key(struct wg *osc, struct snap_key *key) {
+	memset(key, 0, sizeof(struct snap_key));
+	key->model = SNAP_WG;
+	key->k[0] = snap_float(osc->delay_len_total);
+	key->k[1] = snap_float(osc->out_frac);
+	key->k[2] = osc->excite_pos;
+	key->k[3] = osc->impulse;
+	key->k[4] = snap_float(osc->r);
+	key->k[5] = snap_float(osc->a);
+	key->k[6] = osc->tube;
+	key->k[7] = osc->downsample_amt;
+}
 
+static void wg_snap_save(struct wg *osc) {
+	struct snap_key key;
+	wg_snap_key(osc, &key);
+	struct wg_snap *s = snap_finish(&osc->snap, &key);
+	if (s == NULL) {
+		return;
+	}
+	memcpy(s->delay_l, osc->delay_l, (osc->delay_len + 1) * sizeof(wg_t));
+	memcpy(s->delay_r, osc->delay_r, (osc->delay_len + 1) * sizeof(wg_t));
+	s->x_pos_l = osc->x_pos_l;
+	s->x_pos_r = osc->x_pos_r;
+	s->x_pos_l_2 = osc->x_pos_l_2;
+	s->x_pos_r_2 = osc->x_pos_r_2;
+	s->bridge_pos = osc->bridge_pos;
+	s->nut_pos = osc->nut_pos;
+	s->pickup_pos = osc->pickup_pos;
+	s->epos = osc->epos;
+	s->estate = osc->estate;
+}
+
+static void wg_snap_restore(struct wg *osc, const struct wg_snap *s) {
+	memcpy(osc->delay_l, s->delay_l, (osc->delay_len + 1) * sizeof(wg_t));
+	memcpy(osc->delay_r, s->delay_r, (osc->delay_len + 1) * sizeof(wg_t));
+	osc->x_pos_l = s->x_pos_l;
+	osc->x_pos_r = s->x_pos_r;
+	osc->x_pos_l_2 = s->x_pos_l_2;
+	osc->x_pos_r_2 = s->x_pos_r_2;
+	osc->bridge_pos = s->bridge_pos;
+	osc->nut_pos = s->nut_pos;
+	osc->pickup_pos = s->pickup_pos;
+	osc->epos = s->epos;
+	osc->estate = s->estate;
+	// the snapshot is taken on a model step
+	osc->ds_phase = 0;
+}
+
+// stop the voice, it's silent until the next wg_alloc
+void wg_stop(struct wg *osc) {
+	snap_cancel(&osc->snap);
+	dl_free(osc->delay_l, 2 * osc->delay_size * sizeof(wg_t));
+	osc->delay_l = NULL;
+	osc->delay_r = NULL;
+	osc->delay_size = 0;
+}
 
+//-----------------------------------------------------------------------------
 
-		if (i % osc->downsample_amt == 0){
+#if !WG_Q15
+
+// generate samples i..n-1
+static void wg_kernel(struct wg *osc, float *out, size_t i, size_t n, float vel) {
+	wg_t *dl = osc->delay_l;
+	wg_t *dr = osc->delay_r;
+	float y = osc->hold_y;
+	for (; i < n; i++) {
+		// the phase carries over blocks, they can be any length
+		if (osc->ds_phase == 0){
+			if (osc->snap.mode == SNAP_RECORD && osc->estate == 0) {
+				wg_snap_save(osc);
+			}
 			float mallet_out = 0;
 			if (osc->estate == 1){
-				mallet_out = impulse_gen(osc);		
-				osc->delay_l[osc->x_pos_l] += mallet_out;
-				osc->delay_r[osc->x_pos_r] += mallet_out;
-				//if (osc->impulse_solo){
-				//	out[i] = mallet_out;
-				//}
+				mallet_out = impulse_gen(osc);
+				dl[osc->x_pos_l] = wg_wr(wg_rd(dl[osc->x_pos_l], WG_Q_SHIFT) + mallet_out, WG_Q_SHIFT);
+				dr[osc->x_pos_r] = wg_wr(wg_rd(dr[osc->x_pos_r], WG_Q_SHIFT) + mallet_out, WG_Q_SHIFT);
 			}
 
-			//DBG("epos=%d, etate=%d, mallet_out=%d\r\n",osc->epos,osc->estate, (int) (mallet_out*1000));
-			// nut reflection 
-			osc->delay_r[osc->bridge_pos] = osc->tube * osc->delay_l[osc->nut_pos];
+			// nut reflection
+			dr[osc->bridge_pos] = wg_wr(osc->tube * wg_rd(dl[osc->nut_pos], WG_Q_SHIFT), WG_Q_SHIFT);
 			// bridge reflection
-			osc->delay_l[osc->bridge_pos] =  osc->r * osc->delay_r[osc->nut_pos];
+			dl[osc->bridge_pos] = wg_wr(osc->r * wg_rd(dr[osc->nut_pos], WG_Q_SHIFT), WG_Q_SHIFT);
 
-			// all pass filter for stiffness (when used for pitch correction it changes the "stiffness")
-			osc->delay_l[osc->x_pos_l_2] = osc->a * osc->delay_l[osc->x_pos_l_2] +
-									osc->delay_l[osc->x_pos_l] -
-									osc->a * osc->delay_l[osc->x_pos_l];
+			float l = wg_rd(dl[osc->x_pos_l], WG_Q_SHIFT);
+			float l2 = wg_rd(dl[osc->x_pos_l_2], WG_Q_SHIFT);
+			float r = wg_rd(dr[osc->x_pos_r], WG_Q_SHIFT);
+			float r2 = wg_rd(dr[osc->x_pos_r_2], WG_Q_SHIFT);
 
+			// all pass filter for stiffness (when used for pitch correction it changes the "stiffness")
+			l2 = osc->a * l2 + l - osc->a * l;
+			dl[osc->x_pos_l_2] = wg_wr(l2, WG_Q_SHIFT);
 
 			// with linear interp
 			float frac = (float) 1.0f - osc->delay_len_frac;
-			osc->delay_l[osc->x_pos_l] = (1.0f - frac) * osc->delay_l[osc->x_pos_l]+
-								(frac) * osc->delay_l[osc->x_pos_l_2];
-			osc->delay_r[osc->x_pos_r] = (1.0f - frac) * osc->delay_r[osc->x_pos_r]+
-								(frac) * osc->delay_r[osc->x_pos_r_2];
-
+			l = (1.0f - frac) * l + (frac) * l2;
+			r = (1.0f - frac) * r + (frac) * r2;
+			dl[osc->x_pos_l] = wg_wr(l, WG_Q_SHIFT);
+			dr[osc->x_pos_r] = wg_wr(r, WG_Q_SHIFT);
 
 			// added scaling factor for frac due to linear interp varying amplitudes due to low pass effect
-			
-			out[i] = mallet_out * osc->impulse_solo + (
-				((osc->velocity) / 0.8f + 0.2f) * 0.75f * (frac) * (osc->delay_l[osc->x_pos_l] + 
-				osc->delay_r[osc->x_pos_r]))*(1.0f - osc->impulse_solo);
-
-
+			// (using the full rate frac, so the level doesn't change with the lod)
+			y = 0.75f * (osc->out_frac) * (l + r);
+			out[i] = mallet_out * osc->impulse_solo + vel * y * (1.0f - osc->impulse_solo);
+			osc->hold = out[i];
+			osc->hold_y = y;
 
 			//stepping and wrapping pointers
 			osc->x_pos_l += 1;
@@ -102,10 +186,102 @@ void wg_gen(struct wg *osc, float *out, size_t n) {
 			if (osc->pickup_pos > osc->delay_len){
 				osc->pickup_pos = 0;
 			}
-		} else
-		out[i] = out[i] * 0.5f + out[i-1] *0.5f; // linear interp
+		} else {
+			out[i] = osc->hold; // sample and hold
+		}
+		osc->ds_phase = (osc->ds_phase + 1 < osc->downsample_amt) ? osc->ds_phase + 1 : 0;
+		if (osc->snap.mode == SNAP_RECORD) {
+			snap_record(&osc->snap, y);
+		}
 		osc->epos += 1; // incrementing impulse sample
-	} 
+	}
+}
+
+#else
+
+// Fixed point kernel.
+// The delay lines are Q14. The all pass and the linear interpolation are
+// both a two tap mix of adjacent samples, so each is one dual multiply.
+static void wg_kernel(struct wg *osc, float *out, size_t i, size_t n, float vel) {
+	wg_t *dl = osc->delay_l;
+	wg_t *dr = osc->delay_r;
+	// (1 - a, a) all pass mix
+	uint32_t ap = q_mix(osc->a);
+	// (frac, 1 - frac) linear interpolation mix
+	uint32_t li = q_mix(1.0f - osc->delay_len_frac);
+	int32_t r = q15(osc->r);
+	int32_t tube = osc->tube;
+	// output scaling
+	float ky = 0.75f * osc->out_frac * (1.f / (float)(1 << WG_Q_SHIFT));
+	float y = osc->hold_y;
+	for (; i < n; i++) {
+		// the phase carries over blocks, they can be any length
+		if (osc->ds_phase == 0) {
+			if (osc->snap.mode == SNAP_RECORD && osc->estate == 0) {
+				wg_snap_save(osc);
+			}
+			float mallet_out = 0;
+			if (osc->estate == 1) {
+				mallet_out = impulse_gen(osc);
+				int32_t m = q_sample(mallet_out, WG_Q_SHIFT);
+				dl[osc->x_pos_l] = q_sat16(dl[osc->x_pos_l] + m);
+				dr[osc->x_pos_r] = q_sat16(dr[osc->x_pos_r] + m);
+			}
+			// nut and bridge reflections
+			dr[osc->bridge_pos] = q_sat16(tube * dl[osc->nut_pos]);
+			dl[osc->bridge_pos] = q_sat16((r * dr[osc->nut_pos] + Q15_ROUND) >> 15);
+
+			// all pass filter for stiffness
+			uint32_t x = q_pack(dl[osc->x_pos_l], dl[osc->x_pos_l_2]);
+			dl[osc->x_pos_l_2] = q_sat16(q_smlad(x, ap, Q15_ROUND) >> 15);
+
+			// linear interpolation
+			x = q_pack(dl[osc->x_pos_l], dl[osc->x_pos_l_2]);
+			dl[osc->x_pos_l] = q_sat16(q_smlad(x, li, Q15_ROUND) >> 15);
+			x = q_pack(dr[osc->x_pos_r], dr[osc->x_pos_r_2]);
+			dr[osc->x_pos_r] = q_sat16(q_smlad(x, li, Q15_ROUND) >> 15);
+
+			y = ky * (float)(dl[osc->x_pos_l] + dr[osc->x_pos_r]);
+			out[i] = (osc->impulse_solo) ? mallet_out : vel * y;
+			osc->hold = out[i];
+			osc->hold_y = y;
+
+			// stepping and wrapping pointers
+			osc->x_pos_l = (osc->x_pos_l < osc->delay_len) ? osc->x_pos_l + 1 : 0;
+			osc->x_pos_l_2 = (osc->x_pos_l_2 < osc->delay_len) ? osc->x_pos_l_2 + 1 : 0;
+			osc->x_pos_r = (osc->x_pos_r < osc->delay_len) ? osc->x_pos_r + 1 : 0;
+			osc->x_pos_r_2 = (osc->x_pos_r_2 < osc->delay_len) ? osc->x_pos_r_2 + 1 : 0;
+			osc->bridge_pos = (osc->bridge_pos < osc->delay_len) ? osc->bridge_pos + 1 : 0;
+			osc->nut_pos = (osc->nut_pos < osc->delay_len) ? osc->nut_pos + 1 : 0;
+			osc->pickup_pos = (osc->pickup_pos < osc->delay_len) ? osc->pickup_pos + 1 : 0;
+		} else {
+			out[i] = osc->hold;	// sample and hold
+		}
+		osc->ds_phase = (osc->ds_phase + 1 < osc->downsample_amt) ? osc->ds_phase + 1 : 0;
+		if (osc->snap.mode == SNAP_RECORD) {
+			snap_record(&osc->snap, y);
+		}
+		osc->epos += 1;
+	}
+}
+
+#endif
+
+void wg_gen(struct wg *osc, float *out, size_t n) {
+	if (osc->delay_l == NULL) {
+		memset(out, 0, n * sizeof(float));
+		return;
+	}
+	float am[n];
+	adsr_gen(&osc->adsr, am, n);
+	float vel = (osc->velocity) / 0.8f + 0.2f;
+	size_t i = 0;
+	// play back a cached excitation
+	if (osc->snap.mode == SNAP_PLAY) {
+		i = snap_play(&osc->snap, out, n, vel);
+	}
+	wg_kernel(osc, out, i, n, vel);
+	osc->fresh = 0;
 	block_mul(out, am, n);
 	//svf2_gen_lpf(&osc->opf, out, out, n, FILT_LOW_PASS); //TODO remove
 }
@@ -113,6 +289,9 @@ void wg_gen(struct wg *osc, float *out, size_t n) {
 //-----------------------------------------------------------------------------
 
 void wg_excite(struct wg *osc) {
+	if (osc->delay_l == NULL) {
+		return;
+	}
 	// On each time interval, insert the next sample point of the exciter
 	// sample into a point of the delay line.
 
@@ -127,18 +306,35 @@ void wg_excite(struct wg *osc) {
 	// |                         x               x                |
 	// ------------------------------------------------------------
 	//
-	//
+	// The positions are relative to the nut. A silent string starts with the
+	// nut at 0. A ringing string is struck in place: the pointers and the
+	// travelling waves are kept and the impulse adds to them.
 	//osc->excite_pos = 3;
-	osc->x_pos_l = osc->excite_pos;
-	osc->x_pos_r = (osc->delay_len) - osc->excite_pos;
-	osc->x_pos_l_2 = osc->x_pos_l + 1;
-	osc->x_pos_r_2 = osc->x_pos_r + 1;
-	osc->bridge_pos = osc->delay_len;
-	osc->nut_pos = 0;
-	osc->pickup_pos = WG_PICKUP_POS;
-
-
-
+	uint32_t len = osc->delay_len + 1;
+	uint32_t nut = 0;
+	if (!osc->fresh && osc->retrigger) {
+		nut = osc->nut_pos % len;
+	} else {
+		// the excitation starts on a model step
+		osc->ds_phase = 0;
+	}
+	osc->nut_pos = nut;
+	osc->x_pos_l = (nut + osc->excite_pos) % len;
+	osc->x_pos_r = (nut + osc->delay_len - osc->excite_pos) % len;
+	osc->x_pos_l_2 = (osc->x_pos_l + 1) % len;
+	osc->x_pos_r_2 = (osc->x_pos_r + 1) % len;
+	osc->bridge_pos = (nut + osc->delay_len) % len;
+	osc->pickup_pos = (nut + WG_PICKUP_POS) % len;
+
+	// a silent voice can use a cached excitation
+	snap_cancel(&osc->snap);
+	if (osc->fresh && !osc->impulse_solo && osc->delay_len < WG_SNAP_LEN) {
+		struct snap_key key;
+		wg_snap_key(osc, &key);
+		if (snap_lookup(&osc->snap, &key) == SNAP_PLAY) {
+			wg_snap_restore(osc, snap_state(&osc->snap));
+		}
+	}
 }
 
 
@@ -154,11 +350,36 @@ void wg_ctrl_reflection(struct wg *osc, float reflection) {
 	osc->r = reflection;
 }
 
+// clear the newly used part of the delay lines
+static void wg_clear(struct wg *osc) {
+	uint32_t n = osc->delay_len + 2;
+	if (n > osc->delay_size) {
+		n = osc->delay_size;
+	}
+	if (n > osc->clear_len) {
+		memset(&osc->delay_l[osc->clear_len], 0, (n - osc->clear_len) * sizeof(wg_t));
+		memset(&osc->delay_r[osc->clear_len], 0, (n - osc->clear_len) * sizeof(wg_t));
+		osc->clear_len = n;
+	}
+}
+
 void wg_ctrl_frequency(struct wg *osc, float freq) {
 	osc->freq = freq;
-	osc->delay_len_total = (AUDIO_FS/freq/2.0f/osc->downsample_amt)+1;
+	if (osc->delay_l == NULL) {
+		return;
+	}
+	float total = (audio_fs/freq/2.0f/osc->downsample_amt)+1;
+	// wg_alloc sized the delay lines for the lowest pitch
+	osc->delay_len_total = clampf(total, 1.f, (float)(osc->delay_size - 2));
+	if (osc->delay_len_total != total) {
+		DBG("wg %d Hz is out of range at %d Hz\r\n", (int)freq, (int)audio_fs);
+	}
 	osc->delay_len = (uint32_t) osc->delay_len_total; // delay line length
 	osc->delay_len_frac = osc->delay_len_total - (float) osc->delay_len;
+	// output scaling for the full rate delay line
+	total = (audio_fs/freq/2.0f/osc->downsample_base)+1;
+	osc->out_frac = 1.0f - (total - (float)(uint32_t) total);
+	wg_clear(osc);
 	//DBG("delay length: %d\r\n", osc->delay_len);
 }
 
@@ -182,7 +403,8 @@ void wg_set_velocity(struct wg *osc, float velocity) {
 }
 
 void wg_set_samplerate(struct wg *osc, float downsample_amt) {
-	osc->downsample_amt = downsample_amt;
+	osc->downsample_base = downsample_amt;
+	osc->downsample_amt = osc->downsample_base << osc->lod;
 }
 
 void wg_exciter_type(struct wg *osc, int exciter_type) {
@@ -200,10 +422,104 @@ void wg_exciter_type(struct wg *osc, int exciter_type) {
 }
 
 void wg_init(struct wg *osc) {
+	memset(osc, 0, sizeof(struct wg));
 	// setting all pass values
 	osc->ap_state_1 = 0.0f;
 	osc->ap_state_2 = 0.0f;
+	osc->downsample_base = 1;
 	osc->downsample_amt = 1;
+	osc->lod = LOD_FULL;
+	osc->fresh = 1;
+}
+
+// Allocate the delay lines for notes down to freq (Hz).
+// The voice runs at the highest rate that fits its share of the pool (see
+// dl_fits), the lowest rate takes whatever there is. Returns -1 if there's no
+// room at all, the voice is then silent.
+int wg_alloc(struct wg *osc, float freq) {
+	for (uint32_t ds = 1; ds <= WG_DOWNSAMPLE_MAX; ds <<= 1) {
+		// both delay lines are in one block
+		size_t size = dl_size(2 * ((uint32_t) (audio_fs / freq / 2.0f / ds) + 3) * sizeof(wg_t));
+		if (ds < WG_DOWNSAMPLE_MAX && !dl_fits(size)) {
+			continue;
+		}
+		wg_t *buf = (size) ? dl_alloc(size) : NULL;
+		if (buf) {
+			osc->delay_size = size / (2 * sizeof(wg_t));
+			osc->delay_l = buf;
+			osc->delay_r = buf + osc->delay_size;
+			osc->clear_len = 0;
+			wg_set_samplerate(osc, ds);
+			return 0;
+		}
+	}
+	DBG("no delay line memory for %d Hz\r\n", (int)freq);
+	return -1;
+}
+
+//-----------------------------------------------------------------------------
+// level of detail
+// LOD_LOW halves the internal sample rate. The delay lines are resampled to
+// the new length (keeping the wave shape) so the switch doesn't click.
+
+// interpolate a delay line of len samples at x
+static wg_t wg_interp(const wg_t *buf, uint32_t len, float x) {
+	uint32_t k = (uint32_t) x;
+	uint32_t k1 = (k + 1 < len) ? k + 1 : k;
+	float y0 = wg_rd(buf[k], WG_Q_SHIFT);
+	float y1 = wg_rd(buf[k1], WG_Q_SHIFT);
+	return wg_wr(y0 + (x - (float)k) * (y1 - y0), WG_Q_SHIFT);
+}
+
+// Resample a delay line of len samples (starting at ofs) to len2 samples.
+// It's done in place. A shorter line is written upwards, each sample reads
+// from at or above itself, and a longer one downwards (sample 0 is kept).
+static void wg_resample(wg_t *buf, uint32_t len, uint32_t ofs, uint32_t len2) {
+	dl_rotate(buf, len, ofs, sizeof(wg_t));
+	float step = (float)len / (float)len2;
+	if (len2 <= len) {
+		for (uint32_t i = 0; i < len2; i++) {
+			buf[i] = wg_interp(buf, len, (float)i * step);
+		}
+	} else {
+		for (uint32_t i = len2 - 1; i > 0; i--) {
+			buf[i] = wg_interp(buf, len, (float)i * step);
+		}
+	}
+}
+
+// move a delay line position to the resampled delay line
+static uint32_t wg_repos(uint32_t pos, uint32_t len, uint32_t ofs, uint32_t len2) {
+	uint32_t x = (pos + len - ofs) % len;
+	return ((x * len2 + (len >> 1)) / len) % len2;
+}
+
+void wg_ctrl_lod(struct wg *osc, int lod) {
+	if (lod == osc->lod || osc->delay_l == NULL) {
+		return;
+	}
+	uint32_t ds = osc->downsample_base << lod;
+	if (audio_fs / osc->freq / 2.0f / ds < WG_LOD_MIN_LEN) {
+		// the delay line would be too short
+		return;
+	}
+	uint32_t len = osc->delay_len + 1;
+	uint32_t ofs = osc->nut_pos;
+	osc->lod = lod;
+	osc->downsample_amt = ds;
+	wg_ctrl_frequency(osc, osc->freq);
+	uint32_t len2 = osc->delay_len + 1;
+	wg_resample(osc->delay_l, len, ofs, len2);
+	wg_resample(osc->delay_r, len, ofs, len2);
+	// the nut is now at the start of the delay lines
+	osc->x_pos_l = wg_repos(osc->x_pos_l, len, ofs, len2);
+	osc->x_pos_r = wg_repos(osc->x_pos_r, len, ofs, len2);
+	osc->x_pos_l_2 = (osc->x_pos_l + 1) % len2;
+	osc->x_pos_r_2 = (osc->x_pos_r + 1) % len2;
+	osc->pickup_pos = wg_repos(osc->pickup_pos, len, ofs, len2);
+	osc->bridge_pos = len2 - 1;
+	osc->nut_pos = 0;
+	osc->excite_pos = osc->excite_loc * osc->delay_len_total;
 }
 
 //-----------------------------------------------------------------------------
@@ -1,11 +1,37 @@
 //-----------------------------------------------------------------------------
 /*
 
-2d waveguide grid
+2d waveguide mesh
+
+The rectilinear waveguide mesh is run in its finite difference form. Each
+junction velocity only depends on the junction velocities around it:
+
+  u(n+1) = 0.5 * (uN(n) + uS(n) + uE(n) + uW(n)) - u(n-1)
+
+so the mesh is a plane of junction values at n and one at n-1, instead of a
+junction velocity and eight travelling waves per junction. u(n+1) replaces
+u(n-1) in place and the planes swap roles, so one sweep does a whole update.
+
+The planes have a border of zero junctions around them (clamped edges), so
+every junction is updated the same way and there are no boundary loops.
+
+The general form of the update is
+
+  u(n+1) = a1 * (uN + uS + uE + uW) + a0 * u(n) - g * u(n-1)
+
+a1 = g * c, a0 = g * (2 - 4 * c) where c is the wave speed squared (in
+junctions per update, at most 0.5 for stability) and g is the loss. The
+mesh above is c = 0.5, and a lower wave speed tunes the same mesh to lower
+notes. Without loss, the lowest mode of a size x size mesh is at
+
+  sin(w / 2) = sqrt(2 * c) * sin(pi / (2 * (size + 1)))
 
 */
 //-----------------------------------------------------------------------------
 
+#include <math.h>
+#include <string.h>
+
 #include "pmsynth.h"
 #include "utils.h"
 
@@ -14,138 +40,181 @@
 
 //-----------------------------------------------------------------------------
 
-#define STRIKE_POS_X 2
-#define	STRIKE_POS_Y 4
-#define GRID_SIZE 7
-#define DECAY 0.5f // decay between junctions (keep below 0.5)
-#define BOUNDARY_REFLN -0.99f
+// default excite and pickup positions
+#define STRIKE_POS_X 0.3f
+#define STRIKE_POS_Y 0.6f
+#define PICKUP_POS_X 0.3f
+#define PICKUP_POS_Y 0.3f
+
+// exciter sample scaling
+#define MESH_IN_SCALE 2.f
 
 //-----------------------------------------------------------------------------
 
-void wg_2d_gen(struct wg_2d *osc, float *out, size_t n) {
-	float mallet_out = 0;
-	for (size_t i = 0; i < n; i++) {
-		if (i % 2 == 0){
-
-			// TICK
-
-			// mallet hit
-			if (osc->estate == 1){
-				mallet_out = impulse_gen_2d(osc);		
-			} 
-
-			// calculate junction velocity
-			for (size_t x = 0; x <= (GRID_SIZE - 1); x++){
-				for (size_t y = 0; y <= (GRID_SIZE - 1); y++){
-					osc->mesh[x][y].vJ = DECAY * (osc->mesh[x][y].vE +
-										 osc->mesh[x][y+1].vW +
-										 osc->mesh[x][y].vN +
-										 osc->mesh[x+1][y].vS);
-				}
-			}
-			// add the exciter sample
-			osc->mesh[STRIKE_POS_X][STRIKE_POS_Y].vJ += mallet_out;
-			// calculate out-travelling waves from junction
-			for (size_t x = 1; x <= GRID_SIZE; x++){
-				for (size_t y = 1; y <= GRID_SIZE; y++){
-					osc->mesh[x-1][y].vE1 = osc->mesh[x-1][y-1].vJ - 
-											osc->mesh[x-1][y].vW;
-
-					osc->mesh[x][y-1].vN1 = osc->mesh[x-1][y-1].vJ - 
-											osc->mesh[x][y-1].vS;
-
-					osc->mesh[x-1][y-1].vW1 = osc->mesh[x-1][y-1].vJ - 
-											osc->mesh[x-1][y-1].vE;
-
-					osc->mesh[x-1][y-1].vS1 = osc->mesh[x-1][y-1].vJ - 
-											osc->mesh[x-1][y-1].vN;
-				}
-			}
+// return the cell for a position (0..1) on a size x size mesh
+static uint16_t wg_2d_cell(size_t size, float x, float y) {
+	size_t i = 1 + (size_t)(clampf(x, 0.f, 1.f) * (float)(size - 1) + 0.5f);
+	size_t j = 1 + (size_t)(clampf(y, 0.f, 1.f) * (float)(size - 1) + 0.5f);
+	return j * MESH_STRIDE + i;
+}
 
-		} else{
-
-			// TOCK
-			// mallet hit
-			if (osc->estate == 1){
-				mallet_out = impulse_gen_2d(osc);		
-			} 
-
-			// calculate junction velocity
-			for (size_t x = 0; x <= GRID_SIZE - 1; x++){
-				for (size_t y = 0; y <= GRID_SIZE - 1; y++){
-					osc->mesh[x][y].vJ = DECAY * 
-										(osc->mesh[x][y].vE1 +
-										 osc->mesh[x][y+1].vW1 +
-										 osc->mesh[x][y].vN1 +
-										 osc->mesh[x+1][y].vS1);
-				}
-			}
-			
-			// add the exciter sample
-			osc->mesh[STRIKE_POS_X][STRIKE_POS_Y].vJ += mallet_out;
+// set the coefficients and cells for the current frequency and level of detail
+static void wg_2d_tune(struct wg_2d *osc) {
+	size_t size = (osc->lod == LOD_LOW) ? MESH_SIZE_LOD : MESH_SIZE;
+	float ts = (osc->lod == LOD_LOW) ? 2.f * audio_ts : audio_ts;	// update period
+	// The amplitude decays by h = sqrt(g) per update, and by attenuate per
+	// period. The loss raises the pitch a little, so it's part of the tuning.
+	float d = osc->freq * ts * logf(osc->attenuate);
+	float h = expf(d);
+	float g = h * h;
+	// wave speed for the lowest mode
+	float q = sin_eval(PI * osc->freq * ts);
+	float s = sin_eval(PI / (float)(2 * (size + 1)));
+	float c = clampf((2.f * q * q + expm1f(d)) / (4.f * h * s * s), 0.f, 0.5f);
+	osc->a1 = g * c;
+	osc->a0 = g * (2.f - 4.f * c);
+	osc->g = g;
+	// the lower the wave speed the more a sample moves the mesh
+	osc->k = 2.f * c;
+	osc->eidx = wg_2d_cell(size, osc->ex, osc->ey);
+	osc->pidx = wg_2d_cell(size, osc->px, osc->py);
+}
 
-			// calculate out-travelling waves from junction
-			for (size_t x = 1; x <= GRID_SIZE; x++){
-				for (size_t y = 1; y <= GRID_SIZE; y++){
-					osc->mesh[x-1][y].vE = osc->mesh[x-1][y-1].vJ - 
-											osc->mesh[x-1][y].vW1;
+//-----------------------------------------------------------------------------
 
-					osc->mesh[x][y-1].vN = osc->mesh[x-1][y-1].vJ - 
-											osc->mesh[x][y-1].vS1;
+// Update the mesh, add the exciter sample and return the pickup value.
+// size is a constant after inlining, so the loops can be unrolled.
+static inline float wg_2d_update(struct wg_2d *osc, size_t size, float in) {
+	const float *restrict u = osc->u[osc->cur];
+	float *restrict u1 = osc->u[osc->cur ^ 1];
+	float a1 = osc->a1;
+	float a0 = osc->a0;
+	float g = osc->g;
+	for (size_t y = 1; y <= size; y++) {
+		size_t row = y * MESH_STRIDE;
+		for (size_t i = row + 1; i <= row + size; i++) {
+			u1[i] = a1 * (u[i - MESH_STRIDE] + u[i + MESH_STRIDE] + u[i - 1] + u[i + 1]) + a0 * u[i] - g * u1[i];
+		}
+	}
+	u1[osc->eidx] += in;
+	osc->cur ^= 1;
+	return u1[osc->pidx];
+}
 
-					osc->mesh[x-1][y-1].vW = osc->mesh[x-1][y-1].vJ - 
-											osc->mesh[x-1][y-1].vE1;
+void wg_2d_gen(struct wg_2d *osc, float *out, size_t n) {
+	// LOD_LOW halves the mesh resolution and the update rate
+	int lod = osc->lod;
+	float k = MESH_IN_SCALE * osc->k * osc->vel;
+	float in = 0.f;
+	for (size_t i = 0; i < n; i++) {
+		// mallet hit
+		if (osc->estate == 1) {
+			in += k * impulse_gen_2d(osc);
+		}
+		if (lod == LOD_LOW) {
+			if ((i & 1) == 0) {
+				// the exciter is summed over the update period
+				out[i] = osc->u[osc->cur][osc->pidx];
+				continue;
+			}
+			out[i] = wg_2d_update(osc, MESH_SIZE_LOD, in);
+		} else {
+			out[i] = wg_2d_update(osc, MESH_SIZE, in);
+		}
+		in = 0.f;
+	}
+}
 
-					osc->mesh[x-1][y-1].vS = osc->mesh[x-1][y-1].vJ - 
-											osc->mesh[x-1][y-1].vN1;
+//-----------------------------------------------------------------------------
+// level of detail
+// The coarse mesh has half the junctions on each side, with twice the
+// spacing, and is updated at half the rate. It's retuned so the pitch stays
+// the same. Both planes are averaged onto the coarse mesh and copied back
+// onto the fine mesh, in place.
+
+// average a 2x2 block of junctions from the fine mesh
+static float wg_2d_restrict(const float *u, size_t x, size_t y) {
+	size_t i = (2 * y + 1) * MESH_STRIDE + 2 * x + 1;
+	return 0.25f * (u[i] + u[i + 1] + u[i + MESH_STRIDE] + u[i + MESH_STRIDE + 1]);
+}
+
+void wg_2d_ctrl_lod(struct wg_2d *osc, int lod) {
+	if (lod == osc->lod) {
+		return;
+	}
+	osc->lod = lod;
+	for (int k = 0; k < 2; k++) {
+		float *u = osc->u[k];
+		if (lod == LOD_LOW) {
+			// forwards, each coarse junction is before the fine ones it's read from
+			for (size_t y = 0; y < MESH_SIZE_LOD; y++) {
+				for (size_t x = 0; x < MESH_SIZE_LOD; x++) {
+					u[(y + 1) * MESH_STRIDE + x + 1] = wg_2d_restrict(u, x, y);
 				}
 			}
-			// boundary calculations
-			for (size_t x = 1; x <= GRID_SIZE; x++){
-				osc->mesh[x-1][0].vE = BOUNDARY_REFLN * 
-									osc->mesh[x-1][0].vW1;
-
-				osc->mesh[x-1][GRID_SIZE].vW = BOUNDARY_REFLN * 
-									osc->mesh[x-1][GRID_SIZE].vE1;	
+			// clear the border of the coarse mesh
+			for (size_t i = 0; i <= MESH_SIZE_LOD + 1; i++) {
+				u[(MESH_SIZE_LOD + 1) * MESH_STRIDE + i] = 0.f;
+				u[i * MESH_STRIDE + MESH_SIZE_LOD + 1] = 0.f;
 			}
-			for (size_t y = 1; y <= GRID_SIZE; y++){
-				osc->mesh[0][y-1].vN = BOUNDARY_REFLN * 
-									osc->mesh[0][y-1].vS1;
-
-				osc->mesh[GRID_SIZE][y-1].vS = BOUNDARY_REFLN * 
-									osc->mesh[GRID_SIZE][y-1].vN1;	
+		} else {
+			// backwards, so each coarse junction is read before it's overwritten
+			for (int y = MESH_SIZE - 1; y >= 0; y--) {
+				for (int x = MESH_SIZE - 1; x >= 0; x--) {
+					u[(y + 1) * MESH_STRIDE + x + 1] = u[((y >> 1) + 1) * MESH_STRIDE + (x >> 1) + 1];
+				}
 			}
-		
 		}
-		out[i] = osc->mesh[2][2].vJ;
 	}
+	wg_2d_tune(osc);
 }
 
 //-----------------------------------------------------------------------------
 
 void wg_2d_pluck(struct wg_2d *osc) {
-	// On each time interval, insert the next sample point of the exciter
-	// sample into a point of the delay line.
-
-	// for now it sets a flag for wg_gen to begin adding this to the delay
-	// line
+	// sets a flag for wg_2d_gen to begin adding the exciter sample to the
+	// mesh at the excite position
 	osc->estate = 1;
 	osc->epos = 0;
 }
 
+void wg_2d_set_velocity(struct wg_2d *osc, float vel) {
+	osc->vel = vel;
+}
+
 //-----------------------------------------------------------------------------
 
+// attenuate is the decay per period of the lowest mode (0..1]
 void wg_2d_ctrl_attenuate(struct wg_2d *osc, float attenuate) {
-	//osc->k = 0.5f * attenuate;
+	osc->attenuate = clampf(attenuate, 0.01f, 1.f);
+	wg_2d_tune(osc);
 }
 
+// The highest note is where the wave speed reaches its limit, about 2.6kHz
+// (2.4kHz at LOD_LOW). Above that the mesh stays at its highest note.
 void wg_2d_ctrl_frequency(struct wg_2d *osc, float freq) {
-	//osc->freq = freq;
-	//osc->xstep = (uint32_t) (osc->freq * KS_FSCALE);
+	osc->freq = freq;
+	wg_2d_tune(osc);
+}
+
+// set the excite and pickup positions (0..1 across the mesh)
+void wg_2d_ctrl_position(struct wg_2d *osc, float ex, float ey, float px, float py) {
+	osc->ex = ex;
+	osc->ey = ey;
+	osc->px = px;
+	osc->py = py;
+	wg_2d_tune(osc);
 }
 
 void wg_2d_init(struct wg_2d *osc) {
-	// do nothing
+	memset(osc, 0, sizeof(struct wg_2d));
+	osc->attenuate = 0.99f;
+	osc->vel = 1.f;
+	osc->ex = STRIKE_POS_X;
+	osc->ey = STRIKE_POS_Y;
+	osc->px = PICKUP_POS_X;
+	osc->py = PICKUP_POS_Y;
+	wg_2d_tune(osc);
 }
 
 //-----------------------------------------------------------------------------
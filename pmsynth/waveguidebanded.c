@@ -6,6 +6,8 @@ Banded waveguide model
 */
 //-----------------------------------------------------------------------------
 
+#include <string.h>
+
 #include "pmsynth.h"
 #include "utils.h"
 
@@ -14,32 +16,139 @@ Banded waveguide model
 #include <math.h>
 //-----------------------------------------------------------------------------
 
-void wgb_gen(struct wgb *osc, float *out, size_t n) {
-	float am[n];
-	adsr_gen(&osc->adsr, am, n);
-	for (size_t i = 0; i < n; i++) {
+// the lowest internal rate (as a divisor) when the delay line pool is short
+// The three modes of a low note (down to note 19) fit the voice budget at
+// this rate.
+#define WGB_DOWNSAMPLE_MAX 16
+
+// the delay lines are used up to delay_len + 4 (the pointers start at 0..3)
+#define WGB_DELAY_PAD 4
+
+//-----------------------------------------------------------------------------
+// excitation snapshots
+
+// the model state at the end of the excitation
+struct wgb_snap {
+	struct mode mode[NUM_MODES];
+	wg_t delay[NUM_MODES][WGB_SNAP_LEN];
+	uint32_t epos;
+	int estate;
+};
+
+// return !=0 if the mode delay lines fit in a snapshot
+static int wgb_snap_fits(struct wgb *osc) {
+	for (size_t j = 0; j < NUM_MODES; j++) {
+		if (osc->mode[j].delay_len + WGB_DELAY_PAD > WGB_SNAP_LEN) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+// the parameters the excitation depends on
+static void wgb_snap_key(struct wgb *osc, struct snap_key *key) {
+	memset(key, 0, sizeof(struct snap_key));
+	key->model = SNAP_WGB;
+	key->k[0] = snap_float(osc->freq);
+	key->k[1] = snap_float(audio_fs);
+	key->k[2] = snap_float(osc->h_coef);
+	key->k[3] = snap_float(osc->brightness);
+	key->k[4] = snap_float(osc->mode_mix_amt);
+	key->k[5] = snap_float(osc->reflection_adjust);
+	key->k[6] = osc->resonator_type | (osc->impulse << 8);
+	key->k[7] = osc->lod | (osc->num_modes << 8);
+	// the mode rates depend on the delay line memory the voice got
+	for (size_t j = 0; j < NUM_MODES; j++) {
+		key->k[7] |= osc->mode[j].downsample_amt << (16 + 5 * j);
+	}
+}
+
+static void wgb_snap_save(struct wgb *osc) {
+	struct snap_key key;
+	wgb_snap_key(osc, &key);
+	struct wgb_snap *s = snap_finish(&osc->snap, &key);
+	if (s == NULL) {
+		return;
+	}
+	memcpy(s->mode, osc->mode, sizeof(osc->mode));
+	for (size_t j = 0; j < NUM_MODES; j++) {
+		struct mode *m = &osc->mode[j];
+		memcpy(s->delay[j], m->delay, (m->delay_len + WGB_DELAY_PAD) * sizeof(wg_t));
+	}
+	s->epos = osc->epos;
+	s->estate = osc->estate;
+}
+
+static void wgb_snap_restore(struct wgb *osc, const struct wgb_snap *s) {
+	for (size_t j = 0; j < NUM_MODES; j++) {
+		struct mode *m = &osc->mode[j];
+		// keep this voice's delay line
+		wg_t *delay = m->delay;
+		uint32_t delay_size = m->delay_size;
+		uint32_t clear_len = m->clear_len;
+		*m = s->mode[j];
+		m->delay = delay;
+		m->delay_size = delay_size;
+		m->clear_len = clear_len;
+		memcpy(m->delay, s->delay[j], (m->delay_len + WGB_DELAY_PAD) * sizeof(wg_t));
+	}
+	osc->epos = s->epos;
+	osc->estate = s->estate;
+}
+
+// stop the voice, it's silent until the next wgb_alloc
+void wgb_stop(struct wgb *osc) {
+	snap_cancel(&osc->snap);
+	for (size_t j = 0; j < NUM_MODES; j++) {
+		struct mode *m = &osc->mode[j];
+		dl_free(m->delay, m->delay_size * sizeof(wg_t));
+		m->delay = NULL;
+		m->delay_size = 0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+#if !WG_Q15
+
+// generate samples i..n-1
+static void wgb_kernel(struct wgb *osc, float *out, size_t i, size_t n, float fade, float fade_step) {
+	for (; i < n; i++) {
+		if (osc->snap.mode == SNAP_RECORD && osc->estate == 0) {
+			wgb_snap_save(osc);
+		}
 		out[i] = 0.0f;
 
-		for (size_t j = 0; j < NUM_MODES; j++) {
-			if (i % osc->mode[j].downsample_amt == 0){
+		for (size_t j = 0; j < osc->num_modes; j++) {
+			// the phase carries over blocks, they can be any length
+			if (osc->mode[j].ds_phase == 0){
 				// mallet hit
 				float mallet_out = 0;
 				if (osc->estate == 1){
 					mallet_out = impulse_gen_wgb(osc);		
-					osc->mode[j].delay[osc->mode[j].dl_ptr_in] += mallet_out;
+					wg_t *x = &osc->mode[j].delay[osc->mode[j].dl_ptr_in];
+					*x = wg_wr(wg_rd(*x, WGB_Q_SHIFT) + mallet_out, WGB_Q_SHIFT);
 					// uncomment for direct mallet output
 					//out[i] = mallet_out;
 				}
 
-				out[i] += osc->mode[j].delay[osc->mode[j].dl_ptr_out]*osc->mode[j].mix_factor;
-				svf2_gen(&osc->mode[j].bpf, &osc->mode[j].delay[osc->mode[j].dl_ptr_out], &osc->mode[j].delay[osc->mode[j].dl_ptr_in], 1, FILT_BAND_PASS);
+				float mix = osc->mode[j].mix_factor;
+				if (j >= WGB_LOD_MODES) {
+					mix *= fade;
+				}
+				out[i] += wg_rd(osc->mode[j].delay[osc->mode[j].dl_ptr_out], WGB_Q_SHIFT) * mix;
+				float x = wg_rd(osc->mode[j].delay[osc->mode[j].dl_ptr_in], WGB_Q_SHIFT);
+				svf2_gen(&osc->mode[j].bpf, &x, &x, 1, FILT_BAND_PASS);
+				osc->mode[j].delay[osc->mode[j].dl_ptr_out] = wg_wr(x, WGB_Q_SHIFT);
 
 				//---------------------------------------------------------
 				// linear interp for tuning, currently only applies to lowest harmonic to save cpu
 				if (j == 0){
 				float frac = (float) osc->mode[j].delay_len_frac;
 
-				osc->mode[j].delay[osc->mode[j].dl_ptr_lin_tuner_2] = (frac) * osc->mode[j].delay[osc->mode[j].dl_ptr_lin_tuner_1] + (1.0f - frac) * osc->mode[j].delay[osc->mode[j].dl_ptr_lin_tuner_2];
+				float x1 = wg_rd(osc->mode[j].delay[osc->mode[j].dl_ptr_lin_tuner_1], WGB_Q_SHIFT);
+				float x2 = wg_rd(osc->mode[j].delay[osc->mode[j].dl_ptr_lin_tuner_2], WGB_Q_SHIFT);
+				osc->mode[j].delay[osc->mode[j].dl_ptr_lin_tuner_2] = wg_wr((frac) * x1 + (1.0f - frac) * x2, WGB_Q_SHIFT);
 				
 				// wrapping linear interp pointers 
 				osc->mode[j].dl_ptr_lin_tuner_1 += 1;
@@ -61,19 +170,140 @@ void wgb_gen(struct wgb *osc, float *out, size_t n) {
 					if (osc->mode[j].dl_ptr_out > osc->mode[j].delay_len){
 						osc->mode[j].dl_ptr_out = 0;
 						// mixing between modes
-						osc->mode[j].delay[osc->mode[j].dl_ptr_out] = (osc->mode_mix_amt) * out[i] + (1.0f - osc->mode_mix_amt) * osc->mode[j].delay[osc->mode[j].dl_ptr_out];
+						float x = wg_rd(osc->mode[j].delay[osc->mode[j].dl_ptr_out], WGB_Q_SHIFT);
+						osc->mode[j].delay[osc->mode[j].dl_ptr_out] = wg_wr((osc->mode_mix_amt) * out[i] + (1.0f - osc->mode_mix_amt) * x, WGB_Q_SHIFT);
 					}
 				} else {
-				out[i] = out[i] * 0.5f + out[i-1] *0.5f; // linear interp on output when downsampling
+				out[i] = out[i] * 0.5f + osc->prev *0.5f; // linear interp on output when downsampling
 				osc->epos += 1; // incrementing impulse sample
 				}
+			osc->mode[j].ds_phase = (osc->mode[j].ds_phase + 1 < osc->mode[j].downsample_amt) ? osc->mode[j].ds_phase + 1 : 0;
 			}
+		osc->prev = out[i];
+		fade -= fade_step;
+		if (osc->snap.mode == SNAP_RECORD) {
+			snap_record(&osc->snap, out[i]);
+		}
 		//all pass filter for tuning!
 		// float temp = out[i];
 		// out[i] = - osc->a * out[i]+ osc->ap_old_in + osc->a * osc->ap_old_out;
 		// osc->ap_old_out = out[i];
 		// osc->ap_old_in = temp;
 	}
+}
+
+#else
+
+// Fixed point kernel.
+// The delay lines are Q13, the bandpass state is Q24 with Q31 coefficients.
+static void wgb_kernel(struct wgb *osc, float *out, size_t i, size_t n, float fade, float fade_step) {
+	// the bandpass coefficients
+	int32_t a1[NUM_MODES], a2[NUM_MODES], a3[NUM_MODES];
+	int32_t mix[NUM_MODES];
+	for (size_t j = 0; j < osc->num_modes; j++) {
+		struct svf2 *f = &osc->mode[j].bpf;
+		float k1 = 1.f / (1.f + (f->g * (f->g + f->k)));
+		float k2 = f->g * k1;
+		a1[j] = q31(k1);
+		a2[j] = q31(k2);
+		a3[j] = q31(f->g * k2);
+		mix[j] = q15(osc->mode[j].mix_factor);
+	}
+	// (frac, 1 - frac) linear interpolation mix for the lowest mode
+	uint32_t li = q_mix(1.0f - osc->mode[0].delay_len_frac);
+	// (amt, 1 - amt) mode mix
+	uint32_t mm = q_mix(1.0f - osc->mode_mix_amt);
+	// the previous output sample
+	int32_t prev = q_sample(osc->prev, WGB_Q_SHIFT);
+
+	for (; i < n; i++) {
+		if (osc->snap.mode == SNAP_RECORD && osc->estate == 0) {
+			wgb_snap_save(osc);
+		}
+		int32_t acc = 0;
+		for (size_t j = 0; j < osc->num_modes; j++) {
+			struct mode *m = &osc->mode[j];
+			wg_t *d = m->delay;
+			// the phase carries over blocks, they can be any length
+			if (m->ds_phase == 0) {
+				// mallet hit
+				if (osc->estate == 1) {
+					int32_t x = q_sample(impulse_gen_wgb(osc), WGB_Q_SHIFT);
+					d[m->dl_ptr_in] = q_sat16(d[m->dl_ptr_in] + x);
+				}
+				int32_t k = mix[j];
+				if (j >= WGB_LOD_MODES && osc->fade) {
+					k = q15(m->mix_factor * fade);
+				}
+				acc += (d[m->dl_ptr_out] * k) >> 15;
+
+				// bandpass from the input to the output tap
+				int32_t v0 = (int32_t)d[m->dl_ptr_in] << (24 - WGB_Q_SHIFT);
+				int32_t v3 = v0 - m->ic2;
+				int32_t v1 = q31_mul(m->ic1, a1[j]) + q31_mul(v3, a2[j]);
+				int32_t v2 = m->ic2 + q31_mul(m->ic1, a2[j]) + q31_mul(v3, a3[j]);
+				m->ic1 = 2 * v1 - m->ic1;
+				m->ic2 = 2 * v2 - m->ic2;
+				d[m->dl_ptr_out] = q_sat16(v1 >> (24 - WGB_Q_SHIFT));
+
+				// linear interp for tuning (lowest mode only)
+				if (j == 0) {
+					uint32_t x = q_pack(d[m->dl_ptr_lin_tuner_1], d[m->dl_ptr_lin_tuner_2]);
+					d[m->dl_ptr_lin_tuner_2] = q_sat16(q_smlad(x, li, Q15_ROUND) >> 15);
+					m->dl_ptr_lin_tuner_1 = (m->dl_ptr_lin_tuner_1 < m->delay_len) ? m->dl_ptr_lin_tuner_1 + 1 : 0;
+					m->dl_ptr_lin_tuner_2 = (m->dl_ptr_lin_tuner_2 < m->delay_len) ? m->dl_ptr_lin_tuner_2 + 1 : 0;
+				}
+
+				m->dl_ptr_in = (m->dl_ptr_in < m->delay_len) ? m->dl_ptr_in + 1 : 0;
+				m->dl_ptr_out += 1;
+				if (m->dl_ptr_out > m->delay_len) {
+					m->dl_ptr_out = 0;
+					// mixing between modes
+					uint32_t x = q_pack(q_sat16(acc), d[0]);
+					d[0] = q_sat16(q_smlad(x, mm, Q15_ROUND) >> 15);
+				}
+			} else {
+				acc = (acc + prev) >> 1;	// linear interp on output when downsampling
+				osc->epos += 1;
+			}
+			m->ds_phase = (m->ds_phase + 1 < m->downsample_amt) ? m->ds_phase + 1 : 0;
+		}
+		prev = acc;
+		out[i] = (float)acc * (1.f / (float)(1 << WGB_Q_SHIFT));
+		fade -= fade_step;
+		if (osc->snap.mode == SNAP_RECORD) {
+			snap_record(&osc->snap, out[i]);
+		}
+	}
+	osc->prev = (float)prev * (1.f / (float)(1 << WGB_Q_SHIFT));
+}
+
+#endif
+
+void wgb_gen(struct wgb *osc, float *out, size_t n) {
+	if (osc->mode[0].delay == NULL) {
+		memset(out, 0, n * sizeof(float));
+		return;
+	}
+	float am[n];
+	adsr_gen(&osc->adsr, am, n);
+	size_t i = 0;
+	// play back a cached excitation
+	if (osc->snap.mode == SNAP_PLAY) {
+		i = snap_play(&osc->snap, out, n, 1.0f);
+		if (i > 0) {
+			osc->prev = out[i - 1];
+		}
+	}
+	// fade out the upper modes when going to LOD_LOW
+	float fade_step = (osc->fade) ? 1.0f / (float)n : 0.0f;
+	float fade = 1.0f - (float)i * fade_step;
+	wgb_kernel(osc, out, i, n, fade, fade_step);
+	if (osc->fade) {
+		osc->fade = 0;
+		osc->num_modes = WGB_LOD_MODES;
+	}
+	osc->fresh = 0;
 	block_mul(out, am, n);
 
 	// low pass linked to envelope ended up being too cpu intensive so was removed
@@ -86,16 +316,33 @@ void wgb_gen(struct wgb *osc, float *out, size_t n) {
 //-----------------------------------------------------------------------------
 
 void wgb_pluck(struct wgb *osc) {
+	if (osc->mode[0].delay == NULL) {
+		return;
+	}
 	osc->estate = 1;
 	osc->epos = 0;
-	for (size_t i = 0; i < NUM_MODES; i++) {
-		osc->mode[i].dl_ptr_out = 1;
-		osc->mode[i].dl_ptr_in = 0;
-
-		osc->mode[i].dl_ptr_lin_tuner_1 = 2;
-		osc->mode[i].dl_ptr_lin_tuner_2 = 3;
+	// a ringing bar is struck in place, the impulse adds to the modes
+	if (osc->fresh || !osc->retrigger) {
+		for (size_t i = 0; i < NUM_MODES; i++) {
+			osc->mode[i].dl_ptr_out = 1;
+			osc->mode[i].dl_ptr_in = 0;
+
+			osc->mode[i].dl_ptr_lin_tuner_1 = 2;
+			osc->mode[i].dl_ptr_lin_tuner_2 = 3;
+			// the excitation starts on a step of each mode
+			osc->mode[i].ds_phase = 0;
+		}
 	}
 
+	// a silent voice can use a cached excitation
+	snap_cancel(&osc->snap);
+	if (osc->fresh && wgb_snap_fits(osc)) {
+		struct snap_key key;
+		wgb_snap_key(osc, &key);
+		if (snap_lookup(&osc->snap, &key) == SNAP_PLAY) {
+			wgb_snap_restore(osc, snap_state(&osc->snap));
+		}
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -107,6 +354,9 @@ void wgb_ctrl_attenuate(struct wgb *osc, float attenuate) {
 void wgb_ctrl_frequency(struct wgb *osc, float freq) {
 
 	osc->freq = freq;
+	if (osc->mode[0].delay == NULL) {
+		return;
+	}
 	osc->mode[0].freq_coef = 1.0f;
 	float mode_1_freq;
 	float mode_2_freq;
@@ -143,10 +393,12 @@ void wgb_ctrl_frequency(struct wgb *osc, float freq) {
 	
 	for (size_t i = 0; i < NUM_MODES; i++) {		
 
-		uint32_t delay_len = AUDIO_FS/(osc->mode[i].freq_coef * freq);
+		uint32_t delay_len = audio_fs/(osc->mode[i].freq_coef * freq);
+		// wgb_alloc chose the rate the delay line fits at for the fundamental
+		uint32_t size = osc->mode[i].delay_size - WGB_DELAY_PAD;
 
-		if (delay_len > WGB_DELAY_SIZE) {
-			uint32_t rough_ds = (delay_len / WGB_DELAY_SIZE) + 1;
+		if (delay_len > size) {
+			uint32_t rough_ds = (delay_len / size) + 1;
 			osc->mode[i].downsample_amt = rough_ds + rough_ds % 2;
 
 			osc->mode[i].delay_len_total = delay_len / osc->mode[i].downsample_amt;
@@ -160,6 +412,17 @@ void wgb_ctrl_frequency(struct wgb *osc, float freq) {
 			osc->mode[i].delay_len  = (uint32_t) osc->mode[i].delay_len_total;
 			osc->mode[i].delay_len_frac = osc->mode[i].delay_len_total - (float) osc->mode[i].delay_len;
 		}
+		// clear the newly used part of the delay line
+		// (the pointers start at 0..3, before they wrap)
+		struct mode *m = &osc->mode[i];
+		uint32_t n = m->delay_len + WGB_DELAY_PAD;
+		if (n > m->delay_size) {
+			n = m->delay_size;
+		}
+		if (n > m->clear_len) {
+			memset(&m->delay[m->clear_len], 0, (n - m->clear_len) * sizeof(wg_t));
+			m->clear_len = n;
+		}
 		//DBG("delay length for mode %d: %d.%d \r\n", i, osc->mode[i].delay_len, (uint32_t) osc->mode[i].delay_len_frac * 100.0f);
 		svf2_ctrl_cutoff(&osc->mode[i].bpf, osc->mode[i].freq_coef * freq * osc->mode[i].downsample_amt);
 		svf2_ctrl_resonance(&osc->mode[i].bpf, 0.4999999f - osc->reflection_adjust);
@@ -208,7 +471,68 @@ void wgb_ctrl_resonator_type(struct wgb *osc, int resonator_type) {
 }
 
 void wgb_init(struct wgb *osc) {
-	// do nothing
+	memset(osc, 0, sizeof(struct wgb));
+	osc->lod = LOD_FULL;
+	osc->num_modes = NUM_MODES;
+	osc->fresh = 1;
+}
+
+// Allocate the mode delay lines for notes down to freq (Hz).
+// Each mode gets the length of the fundamental (the harmonic modulation can
+// pull the upper modes down close to it). A mode that doesn't fit the voice
+// share of the pool at the full rate (see dl_fits, the modes share it) runs at
+// a lower rate. Returns -1 if there's no room at all, the voice is then silent.
+int wgb_alloc(struct wgb *osc, float freq) {
+	for (size_t j = 0; j < NUM_MODES; j++) {
+		struct mode *m = &osc->mode[j];
+		for (uint32_t ds = 1; ds <= WGB_DOWNSAMPLE_MAX && m->delay == NULL; ds <<= 1) {
+			size_t size = dl_size(((uint32_t) (audio_fs / freq / ds) + WGB_DELAY_PAD + 1) * sizeof(wg_t));
+			if (ds < WGB_DOWNSAMPLE_MAX && !dl_fits(NUM_MODES * size)) {
+				continue;
+			}
+			m->delay = (size) ? dl_alloc(size) : NULL;
+			m->delay_size = size / sizeof(wg_t);
+		}
+		if (m->delay == NULL) {
+			DBG("no delay line memory for %d Hz\r\n", (int)freq);
+			wgb_stop(osc);
+			return -1;
+		}
+		m->clear_len = 0;
+	}
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+// level of detail
+// LOD_LOW only generates the lowest modes. The upper modes are faded out
+// over a block, and restart from silence when going back to LOD_FULL.
+
+void wgb_ctrl_lod(struct wgb *osc, int lod) {
+	if (lod == osc->lod || osc->mode[0].delay == NULL) {
+		return;
+	}
+	osc->lod = lod;
+	if (lod == LOD_LOW) {
+		osc->fade = 1;
+		return;
+	}
+	osc->fade = 0;
+	for (size_t i = osc->num_modes; i < NUM_MODES; i++) {
+		struct mode *m = &osc->mode[i];
+		memset(m->delay, 0, m->clear_len * sizeof(wg_t));
+		m->bpf.ic1eq = 0.0f;
+		m->bpf.ic2eq = 0.0f;
+#if WG_Q15
+		m->ic1 = 0;
+		m->ic2 = 0;
+#endif
+		m->dl_ptr_out = 1;
+		m->dl_ptr_in = 0;
+		m->dl_ptr_lin_tuner_1 = 2;
+		m->dl_ptr_lin_tuner_2 = 3;
+	}
+	osc->num_modes = NUM_MODES;
 }
 
 //-----------------------------------------------------------------------------
@@ -6,13 +6,13 @@ Woodwind modelling (with the use of waveguides)
 */
 //-----------------------------------------------------------------------------
 
+#include <string.h>
+
 #include "pmsynth.h"
 #include "utils.h"
 
 #define DEBUG
 #include "logging.h"
-#include "display.h"
-#include "lcd.h"
 
 
 //-----------------------------------------------------------------------------
@@ -22,97 +22,191 @@ Woodwind modelling (with the use of waveguides)
 #define FILTER_COEF 0.6f
 #define DC_FILT_GAIN 0.99f
 
-//-----------------------------------------------------------------------------
-
-void ww_gen(struct ww *osc, float *out, size_t n) {
+// shortest jet delay line for LOD_LOW
+#define WW_LOD_MIN_LEN 4
 
-	// input generation
-	//-----------------------------------------------------------------------------
+// the lowest internal rate (as a divisor) when the delay line pool is short
+#define WW_DOWNSAMPLE_MAX 8
 
-	float am[n];
-	float breath[n];
-	float vibrato[n];
-
-	sin_gen(&osc->vibrato, vibrato, NULL, n);
-	adsr_gen(&osc->adsr, am, n);
-	noise_gen_white(&osc->ns, breath, n);
+//-----------------------------------------------------------------------------
 
-	block_mul(breath, am, n); // white noise following adsr
-	//block_mul_k(breath, 0.0085f, n); // scaling white noise
-	block_mul_k(breath, osc->noise_amt, n); // scaling white noise
+// jet nonlinearity table, x - x * 2^x for x = -4..4 (the Q13 delay line
+// range) in steps of 1/16, as (y, dy) pairs for interpolation. The float
+// delay lines aren't limited, outside the table ww_jet uses pow2.
+#define WW_JET_MIN (-4.f)
+#define WW_JET_SCALE 16.f
+#define WW_JET_SIZE 128
+
+static const float ww_jet_table[WW_JET_SIZE * 2] = {
+	-3.750000f, 0.069489f, -3.680511f, 0.069618f, -3.610893f, 0.069745f, -3.541148f, 0.069868f,
+	-3.471280f, 0.069989f, -3.401291f, 0.070106f, -3.331185f, 0.070218f, -3.260967f, 0.070326f,
+	-3.190641f, 0.070428f, -3.120213f, 0.070523f, -3.049690f, 0.070612f, -2.979078f, 0.070692f,
+	-2.908386f, 0.070764f, -2.837622f, 0.070826f, -2.766795f, 0.070878f, -2.695917f, 0.070917f,
+	-2.625000f, 0.070944f, -2.554056f, 0.070957f, -2.483099f, 0.070954f, -2.412145f, 0.070935f,
+	-2.341210f, 0.070897f, -2.270313f, 0.070839f, -2.199475f, 0.070760f, -2.128715f, 0.070657f,
+	-2.058058f, 0.070529f, -1.987530f, 0.070373f, -1.917156f, 0.070189f, -1.846968f, 0.069972f,
+	-1.776996f, 0.069721f, -1.707275f, 0.069433f, -1.637842f, 0.069106f, -1.568736f, 0.068736f,
+	-1.500000f, 0.068320f, -1.431680f, 0.067855f, -1.363825f, 0.067338f, -1.296486f, 0.066765f,
+	-1.229722f, 0.066131f, -1.163591f, 0.065432f, -1.098159f, 0.064665f, -1.033494f, 0.063824f,
+	-0.969670f, 0.062904f, -0.906766f, 0.061901f, -0.844865f, 0.060807f, -0.784058f, 0.059618f,
+	-0.724440f, 0.058327f, -0.666113f, 0.056927f, -0.609185f, 0.055412f, -0.553773f, 0.053773f,
+	-0.500000f, 0.052003f, -0.447997f, 0.050094f, -0.397903f, 0.048036f, -0.349867f, 0.045820f,
+	-0.304047f, 0.043436f, -0.260611f, 0.040874f, -0.219738f, 0.038122f, -0.181616f, 0.035169f,
+	-0.146447f, 0.032002f, -0.114444f, 0.028609f, -0.085835f, 0.024975f, -0.060861f, 0.021085f,
+	-0.039776f, 0.016925f, -0.022851f, 0.012477f, -0.010374f, 0.007725f, -0.002650f, 0.002650f,
+	0.000000f, -0.002767f, -0.002767f, -0.008546f, -0.011313f, -0.014709f, -0.026023f, -0.021279f,
+	-0.047302f, -0.028279f, -0.075581f, -0.035734f, -0.111315f, -0.043672f, -0.154987f, -0.052120f,
+	-0.207107f, -0.061108f, -0.268215f, -0.070667f, -0.338882f, -0.080830f, -0.419712f, -0.091633f,
+	-0.511345f, -0.103110f, -0.614455f, -0.115302f, -0.729757f, -0.128249f, -0.858006f, -0.141994f,
+	-1.000000f, -0.156582f, -1.156582f, -0.172061f, -1.328642f, -0.188481f, -1.517123f, -0.205895f,
+	-1.723018f, -0.224359f, -1.947377f, -0.243932f, -2.191309f, -0.264676f, -2.455985f, -0.286656f,
+	-2.742641f, -0.309941f, -3.052582f, -0.334603f, -3.387185f, -0.360720f, -3.747905f, -0.388370f,
+	-4.136275f, -0.417639f, -4.553914f, -0.448616f, -5.002530f, -0.481395f, -5.483925f, -0.516075f,
+	-6.000000f, -0.552759f, -6.552759f, -0.591557f, -7.144316f, -0.632585f, -7.776901f, -0.675963f,
+	-8.452864f, -0.721821f, -9.174685f, -0.770291f, -9.944976f, -0.821516f, -10.766492f, -0.875644f,
+	-11.642136f, -0.932832f, -12.574968f, -0.993246f, -13.568214f, -1.057057f, -14.625271f, -1.124450f,
+	-15.749721f, -1.195616f, -16.945337f, -1.270756f, -18.216093f, -1.350084f, -19.566177f, -1.433823f,
+	-21.000000f, -1.522208f, -22.522208f, -1.615486f, -24.137693f, -1.713917f, -25.851610f, -1.817775f,
+	-27.669385f, -1.927347f, -29.596732f, -2.042936f, -31.639668f, -2.164860f, -33.804528f, -2.293452f,
+	-36.097980f, -2.429065f, -38.527045f, -2.572069f, -41.099114f, -2.722851f, -43.821965f, -2.881820f,
+	-46.703785f, -3.049406f, -49.753191f, -3.226060f, -52.979251f, -3.412256f, -56.391507f, -3.608493f,
+};
+
+// return the jet nonlinearity for x
+static inline float ww_jet(float x, int jet) {
+	if (jet == WW_JET_CUBIC) {
+		// x - x^3, limited to +/- 1 (as the STK flute jet table)
+		return clampf(x - x * x * x, -1.f, 1.f);
+	}
+	float u = (x - WW_JET_MIN) * WW_JET_SCALE;
+	if (u < 0.f || u >= (float)WW_JET_SIZE) {
+		return x - x * pow2(x);
+	}
+	uint32_t i = (uint32_t) u;
+	const float *y = &ww_jet_table[i << 1];
+	return y[0] + (u - (float)i) * y[1];
+}
 
-	//block_mul_k(vibrato, 0.008f, n); // scaling vibrato
-	block_mul_k(vibrato, osc->vibrato_amt, n); // scaling vibrato
-	block_add(breath, vibrato, n); // adding vibrato to white noise
+//-----------------------------------------------------------------------------
 
-	block_add(breath, am, n); // adding to adsr to make pressure input
+// Run the model for a block. The pressure input (envelope, breath noise and
+// vibrato) is made in the same loop as the delay lines, and only for the
+// samples the model runs on. jet is a constant after inlining.
+static inline void ww_run(struct ww *osc, float *out, size_t n, int jet) {
+	dl_t *dl_1 = osc->dl_1;
+	dl_t *dl_2 = osc->dl_2;
+	uint32_t dl_1_len = osc->dl_1_len;
+	uint32_t dl_2_len = osc->dl_2_len;
+	uint32_t dl_1_ptr_in = osc->dl_1_ptr_in;
+	uint32_t dl_1_ptr_out = osc->dl_1_ptr_out;
+	uint32_t dl_2_ptr_in = osc->dl_2_ptr_in;
+	uint32_t dl_2_ptr_out = osc->dl_2_ptr_out;
+	uint32_t ds = osc->downsample_amt;
+	float r_1 = osc->r_1;
+	float r_2 = osc->r_2;
+	float noise_amt = osc->noise_amt;
+	float vibrato_amt = osc->vibrato_amt;
+	float dl_1_out = osc->dl_1_out;
+	float flute_out = osc->flute_out_old;
+	float dc_in = osc->dc_filt_in;
+	float dc_out = osc->dc_filt_out;
+	// the vibrato steps once per model sample
+	uint32_t vx = osc->vibrato.x;
+	uint32_t vstep = osc->vibrato.xstep * ds;
+	// velocity adjusts volume
+	float k = osc->velocity / 0.8f + 0.2f;
+
+	// At half rate the one pole filters need squared pole
+	// positions to keep the same response.
+	float lp_coef = osc->lp_filter_coef;
+	float dc_gain = DC_FILT_GAIN;
+	if (osc->lod == LOD_LOW) {
+		lp_coef = lp_coef * (2.f - lp_coef);
+		dc_gain = dc_gain * dc_gain;
+	}
 
-/*	 pressure input looks a bit like:
-		  
-		 _-_-_-_-_-_-_
-		/             \
-	   /               \
-	  /                 \ (with dc offset)*/
+	uint32_t phase = osc->ds_phase;
+	float y = osc->hold;
 
-	
-	// delay line calcs
 	for (size_t i = 0; i < n; i++) {
+		// sample and hold (least cpu), the adsr runs at the full rate
+		// The phase carries over blocks, they can be any length.
+		if (phase != 0) {
+			adsr_sample(&osc->adsr);
+			out[i] = y;
+			phase = (phase + 1 < ds) ? phase + 1 : 0;
+			continue;
+		}
+		phase = (ds > 1) ? 1 : 0;
+
+		// pressure input, white noise following the adsr plus vibrato,
+		// added to the adsr (as a dc offset)
+		/* pressure input looks a bit like:
+
+			 _-_-_-_-_-_-_
+			/             \
+		   /               \
+		  /                 \ (with dc offset)*/
+		float am = adsr_sample(&osc->adsr);
+		float breath = am * (1.f + noise_amt * rand_float()) + vibrato_amt * cos_lookup(vx);
+		vx += vstep;
+
+		// delay line 2 (for jet reed)
+		dl_2[dl_2_ptr_in] = dl_wr(breath + r_1 * dl_1_out, WW_Q_SHIFT);
+
+		// stepping and wrapping pointers for delay line 2
+		dl_2_ptr_in = (dl_2_ptr_in == dl_2_len) ? 0 : dl_2_ptr_in + 1;
+		dl_2_ptr_out = (dl_2_ptr_out == dl_2_len) ? 0 : dl_2_ptr_out + 1;
+
+		float reed_out = dl_rd(dl_2[dl_2_ptr_out], WW_Q_SHIFT);
+
+		// summing and adding
+		reed_out = ww_jet(reed_out, jet) + r_2 * dl_1_out;
+
+		// low pass filter
+		flute_out += lp_coef * (reed_out - flute_out);
+
+		// for delay line 1
+		dl_1[dl_1_ptr_in] = dl_wr(flute_out, WW_Q_SHIFT);
+
+		// stepping and wrapping pointers for delay line 1
+		dl_1_ptr_in = (dl_1_ptr_in == dl_1_len) ? 0 : dl_1_ptr_in + 1;
+		dl_1_ptr_out = (dl_1_ptr_out == dl_1_len) ? 0 : dl_1_ptr_out + 1;
+
+		// setting output
+		dl_1_out = dl_rd(dl_1[dl_1_ptr_out], WW_Q_SHIFT);
+
+		// dc block
+		dc_out = flute_out - dc_in + (dc_gain * dc_out);
+		dc_in = flute_out;
+
+		y = k * dc_out;
+		out[i] = y;
+	}
 
-			if (i % osc->downsample_amt == 0){
-			// delay line 2 (for jet reed)
-			osc->dl_2[osc->dl_2_ptr_in] = breath[i] + osc->r_1 * osc->dl_1_out;
-
-			// stepping and wrapping pointers for delay line 2
-			osc->dl_2_ptr_in += 1;
-			if (osc->dl_2_ptr_in > osc->dl_2_len){
-				osc->dl_2_ptr_in = 0;
-			}
-
-			osc->dl_2_ptr_out += 1;
-			if (osc->dl_2_ptr_out > osc->dl_2_len){
-				osc->dl_2_ptr_out = 0;
-			}
-
-			float reed_out = osc->dl_2[osc->dl_2_ptr_out];
-
-			// summing and adding
-			reed_out = reed_out - (pow2(reed_out) * reed_out);
-			reed_out = reed_out + osc->r_2 * osc->dl_1_out;
-
-			// low pass filter
-			float flute_out = osc->flute_out_old + osc->lp_filter_coef * (reed_out - osc->flute_out_old);
-			osc->flute_out_old = flute_out;
-
-			// for delay line 1
-			osc->dl_1[osc->dl_1_ptr_in] = flute_out;
-
-			// stepping and wrapping pointers for delay line 1
-			osc->dl_1_ptr_in += 1;
-			if (osc->dl_1_ptr_in > osc->dl_1_len){
-				osc->dl_1_ptr_in = 0;
-			}
-
-			osc->dl_1_ptr_out += 1;
-			if (osc->dl_1_ptr_out > osc->dl_1_len){
-				osc->dl_1_ptr_out = 0;
-			}
-
-			// setting output
-			osc->dl_1_out = osc->dl_1[osc->dl_1_ptr_out];
-
-			// outputting audio
-			out[i] = flute_out;
-
-			// dc block
+	osc->dl_1_ptr_in = dl_1_ptr_in;
+	osc->dl_1_ptr_out = dl_1_ptr_out;
+	osc->dl_2_ptr_in = dl_2_ptr_in;
+	osc->dl_2_ptr_out = dl_2_ptr_out;
+	osc->dl_1_out = dl_1_out;
+	osc->flute_out_old = flute_out;
+	osc->dc_filt_in = dc_in;
+	osc->dc_filt_out = dc_out;
+	osc->vibrato.x = vx;
+	osc->ds_phase = phase;
+	osc->hold = y;
+}
 
-			osc->dc_filt_out = flute_out - osc->dc_filt_in + (DC_FILT_GAIN * osc->dc_filt_out);
-			osc->dc_filt_in = flute_out;
-			out[i] = osc->dc_filt_out;
-			//out[i] = breath[i];
-		} else
-		out[i] = out [i-1]; // sample and hold (least cpu)
+void ww_gen(struct ww *osc, float *out, size_t n) {
+	if (osc->dl_1 == NULL) {
+		memset(out, 0, n * sizeof(float));
+		return;
+	}
+	if (osc->jet == WW_JET_CUBIC) {
+		ww_run(osc, out, n, WW_JET_CUBIC);
+	} else {
+		ww_run(osc, out, n, WW_JET_EXP);
 	}
-	block_mul_k(out, (osc->velocity / 0.8f + 0.2f), n);
 }
 
 //-----------------------------------------------------------------------------
@@ -129,7 +223,8 @@ void ww_blow(struct ww *osc) {
 	osc->dl_1_ptr_in = osc->dl_1_len;
 	osc->dl_1_ptr_out = 0;
 
-
+	// the breath starts on a model step
+	osc->ds_phase = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -145,7 +240,13 @@ void ww_update_vib_noise(struct ww *osc, float vibrato_amt, float noise_amt) {
 }
 
 void ww_set_samplerate(struct ww *osc, float downsample_amt) {
-	osc->downsample_amt = downsample_amt;
+	osc->downsample_base = downsample_amt;
+	osc->downsample_amt = osc->downsample_base << osc->lod;
+}
+
+// select the jet nonlinearity (WW_JET_EXP, WW_JET_CUBIC)
+void ww_ctrl_jet(struct ww *osc, int jet) {
+	osc->jet = jet;
 }
 
 void ww_update_coefficients(struct ww *osc, float lp_filter_coef, float r_1, float r_2) {
@@ -156,8 +257,17 @@ void ww_update_coefficients(struct ww *osc, float lp_filter_coef, float r_1, flo
 
 void ww_ctrl_frequency(struct ww *osc, float freq) {
 	osc->freq = freq;
+	if (osc->dl_1 == NULL) {
+		return;
+	}
 
-	osc->dl_1_len_total = (AUDIO_FS/freq)/osc->downsample_amt;
+	float total = (audio_fs/freq)/osc->downsample_amt;
+	// ww_alloc sized the delay lines for the lowest pitch, and the
+	// shortest jet line is 1 sample
+	osc->dl_1_len_total = clampf(total, 4.f, (float)(2 * (osc->dl_size - 1)));
+	if (osc->dl_1_len_total != total) {
+		DBG("ww %d Hz is out of range at %d Hz\r\n", (int)freq, (int)audio_fs);
+	}
 	osc->dl_1_len = (uint32_t) osc->dl_1_len_total/2.0f; // delay line 1 length
 	osc->dl_1_len_frac = osc->dl_1_len_total - (float) osc->dl_1_len;
 
@@ -165,12 +275,115 @@ void ww_ctrl_frequency(struct ww *osc, float freq) {
 	osc->dl_2_len = (uint32_t) osc->dl_2_len_total; // delay line 2 length
 	osc->dl_2_len_frac = osc->dl_2_len_total - (float) osc->dl_2_len;
 
-	DBG("freq: %d, delay 1 length: %d, delay 2 length: %d\r\n", (int)freq, osc->dl_1_len, osc->dl_2_len);
+	//DBG("freq: %d, delay 1 length: %d, delay 2 length: %d\r\n", (int)freq, osc->dl_1_len, osc->dl_2_len);
+
+	// clear the newly used part of the delay lines
+	if (osc->dl_1_len + 1 > osc->clear_len_1) {
+		memset(&osc->dl_1[osc->clear_len_1], 0, (osc->dl_1_len + 1 - osc->clear_len_1) * sizeof(dl_t));
+		osc->clear_len_1 = osc->dl_1_len + 1;
+	}
+	if (osc->dl_2_len + 1 > osc->clear_len_2) {
+		memset(&osc->dl_2[osc->clear_len_2], 0, (osc->dl_2_len + 1 - osc->clear_len_2) * sizeof(dl_t));
+		osc->clear_len_2 = osc->dl_2_len + 1;
+	}
 
 }
 
 void ww_init(struct ww *osc) {
+	memset(osc, 0, sizeof(struct ww));
+	osc->downsample_base = 1;
 	osc->downsample_amt = 1;
+	osc->lod = LOD_FULL;
+}
+
+// Allocate the delay lines for notes down to freq (Hz).
+// The voice runs at the highest rate that fits its share of the pool (see
+// dl_fits), the lowest rate takes whatever there is. Returns -1 if there's no
+// room at all, the voice is then silent.
+int ww_alloc(struct ww *osc, float freq) {
+	for (uint32_t ds = 1; ds <= WW_DOWNSAMPLE_MAX; ds <<= 1) {
+		// both delay lines are in one block (the jet line is the shorter)
+		size_t size = dl_size(2 * ((uint32_t) (audio_fs / freq / 2.f / ds) + 2) * sizeof(dl_t));
+		if (ds < WW_DOWNSAMPLE_MAX && !dl_fits(size)) {
+			continue;
+		}
+		dl_t *buf = (size) ? dl_alloc(size) : NULL;
+		if (buf) {
+			osc->dl_size = size / (2 * sizeof(dl_t));
+			osc->dl_1 = buf;
+			osc->dl_2 = buf + osc->dl_size;
+			osc->clear_len_1 = 0;
+			osc->clear_len_2 = 0;
+			osc->ds_phase = 0;
+			osc->hold = 0.f;
+			ww_set_samplerate(osc, ds);
+			return 0;
+		}
+	}
+	DBG("no delay line memory for %d Hz\r\n", (int)freq);
+	return -1;
+}
+
+// stop the voice, it's silent until the next ww_alloc
+void ww_stop(struct ww *osc) {
+	dl_free(osc->dl_1, 2 * osc->dl_size * sizeof(dl_t));
+	osc->dl_1 = NULL;
+	osc->dl_2 = NULL;
+	osc->dl_size = 0;
+}
+
+//-----------------------------------------------------------------------------
+// level of detail
+// LOD_LOW halves the internal sample rate. The delay lines are resampled to
+// the new length (keeping the wave shape) so the switch doesn't click.
+
+// interpolate a delay line of len samples at x
+static dl_t ww_interp(const dl_t *buf, uint32_t len, float x) {
+	uint32_t k = (uint32_t) x;
+	uint32_t k1 = (k + 1 < len) ? k + 1 : k;
+	float y0 = dl_rd(buf[k], WW_Q_SHIFT);
+	float y1 = dl_rd(buf[k1], WW_Q_SHIFT);
+	return dl_wr(y0 + (x - (float)k) * (y1 - y0), WW_Q_SHIFT);
+}
+
+// resample a delay line of len samples (starting at ofs) to len2 samples
+// In place, as for the 1D waveguide.
+static void ww_resample(dl_t *buf, uint32_t len, uint32_t ofs, uint32_t len2) {
+	dl_rotate(buf, len, ofs, sizeof(dl_t));
+	float step = (float)len / (float)len2;
+	if (len2 <= len) {
+		for (uint32_t i = 0; i < len2; i++) {
+			buf[i] = ww_interp(buf, len, (float)i * step);
+		}
+	} else {
+		for (uint32_t i = len2 - 1; i > 0; i--) {
+			buf[i] = ww_interp(buf, len, (float)i * step);
+		}
+	}
+}
+
+void ww_ctrl_lod(struct ww *osc, int lod) {
+	if (lod == osc->lod || osc->dl_1 == NULL) {
+		return;
+	}
+	uint32_t ds = osc->downsample_base << lod;
+	if (audio_fs / osc->freq / 4.f / ds < WW_LOD_MIN_LEN) {
+		// the delay lines would be too short
+		return;
+	}
+	uint32_t len_1 = osc->dl_1_len + 1;
+	uint32_t len_2 = osc->dl_2_len + 1;
+	osc->lod = lod;
+	osc->downsample_amt = ds;
+	ww_ctrl_frequency(osc, osc->freq);
+	// the output pointer is at the start of the delay lines,
+	// the input pointer is one sample behind it.
+	ww_resample(osc->dl_1, len_1, osc->dl_1_ptr_out, osc->dl_1_len + 1);
+	ww_resample(osc->dl_2, len_2, osc->dl_2_ptr_out, osc->dl_2_len + 1);
+	osc->dl_1_ptr_out = 0;
+	osc->dl_1_ptr_in = osc->dl_1_len;
+	osc->dl_2_ptr_out = 0;
+	osc->dl_2_ptr_in = osc->dl_2_len;
 }
 
 //-----------------------------------------------------------------------------
@@ -73,6 +73,17 @@ int dma_disable(struct dma_drv *dma) {
 	return 0;
 }
 
+// start a single (non-circular) transfer of nitems to/from the memory address
+// Note: the previous transfer must be complete
+void dma_start(struct dma_drv *dma, uint32_t adr, uint32_t nitems) {
+	dma_clr_irq_flags(dma, DMA_IRQ_ALL);
+	dma->sregs->M0AR = adr;
+	dma->sregs->NDTR = nitems;
+	// the isr turns off the tc interrupt at the end of a single transfer
+	dma->sregs->CR = (dma->sregs->CR & ~DMA_SxCR_HTIE) | DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+	dma->sregs->CR |= DMA_SxCR_EN;
+}
+
 //-----------------------------------------------------------------------------
 
 // Called from DMAX_StreamY_IRQHandler()
@@ -198,7 +209,7 @@ int dma_init(struct dma_drv *dma, struct dma_cfg *cfg) {
 	val |= cfg->mburst;	// Memory burst transfer
 	val |= cfg->pburst;	// Peripheral burst transfer
 	val |= (0 << 19 /*CT*/);	// Current target (only in double buffer mode)
-	val |= (0 << 18 /*DBM*/);	// Double buffer mode (off)
+	val |= cfg->dbm;	// Double buffer mode
 	val |= cfg->pl;		// Priority level
 	val |= cfg->pincos;	// Peripheral increment offset
 	val |= cfg->msize;	// Memory data size
@@ -231,6 +242,11 @@ int dma_init(struct dma_drv *dma, struct dma_cfg *cfg) {
 		goto exit;
 	}
 
+	// second memory target for double buffer mode
+	if (cfg->dbm) {
+		dma->sregs->M1AR = cfg->mem1;
+	}
+
 	dma->sregs->NDTR = cfg->nitems;
 
 	// SxFCR setup
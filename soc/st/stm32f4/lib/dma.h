@@ -48,6 +48,9 @@ typedef struct {
 #define DMA_CIRC_ON (1U << 8)
 #define DMA_CIRC_OFF 0
 
+#define DMA_DBM_ON (1U << 18)
+#define DMA_DBM_OFF 0
+
 #define DMA_PINCOS_4 (1U << 15)
 #define DMA_PINCOS_PSIZE 0
 
@@ -96,11 +99,13 @@ struct dma_cfg {
 	uint32_t pinc;		// peripheral increment
 	uint32_t pincos;	// peripheral increment offset
 	uint32_t circ;		// circular mode
+	uint32_t dbm;		// double buffer mode
 	uint32_t pfctrl;	// peripheral flow control
 	uint32_t fifo;		// fifo control
 	uint32_t fth;		// fifo threshold
 	uint32_t src;		// source address
 	uint32_t dst;		// destination address
+	uint32_t mem1;		// second memory address (double buffer mode)
 	uint32_t nitems;	// number of items in the buffer
 	void (*err_callback) (struct dma_drv * dma, uint32_t errors);	// errors callback
 	void (*ht_callback) (struct dma_drv * dma, int idx);	// half transfer callback
@@ -114,6 +119,16 @@ static inline uint32_t dma_ndtr(struct dma_drv *dma) {
 	return dma->sregs->NDTR;
 }
 
+// set the memory address for a double buffer mode target (idx = 0,1)
+// Note: only the target not currently in use (per SxCR.CT) may be written
+static inline void dma_set_mar(struct dma_drv *dma, int idx, uint32_t adr) {
+	if (idx) {
+		dma->sregs->M1AR = adr;
+	} else {
+		dma->sregs->M0AR = adr;
+	}
+}
+
 // enable a dma stream
 // Note: enable the dma stream *before* enabling the peripheral
 static inline void dma_enable(struct dma_drv *dma) {
@@ -122,6 +137,7 @@ static inline void dma_enable(struct dma_drv *dma) {
 
 int dma_init(struct dma_drv *dma, struct dma_cfg *cfg);
 int dma_disable(struct dma_drv *dma);
+void dma_start(struct dma_drv *dma, uint32_t adr, uint32_t nitems);
 void dma_isr(struct dma_drv *dma);
 
 //-----------------------------------------------------------------------------
@@ -32,6 +32,7 @@ static const struct i2s_clk_cfg *i2s_clk_lookup(uint32_t fs) {
 		{12000, 384, 5, 12, 1},	// 12000 Hz
 		{22050, 429, 4, 9, 1},	// 22049.753289 Hz
 		{24000, 424, 3, 11, 1},	// 24003.623188 Hz
+		{32000, 213, 2, 6, 1},	// 32001.201923 Hz
 		{35156, 270, 5, 3, 0},	// 35156.25 Hz (goom rate)
 		{44100, 429, 2, 9, 1},	// 44099.506579 Hz
 		{48000, 430, 7, 2, 1},	// 47991.071429 Hz
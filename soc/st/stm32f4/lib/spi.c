@@ -46,7 +46,9 @@ static inline uint32_t spi_bsy(struct spi_drv *spi) {
 }
 
 // wait for the spi operation to complete
+// Note: check txe first, bsy can drop between frames while dr is loaded.
 void spi_wait4_done(struct spi_drv *spi) {
+	while (!spi_txe(spi)) ;
 	while (spi_bsy(spi)) ;
 }
 
@@ -118,6 +120,50 @@ void spi_tx16(struct spi_drv *spi, uint16_t data, size_t n) {
 	}
 }
 
+// Tx a 16 bit buffer
+void spi_txbuf16(struct spi_drv *spi, const uint16_t * buf, size_t n) {
+	spi_set_bits(spi, 16);
+	for (size_t i = 0; i < n; i++) {
+		while (!spi_txe(spi)) ;
+		spi->regs->DR = buf[i];
+	}
+}
+
+//-----------------------------------------------------------------------------
+// DMA Tx
+
+// setup a dma stream for tx (the memory address and count are set per transfer)
+int spi_tx_dma(struct spi_drv *spi, struct dma_cfg *cfg) {
+	int rc = 0;
+
+	cfg->dst = (uint32_t) & spi->regs->DR;
+	rc = dma_init(&spi->tx_dma, cfg);
+	if (rc != 0) {
+		goto exit;
+	}
+
+ exit:
+	return rc;
+}
+
+// start a dma tx of a 16 bit buffer (n < 65536)
+// The buffer must not change until spi_tx_dma_done() is called from the
+// dma transfer complete callback.
+void spi_txbuf16_dma(struct spi_drv *spi, const uint16_t * buf, size_t n) {
+	spi_set_bits(spi, 16);
+	spi->tx_busy = 1;
+	// start the dma, then the spi dma requests
+	dma_start(&spi->tx_dma, (uint32_t) buf, n);
+	spi->regs->CR2 |= SPI_CR2_TXDMAEN;
+}
+
+// dma tx complete (call from the dma transfer complete callback)
+// Note: the last frame may still be shifting out, see spi_wait4_done().
+void spi_tx_dma_done(struct spi_drv *spi) {
+	spi->regs->CR2 &= ~SPI_CR2_TXDMAEN;
+	spi->tx_busy = 0;
+}
+
 //-----------------------------------------------------------------------------
 
 int spi_init(struct spi_drv *spi, struct spi_cfg *cfg) {
@@ -157,8 +157,14 @@ struct spi_drv {
 	struct spi_cfg cfg;	// configuration values
 	SPI_TypeDef *regs;	// SPI/I2S peripheral registers
 	int bits;		// current 8/16 bit mode
+	struct dma_drv tx_dma;	// tx dma stream
+	volatile int tx_busy;	// dma tx in progress
 };
 
+int spi_tx_dma(struct spi_drv *spi, struct dma_cfg *cfg);
+void spi_txbuf16_dma(struct spi_drv *spi, const uint16_t * buf, size_t n);
+void spi_tx_dma_done(struct spi_drv *spi);
+
 #elif defined(SPI_DRIVER_BITBANG)
 
 struct spi_cfg {
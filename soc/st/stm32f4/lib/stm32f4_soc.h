@@ -15,8 +15,8 @@ STM32F4 SoC top-level include file
 #include "gpio.h"
 #include "delay.h"
 #include "i2c.h"
-#include "spi.h"
 #include "dma.h"
+#include "spi.h"
 #include "irq.h"
 #include "adc.h"
 #include "usart.h"
@@ -140,6 +140,64 @@ size_t usart_rxbuf(struct usart_drv * usart, uint8_t * buf, size_t n) {
 	return i;
 }
 
+//-----------------------------------------------------------------------------
+// dma rx mode
+// The rx dma writes to a circular buffer with no per-byte cpu cost.
+// The reader consumes the bytes in place (peek/consume). The idle line
+// interrupt signals the end of a burst of rx data.
+
+// switch to dma rx mode (cfg->dst is the buffer, cfg->nitems is its size)
+int usart_rx_dma(struct usart_drv *usart, struct dma_cfg *cfg) {
+	int rc = 0;
+
+	if (cfg->nitems == 0 || (cfg->nitems & (cfg->nitems - 1)) != 0) {
+		rc = -1;
+		goto exit;
+	}
+	// stop the rx interrupt
+	usart->regs->CR1 &= ~USART_CR1_RXNEIE;
+
+	cfg->src = (uint32_t) & usart->regs->DR;
+	rc = dma_init(&usart->rx_dma, cfg);
+	if (rc != 0) {
+		goto exit;
+	}
+	usart->rx_dma_buf = (const uint8_t *)cfg->dst;
+	usart->rx_dma_size = cfg->nitems;
+	usart->rx_dma_rd = 0;
+
+	// start the dma, then the usart dma requests and the idle line interrupt
+	dma_enable(&usart->rx_dma);
+	usart->regs->CR3 |= USART_CR3_DMAR;
+	usart->regs->CR1 |= USART_CR1_IDLEIE;
+
+ exit:
+	return rc;
+}
+
+// return the dma write index into the rx dma buffer
+size_t usart_rx_dma_wr(struct usart_drv *usart) {
+	// ndtr counts down from the buffer size
+	return (usart->rx_dma_size - dma_ndtr(&usart->rx_dma)) & (usart->rx_dma_size - 1);
+}
+
+// return the number of contiguous rx bytes available at *buf
+size_t usart_rx_dma_peek(struct usart_drv *usart, const uint8_t ** buf) {
+	size_t wr = usart_rx_dma_wr(usart);
+	size_t rd = usart->rx_dma_rd;
+	*buf = &usart->rx_dma_buf[rd];
+	if (wr >= rd) {
+		return wr - rd;
+	}
+	// up to the end of the buffer, the wrapped bytes are read next time
+	return usart->rx_dma_size - rd;
+}
+
+// consume n rx bytes returned by usart_rx_dma_peek()
+void usart_rx_dma_consume(struct usart_drv *usart, size_t n) {
+	usart->rx_dma_rd = (usart->rx_dma_rd + n) & (usart->rx_dma_size - 1);
+}
+
 //-----------------------------------------------------------------------------
 
 void usart_isr(struct usart_drv *usart) {
@@ -149,8 +207,16 @@ void usart_isr(struct usart_drv *usart) {
 	if (status & (USART_SR_ORE | USART_SR_PE | USART_SR_FE | USART_SR_NE)) {
 		usart->rx_errors++;
 	}
-	// receive
-	if (status & USART_SR_RXNE) {
+	// idle line (dma rx mode)
+	if ((status & USART_SR_IDLE) && (usart->regs->CR1 & USART_CR1_IDLEIE)) {
+		// read SR then DR to clear the idle flag
+		(void)usart->regs->DR;
+		if (usart->idle_callback) {
+			usart->idle_callback(usart);
+		}
+	}
+	// receive (interrupt rx mode)
+	if ((status & USART_SR_RXNE) && (usart->regs->CR1 & USART_CR1_RXNEIE)) {
 		uint8_t c = usart->regs->DR;
 		int rx_wr_inc = INC_MOD(usart->rx_wr, RXBUF_SIZE);
 		if (rx_wr_inc != usart->rx_rd) {
@@ -188,6 +254,7 @@ int usart_init(struct usart_drv *usart, struct usart_cfg *cfg) {
 	memset(usart, 0, sizeof(struct usart_drv));
 	usart->regs = (USART_TypeDef *) cfg->base;
 	usart->irq = usart_irq(cfg->base);
+	usart->idle_callback = cfg->idle_callback;
 
 	// enable the usart module
 	usart_module_enable(cfg->base);
@@ -20,12 +20,15 @@ USART Driver
 #define TXBUF_SIZE 32		// must be a power of 2
 #define RXBUF_SIZE 32		// must be a power of 2
 
+struct usart_drv;
+
 struct usart_cfg {
 	uint32_t base;		// base address of usart peripheral
 	int baud;		// baud rate
 	int data;		// data bits
 	int parity;		// parity bits
 	int stop;		// stop bits
+	void (*idle_callback) (struct usart_drv * usart);	// rx line idle callback (dma rx mode)
 };
 
 struct usart_drv {
@@ -36,6 +39,12 @@ struct usart_drv {
 	volatile int rx_wr, rx_rd;
 	volatile int tx_wr, tx_rd;
 	int rx_errors;
+	// dma rx mode
+	struct dma_drv rx_dma;	// circular mode rx dma
+	const uint8_t *rx_dma_buf;	// rx dma buffer (NULL == interrupt rx mode)
+	size_t rx_dma_size;	// rx dma buffer size, must be a power of 2
+	size_t rx_dma_rd;	// read index into the rx dma buffer
+	void (*idle_callback) (struct usart_drv * usart);	// rx line idle callback
 };
 
 //-----------------------------------------------------------------------------
@@ -44,6 +53,12 @@ int usart_init(struct usart_drv *usart, struct usart_cfg *cfg);
 void usart_isr(struct usart_drv *usart);
 size_t usart_rxbuf(struct usart_drv *usart, uint8_t * buf, size_t n);
 
+// dma rx mode
+int usart_rx_dma(struct usart_drv *usart, struct dma_cfg *cfg);
+size_t usart_rx_dma_wr(struct usart_drv *usart);
+size_t usart_rx_dma_peek(struct usart_drv *usart, const uint8_t ** buf);
+void usart_rx_dma_consume(struct usart_drv *usart, size_t n);
+
 // stdio functions
 void usart_putc(struct usart_drv *usart, char c);
 void usart_flush(struct usart_drv *usart);
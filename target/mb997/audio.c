@@ -19,6 +19,10 @@ Audio Control for the STM32F4 Discovery Board
 
 struct audio_drv pmsynth_audio;
 
+// actual sample rate/period, used by all the synth models
+float audio_fs = (float)AUDIO_SAMPLE_RATE;
+float audio_ts = 1.f / (float)AUDIO_SAMPLE_RATE;
+
 //-----------------------------------------------------------------------------
 // DMA setup
 
@@ -27,22 +31,32 @@ static void audio_err_callback(struct dma_drv *dma, uint32_t errors) {
 	DBG("dma error 0x%08x\r\n", errors);
 }
 
-// half transfer callback
-static void audio_ht_callback(struct dma_drv *dma, int idx) {
-	// dma is reading from the top half, so fill the bottom half
-	int rc = event_wr(EVENT_TYPE_AUDIO | AUDIO_BLOCK_SIZE, &pmsynth_audio.buffer[0]);
-	if (rc != 0) {
-		DBG("event_wr error for ht callback\r\n");
-	}
-}
-
 // transfer complete callback
 static void audio_tc_callback(struct dma_drv *dma, int idx) {
-	// dma is reading from the bottom half, so fill the top half
-	int rc = event_wr(EVENT_TYPE_AUDIO | AUDIO_BLOCK_SIZE, &pmsynth_audio.buffer[HALF_AUDIO_BUFFER_SIZE]);
-	if (rc != 0) {
-		DBG("event_wr error for tc callback\r\n");
+	struct audio_ring *ring = &pmsynth_audio.ring;
+	// dma is reading from target idx, the other target has been played
+	int t = idx ^ 1;
+	if (ring->held[t]) {
+		ring->rd += 1;
 	}
+	ring->played += 1;
+	// the render-ahead margin (in blocks)
+	int fill = (int)(ring->wr - ring->queued);
+	// give the next rendered block to the free target
+	if (fill > 0) {
+		dma_set_mar(dma, t, (uint32_t) ring->block[ring->queued & (AUDIO_RING_SIZE - 1)]);
+		ring->queued += 1;
+		ring->held[t] = 1;
+	} else {
+		// the renderer is behind
+		dma_set_mar(dma, t, (uint32_t) ring->silence);
+		ring->held[t] = 0;
+		pmsynth_audio.stats.underrun += 1;
+	}
+	// let the main loop know a block has been played
+	event_wr(EVENT_TYPE_AUDIO | (uint32_t) fill, NULL);
+	// wake the renderer to refill the ring
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
 }
 
 // DMA configuration
@@ -59,14 +73,15 @@ static struct dma_cfg audio_dma_cfg = {
 	.minc = DMA_MINC_ON,
 	.pinc = DMA_PINC_OFF,
 	.circ = DMA_CIRC_ON,
+	.dbm = DMA_DBM_ON,
 	.pfctrl = DMA_PFCTRL_DMA,
 	.fifo = DMA_FIFO_ENABLE,
 	.fth = DMA_FTH(3),
-	.src = (uint32_t) pmsynth_audio.buffer,
+	.src = (uint32_t) pmsynth_audio.ring.silence,
+	.mem1 = (uint32_t) pmsynth_audio.ring.silence,
 	.dst = (uint32_t) & SPI3->DR,
-	.nitems = AUDIO_BUFFER_SIZE,
+	.nitems = AUDIO_DMA_BLOCK_SIZE,
 	.err_callback = audio_err_callback,
-	.ht_callback = audio_ht_callback,
 	.tc_callback = audio_tc_callback,
 };
 
@@ -108,20 +123,12 @@ static struct cs4x_cfg audio_dac_cfg = {
 
 //-----------------------------------------------------------------------------
 
-int audio_init(struct audio_drv *audio) {
+// setup the i2s clocking for a nominal sample rate
+static int audio_clk_init(struct audio_drv *audio, uint32_t rate) {
 	int rc = 0;
 
-	// setup the dma to feed the i2s
-	rc = dma_init(&audio->dma, &audio_dma_cfg);
-	if (rc != 0) {
-		DBG("dma_init failed %d\r\n", rc);
-		goto exit;
-	}
-	// Setup DMA1_Stream7 interrupt
-	HAL_NVIC_SetPriority(DMA1_Stream7_IRQn, 6, 0);
-
 	// Setup the i2s pll to generate i2s_clk
-	rc = set_i2sclk(AUDIO_SAMPLE_RATE);
+	rc = set_i2sclk(rate);
 	if (rc != 0) {
 		DBG("i2sclk_init failed %d\r\n", rc);
 		goto exit;
@@ -129,11 +136,60 @@ int audio_init(struct audio_drv *audio) {
 	DBG("i2sclk %d Hz\r\n", get_i2sclk());
 
 	// setup the i2s interface
+	audio_i2s_cfg.fs = rate;
 	rc = i2s_init(&audio->i2s, &audio_i2s_cfg);
 	if (rc != 0) {
 		DBG("i2s_init failed %d\r\n", rc);
 		goto exit;
 	}
+	// record the actual sample rate (the clock dividers rarely give the nominal rate)
+	audio->rate = rate;
+	audio_fs = (float)i2s_get_fsclk(&audio->i2s);
+	audio_ts = 1.f / audio_fs;
+
+ exit:
+	return rc;
+}
+
+//-----------------------------------------------------------------------------
+
+// reset the render-ahead ring, the dma starts on the silent block
+// Note: the played count is the sample clock, so it keeps running.
+static void audio_ring_reset(struct audio_ring *ring) {
+	memset(ring->silence, 0, sizeof(ring->silence));
+	ring->wr = 0;
+	ring->rd = 0;
+	ring->queued = 0;
+	ring->held[0] = 0;
+	ring->held[1] = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+int audio_init(struct audio_drv *audio) {
+	int rc = 0;
+
+	// setup the render-ahead ring
+	audio_ring_reset(&audio->ring);
+	audio->ring.depth = AUDIO_RING_DEPTH;
+	audio->ring.played = 0;
+
+	// setup the dma to feed the i2s
+	rc = dma_init(&audio->dma, &audio_dma_cfg);
+	if (rc != 0) {
+		DBG("dma_init failed %d\r\n", rc);
+		goto exit;
+	}
+	// Setup DMA1_Stream7 interrupt
+	HAL_NVIC_SetPriority(DMA1_Stream7_IRQn, 6, 0);
+	// The renderer runs in PendSV at the lowest priority, below SysTick (14).
+	HAL_NVIC_SetPriority(PendSV_IRQn, AUDIO_RENDER_PRIORITY, 0);
+
+	// setup the i2s interface and clocking
+	rc = audio_clk_init(audio, AUDIO_SAMPLE_RATE);
+	if (rc != 0) {
+		goto exit;
+	}
 	// setup the i2c bus used to control the dac
 	rc = i2c_init(&audio->i2c, &audio_i2c_cfg);
 	if (rc != 0) {
@@ -149,10 +205,7 @@ int audio_init(struct audio_drv *audio) {
 	}
 	// setup the stats
 	memset(&audio->stats, 0, sizeof(struct audio_stats));
-	audio->stats.min = AUDIO_BUFFER_SIZE;
-
-	// setup the buffer
-	memset(audio->buffer, 0, sizeof(int16_t) * AUDIO_BUFFER_SIZE);
+	audio->stats.min = AUDIO_RING_SIZE * AUDIO_BLOCK_SIZE;
 
  exit:
 	return rc;
@@ -186,6 +239,43 @@ int audio_start(struct audio_drv *audio) {
 
 //-----------------------------------------------------------------------------
 
+// change the sample rate of a running audio output
+// The caller is responsible for updating any rate dependent synth state.
+int audio_set_rate(struct audio_drv *audio, uint32_t rate) {
+	int rc = 0;
+
+	if (rate == audio->rate) {
+		return 0;
+	}
+	// stop the dma and i2s while we change the clocks
+	rc = dma_disable(&audio->dma);
+	if (rc != 0) {
+		DBG("dma_disable failed %d\r\n", rc);
+		goto exit;
+	}
+	i2s_disable(&audio->i2s);
+
+	rc = audio_clk_init(audio, rate);
+	if (rc != 0) {
+		goto exit;
+	}
+	// restart the dma with an empty ring
+	audio_ring_reset(&audio->ring);
+	rc = dma_init(&audio->dma, &audio_dma_cfg);
+	if (rc != 0) {
+		DBG("dma_init failed %d\r\n", rc);
+		goto exit;
+	}
+	dma_enable(&audio->dma);
+	i2s_enable(&audio->i2s);
+	DBG("fs %d Hz\r\n", i2s_get_fsclk(&audio->i2s));
+
+ exit:
+	return rc;
+}
+
+//-----------------------------------------------------------------------------
+
 // clip and convert samples to the -32768..32767 range.
 static int16_t clip_convert(float x) {
 	return (int16_t) __SSAT((int32_t) (x * 32767.f), 16);
@@ -202,50 +292,83 @@ void audio_wr(int16_t * dst, size_t n, float *ch_l, float *ch_r) {
 
 //-----------------------------------------------------------------------------
 
+// return the next block to render, or NULL if the ring is at depth
+int16_t *audio_ring_wr(struct audio_drv *audio) {
+	struct audio_ring *ring = &audio->ring;
+	if (ring->wr - ring->rd >= ring->depth) {
+		return NULL;
+	}
+	return ring->block[ring->wr & (AUDIO_RING_SIZE - 1)];
+}
+
+// hand the rendered block to the dma
+void audio_ring_commit(struct audio_drv *audio) {
+	// the block data must be written before the dma callback sees it
+	__DMB();
+	audio->ring.wr += 1;
+}
+
+// set the render-ahead depth (in blocks)
+// Each block adds AUDIO_BLOCK_SIZE samples of latency. The dma holds 2 of
+// the blocks, so the renderer has (depth - 1) blocks to beat the deadline.
+void audio_ring_depth(struct audio_drv *audio, uint32_t depth) {
+	if (depth < 2) {
+		depth = 2;
+	}
+	if (depth > AUDIO_RING_SIZE) {
+		depth = AUDIO_RING_SIZE;
+	}
+	audio->ring.depth = depth;
+	DBG("audio ring depth %d (%d samples)\r\n", audio->ring.depth, audio->ring.depth * AUDIO_BLOCK_SIZE);
+}
+
+//-----------------------------------------------------------------------------
+// The sample clock: time (in samples) since the dma started.
+
+// return the current playback time
+uint32_t audio_time(struct audio_drv *audio) {
+	struct audio_ring *ring = &audio->ring;
+	uint32_t played, ndtr;
+	// re-read if the dma callback ran
+	do {
+		played = ring->played;
+		ndtr = dma_ndtr(&audio->dma);
+	} while (played != ring->played);
+	return (played * AUDIO_BLOCK_SIZE) + ((AUDIO_DMA_BLOCK_SIZE - ndtr) >> 1);
+}
+
+// return the playback time for the start of the next block to render
+uint32_t audio_render_time(struct audio_drv *audio) {
+	struct audio_ring *ring = &audio->ring;
+	uint32_t played, queued;
+	// re-read if the dma callback ran
+	do {
+		played = ring->played;
+		queued = ring->queued;
+	} while (played != ring->played);
+	// the 2 dma targets, then the rendered blocks not yet given to the dma
+	return (played + 2 + (ring->wr - queued)) * AUDIO_BLOCK_SIZE;
+}
+
+//-----------------------------------------------------------------------------
+
 // report some metrics for realtime audio performance
-void audio_stats(struct audio_drv *audio, int16_t * buf) {
+// fill is the render-ahead margin (in blocks) when the dma took a block
+void audio_stats(struct audio_drv *audio, int fill) {
 	struct audio_stats *stats = &audio->stats;
-	// where are we in the DMA buffer?
-	int ndtr = (int)dma_ndtr(&audio->dma);
-	int margin = -1;
+	int margin = fill * AUDIO_BLOCK_SIZE;
 
 	stats->buffers += 1;
 
-	// We call this just after we have created a new buffer of samples and copied them to the audio buffer.
-	// We have to work faster than the DMA is reading the other buffer half.
-	// Let's see how close the DMA is to finishing:
-	// That gives us a margin for how much we beat the deadline.
-
-	if (buf == audio->buffer) {
-		// we just wrote to the lower buffer
-		if (ndtr > HALF_AUDIO_BUFFER_SIZE) {
-			// dma is reading in the lower half- oops!
-			stats->underrun += 1;
-		} else {
-			// dma is still reading in the top half
-			margin = ndtr;
-		}
-	} else {
-		// we just wrote to the upper buffer
-		if (ndtr < HALF_AUDIO_BUFFER_SIZE) {
-			// dma is reading in the top half- oops!
-			stats->underrun += 1;
-		} else {
-			margin = ndtr - (int)HALF_AUDIO_BUFFER_SIZE;
-		}
+	// record the last N_MARGINS for an average
+	stats->margins[stats->idx] = margin;
+	stats->idx = (stats->idx + 1) & (N_MARGINS - 1);
+	// record max and min margin
+	if (margin < stats->min) {
+		stats->min = margin;
 	}
-
-	if (margin >= 0) {
-		// record the last N_MARGINS for an average
-		stats->margins[stats->idx] = margin;
-		stats->idx = (stats->idx + 1) & (N_MARGINS - 1);
-		// record max and min margin
-		if (margin < stats->min) {
-			stats->min = margin;
-		}
-		if (margin > stats->max) {
-			stats->max = margin;
-		}
+	if (margin > stats->max) {
+		stats->max = margin;
 	}
 	// print a periodic stats message
 	if ((stats->buffers & ((1 << 10) - 1)) == 0) {
@@ -256,7 +379,7 @@ void audio_stats(struct audio_drv *audio, int16_t * buf) {
 			ave += stats->margins[i];
 		}
 		ave /= N_MARGINS;
-		DBG("margin min %d max %d ave %d underruns %d\r\n", stats->min, stats->max, ave, stats->underrun);
+		DBG("depth %d margin min %d max %d ave %d underruns %d\r\n", audio->ring.depth, stats->min, stats->max, ave, stats->underrun);
 	}
 }
 
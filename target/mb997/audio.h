@@ -17,21 +17,33 @@ Audio Control for the STM32F4 Discovery Board
 
 //-----------------------------------------------------------------------------
 
-// Total bits/sec = AUDIO_SAMPLE_RATE * N bits per channel * 2 channels
-// This is used to lookup the i2s clock configuration in a table.
+// Total bits/sec = sample rate * N bits per channel * 2 channels
+// The nominal rate is used to lookup the i2s clock configuration in a table.
+// This is the rate at boot, audio_set_rate() can change it at runtime.
+// Supported rates: 22050, 32000, 44100, 48000 Hz
 #define AUDIO_SAMPLE_RATE 44100U	// Hz
 
 // The hardware is often not capable of the exact sample rate.
 // This is the sample rate we actually get per the clock divider settings.
+// It is set from the i2s configuration by audio_init() and audio_set_rate().
 // See ./scripts/i2sclk.py for details.
-#define AUDIO_FS 44099.507f	// Hz
+extern float audio_fs;		// sample rate (Hz)
+extern float audio_ts;		// sample period (1/audio_fs secs)
 
 // The size (in audio samples) of the work buffer.
 #define AUDIO_BLOCK_SIZE 128
 
-// The size (in audio samples) of the buffer that is DMAed from memory to I2S.
-#define AUDIO_BUFFER_SIZE (4 * AUDIO_BLOCK_SIZE)
-#define HALF_AUDIO_BUFFER_SIZE (2 * AUDIO_BLOCK_SIZE)
+// The size (in int16 items) of a stereo block that is DMAed from memory to I2S.
+#define AUDIO_DMA_BLOCK_SIZE (2 * AUDIO_BLOCK_SIZE)
+
+// The synth renders blocks ahead of the DMA into a ring of blocks.
+// The DMA (double buffer mode) reads the blocks in place, the DMA callback
+// just advances the read pointer. More depth == more latency, fewer underruns.
+#define AUDIO_RING_SIZE 8U	// maximum depth, must be a power of 2
+#define AUDIO_RING_DEPTH 4U	// default render-ahead depth (in blocks)
+
+// The renderer runs in PendSV at this (the lowest) priority.
+#define AUDIO_RENDER_PRIORITY 15U
 
 //-----------------------------------------------------------------------------
 
@@ -39,30 +51,62 @@ Audio Control for the STM32F4 Discovery Board
 
 struct audio_stats {
 	uint32_t buffers;
-	uint32_t underrun;	// number of DMA buffer underruns
+	volatile uint32_t underrun;	// number of DMA buffer underruns
 	int max;		// maximum margin (in audio samples)
 	int min;		// minimum margin (in audio samples)
 	int margins[N_MARGINS];	// storage for moving average
 	int idx;		// storage write index
 };
 
+struct audio_ring {
+	int16_t block[AUDIO_RING_SIZE][AUDIO_DMA_BLOCK_SIZE] ALIGN(4);	// rendered blocks
+	int16_t silence[AUDIO_DMA_BLOCK_SIZE] ALIGN(4);	// played on underrun
+	volatile uint32_t wr;	// number of blocks rendered
+	volatile uint32_t rd;	// number of blocks played
+	uint32_t queued;	// number of blocks handed to the dma
+	volatile uint32_t played;	// number of blocks (including silence) played
+	uint8_t held[2];	// does the dma target hold a ring block?
+	uint32_t depth;		// render-ahead depth (in blocks)
+};
+
 struct audio_drv {
+	uint32_t rate;		// nominal sample rate (Hz)
 	struct dma_drv dma;
 	struct i2s_drv i2s;
 	struct i2c_drv i2c;
 	struct cs4x_drv dac;
 	struct audio_stats stats;
-	int16_t buffer[AUDIO_BUFFER_SIZE] ALIGN(4);	// dma->i2s buffer
+	struct audio_ring ring;	// dma->i2s buffers
 };
 
 extern struct audio_drv pmsynth_audio;
 
 //-----------------------------------------------------------------------------
 
+// Hold off the renderer, so the main loop can change the voices it owns.
+// Only PendSV is masked. Returns the state for audio_render_unlock().
+static inline uint32_t audio_render_lock(void) {
+	uint32_t x = __get_BASEPRI();
+	__set_BASEPRI_MAX(AUDIO_RENDER_PRIORITY << (8U - __NVIC_PRIO_BITS));
+	return x;
+}
+
+static inline void audio_render_unlock(uint32_t x) {
+	__set_BASEPRI(x);
+}
+
+//-----------------------------------------------------------------------------
+
 int audio_init(struct audio_drv *audio);
 int audio_start(struct audio_drv *audio);
+int audio_set_rate(struct audio_drv *audio, uint32_t rate);
 void audio_wr(int16_t * dst, size_t n, float *ch_l, float *ch_r);
-void audio_stats(struct audio_drv *audio, int16_t * buf);
+int16_t *audio_ring_wr(struct audio_drv *audio);
+void audio_ring_commit(struct audio_drv *audio);
+void audio_ring_depth(struct audio_drv *audio, uint32_t depth);
+uint32_t audio_time(struct audio_drv *audio);
+uint32_t audio_render_time(struct audio_drv *audio);
+void audio_stats(struct audio_drv *audio, int fill);
 void audio_master_volume(struct audio_drv *audio, uint8_t vol);
 
 //-----------------------------------------------------------------------------
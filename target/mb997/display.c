@@ -42,6 +42,47 @@ static struct spi_cfg lcd_spi_cfg = {
 #error "what kind of SPI driver are we building?"
 #endif
 
+//-----------------------------------------------------------------------------
+// SPI Tx DMA
+
+#if defined(SPI_DRIVER_HW)
+
+// errors callback
+static void lcd_dma_err_callback(struct dma_drv *dma, uint32_t errors) {
+	DBG("lcd dma error 0x%08x\r\n", errors);
+}
+
+// transfer complete callback
+static void lcd_dma_tc_callback(struct dma_drv *dma, int idx) {
+	lcd_dma_done(&pmsynth_display.lcd);
+}
+
+// SPI2_TX is DMA1 stream 4 channel 0
+static struct dma_cfg lcd_dma_cfg = {
+	.controller = DMA1_BASE,
+	.stream = 4,
+	.chsel = DMA_CHSEL(0),
+	.pl = DMA_PL(1),
+	.dir = DMA_DIR_M2P,
+	.msize = DMA_MSIZE(16),
+	.psize = DMA_PSIZE(16),
+	.mburst = DMA_MBURST_INCR1,
+	.pburst = DMA_PBURST_INCR1,
+	.minc = DMA_MINC_ON,
+	.pinc = DMA_PINC_OFF,
+	.circ = DMA_CIRC_OFF,
+	.pfctrl = DMA_PFCTRL_DMA,
+	.fifo = DMA_FIFO_DISABLE,
+	.err_callback = lcd_dma_err_callback,
+	.tc_callback = lcd_dma_tc_callback,
+};
+
+void DMA1_Stream4_IRQHandler(void) {
+	dma_isr(&pmsynth_display.spi.tx_dma);
+}
+
+#endif
+
 //-----------------------------------------------------------------------------
 
 static struct lcd_cfg lcd_cfg = {
@@ -51,24 +92,24 @@ static struct lcd_cfg lcd_cfg = {
 	.led = IO_LCD_LED,	// gpio for led backlight control
 	.bg = LCD_COLOR_NAVY,
 	.rotation = 3,
+#if defined(SPI_DRIVER_HW)
+	.dma = 1,
+#endif
 };
 
 //-----------------------------------------------------------------------------
 
-static struct term_cfg term_cfg = {
-	.font = 0,
-	.lines = 11,
-	.yofs = 0,
-	.bg = LCD_COLOR_BLACK,
-	.fg = LCD_COLOR_WHITE,
-};
-
-//-----------------------------------------------------------------------------
-
-static void term_test(struct term_drv *drv) {
-	term_print(drv, "______PMSYNTH__________________\n",0);
-	term_print(drv, "_________________ALPHA_________\n",1);
-
+// title lines
+static void display_title(struct ui_drv *ui) {
+	const struct font *f = font_get(0);
+	int dy = f->ascent - f->descent;
+	int w = ui->lcd->width;
+	struct widget *wd;
+	wd = ui_add_text(ui, 0, 0, w, dy, 0, LCD_COLOR_WHITE, LCD_COLOR_BLACK);
+	ui_set_text(ui, wd, "______PMSYNTH__________________");
+	wd = ui_add_text(ui, 0, dy, w, dy, 0, LCD_COLOR_WHITE, LCD_COLOR_BLACK);
+	ui_set_text(ui, wd, "_________________ALPHA_________");
+	ui_flush(ui, -1);
 }
 
 
@@ -82,6 +123,17 @@ int display_init(struct display_drv *display) {
 		DBG("spi_init failed %d\r\n", rc);
 		goto exit;
 	}
+#if defined(SPI_DRIVER_HW)
+	// setup the spi tx dma
+	rc = spi_tx_dma(&display->spi, &lcd_dma_cfg);
+	if (rc != 0) {
+		DBG("spi_tx_dma failed %d\r\n", rc);
+		goto exit;
+	}
+	// above the audio renderer (PendSV), below the midi serial port
+	HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 12, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
+#endif
 	// setup the lcd
 	lcd_cfg.spi = &display->spi;
 	rc = lcd_init(&display->lcd, &lcd_cfg);
@@ -89,15 +141,14 @@ int display_init(struct display_drv *display) {
 		DBG("lcd_init failed %d\r\n", rc);
 		goto exit;
 	}
-	// setup the stdio terminal
-	term_cfg.lcd = &display->lcd;
-	rc = term_init(&display->term, &term_cfg);
+	// setup the widgets
+	rc = ui_init(&display->ui, &display->lcd, LCD_COLOR_BLACK);
 	if (rc != 0) {
-		DBG("term_init failed %d\r\n", rc);
+		DBG("ui_init failed %d\r\n", rc);
 		goto exit;
 	}
 
-	term_test(&display->term);
+	display_title(&display->ui);
 
  exit:
 	return rc;
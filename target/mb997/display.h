@@ -19,7 +19,7 @@ Display Control
 struct display_drv {
 	struct spi_drv spi;
 	struct lcd_drv lcd;
-	struct term_drv term;
+	struct ui_drv ui;
 };
 
 extern struct display_drv pmsynth_display;
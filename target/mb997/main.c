@@ -98,7 +98,9 @@ void SVC_Handler(void) {
 }
 void DebugMon_Handler(void) {
 }
+// render audio ahead of the dma (pended by the audio dma callback)
 void PendSV_Handler(void) {
+	pmsynth_render(&synth);
 }
 
 void SysTick_Handler(void) {
@@ -221,12 +223,20 @@ static struct rng_drv pmsynth_rng;
 //-----------------------------------------------------------------------------
 // midi port (on USART2)
 
+// the end of a burst of midi bytes
+static void midi_idle_callback(struct usart_drv *usart) {
+	// pass the rx time and dma position for timestamping
+	uint32_t t = audio_time(&pmsynth_audio);
+	event_wr(EVENT_TYPE_MIDI | (uint32_t) usart_rx_dma_wr(usart), (void *)(uintptr_t) t);
+}
+
 struct usart_cfg midi_serial_cfg = {
 	.base = USART2_BASE,
 	.baud = 31250,
 	.data = 8,
 	.parity = 0,
 	.stop = 1,
+	.idle_callback = midi_idle_callback,
 };
 
 struct usart_drv midi_serial;
@@ -235,6 +245,30 @@ void USART2_IRQHandler(void) {
 	usart_isr(&midi_serial);
 }
 
+// midi rx dma buffer, at 31250 baud this is ~80 ms of data
+#define MIDI_RXDMA_SIZE 256	// must be a power of 2
+static uint8_t midi_rxdma_buf[MIDI_RXDMA_SIZE];
+
+// USART2_RX is DMA1, stream 5, channel 4
+static struct dma_cfg midi_rxdma_cfg = {
+	.controller = DMA1_BASE,
+	.stream = 5,
+	.chsel = DMA_CHSEL(4),
+	.pl = DMA_PL(0),
+	.dir = DMA_DIR_P2M,
+	.msize = DMA_MSIZE(8),
+	.psize = DMA_PSIZE(8),
+	.mburst = DMA_MBURST_INCR1,
+	.pburst = DMA_PBURST_INCR1,
+	.minc = DMA_MINC_ON,
+	.pinc = DMA_PINC_OFF,
+	.circ = DMA_CIRC_ON,
+	.pfctrl = DMA_PFCTRL_DMA,
+	.fifo = DMA_FIFO_DISABLE,
+	.dst = (uint32_t) midi_rxdma_buf,
+	.nitems = MIDI_RXDMA_SIZE,
+};
+
 
 
 //-----------------------------------------------------------------------------
@@ -268,6 +302,12 @@ int main(void) {
 		DBG("usart_init failed %d\r\n", rc);
 		goto exit;
 	}
+	// receive midi bytes with dma
+	rc = usart_rx_dma(&midi_serial, &midi_rxdma_cfg);
+	if (rc != 0) {
+		DBG("usart_rx_dma failed %d\r\n", rc);
+		goto exit;
+	}
 	// setup the interrupts for the serial port
 	HAL_NVIC_SetPriority(USART2_IRQn, 10, 0);
 	NVIC_EnableIRQ(USART2_IRQn);
@@ -0,0 +1,199 @@
+// generated by: ./pbm2rle -o icons.c mallet.pbm guitar_pick.pbm blow.pbm harp.pbm tube.pbm flute.pbm xylophone.pbm (don't edit)
+#include "lcd.h"
+static const uint8_t mallet_rle[] = {
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6b, 0x9f,
+	0x7f, 0x59, 0x84, 0xbf, 0x7f, 0x54, 0x80, 0xef, 0x7f, 0x55, 0x82, 0xef, 0x7f, 0x4c, 0x9f, 0xe0,
+	0xab, 0x7f, 0x4b, 0x84, 0xb8, 0x85, 0xdf, 0x7f, 0xff, 0x81, 0xec, 0x89, 0xef, 0x7f, 0x47, 0x82,
+	0xee, 0x87, 0xdf, 0x7f, 0x47, 0x81, 0xee, 0xb5, 0xdf, 0x7f, 0xff, 0x81, 0xbb, 0xaf, 0xef, 0x7f,
+	0x47, 0xa0, 0xfb, 0xc6, 0x9f, 0x7f, 0x48, 0x97, 0xef, 0xf1, 0x7f, 0x4e, 0x9b, 0xef, 0xf5, 0x7f,
+	0x4e, 0xbf, 0xef, 0xf5, 0x7f, 0x4f, 0x8c, 0xbf, 0xeb, 0x7f, 0x51, 0x97, 0xfe, 0xdf, 0x7f, 0x4f,
+	0xaf, 0xfd, 0xbf, 0x7f, 0x4f, 0xaf, 0xfd, 0xbf, 0x7f, 0x4e, 0xaf, 0xfd, 0xbf, 0x7f, 0x4f, 0xaf,
+	0xfa, 0x7f, 0x55, 0xaf, 0xfa, 0x7f, 0x56, 0xaf, 0xf5, 0x7f, 0x55, 0xaf, 0xf5, 0x7f, 0x56, 0xaf,
+	0xf5, 0x7f, 0x55, 0xaf, 0xf5, 0x7f, 0x56, 0xaf, 0xeb, 0x7f, 0x55, 0xaf, 0xeb, 0x7f, 0x56, 0xaf,
+	0xd7, 0x7f, 0x55, 0xaf, 0xd7, 0x7f, 0x56, 0xaf, 0xd7, 0x7f, 0x55, 0xaf, 0xd7, 0x7f, 0x56, 0xaf,
+	0xaf, 0x7f, 0x55, 0xaf, 0xaf, 0x7f, 0x56, 0xae, 0xdf, 0x7f, 0x55, 0xae, 0xdf, 0x7f, 0x56, 0xae,
+	0xdf, 0x7f, 0x55, 0xae, 0xdf, 0x7f, 0x56, 0xad, 0xbf, 0x7f, 0x55, 0xad, 0xbf, 0x7f, 0x56, 0xaa,
+	0x7f, 0x5c, 0xaa, 0x7f, 0x5d, 0xaa, 0x7f, 0x5c, 0xaa, 0x7f, 0x5d, 0xa5, 0x7f, 0x5c, 0xa5, 0x7f,
+	0x5d, 0xab, 0x7f, 0x5c, 0xab, 0x7f, 0x5d, 0xab, 0x7f, 0x5c, 0xab, 0x7f, 0x5d, 0xa7, 0x7f, 0x5c,
+	0xa7, 0x7f, 0x5d, 0xaf, 0x7f, 0x5c, 0xaf, 0x7f, 0x5d, 0xaf, 0x7f, 0x5c, 0xaf, 0x7f, 0x5c, 0x97,
+	0x7f, 0x5c, 0x97, 0x7f, 0x5c, 0xab, 0x7f, 0x5c, 0xab, 0x7f, 0x5d, 0xab, 0x7f, 0x5c, 0xab, 0x7f,
+	0x5c, 0xa5, 0x7f, 0x5c, 0xa5, 0x7f, 0x5c, 0xaa, 0x7f, 0x5c, 0xba, 0x7f, 0x5d, 0xaa, 0x7f, 0x5c,
+	0xaa, 0x7f, 0x5c, 0xad, 0xbf, 0x7f, 0x55, 0xad, 0xbf, 0x7f, 0x55, 0xae, 0xdf, 0x7f, 0x55, 0xae,
+	0xdf, 0x7f, 0x56, 0xae, 0xdf, 0x7f, 0x55, 0xae, 0xdf, 0x7f, 0x55, 0xaf, 0xaf, 0x7f, 0x55, 0xaf,
+	0xaf, 0x7f, 0x55, 0xaf, 0xd7, 0x7f, 0x55, 0xaf, 0xd7, 0x7f, 0x56, 0xaf, 0xd7, 0x7f, 0x55, 0xaf,
+	0xd7, 0x7f, 0x55, 0xaf, 0xeb, 0x7f, 0x55, 0xaf, 0xeb, 0x7f, 0x55, 0xaf, 0xf7, 0x7f, 0x55, 0xaf,
+	0x7f, 0x5d, 0xbf, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x64,
+};
+const struct rle_image icon_mallet = {100, 100, mallet_rle}; // 351 bytes
+static const uint8_t guitar_pick_rle[] = {
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x77, 0xbf, 0x7f, 0x68, 0xbf, 0x7f, 0x4d, 0xbf, 0x7f, 0x5b, 0xbf, 0x48,
+	0xbf, 0x7f, 0x4a, 0xbf, 0x7f, 0x6e, 0xbf, 0x7f, 0xfe, 0xef, 0x4f, 0xbf, 0x7f, 0xff, 0xbf, 0x4e,
+	0xbf, 0x7f, 0x5c, 0xbf, 0x7f, 0xbe, 0x55, 0xbf, 0x7f, 0xef, 0x55, 0xbf, 0x7f, 0xfa, 0x48, 0x8f,
+	0xfe, 0x7f, 0x4c, 0xbc, 0x9c, 0xbf, 0xdf, 0x7f, 0x48, 0x87, 0xff, 0xbf, 0xbf, 0x77, 0xbf, 0xfc,
+	0xfd, 0xab, 0xf7, 0xef, 0x7f, 0xfb, 0xaf, 0x9f, 0xbd, 0xf7, 0x79, 0xbf, 0xfb, 0xe3, 0xe5, 0xde,
+	0xf7, 0x7f, 0xfb, 0xfe, 0xfb, 0xdf, 0xd7, 0x78, 0xbf, 0xfd, 0x47, 0xbd, 0xb5, 0xe7, 0x7f, 0xfb,
+	0x48, 0xbd, 0xbf, 0xdf, 0x7f, 0xf7, 0x48, 0xba, 0xd5, 0xbf, 0x74, 0xbf, 0xfd, 0x4c, 0xba, 0xde,
+	0x7f, 0xff, 0xbf, 0x48, 0xb5, 0xaa, 0x78, 0xbf, 0xfd, 0x4e, 0xb9, 0xae, 0x7f, 0xfb, 0x4f, 0xb9,
+	0xa9, 0x76, 0xbf, 0xfd, 0x51, 0xb2, 0xd3, 0x7f, 0xdf, 0x4e, 0xb0, 0xab, 0x7f, 0xbf, 0x4e, 0xb2,
+	0xd3, 0x7f, 0xbf, 0x4e, 0xb0, 0x93, 0x7e, 0xbf, 0x4f, 0xb1, 0xa0, 0x1d, 0xd5, 0xbf, 0x52, 0xbf,
+	0x4e, 0xb8, 0x89, 0x7f, 0xbf, 0x4e, 0xb8, 0x81, 0x7f, 0xbf, 0x4e, 0xb0, 0x81, 0x7e, 0xbf, 0x4e,
+	0xb8, 0x80, 0x7f, 0xbf, 0x4d, 0xb8, 0x2a, 0xd5, 0xbf, 0x4f, 0xbf, 0x4b, 0xbc, 0x07, 0x7f, 0xf7,
+	0x4c, 0xbc, 0x08, 0x7f, 0xfb, 0x4a, 0x9e, 0x0a, 0x74, 0xbf, 0x48, 0x83, 0xf1, 0xf8, 0x08, 0x7f,
+	0x4a, 0x83, 0xfc, 0x0a, 0x78, 0xbf, 0x55, 0x33, 0xd5, 0xbf, 0xff, 0xbf, 0x50, 0x0f, 0x7e, 0x83,
+	0x4b, 0x11, 0x7f, 0xf8, 0x1c, 0x7f, 0x4f, 0x13, 0x7f, 0x51, 0x10, 0x7f, 0x54, 0x0e, 0x7f, 0x55,
+	0x0d, 0x7a, 0xb5, 0xa0, 0x3f, 0x8a, 0xd7, 0x65, 0x09, 0x7f, 0x5c, 0x81, 0x7f, 0x5f, 0x9f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x60,
+};
+const struct rle_image icon_guitar_pick = {100, 100, guitar_pick_rle}; // 327 bytes
+static const uint8_t blow_rle[] = {
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x4f, 0x87, 0x7f, 0x59, 0x8f, 0x87, 0x7f, 0x54, 0xbf, 0xfc, 0x87, 0x7f,
+	0xf8, 0x82, 0xbf, 0x4b, 0x87, 0x7d, 0x9f, 0xf7, 0x54, 0xbf, 0x78, 0xbf, 0x5d, 0xbf, 0x76, 0x9f,
+	0x5e, 0xbf, 0x76, 0x9f, 0x5e, 0xbf, 0x75, 0xbf, 0x5f, 0xbf, 0x74, 0xbf, 0x5f, 0xbf, 0x75, 0xbf,
+	0x4f, 0xbf, 0xfb, 0xe7, 0x78, 0xbf, 0x4e, 0x9f, 0xf9, 0xfb, 0x78, 0xbf, 0x4e, 0x9f, 0xf9, 0xfb,
+	0x76, 0x9f, 0x50, 0x9f, 0xf9, 0xfb, 0x75, 0xbf, 0x62, 0xbf, 0x72, 0xbf, 0x54, 0xbd, 0xfe, 0x79,
+	0xbf, 0x55, 0x87, 0xfd, 0x78, 0xbf, 0x5e, 0x81, 0x76, 0xbf, 0x49, 0x87, 0x48, 0x83, 0xf9, 0x75,
+	0x9f, 0x47, 0xbc, 0x48, 0xbf, 0xff, 0xbf, 0x71, 0x83, 0xfe, 0xfe, 0xbf, 0xbf, 0x47, 0xbf, 0x76,
+	0x9f, 0xdf, 0xf7, 0xf1, 0x47, 0x9f, 0x7a, 0x81, 0xbf, 0xef, 0xdb, 0xfd, 0x50, 0x8f, 0x6f, 0xbf,
+	0xe0, 0xb9, 0xf1, 0x4f, 0xbb, 0x71, 0x07, 0x4a, 0x83, 0x47, 0x9f, 0xff, 0xbf, 0x7f, 0x50, 0x9f,
+	0xfd, 0x7f, 0x50, 0x8f, 0x9f, 0xf7, 0x7f, 0x51, 0x9e, 0xbe, 0x7f, 0x50, 0x9f, 0xbe, 0x87, 0x7f,
+	0x50, 0x9e, 0xbf, 0x7f, 0x57, 0xbe, 0x7f, 0x5d, 0xbe, 0xbf, 0x7f, 0x56, 0x8f, 0x7f, 0x5f, 0x9f,
+	0x7f, 0x5e, 0xbf, 0x7f, 0x5d, 0xbf, 0x7f, 0x55, 0xbf, 0xbf, 0x7f, 0x56, 0x9d, 0x7f, 0x5e, 0x8f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x40,
+};
+const struct rle_image icon_blow = {100, 100, blow_rle}; // 285 bytes
+static const uint8_t harp_rle[] = {
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x71, 0x07, 0x7f, 0x5a, 0xbb, 0xef, 0x7f, 0x50,
+	0x81, 0xba, 0xdf, 0x7f, 0x4c, 0x9e, 0xcb, 0x97, 0x7f, 0x4d, 0xbf, 0xd0, 0xb3, 0x7f, 0x4d, 0xbf,
+	0xe5, 0xfb, 0x7f, 0x4d, 0xb8, 0x89, 0xfb, 0x7f, 0x4d, 0xbb, 0xfc, 0xdd, 0x7f, 0x4d, 0xbb, 0xfe,
+	0xde, 0x7f, 0x4e, 0xb7, 0xfe, 0xbe, 0x7f, 0x4d, 0xbb, 0x47, 0x9d, 0x7f, 0x4c, 0xb3, 0x48, 0xbd,
+	0x7f, 0x4b, 0xbb, 0x49, 0xad, 0x7f, 0x4b, 0xb7, 0x49, 0x9d, 0x7f, 0x4b, 0xb7, 0x49, 0x9d, 0x7f,
+	0x4a, 0xbb, 0xe0, 0x99, 0xcf, 0x7f, 0x47, 0xb7, 0xe5, 0xa2, 0xaf, 0x7f, 0x47, 0xb7, 0xd5, 0xa9,
+	0xef, 0x7f, 0xff, 0xbb, 0xca, 0xd4, 0xe7, 0x78, 0x83, 0x47, 0xa7, 0xca, 0xd5, 0x97, 0x77, 0xbe,
+	0x48, 0xb7, 0xaa, 0xd4, 0xf7, 0x76, 0xb5, 0xdf, 0xf6, 0xf5, 0xaa, 0xde, 0x79, 0x9e, 0xef, 0xee,
+	0xe5, 0xaa, 0xce, 0x78, 0xb8, 0xa7, 0xf6, 0xf2, 0xd5, 0xaf, 0xbf, 0x72, 0xa9, 0xdb, 0xf6, 0xea,
+	0xd5, 0xab, 0xbf, 0x72, 0x99, 0x9d, 0xee, 0xea, 0xd5, 0xa7, 0xbf, 0x72, 0x8c, 0xe6, 0xed, 0xca,
+	0xd5, 0xa7, 0xbf, 0x72, 0xa8, 0xb7, 0x99, 0xca, 0xd5, 0xaf, 0xbf, 0x73, 0x8c, 0xb3, 0xf6, 0xd5,
+	0xaa, 0xce, 0x79, 0xaa, 0x99, 0xae, 0xd5, 0xaa, 0xde, 0x7a, 0xac, 0xdc, 0xb9, 0xaa, 0xd5, 0xad,
+	0x79, 0xaa, 0xa7, 0xe5, 0xaa, 0xd5, 0x9d, 0x7a, 0xae, 0xb0, 0xaa, 0xd5, 0xaa, 0xbb, 0x79, 0xa5,
+	0x95, 0xaa, 0xd5, 0xaa, 0xfb, 0x7a, 0xae, 0x8a, 0xd5, 0xaa, 0xd4, 0xf7, 0x79, 0xa7, 0x8a, 0xd5,
+	0xaa, 0xd5, 0xf7, 0x7a, 0xab, 0x95, 0xaa, 0xd5, 0xaa, 0xef, 0x79, 0xa7, 0xa5, 0xaa, 0xd5, 0xa9,
+	0xef, 0x7a, 0xa3, 0xaa, 0xd5, 0xaa, 0xd3, 0xdf, 0x79, 0xa7, 0xc2, 0xd5, 0xaa, 0xd7, 0xdf, 0x7a,
+	0xb3, 0xb5, 0xaa, 0xd5, 0xa7, 0xbf, 0x79, 0xa7, 0xd1, 0xaa, 0xd5, 0xaf, 0xbf, 0x7a, 0xb5, 0xd2,
+	0xd5, 0xaa, 0xd6, 0x7f, 0xd1, 0xe5, 0xaa, 0xd5, 0xa7, 0xbf, 0x7b, 0xb7, 0xd1, 0xaa, 0xd5, 0xbd,
+	0x7f, 0xd5, 0xf6, 0xd5, 0xaa, 0xce, 0x7f, 0xf6, 0xd9, 0x8a, 0xd5, 0xa7, 0xbf, 0x7c, 0xab, 0xe8,
+	0xd5, 0xaa, 0xfb, 0x7f, 0xec, 0xfb, 0x8a, 0xd5, 0x9d, 0x7f, 0xf5, 0xbc, 0xc5, 0xaa, 0xde, 0x7f,
+	0xfd, 0xe7, 0xaa, 0xd5, 0xab, 0xbf, 0x7e, 0xab, 0xf2, 0x95, 0xa9, 0xef, 0x7f, 0xee, 0xf9, 0xaa,
+	0xd4, 0xf7, 0x7f, 0xf6, 0x9e, 0xd1, 0xaa, 0xfb, 0x7f, 0xfd, 0xef, 0xd8, 0xd5, 0x9d, 0x7f, 0xfe,
+	0xfb, 0xf5, 0xaa, 0xde, 0x7f, 0x47, 0xab, 0xf5, 0x8a, 0xd6, 0x7f, 0x47, 0xbd, 0xfb, 0xaa, 0xce,
+	0x7f, 0x48, 0xb9, 0xfa, 0xc5, 0xbd, 0x7f, 0x47, 0xb5, 0xfb, 0xd5, 0x9d, 0x7f, 0x48, 0xbd, 0xfb,
+	0xa2, 0xbb, 0x7f, 0x47, 0xbd, 0xfd, 0xe2, 0xfb, 0x7f, 0x48, 0xbd, 0xfb, 0xd5, 0xb7, 0x7f, 0x47,
+	0xbc, 0xfd, 0xd0, 0xf7, 0x7f, 0x48, 0x9d, 0xfd, 0xab, 0xef, 0x7f, 0x47, 0xbe, 0xfc, 0xe9, 0xef,
+	0x7f, 0x48, 0xbd, 0xfd, 0xd3, 0xdf, 0x7f, 0x47, 0xbe, 0xfe, 0xf7, 0xdf, 0x7f, 0x48, 0xbd, 0xfc,
+	0xeb, 0xbf, 0x7f, 0x47, 0xbe, 0xfe, 0xe7, 0xbf, 0x7f, 0x48, 0xbe, 0xfe, 0xde, 0x7f, 0x4e, 0xbe,
+	0xfe, 0x8e, 0x7f, 0x4f, 0xbe, 0xfe, 0x9d, 0x7f, 0x4e, 0xbe, 0xff, 0xbd, 0x7f, 0x4e, 0xbf, 0xbe,
+	0x82, 0x7f, 0x4e, 0xbf, 0x98, 0xff, 0x9f, 0x7f, 0x47, 0xaf, 0xc6, 0x9c, 0xef, 0x7f, 0x47, 0xac,
+	0x9b, 0xc3, 0x8f, 0x7f, 0xff, 0x95, 0xf4, 0xdd, 0x97, 0x7f, 0xff, 0xa7, 0xa9, 0xc0, 0xbb, 0x7f,
+	0x48, 0xb5, 0x8f, 0x49, 0xbf, 0x7f, 0xfa, 0xa5, 0xdf, 0x47, 0xbf, 0x7f, 0xf8, 0xf4, 0xf7, 0x47,
+	0xbf, 0x7f, 0x49, 0xad, 0x4b, 0xbf, 0x7f, 0x49, 0xa7, 0x4a, 0xbf, 0x7f, 0x4a, 0xad, 0x9f, 0xe7,
+	0x7f, 0x4f, 0x89, 0xc0, 0xbf, 0x7f, 0x4f, 0x8f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x61,
+};
+const struct rle_image icon_harp = {100, 100, harp_rle}; // 548 bytes
+static const uint8_t tube_rle[] = {
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x5d, 0x07, 0x7f, 0x53, 0x07, 0x47, 0x07, 0x7f, 0x47, 0x85, 0xfe, 0x4d, 0x87,
+	0x7e, 0x8a, 0xea, 0x53, 0x9f, 0x78, 0x95, 0xb7, 0xfb, 0x50, 0x9f, 0x76, 0x95, 0xad, 0xaf, 0x51,
+	0xbf, 0x74, 0x85, 0xb5, 0x58, 0x8f, 0x75, 0xb1, 0xae, 0xd6, 0x4f, 0x93, 0x77, 0xbc, 0x95, 0x52,
+	0x85, 0x9f, 0x74, 0xbf, 0xe0, 0x8b, 0xf8, 0x81, 0xaa, 0x79, 0xbf, 0x49, 0x07, 0xfb, 0xb5, 0xaf,
+	0x75, 0xbf, 0x51, 0xae, 0xea, 0xcf, 0x75, 0xbf, 0x4e, 0xbf, 0xaa, 0xd5, 0x78, 0xbf, 0x50, 0xab,
+	0xb5, 0xa7, 0x76, 0xbf, 0x4c, 0xbf, 0xf6, 0xd5, 0xbf, 0x73, 0xbf, 0x4f, 0xaa, 0xea, 0xd3, 0x77,
+	0xbf, 0x4e, 0xbf, 0xd6, 0xd5, 0x78, 0xbf, 0x52, 0xae, 0xd5, 0x9f, 0x74, 0xbf, 0x4c, 0xb5, 0xea,
+	0xd5, 0xbf, 0x73, 0xbf, 0x53, 0xb6, 0xea, 0xbf, 0x73, 0xbf, 0x4e, 0xb7, 0xb5, 0xa9, 0x78, 0xbf,
+	0x4f, 0xbb, 0xad, 0xab, 0x77, 0xbf, 0x4c, 0xbd, 0xed, 0xaa, 0xbf, 0x73, 0xbf, 0x4e, 0xbd, 0xda,
+	0xd5, 0x78, 0xbf, 0x50, 0xad, 0xda, 0xd7, 0x76, 0xbf, 0x4d, 0xbe, 0xea, 0xd4, 0x79, 0xbf, 0x4f,
+	0xae, 0xea, 0xd3, 0x77, 0xbf, 0x53, 0xb5, 0xd5, 0xbf, 0x73, 0xbf, 0x4c, 0xb5, 0xed, 0xaa, 0xbf,
+	0x73, 0xbf, 0x53, 0xb6, 0xd5, 0xbf, 0x73, 0xbf, 0x4e, 0xb7, 0xb5, 0xa9, 0x78, 0xbf, 0x4f, 0xbb,
+	0xad, 0xab, 0x77, 0xbf, 0x4c, 0xbd, 0xed, 0xaa, 0xbf, 0x73, 0xbf, 0x4e, 0xbd, 0xda, 0xd5, 0x78,
+	0xbf, 0x50, 0xad, 0xd5, 0xa7, 0x76, 0xbf, 0x4d, 0xbe, 0xeb, 0xaa, 0x79, 0xbf, 0x4f, 0xae, 0xea,
+	0xd3, 0x77, 0xbf, 0x53, 0xb6, 0xd5, 0xbf, 0x73, 0xbf, 0x4c, 0xb5, 0xed, 0xaa, 0xbf, 0x73, 0xbf,
+	0x53, 0xb5, 0xd5, 0xbf, 0x73, 0xbf, 0x4e, 0xb7, 0xb5, 0xa9, 0x78, 0xbf, 0x4f, 0xbb, 0xb5, 0xab,
+	0x77, 0xbf, 0x4c, 0xbd, 0xed, 0xaa, 0xbf, 0x73, 0xbf, 0x4e, 0xbd, 0xd6, 0xd5, 0x78, 0xbf, 0x50,
+	0xad, 0xd5, 0xa7, 0x76, 0xbf, 0x4d, 0xbe, 0xed, 0xaa, 0x79, 0xbf, 0x4f, 0xae, 0xea, 0xd3, 0x77,
+	0xbf, 0x53, 0xb5, 0xd5, 0xbf, 0x73, 0xbf, 0x4c, 0xb5, 0xed, 0xaa, 0xbf, 0x73, 0xbf, 0x53, 0xb6,
+	0xd5, 0xbf, 0x73, 0xbf, 0x4e, 0xb7, 0xb6, 0xd5, 0x78, 0xbf, 0x4f, 0xbb, 0xaa, 0xd3, 0x77, 0xbf,
+	0x4c, 0xbd, 0xed, 0xaa, 0xbf, 0x73, 0xbf, 0x4e, 0xbd, 0xd6, 0xd5, 0x78, 0xbf, 0x50, 0xad, 0xd5,
+	0xa7, 0x76, 0xbf, 0x4d, 0xbe, 0xed, 0xaa, 0x79, 0xbf, 0x4f, 0xae, 0xea, 0xd3, 0x77, 0xbf, 0x53,
+	0xb5, 0xd5, 0xbf, 0x73, 0xbf, 0x4c, 0xb5, 0xed, 0xaa, 0xbf, 0x73, 0xbf, 0x53, 0xb6, 0xd5, 0xbf,
+	0x73, 0xbf, 0x4e, 0xb7, 0xb5, 0xa9, 0x78, 0xbf, 0x4f, 0xbb, 0xad, 0xab, 0x77, 0xbf, 0x4c, 0xbd,
+	0xed, 0xaa, 0xbf, 0x73, 0xbf, 0x4e, 0xbd, 0xda, 0xd5, 0x78, 0xbf, 0x50, 0xad, 0xd5, 0xa7, 0x76,
+	0xbf, 0x4d, 0xbe, 0xeb, 0xaa, 0x79, 0xbf, 0x4f, 0xae, 0xea, 0xd3, 0x77, 0x9f, 0x53, 0xbb, 0xaa,
+	0xbf, 0x73, 0x8f, 0x4c, 0xb5, 0xea, 0xd4, 0xbf, 0x73, 0xb3, 0x53, 0xae, 0xd2, 0xbf, 0x73, 0xbc,
+	0x9f, 0x47, 0xb7, 0xd0, 0x95, 0x78, 0xbf, 0xe0, 0x8f, 0xf8, 0x81, 0xb4, 0x79, 0xbf, 0x49, 0x07,
+	0xfb, 0xb5, 0xaf, 0x76, 0xbf, 0x50, 0xae, 0xea, 0xdf, 0x76, 0x9f, 0x4d, 0xbf, 0xaa, 0xd3, 0x7b,
+	0x9f, 0x4e, 0xab, 0xd4, 0x7f, 0xe1, 0x49, 0xb7, 0xf4, 0x8f, 0x7f, 0xf8, 0x83, 0xfe, 0x80, 0x7f,
+	0x53, 0x07, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x71,
+};
+const struct rle_image icon_tube = {100, 100, tube_rle}; // 513 bytes
+static const uint8_t flute_rle[] = {
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7c, 0x87,
+	0x7f, 0x5b, 0xbc, 0x7f, 0x5d, 0xbc, 0xbf, 0x7f, 0x56, 0x90, 0x9f, 0x7f, 0x56, 0xbb, 0xcf, 0x7f,
+	0x56, 0x9c, 0xe7, 0x7f, 0x56, 0xa7, 0xf3, 0x7f, 0x56, 0xab, 0xf9, 0x7f, 0x56, 0x9d, 0xfc, 0x7f,
+	0x57, 0x9d, 0xfc, 0x7f, 0x56, 0x97, 0xfe, 0xbf, 0x7f, 0x50, 0x8d, 0xfe, 0xbf, 0x7f, 0x50, 0x9f,
+	0xfe, 0xbf, 0x7f, 0x50, 0x95, 0xfe, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x9b, 0xfe,
+	0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x97, 0xfe, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf,
+	0x7f, 0x50, 0x8f, 0xf8, 0xbf, 0x7f, 0x50, 0x9f, 0xf6, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f,
+	0x50, 0x9f, 0xf8, 0xbf, 0x7f, 0x50, 0x9f, 0xf6, 0xbf, 0x7f, 0x50, 0x9f, 0xfc, 0xbf, 0x7f, 0x50,
+	0x9f, 0xf0, 0xbf, 0x7f, 0x50, 0x9f, 0xf6, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x9f,
+	0xf8, 0xbf, 0x7f, 0x50, 0x9f, 0xf6, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x9f, 0xf8,
+	0xbf, 0x7f, 0x50, 0x9f, 0xf6, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x9f, 0xf8, 0xbf,
+	0x7f, 0x50, 0x9f, 0xf6, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f,
+	0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x9f, 0xfe, 0xbf, 0x7f, 0x50,
+	0x9f, 0xfe, 0xbf, 0x7f, 0x50, 0x9f, 0xe1, 0x7f, 0x57, 0x9e, 0x87, 0x7f, 0x57, 0x98, 0x9f, 0x7f,
+	0x57, 0x81, 0x7f, 0x5e, 0x9f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x42,
+};
+const struct rle_image icon_flute = {100, 100, flute_rle}; // 298 bytes
+static const uint8_t xylophone_rle[] = {
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x60, 0x8f, 0x7f, 0x59, 0x8e, 0x7f, 0x5c, 0x9f, 0xbf, 0x7f, 0x55, 0xaf, 0xdf, 0x7f, 0x55,
+	0xb7, 0xef, 0x7f, 0x50, 0x8d, 0xef, 0xdf, 0x7f, 0x4c, 0x9d, 0xbd, 0xfb, 0x7f, 0x4d, 0x9b, 0x9f,
+	0xbe, 0x7f, 0x4e, 0xaf, 0xdf, 0xdf, 0xbf, 0x7f, 0xc7, 0xdb, 0xf7, 0xf7, 0xef, 0x7f, 0x9d, 0xe6,
+	0xfd, 0xfd, 0xfb, 0x7f, 0x9b, 0x8d, 0xdf, 0xbf, 0xbe, 0x7f, 0xd7, 0xee, 0xb7, 0xef, 0xef, 0xdf,
+	0x7a, 0xb7, 0xe3, 0xb7, 0xef, 0xef, 0xdf, 0x72, 0x8f, 0x9b, 0xf7, 0xdb, 0xf7, 0xf7, 0xef, 0x70,
+	0x9d, 0x8b, 0xbe, 0xfb, 0xbe, 0xfe, 0xfd, 0x71, 0x9b, 0xbe, 0xef, 0xde, 0xef, 0xdf, 0xdc, 0xbf,
+	0x6b, 0xaf, 0xd1, 0xb7, 0xef, 0xb7, 0xef, 0xe3, 0xdf, 0x64, 0x8f, 0xb7, 0xe7, 0xdb, 0xf7, 0xdb,
+	0xf7, 0xef, 0xdf, 0x62, 0x9d, 0xc6, 0xfd, 0xfb, 0xbe, 0xfb, 0xbe, 0xfb, 0xf7, 0x63, 0x9b, 0x9d,
+	0xdf, 0xbe, 0xef, 0xde, 0xed, 0xdd, 0xfb, 0x64, 0xaf, 0xd8, 0xef, 0xdf, 0xb7, 0xef, 0xb7, 0x8d,
+	0xfb, 0x5d, 0x8f, 0xb7, 0xe7, 0xb7, 0xef, 0xdb, 0xf7, 0xd8, 0xf5, 0xfb, 0x5b, 0x9d, 0xc6, 0xfd,
+	0xf6, 0xfd, 0xfb, 0xb6, 0xfa, 0xfd, 0xbe, 0x57, 0x8c, 0xec, 0xb6, 0xfd, 0xf6, 0xfd, 0xfb, 0xb8,
+	0xf9, 0xc6, 0xfd, 0x54, 0x9d, 0xaf, 0xdc, 0xef, 0xde, 0xef, 0xdf, 0xb1, 0xe8, 0x83, 0xdf, 0xbf,
+	0x4d, 0x9f, 0xcd, 0xf8, 0xed, 0xfb, 0xed, 0xdb, 0xf5, 0xf9, 0xfe, 0xf7, 0xef, 0x4f, 0xaf, 0xe6,
+	0xfd, 0xf6, 0xfd, 0xf6, 0xf1, 0xf9, 0xc7, 0xff, 0xb7, 0xef, 0x4f, 0xb7, 0xf3, 0xbe, 0xfb, 0xbe,
+	0xfb, 0x8e, 0xc0, 0xbf, 0xf8, 0x96, 0x8f, 0x4f, 0xbb, 0xf9, 0xdf, 0xbd, 0xdb, 0xbd, 0xbe, 0x9f,
+	0xff, 0x87, 0xe1, 0x56, 0xad, 0xfc, 0xef, 0xde, 0xee, 0x9e, 0xb1, 0x49, 0x87, 0x61, 0xbe, 0xfe,
+	0xb7, 0xef, 0xb1, 0xe8, 0x8f, 0xfe, 0x8f, 0x64, 0xb7, 0xbf, 0x9b, 0xb7, 0xd7, 0xe7, 0x48, 0x83,
+	0x69, 0xbf, 0xdf, 0xcd, 0xe3, 0xe6, 0x9f, 0xfc, 0x8f, 0x6b, 0xad, 0xef, 0xe6, 0x9c, 0x81, 0x47,
+	0x83, 0x71, 0xbf, 0xf7, 0x82, 0xfd, 0x4b, 0x87, 0x74, 0xb6, 0xf8, 0xf4, 0xe3, 0x47, 0x87, 0x79,
+	0xbf, 0xf7, 0xe4, 0xbf, 0xf0, 0x7f, 0xed, 0xfb, 0xf7, 0xff, 0x87, 0x7f, 0xfb, 0xed, 0xfb, 0xf8,
+	0xbf, 0x7f, 0xfe, 0xbe, 0xfd, 0xc3, 0x7f, 0x4e, 0xbe, 0xfc, 0xbf, 0x7f, 0x4f, 0xad, 0xfb, 0x7f,
+	0x56, 0xbb, 0xf7, 0x7f, 0x56, 0xb7, 0xef, 0x7f, 0x56, 0xac, 0x9f, 0x7f, 0x56, 0x87, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+	0x7f, 0x61,
+};
+const struct rle_image icon_xylophone = {100, 100, xylophone_rle}; // 434 bytes
@@ -61,6 +61,68 @@ struct term_drv {
 int term_init(struct term_drv *drv, struct term_cfg *cfg);
 void term_print(struct term_drv *drv, char *str, uint8_t line);
 
+//-----------------------------------------------------------------------------
+// Run length encoded 1bpp images (see icons/pbm2rle)
+// Each byte is a run or a span of literal pixels (1 = foreground):
+// 0vnnnnnn = run of n + 1 pixels with value v
+// 1ppppppp = 7 literal pixels, msb first
+
+struct rle_image {
+	uint16_t width;
+	uint16_t height;
+	const uint8_t *data;
+};
+
+extern const struct rle_image icon_mallet;
+extern const struct rle_image icon_guitar_pick;
+extern const struct rle_image icon_blow;
+extern const struct rle_image icon_harp;
+extern const struct rle_image icon_tube;
+extern const struct rle_image icon_flute;
+extern const struct rle_image icon_xylophone;
+
+//-----------------------------------------------------------------------------
+// Retained mode widgets
+// Widgets hold their state, and changing it marks the tiles they cover as
+// dirty. ui_flush() redraws only the dirty tiles.
+
+#define UI_TILE_SIZE 16		// tile width/height in pixels
+#define UI_TILES_MAX ((320 / UI_TILE_SIZE) * (320 / UI_TILE_SIZE))
+#define UI_MAX_WIDGETS 16
+#define UI_TEXT_SIZE 32		// max text length (including the terminator)
+
+enum {
+	WIDGET_TEXT,
+	WIDGET_IMAGE,
+};
+
+struct widget {
+	int type;		// widget type
+	uint16_t x, y, w, h;	// screen region
+	uint16_t fg, bg;	// colors
+	const struct font *font;	// text font
+	char text[UI_TEXT_SIZE];	// text string
+	const struct rle_image *img;	// image
+};
+
+struct ui_drv {
+	struct lcd_drv *lcd;	// lcd driver
+	uint16_t bg;		// screen background color
+	int tiles_x, tiles_y;	// screen size in tiles
+	struct widget widgets[UI_MAX_WIDGETS];	// widgets, drawn in order
+	int n;			// number of widgets
+	uint32_t dirty[(UI_TILES_MAX + 31) / 32];	// dirty tile bitmap
+	uint16_t tile[2][UI_TILE_SIZE * UI_TILE_SIZE];	// double buffered tile pixels
+	int tile_idx;		// tile buffer to render next
+};
+
+int ui_init(struct ui_drv *ui, struct lcd_drv *lcd, uint16_t bg);
+struct widget *ui_add_text(struct ui_drv *ui, uint16_t x, uint16_t y, uint16_t w, uint16_t h, int font, uint16_t fg, uint16_t bg);
+struct widget *ui_add_image(struct ui_drv *ui, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t fg, uint16_t bg);
+void ui_set_text(struct ui_drv *ui, struct widget *w, const char *str);
+void ui_set_image(struct ui_drv *ui, struct widget *w, const struct rle_image *img);
+int ui_flush(struct ui_drv *ui, int n);
+
 //-----------------------------------------------------------------------------
 // graphics
 
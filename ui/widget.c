@@ -0,0 +1,278 @@
+//-----------------------------------------------------------------------------
+/*
+
+Retained Mode Widgets
+
+The screen is divided into 16x16 pixel tiles. Changing a widget marks the
+tiles it covers as dirty, and a flush renders each dirty tile (background,
+then the widgets covering it, in order) into a small pixel buffer and sends
+it to the lcd. There's no RAM for a full framebuffer, so widgets are drawn
+directly from their state: images from run length encoded spans and text
+from the font glyph bitmaps.
+
+*/
+//-----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "lcd.h"
+
+//-----------------------------------------------------------------------------
+
+// a rectangle, clipped to a tile
+struct clip {
+	int x0, y0;		// top left (inclusive)
+	int x1, y1;		// bottom right (exclusive)
+};
+
+// intersect a rectangle with the clip region, return 0 if it's empty
+static int clip_rect(struct clip *c, const struct clip *a, int x, int y, int w, int h) {
+	c->x0 = (x > a->x0) ? x : a->x0;
+	c->y0 = (y > a->y0) ? y : a->y0;
+	c->x1 = (x + w < a->x1) ? x + w : a->x1;
+	c->y1 = (y + h < a->y1) ? y + h : a->y1;
+	return (c->x0 < c->x1) && (c->y0 < c->y1);
+}
+
+//-----------------------------------------------------------------------------
+// tile rendering
+// The tile buffer covers the region t, (x,y) are screen coordinates.
+
+// fill a rectangle
+static void tile_fill(uint16_t * buf, const struct clip *t, const struct clip *c, uint16_t color) {
+	int stride = t->x1 - t->x0;
+	int n = c->x1 - c->x0;
+	for (int y = c->y0; y < c->y1; y++) {
+		uint16_t *dst = &buf[(y - t->y0) * stride + (c->x0 - t->x0)];
+		for (int i = 0; i < n; i++) {
+			dst[i] = color;
+		}
+	}
+}
+
+// draw the foreground pixels of a run length encoded image at (x,y)
+static void tile_rle(uint16_t * buf, const struct clip *t, const struct clip *c, int x, int y, const struct rle_image *img, uint16_t fg) {
+	int stride = t->x1 - t->x0;
+	int w = img->width;
+	// pixel index range for the clipped rows
+	int p0 = (c->y0 - y) * w;
+	int p1 = (c->y1 - y) * w;
+	const uint8_t *src = img->data;
+	int p = 0;
+	while (p < p1) {
+		uint8_t r = *src++;
+		if ((r & 0x80) == 0) {
+			// run of n pixels
+			int n = (r & 0x3f) + 1;
+			if ((r & 0x40) && p + n > p0) {
+				for (int i = (p > p0) ? p : p0; i < p + n && i < p1; i++) {
+					int px = x + (i % w);
+					if (px >= c->x0 && px < c->x1) {
+						buf[(y + (i / w) - t->y0) * stride + px - t->x0] = fg;
+					}
+				}
+			}
+			p += n;
+		} else {
+			// 7 literal pixels
+			for (int i = 0; i < 7; i++, p++) {
+				if ((r & (0x40 >> i)) && p >= p0 && p < p1) {
+					int px = x + (p % w);
+					if (px >= c->x0 && px < c->x1) {
+						buf[(y + (p / w) - t->y0) * stride + px - t->x0] = fg;
+					}
+				}
+			}
+		}
+	}
+}
+
+// draw the foreground pixels of a glyph bitmap at (x,y)
+static void tile_glyph(uint16_t * buf, const struct clip *t, const struct clip *a, int x, int y, const struct glyph *g, uint16_t fg) {
+	struct clip c;
+	if (!clip_rect(&c, a, x, y, g->width, g->height)) {
+		return;
+	}
+	int stride = t->x1 - t->x0;
+	for (int py = c.y0; py < c.y1; py++) {
+		uint32_t bit = (py - y) * g->width + (c.x0 - x);
+		uint16_t *dst = &buf[(py - t->y0) * stride + (c.x0 - t->x0)];
+		for (int i = 0; i < c.x1 - c.x0; i++, bit++) {
+			if ((g->data[bit >> 5] << (bit & 31)) & (1U << 31)) {
+				dst[i] = fg;
+			}
+		}
+	}
+}
+
+// draw a text string, the baseline is the widget top + font ascent
+static void tile_text(uint16_t * buf, const struct clip *t, const struct clip *c, const struct widget *w) {
+	const struct font *f = w->font;
+	int x = w->x;
+	int y = w->y + f->ascent;
+	for (size_t i = 0; w->text[i] != 0; i++) {
+		const struct glyph *g = &f->glyphs[(uint8_t) w->text[i]];
+		if (x >= c->x1) {
+			break;
+		}
+		tile_glyph(buf, t, c, x + g->xofs, y - g->yofs - g->height, g, w->fg);
+		x += g->dwidth;
+	}
+}
+
+// render the screen region t into the tile buffer
+static void ui_render(struct ui_drv *ui, uint16_t * buf, const struct clip *t) {
+	tile_fill(buf, t, t, ui->bg);
+	for (int i = 0; i < ui->n; i++) {
+		const struct widget *w = &ui->widgets[i];
+		struct clip c;
+		if (!clip_rect(&c, t, w->x, w->y, w->w, w->h)) {
+			continue;
+		}
+		tile_fill(buf, t, &c, w->bg);
+		switch (w->type) {
+		case WIDGET_TEXT:
+			tile_text(buf, t, &c, w);
+			break;
+		case WIDGET_IMAGE:
+			if (w->img) {
+				struct clip ci;
+				if (clip_rect(&ci, &c, w->x, w->y, w->img->width, w->img->height)) {
+					tile_rle(buf, t, &ci, w->x, w->y, w->img, w->fg);
+				}
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// dirty tiles
+
+// mark the tiles covering a rectangle as dirty
+static void ui_dirty(struct ui_drv *ui, int x, int y, int w, int h) {
+	if (w <= 0 || h <= 0) {
+		return;
+	}
+	int tx0 = x / UI_TILE_SIZE;
+	int ty0 = y / UI_TILE_SIZE;
+	int tx1 = (x + w - 1) / UI_TILE_SIZE;
+	int ty1 = (y + h - 1) / UI_TILE_SIZE;
+	if (tx1 >= ui->tiles_x) {
+		tx1 = ui->tiles_x - 1;
+	}
+	if (ty1 >= ui->tiles_y) {
+		ty1 = ui->tiles_y - 1;
+	}
+	for (int ty = ty0; ty <= ty1; ty++) {
+		for (int tx = tx0; tx <= tx1; tx++) {
+			int i = ty * ui->tiles_x + tx;
+			ui->dirty[i >> 5] |= (1U << (i & 31));
+		}
+	}
+}
+
+// redraw up to n dirty tiles (n < 0 for all), return 1 if more are dirty
+// Each tile is rendered while the previous one is being sent.
+int ui_flush(struct ui_drv *ui, int n) {
+	for (int i = 0; i < ui->tiles_x * ui->tiles_y; i++) {
+		uint32_t mask = 1U << (i & 31);
+		if ((ui->dirty[i >> 5] & mask) == 0) {
+			continue;
+		}
+		if (n == 0) {
+			return 1;
+		}
+		n -= 1;
+		ui->dirty[i >> 5] &= ~mask;
+		struct clip t;
+		t.x0 = (i % ui->tiles_x) * UI_TILE_SIZE;
+		t.y0 = (i / ui->tiles_x) * UI_TILE_SIZE;
+		t.x1 = t.x0 + UI_TILE_SIZE;
+		t.y1 = t.y0 + UI_TILE_SIZE;
+		if (t.x1 > ui->lcd->width) {
+			t.x1 = ui->lcd->width;
+		}
+		if (t.y1 > ui->lcd->height) {
+			t.y1 = ui->lcd->height;
+		}
+		// the lcd may still be sending the other buffer, but it finished
+		// with this one before starting that.
+		uint16_t *buf = ui->tile[ui->tile_idx];
+		ui_render(ui, buf, &t);
+		lcd_draw_pixels(ui->lcd, t.x0, t.y0, t.x1 - t.x0, t.y1 - t.y0, buf);
+		ui->tile_idx ^= 1;
+	}
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+// widgets
+
+static struct widget *ui_add(struct ui_drv *ui, int type, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t fg, uint16_t bg) {
+	if (ui->n >= UI_MAX_WIDGETS) {
+		return NULL;
+	}
+	struct widget *wd = &ui->widgets[ui->n];
+	memset(wd, 0, sizeof(struct widget));
+	wd->type = type;
+	wd->x = x;
+	wd->y = y;
+	wd->w = w;
+	wd->h = h;
+	wd->fg = fg;
+	wd->bg = bg;
+	ui->n += 1;
+	ui_dirty(ui, x, y, w, h);
+	return wd;
+}
+
+// add a text widget
+struct widget *ui_add_text(struct ui_drv *ui, uint16_t x, uint16_t y, uint16_t w, uint16_t h, int font, uint16_t fg, uint16_t bg) {
+	struct widget *wd = ui_add(ui, WIDGET_TEXT, x, y, w, h, fg, bg);
+	if (wd) {
+		wd->font = font_get(font);
+	}
+	return wd;
+}
+
+// add an image widget
+struct widget *ui_add_image(struct ui_drv *ui, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t fg, uint16_t bg) {
+	return ui_add(ui, WIDGET_IMAGE, x, y, w, h, fg, bg);
+}
+
+// set the string for a text widget
+void ui_set_text(struct ui_drv *ui, struct widget *w, const char *str) {
+	if (w == NULL || strncmp(w->text, str, UI_TEXT_SIZE - 1) == 0) {
+		return;
+	}
+	strncpy(w->text, str, UI_TEXT_SIZE - 1);
+	w->text[UI_TEXT_SIZE - 1] = 0;
+	ui_dirty(ui, w->x, w->y, w->w, w->h);
+}
+
+// set the image for an image widget
+void ui_set_image(struct ui_drv *ui, struct widget *w, const struct rle_image *img) {
+	if (w == NULL || w->img == img) {
+		return;
+	}
+	w->img = img;
+	ui_dirty(ui, w->x, w->y, w->w, w->h);
+}
+
+//-----------------------------------------------------------------------------
+
+// initialise the widget layer on a cleared screen
+int ui_init(struct ui_drv *ui, struct lcd_drv *lcd, uint16_t bg) {
+	memset(ui, 0, sizeof(struct ui_drv));
+	ui->lcd = lcd;
+	ui->bg = bg;
+	ui->tiles_x = (lcd->width + UI_TILE_SIZE - 1) / UI_TILE_SIZE;
+	ui->tiles_y = (lcd->height + UI_TILE_SIZE - 1) / UI_TILE_SIZE;
+	lcd_fill_rect(lcd, 0, 0, lcd->width, lcd->height, bg);
+	return 0;
+}
+
+//-----------------------------------------------------------------------------